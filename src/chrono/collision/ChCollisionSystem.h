@@ -15,6 +15,8 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
@@ -96,6 +98,10 @@ class ChApi ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const = 0;
 
+    /// Return the time (in seconds) for reporting contacts to the contact container.
+    /// The default implementation returns 0. Derived classes implement this function as applicable.
+    virtual double GetTimerCollisionReport() const { return 0; }
+
     /// Reset any timers associated with collision detection.
     virtual void ResetTimers() {}
 
@@ -186,6 +192,17 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform ray-hit tests for a batch of rays, the i-th ray going from `from[i]` to `to[i]`.
+    /// If a collision model is specified, only hits with that model are reported. If a collision family (0...15) is
+    /// specified, only hits with models in that family are reported (irrespective of their collision family masks).
+    /// The rays are processed in parallel, using the number of threads set for collision detection.
+    /// On return, `results` has one entry per ray. Returns the number of rays that hit.
+    virtual int RayHit(const std::vector<ChVector3d>& from,
+                       const std::vector<ChVector3d>& to,
+                       std::vector<ChRayhitResult>& results,
+                       ChCollisionModel* model = nullptr,
+                       int family = -1) const = 0;
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
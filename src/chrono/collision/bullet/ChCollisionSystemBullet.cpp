@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <stdexcept>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChProximityContainer.h"
@@ -20,6 +21,7 @@
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
 #include "chrono/fea/ChMesh.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono/collision/bullet/ChCollisionSystemBullet.h"
 #include "chrono/collision/bullet/ChCollisionModelBullet.h"
@@ -37,7 +39,8 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChCollisionSystemBullet)
 CH_UPCASTING(ChCollisionSystemBullet, ChCollisionSystem)
 
-ChCollisionSystemBullet::ChCollisionSystemBullet() : m_debug_drawer(nullptr) {
+ChCollisionSystemBullet::ChCollisionSystemBullet()
+    : m_debug_drawer(nullptr), m_num_threads(1), m_parallel_report(true) {
     bt_collision_configuration = new cbtDefaultCollisionConfiguration();
 
 #ifdef BT_USE_OPENMP
@@ -125,6 +128,7 @@ ChCollisionSystemBullet::~ChCollisionSystemBullet() {
 }
 
 void ChCollisionSystemBullet::SetNumThreads(int nthreads) {
+    m_num_threads = std::max(nthreads, 1);
 #ifdef BT_USE_OPENMP
     cbtGetOpenMPTaskScheduler()->setNumThreads(nthreads);
 #endif
@@ -198,6 +202,7 @@ ChAABB ChCollisionSystemBullet::GetBoundingBox() const {
 void ChCollisionSystemBullet::ResetTimers() {
     bt_collision_world->timer_collision_broad.reset();
     bt_collision_world->timer_collision_narrow.reset();
+    m_timer_report.reset();
 }
 
 double ChCollisionSystemBullet::GetTimerCollisionBroad() const {
@@ -208,94 +213,127 @@ double ChCollisionSystemBullet::GetTimerCollisionNarrow() const {
     return bt_collision_world->timer_collision_narrow();
 }
 
-void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
-    // This should remove all old contacts (or at least rewind the index)
-    mcontactcontainer->BeginAddContact();
+double ChCollisionSystemBullet::GetTimerCollisionReport() const {
+    return m_timer_report();
+}
 
+void ChCollisionSystemBullet::CollectContacts(int manifold_index,
+                                              std::vector<ChCollisionInfo>& contacts,
+                                              bool use_callbacks) {
     // NOTE: Bullet does not provide information on radius of curvature at a contact point.
     // As such, for all Bullet-identified contacts, the default value will be used (SMC only).
     ChCollisionInfo icontact;
 
-    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
-    for (int i = 0; i < numManifolds; i++) {
-        cbtPersistentManifold* contactManifold = bt_collision_world->getDispatcher()->getManifoldByIndexInternal(i);
-        const cbtCollisionObject* obA = contactManifold->getBody0();
-        const cbtCollisionObject* obB = contactManifold->getBody1();
-        contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
+    cbtPersistentManifold* contactManifold =
+        bt_collision_world->getDispatcher()->getManifoldByIndexInternal(manifold_index);
+    const cbtCollisionObject* obA = contactManifold->getBody0();
+    const cbtCollisionObject* obB = contactManifold->getBody1();
+    contactManifold->refreshContactPoints(obA->getWorldTransform(), obB->getWorldTransform());
 
-        auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
-        auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
+    auto bt_modelA = (ChCollisionModelBullet*)obA->getUserPointer();
+    auto bt_modelB = (ChCollisionModelBullet*)obB->getUserPointer();
 
-        icontact.modelA = bt_modelA->model;
-        icontact.modelB = bt_modelB->model;
+    icontact.modelA = bt_modelA->model;
+    icontact.modelB = bt_modelB->model;
 
-        double envelopeA = icontact.modelA->GetEnvelope();
-        double envelopeB = icontact.modelB->GetEnvelope();
+    double envelopeA = icontact.modelA->GetEnvelope();
+    double envelopeB = icontact.modelB->GetEnvelope();
 
-        double marginA = icontact.modelA->GetSafeMargin();
-        double marginB = icontact.modelB->GetSafeMargin();
+    double marginA = icontact.modelA->GetSafeMargin();
+    double marginB = icontact.modelB->GetSafeMargin();
 
-        // Execute custom broadphase callback, if any
-        bool do_narrow_contactgeneration = true;
-        if (broad_callback)
-            do_narrow_contactgeneration = broad_callback->OnBroadphase(icontact.modelA, icontact.modelB);
+    // Execute custom broadphase callback, if any
+    if (use_callbacks && broad_callback && !broad_callback->OnBroadphase(icontact.modelA, icontact.modelB))
+        return;
+
+    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+
+    int numContacts = contactManifold->getNumContacts();
+    for (int j = 0; j < numContacts; j++) {
+        cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
 
-        if (do_narrow_contactgeneration) {
-            int numContacts = contactManifold->getNumContacts();
-            // std::cout << "numContacts=" << numContacts << std::endl;
-            for (int j = 0; j < numContacts; j++) {
-                cbtManifoldPoint& pt = contactManifold->getContactPoint(j);
+        // Discard "too far" constraints (the Bullet engine also has its threshold)
+        if (pt.getDistance() >= marginA + marginB)
+            continue;
 
-                // Discard "too far" constraints (the Bullet engine also has its threshold)
-                if (pt.getDistance() < marginA + marginB) {
-                    cbtVector3 ptA = pt.getPositionWorldOnA();
-                    cbtVector3 ptB = pt.getPositionWorldOnB();
+        cbtVector3 ptA = pt.getPositionWorldOnA();
+        cbtVector3 ptB = pt.getPositionWorldOnB();
 
-                    icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
-                    icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
+        icontact.vpA.Set(ptA.getX(), ptA.getY(), ptA.getZ());
+        icontact.vpB.Set(ptB.getX(), ptB.getY(), ptB.getZ());
 
-                    icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(),
-                                    -pt.m_normalWorldOnB.getZ());
-                    icontact.vN.Normalize();
+        icontact.vN.Set(-pt.m_normalWorldOnB.getX(), -pt.m_normalWorldOnB.getY(), -pt.m_normalWorldOnB.getZ());
+        icontact.vN.Normalize();
 
-                    double ptdist = pt.getDistance();
+        double ptdist = pt.getDistance();
 
-                    icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
-                    icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
-                    icontact.distance = ptdist + envelopeA + envelopeB;
+        icontact.vpA = icontact.vpA - icontact.vN * envelopeA;
+        icontact.vpB = icontact.vpB + icontact.vN * envelopeB;
+        icontact.distance = ptdist + envelopeA + envelopeB;
 
-                    icontact.reaction_cache = pt.reactions_cache;
+        icontact.reaction_cache = pt.reactions_cache;
 
-                    bool compoundA = (obA->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
-                    bool compoundB = (obB->getCollisionShape()->getShapeType() == COMPOUND_SHAPE_PROXYTYPE);
+        int indexA = compoundA ? pt.m_index0 : 0;
+        int indexB = compoundB ? pt.m_index1 : 0;
 
-                    int indexA = compoundA ? pt.m_index0 : 0;
-                    int indexB = compoundB ? pt.m_index1 : 0;
+        icontact.shapeA = bt_modelA->m_shapes[indexA].get();
+        icontact.shapeB = bt_modelB->m_shapes[indexB].get();
 
-                    icontact.shapeA = bt_modelA->m_shapes[indexA].get();
-                    icontact.shapeB = bt_modelB->m_shapes[indexB].get();
+        // Execute some user custom callback, if any
+        if (use_callbacks && narrow_callback && !narrow_callback->OnNarrowphase(icontact))
+            continue;
 
-                    // Execute some user custom callback, if any
-                    bool add_contact = true;
-                    if (this->narrow_callback)
-                        add_contact = this->narrow_callback->OnNarrowphase(icontact);
+        contacts.push_back(icontact);
+    }
+}
 
-                    // Add to contact container
-                    if (add_contact) {
-                        ////std::cout << " add indexA=" << indexA << " indexB=" << indexB << std::endl;
-                        ////std::cout << "     typeA=" << icontact.shapeA->m_type << " typeB=" <<
-                        /// icontact.shapeB->m_type << std::endl;
+void ChCollisionSystemBullet::ReportContacts(ChContactContainer* mcontactcontainer) {
+    m_timer_report.start();
+
+    // This should remove all old contacts (or at least rewind the index)
+    mcontactcontainer->BeginAddContact();
 
-                        mcontactcontainer->AddContact(icontact);
-                    }
-                }
-            }
+    int numManifolds = bt_collision_world->getDispatcher()->getNumManifolds();
+    m_contacts.clear();
+
+    if (m_parallel_report && m_num_threads > 1 && !broad_callback && !narrow_callback) {
+        // Process contiguous ranges of manifolds into thread-local batches, then merge the batches in thread order
+        // (and therefore in manifold order).
+        int nthreads = m_num_threads;
+        m_contacts_thr.resize(nthreads);
+
+#pragma omp parallel num_threads(nthreads)
+        {
+            int tid = ChOMP::GetThreadNum();
+            int nthr = ChOMP::GetNumThreads();
+            auto& batch = m_contacts_thr[tid];
+            batch.clear();
+            int start = (int)((long long)numManifolds * tid / nthr);
+            int end = (int)((long long)numManifolds * (tid + 1) / nthr);
+            for (int i = start; i < end; i++)
+                CollectContacts(i, batch, false);
         }
 
-        // Uncomment this line to remove all points
-        ////contactManifold->clearManifold();
+        size_t num_contacts = 0;
+        for (const auto& batch : m_contacts_thr)
+            num_contacts += batch.size();
+        m_contacts.reserve(num_contacts);
+        for (auto& batch : m_contacts_thr) {
+            m_contacts.insert(m_contacts.end(), batch.begin(), batch.end());
+            batch.clear();
+        }
+    } else {
+        for (int i = 0; i < numManifolds; i++)
+            CollectContacts(i, m_contacts, true);
     }
+
+    // Add to contact container
+    mcontactcontainer->AddContacts(m_contacts);
+
     mcontactcontainer->EndAddContact();
+
+    m_timer_report.stop();
 }
 
 void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximitycontainer) {
@@ -321,24 +359,22 @@ void ChCollisionSystemBullet::ReportProximities(ChProximityContainer* mproximity
     mproximitycontainer->EndAddProximities();
 }
 
-bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
-    return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
-}
-
-bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
-                                     const ChVector3d& to,
-                                     ChRayhitResult& result,
-                                     short int filter_group,
-                                     short int filter_mask) const {
-    cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
-    cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
+// Ray test callback which only accepts the specified Bullet collision object.
+class ChObjectRayResultCallback : public cbtCollisionWorld::ClosestRayResultCallback {
+  public:
+    ChObjectRayResultCallback(const cbtVector3& from, const cbtVector3& to, const cbtCollisionObject* object)
+        : cbtCollisionWorld::ClosestRayResultCallback(from, to), m_object(object) {}
 
-    cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
-    rayCallback.m_collisionFilterGroup = filter_group;
-    rayCallback.m_collisionFilterMask = filter_mask;
+    virtual bool needsCollision(cbtBroadphaseProxy* proxy) const override {
+        return proxy->m_clientObject == m_object && ClosestRayResultCallback::needsCollision(proxy);
+    }
 
-    this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
+  private:
+    const cbtCollisionObject* m_object;
+};
 
+bool ChCollisionSystemBullet::LoadRayHitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                               ChRayhitResult& result) {
     if (rayCallback.hasHit()) {
         auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
         result.hitModel = bt_model->model;
@@ -358,6 +394,27 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
     return false;
 }
 
+bool ChCollisionSystemBullet::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
+    return RayHit(from, to, result, cbtBroadphaseProxy::DefaultFilter, cbtBroadphaseProxy::AllFilter);
+}
+
+bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
+                                     const ChVector3d& to,
+                                     ChRayhitResult& result,
+                                     short int filter_group,
+                                     short int filter_mask) const {
+    cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
+    cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
+
+    cbtCollisionWorld::ClosestRayResultCallback rayCallback(btfrom, btto);
+    rayCallback.m_collisionFilterGroup = filter_group;
+    rayCallback.m_collisionFilterMask = filter_mask;
+
+    this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
+
+    return LoadRayHitResult(rayCallback, result);
+}
+
 bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
                                      const ChVector3d& to,
                                      ChCollisionModel* model,
@@ -371,44 +428,56 @@ bool ChCollisionSystemBullet::RayHit(const ChVector3d& from,
                                      ChRayhitResult& result,
                                      short int filter_group,
                                      short int filter_mask) const {
+    // Nothing to hit if the specified model is not processed by this collision system
+    if (!model || !model->HasImplementation()) {
+        result.hit = false;
+        return false;
+    }
+    auto bt_model = static_cast<ChCollisionModelBullet*>(model->GetImplementation());
+
     cbtVector3 btfrom((cbtScalar)from.x(), (cbtScalar)from.y(), (cbtScalar)from.z());
     cbtVector3 btto((cbtScalar)to.x(), (cbtScalar)to.y(), (cbtScalar)to.z());
 
-    cbtCollisionWorld::AllHitsRayResultCallback rayCallback(btfrom, btto);
+    // Only test the Bullet collision object of the specified model and find its closest hit (if any)
+    ChObjectRayResultCallback rayCallback(btfrom, btto, bt_model->GetBulletObject());
     rayCallback.m_collisionFilterGroup = filter_group;
     rayCallback.m_collisionFilterMask = filter_mask;
 
     this->bt_collision_world->rayTest(btfrom, btto, rayCallback);
 
-    // Find the closest hit result on the specified model (if any)
-    int hit = -1;
-    cbtScalar fraction = 1;
-    for (int i = 0; i < rayCallback.m_collisionObjects.size(); ++i) {
-        auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObject->getUserPointer());
-        if (bt_model->model == model && rayCallback.m_hitFractions[i] < fraction) {
-            hit = i;
-            fraction = rayCallback.m_hitFractions[i];
-        }
+    return LoadRayHitResult(rayCallback, result);
+}
+
+int ChCollisionSystemBullet::RayHit(const std::vector<ChVector3d>& from,
+                                    const std::vector<ChVector3d>& to,
+                                    std::vector<ChRayhitResult>& results,
+                                    ChCollisionModel* model,
+                                    int family) const {
+    if (from.size() != to.size())
+        throw std::invalid_argument("Different number of ray start and end points.");
+
+    // A family filter only accepts objects in the given family (irrespective of their collision family masks)
+    short int filter_group = cbtBroadphaseProxy::DefaultFilter;
+    short int filter_mask = cbtBroadphaseProxy::AllFilter;
+    if (family >= 0) {
+        filter_group = cbtBroadphaseProxy::AllFilter;
+        filter_mask = (short int)(1 << family);
     }
 
-    // Ray does not hit specified model
-    if (hit == -1) {
-        result.hit = false;
-        return false;
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    // Bullet ray tests only read the broadphase and collision shape data and can be run concurrently
+    int num_hits = 0;
+#pragma omp parallel for num_threads(m_num_threads) reduction(+ : num_hits)
+    for (int i = 0; i < num_rays; i++) {
+        bool hit = model ? RayHit(from[i], to[i], model, results[i], filter_group, filter_mask)
+                         : RayHit(from[i], to[i], results[i], filter_group, filter_mask);
+        if (hit)
+            num_hits++;
     }
 
-    // Return the closest hit on the specified model
-    auto bt_model = static_cast<ChCollisionModelBullet*>(rayCallback.m_collisionObjects[hit]->getUserPointer());
-    result.hit = true;
-    result.hitModel = bt_model->model;
-    result.abs_hitPoint.Set(rayCallback.m_hitPointWorld[hit].x(), rayCallback.m_hitPointWorld[hit].y(),
-                            rayCallback.m_hitPointWorld[hit].z());
-    result.abs_hitNormal.Set(rayCallback.m_hitNormalWorld[hit].x(), rayCallback.m_hitNormalWorld[hit].y(),
-                             rayCallback.m_hitNormalWorld[hit].z());
-    result.abs_hitNormal.Normalize();
-    result.dist_factor = fraction;
-    result.abs_hitPoint = result.abs_hitPoint - result.abs_hitNormal * result.hitModel->GetEnvelope();
-    return true;
+    return num_hits;
 }
 
 void ChCollisionSystemBullet::SetContactBreakingThreshold(double threshold) {
@@ -15,6 +15,9 @@
 #ifndef CH_COLLISION_SYSTEM_BULLET_H
 #define CH_COLLISION_SYSTEM_BULLET_H
 
+#include <vector>
+
+#include "chrono/core/ChTimer.h"
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/collision/bullet/ChCollisionModelBullet.h"
 #include "chrono/collision/bullet/cbtBulletCollisionCommon.h"
@@ -68,6 +71,16 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
     /// Return the time (in seconds) for narrowphase collision detection.
     virtual double GetTimerCollisionNarrow() const override;
 
+    /// Return the time (in seconds) for reporting contacts to the contact container.
+    virtual double GetTimerCollisionReport() const override;
+
+    /// Enable/disable parallel processing of the contact manifolds in ReportContacts (default: true).
+    /// If enabled and more than one thread is used for collision detection (see SetNumThreads), contact manifolds are
+    /// processed in parallel into thread-local contact batches which are then merged in manifold order. As such, the
+    /// contacts are reported in the same order as in the sequential case. The parallel path is not used if a
+    /// broadphase or narrowphase callback is registered (user callbacks are not required to be thread-safe).
+    void EnableParallelReporting(bool val) { m_parallel_report = val; }
+
     /// After the Run() has completed, you can call this function to
     /// fill a 'contact container', that is an object inherited from class
     /// ChContactContainer. For instance ChSystem, after each Run()
@@ -95,6 +108,15 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests for a batch of rays, optionally restricted to a collision model or a collision family.
+    /// The rays are processed in parallel, each traversing the Bullet broadphase AABB tree. A family filter is mapped to
+    /// the Bullet ray collision filter.
+    virtual int RayHit(const std::vector<ChVector3d>& from,
+                       const std::vector<ChVector3d>& to,
+                       std::vector<ChRayhitResult>& results,
+                       ChCollisionModel* model = nullptr,
+                       int family = -1) const override;
+
     /// Specify a callback object to be used for debug rendering of collision shapes.
     virtual void RegisterVisualizationCallback(std::shared_ptr<VisualizationCallback> callback) override;
 
@@ -136,6 +158,14 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
                 short int filter_group,
                 short int filter_mask) const;
 
+    /// Load the ray-hit result from the closest hit (if any) recorded in the given Bullet ray callback.
+    static bool LoadRayHitResult(const cbtCollisionWorld::ClosestRayResultCallback& rayCallback,
+                                 ChRayhitResult& result);
+
+    /// Collect the contacts from the specified contact manifold and append them to the given list.
+    /// If requested, execute the broadphase and narrowphase user callbacks (if any).
+    void CollectContacts(int manifold_index, std::vector<ChCollisionInfo>& contacts, bool use_callbacks);
+
     /// Remove the specified Bullet model from this collision system.
     /// If erase=true, also remove from the bt_models list.
     void Remove(ChCollisionModelBullet* bt_model, bool erase);
@@ -160,6 +190,12 @@ class ChApi ChCollisionSystemBullet : public ChCollisionSystem {
 
     cbtIDebugDraw* m_debug_drawer;
 
+    int m_num_threads;                                         ///< number of threads for collision detection
+    bool m_parallel_report;                                    ///< process contact manifolds in parallel
+    std::vector<ChCollisionInfo> m_contacts;                   ///< contacts reported to the container
+    std::vector<std::vector<ChCollisionInfo>> m_contacts_thr;  ///< thread-local contact batches
+    ChTimer m_timer_report;                                    ///< timer for contact reporting
+
     friend class ChCollisionModelBullet;
 };
 
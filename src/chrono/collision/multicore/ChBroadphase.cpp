@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <utility>
 
 #include "chrono/collision/multicore/ChBroadphase.h"
 #include "chrono/collision/multicore/ChCollisionUtils.h"
@@ -38,6 +39,12 @@ ChBroadphase::ChBroadphase()
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      coherent(false),
+      coherent_margin(real(0.1)),
+      two_level(false),
+      two_level_ratio(4),
+      cache_valid(false),
+      cache_num_shapes(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -210,36 +217,72 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
-    // Compute overall AABB and then offset all AABBs
+    // Compute overall AABB
     DetermineBoundingBox();
+
+    // In coherent mode, keep the grid from the previous step if it still encloses all shapes.
+    // Otherwise, enlarge the new grid to allow reusing it over subsequent steps.
+    bool reuse_grid = coherent && CanReuseGrid();
+    if (reuse_grid) {
+        cd_data->min_bounding_point = cache_min;
+        cd_data->max_bounding_point = cache_max;
+        cd_data->global_origin = cache_min;
+    } else if (coherent) {
+        real3 margin = 0.05 * (cd_data->max_bounding_point - cd_data->min_bounding_point);
+        cd_data->min_bounding_point = cd_data->min_bounding_point - margin;
+        cd_data->max_bounding_point = cd_data->max_bounding_point + margin;
+        cd_data->global_origin = cd_data->min_bounding_point;
+    }
+
+    // Offset all AABBs
     OffsetAABB();
 
     // Determine resolution of the top level grid
-    ComputeTopLevelResolution();
+    if (reuse_grid) {
+        cd_data->bins_per_axis = cache_bins_per_axis;
+        cd_data->bin_size = cache_bin_size;
+        cd_data->inv_bin_size = 1.0 / cache_bin_size;
+    } else {
+        ComputeTopLevelResolution();
+    }
 
+    cd_data->num_reused_collisions = 0;
+    cd_data->num_rebinned_shapes = 0;
+    cd_data->coarse_shapes.clear();
+
+    // The coarse grid is not used with the coherent broadphase, nor in the presence of fluid particles (the rigid-fluid
+    // narrowphase relies on the top-level grid bins).
     if (cd_data->num_rigid_shapes != 0) {
-        OneLevelBroadphase();
+        if (coherent)
+            CoherentBroadphase(reuse_grid);
+        else if (two_level && cd_data->state_data.num_fluid_bodies == 0)
+            TwoLevelBroadphase();
+        else
+            OneLevelBroadphase(cd_data->aabb_min, cd_data->aabb_max);
         cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
     }
+
+    cache_valid = coherent && cd_data->num_rigid_shapes != 0 && cd_data->num_active_bins > 0;
     return;
 }
 
-void ChBroadphase::OneLevelBroadphase() {
+// Perform the broadphase on the top-level grid, using the specified shape AABBs.
+// Shapes flagged in the optional `excluded` array are not binned.
+void ChBroadphase::OneLevelBroadphase(const std::vector<real3>& box_min,
+                                      const std::vector<real3>& box_max,
+                                      const std::vector<char>* excluded) {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
     const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
 
     const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
     const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
 
-    const std::vector<real3>& aabb_min = cd_data->aabb_min;
-    const std::vector<real3>& aabb_max = cd_data->aabb_max;
     std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
     std::vector<uint>& bin_intersections = cd_data->bin_intersections;
     std::vector<uint>& bin_number = cd_data->bin_number;
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
     std::vector<uint>& bin_active = cd_data->bin_active;
     std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
@@ -259,11 +302,11 @@ void ChBroadphase::OneLevelBroadphase() {
     // Count the number of bins intersected by each shape AABB -> bin_intersections
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX) {
+        if (obj_data_id[i] == UINT_MAX || (excluded && (*excluded)[i])) {
             bin_intersections[i] = 0;
             continue;
         }
-        f_Count_AABB_BIN_Intersection(i, inv_bin_size, aabb_min, aabb_max, bin_intersections);
+        f_Count_AABB_BIN_Intersection(i, inv_bin_size, box_min, box_max, bin_intersections);
     }
 
     // Calculate total number of bin - shape AABB intersections
@@ -278,33 +321,28 @@ void ChBroadphase::OneLevelBroadphase() {
     // For each shape, store the bin index and the shape ID for intersections with this shape
 #pragma omp parallel for
     for (int i = 0; i < num_shapes; i++) {
-        if (obj_data_id[i] == UINT_MAX)
+        if (obj_data_id[i] == UINT_MAX || (excluded && (*excluded)[i]))
             continue;
-        f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, aabb_min, aabb_max, bin_intersections, bin_number,
+        f_Store_AABB_BIN_Intersection(i, bins_per_axis, inv_bin_size, box_min, box_max, bin_intersections, bin_number,
                                       bin_aabb_number);
     }
 
-    // Find the number of active bins (i.e. with at least one shape AABB intersection)
+    // Find the active bins (i.e. with at least one shape AABB intersection)
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
-    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+    FindActiveBins();
 
     if (num_active_bins <= 0) {
         num_possible_collisions = 0;
         return;
     }
 
-    bin_active.resize(num_active_bins);
-    bin_start_index.resize(num_active_bins + 1);
-    bin_start_index[num_active_bins] = 0;
-
-    Thrust_Exclusive_Scan(bin_start_index);
     bin_num_contact.resize(num_active_bins + 1);
     bin_num_contact[num_active_bins] = 0;
 
     // Count the number of AABB-AABB intersections in each active bin -> bin_num_contact
 #pragma omp parallel for
     for (int i = 0; i < (signed)num_active_bins; i++) {
-        f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active, bin_aabb_number,
+        f_Count_AABB_AABB_Intersection(i, inv_bin_size, bins_per_axis, box_min, box_max, bin_active, bin_aabb_number,
                                        bin_start_index, fam_data, obj_active, obj_collide, obj_data_id,
                                        bin_num_contact);
     }
@@ -316,15 +354,220 @@ void ChBroadphase::OneLevelBroadphase() {
     // Store the list of shape pairs in potential collision (i.e. with intersecting AABBs)
 #pragma omp parallel for
     for (int index = 0; index < (signed)num_active_bins; index++) {
-        f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, bin_active,
+        f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, box_min, box_max, bin_active,
                                        bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
                                        obj_collide, obj_data_id, pair_shapeIDs);
     }
 
     pair_shapeIDs.resize(num_possible_collisions);
+}
+
+// -----------------------------------------------------------------------------
+
+// Two-level broadphase: shapes much larger than the top-level bins are processed in a separate, coarse grid.
+void ChBroadphase::TwoLevelBroadphase() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    // Flag the shapes with an AABB spanning more than the specified number of top-level bins in any direction
+    real3 limit = two_level_ratio * cd_data->bin_size;
+    shape_large.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        real3 extent = aabb_max[i] - aabb_min[i];
+        shape_large[i] = obj_data_id[i] != UINT_MAX &&
+                         (extent.x > limit.x || extent.y > limit.y || extent.z > limit.z);
+    }
+
+    for (int i = 0; i < num_shapes; i++) {
+        if (shape_large[i])
+            coarse_shapes.push_back(i);
+    }
+
+    // Without large shapes, fall back on the one-level broadphase
+    if (coarse_shapes.empty()) {
+        OneLevelBroadphase(aabb_min, aabb_max);
+        return;
+    }
+
+    // Candidate pairs of small shapes are found in the top-level grid
+    OneLevelBroadphase(aabb_min, aabb_max, &shape_large);
+
+    // Candidate pairs involving large shapes are found in the coarse grid and appended to the list
+    CoarseBroadphase();
+}
+
+void ChBroadphase::CoarseBroadphase() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const int num_large = (int)coarse_shapes.size();
+
+    // Coarse grid resolution: bins sized by the average AABB of the large shapes, but at least as large as the
+    // threshold for large shapes
+    real3 mean_extent(0);
+    for (int j = 0; j < num_large; j++) {
+        uint i = coarse_shapes[j];
+        mean_extent += aabb_max[i] - aabb_min[i];
+    }
+    mean_extent = Max(mean_extent / real(num_large), two_level_ratio * cd_data->bin_size);
+
+    real3 diag = Abs(cd_data->max_bounding_point - cd_data->global_origin);
+    vec3& bins_per_axis = cd_data->coarse_bins_per_axis;
+    bins_per_axis.x = (int)std::ceil(diag.x / mean_extent.x);
+    bins_per_axis.y = (int)std::ceil(diag.y / mean_extent.y);
+    bins_per_axis.z = (int)std::ceil(diag.z / mean_extent.z);
+    bins_per_axis = Max(bins_per_axis, vec3(1));
+
+    cd_data->coarse_bin_size = diag / real3(bins_per_axis.x, bins_per_axis.y, bins_per_axis.z);
+    real3 inv_bin_size = 1.0 / cd_data->coarse_bin_size;
+    uint num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
+    vec3 max_bin = bins_per_axis - vec3(1);
+
+    // Flag the coarse bins intersected by large shapes
+    coarse_occupied.assign(num_bins, 0);
+    for (int j = 0; j < num_large; j++) {
+        uint i = coarse_shapes[j];
+        vec3 gmin = Clamp(HashMin(aabb_min[i], inv_bin_size), vec3(0), max_bin);
+        vec3 gmax = Clamp(HashMax(aabb_max[i], inv_bin_size), vec3(0), max_bin);
+        for (int x = gmin.x; x <= gmax.x; x++)
+            for (int y = gmin.y; y <= gmax.y; y++)
+                for (int z = gmin.z; z <= gmax.z; z++)
+                    coarse_occupied[Hash_Index(vec3(x, y, z), bins_per_axis)] = 1;
+    }
+
+    // Count the number of occupied coarse bins intersected by each shape AABB
+    coarse_intersections.resize(num_shapes + 1);
+    coarse_intersections[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint count = 0;
+        if (obj_data_id[i] != UINT_MAX) {
+            vec3 gmin = Clamp(HashMin(aabb_min[i], inv_bin_size), vec3(0), max_bin);
+            vec3 gmax = Clamp(HashMax(aabb_max[i], inv_bin_size), vec3(0), max_bin);
+            for (int x = gmin.x; x <= gmax.x; x++)
+                for (int y = gmin.y; y <= gmax.y; y++)
+                    for (int z = gmin.z; z <= gmax.z; z++)
+                        count += coarse_occupied[Hash_Index(vec3(x, y, z), bins_per_axis)];
+        }
+        coarse_intersections[i] = count;
+    }
+
+    Thrust_Exclusive_Scan(coarse_intersections);
+    uint num_intersections = coarse_intersections.back();
+
+    coarse_bin_number.resize(num_intersections);
+    coarse_aabb_number.resize(num_intersections);
+
+    // Store the coarse bin index and the shape ID for each intersection with an occupied coarse bin
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        if (obj_data_id[i] == UINT_MAX)
+            continue;
+        uint offset = coarse_intersections[i];
+        vec3 gmin = Clamp(HashMin(aabb_min[i], inv_bin_size), vec3(0), max_bin);
+        vec3 gmax = Clamp(HashMax(aabb_max[i], inv_bin_size), vec3(0), max_bin);
+        for (int x = gmin.x; x <= gmax.x; x++) {
+            for (int y = gmin.y; y <= gmax.y; y++) {
+                for (int z = gmin.z; z <= gmax.z; z++) {
+                    uint bin = Hash_Index(vec3(x, y, z), bins_per_axis);
+                    if (coarse_occupied[bin]) {
+                        coarse_bin_number[offset] = bin;
+                        coarse_aabb_number[offset] = i;
+                        offset++;
+                    }
+                }
+            }
+        }
+    }
+
+    // Find the active coarse bins and the start of their entries in the sorted list
+    Thrust_Sort_By_Key(coarse_bin_number, coarse_aabb_number);
+
+    coarse_bin_active.clear();
+    coarse_start_index.clear();
+    for (uint k = 0; k < num_intersections; k++) {
+        if (k == 0 || coarse_bin_number[k] != coarse_bin_number[k - 1]) {
+            coarse_bin_active.push_back(coarse_bin_number[k]);
+            coarse_start_index.push_back(k);
+        }
+    }
+    coarse_start_index.push_back(num_intersections);
+
+    const int num_active_bins = (int)coarse_bin_active.size();
+    coarse_num_contact.resize(num_active_bins + 1);
+    coarse_num_contact[num_active_bins] = 0;
+
+    // Count the number of candidate pairs with large shapes in each active coarse bin
+#pragma omp parallel for
+    for (int index = 0; index < num_active_bins; index++) {
+        f_TL_Count_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, coarse_bin_active,
+                                          coarse_aabb_number, coarse_start_index, shape_large, fam_data, obj_active,
+                                          obj_collide, obj_data_id, coarse_num_contact);
+    }
+
+    Thrust_Exclusive_Scan(coarse_num_contact);
+    uint num_coarse_collisions = coarse_num_contact.back();
+
+    // Append the candidate pairs with large shapes after those found in the top-level grid
+#pragma omp parallel for
+    for (int index = 0; index <= num_active_bins; index++) {
+        coarse_num_contact[index] += num_possible_collisions;
+    }
+
+    pair_shapeIDs.resize(num_possible_collisions + num_coarse_collisions);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_active_bins; index++) {
+        f_TL_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, aabb_min, aabb_max, coarse_bin_active,
+                                          coarse_aabb_number, coarse_start_index, coarse_num_contact, shape_large,
+                                          fam_data, obj_active, obj_collide, obj_data_id, pair_shapeIDs);
+    }
+
+    num_possible_collisions += num_coarse_collisions;
+}
+
+// Find the active bins from the list of bin - shape AABB intersections (sorted by bin index).
+// Also create an "extended" vector of start indices that includes bins with no shape AABB intersections (used in ray
+// intersection tests).
+void ChBroadphase::FindActiveBins() {
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+
+    const uint num_bins = cd_data->num_bins;
+    uint& num_active_bins = cd_data->num_active_bins;
+
+    bin_active.resize(cd_data->num_bin_aabb_intersections);
+    bin_start_index.resize(cd_data->num_bin_aabb_intersections);
+    num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
+
+    if (num_active_bins <= 0)
+        return;
+
+    bin_active.resize(num_active_bins);
+    bin_start_index.resize(num_active_bins + 1);
+    bin_start_index[num_active_bins] = 0;
+
+    Thrust_Exclusive_Scan(bin_start_index);
 
-    // For use in ray intersection tests, also create an "extended" vector of start indices that also includes bins with
-    // no shape AABB intersections.
     bin_start_index_ext.resize(num_bins + 1);
 
 #pragma omp parallel for
@@ -343,4 +586,337 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+
+// Upper limit of the grid (relative to the grid origin) for the fat AABBs in coherent mode.
+static inline real3 GridLimit(const real3& min_point, const real3& max_point) {
+    return real(1 - 1e-4) * (max_point - min_point);
+}
+
+// Calculate the fat AABB of a shape, clamped to the grid.
+static inline void FatAABB(const real3& amin,
+                           const real3& amax,
+                           real fraction,
+                           const real3& limit,
+                           real3& fmin,
+                           real3& fmax) {
+    real3 margin(fraction * Max(amax - amin));
+    fmin = Clamp(amin - margin, real3(0), limit);
+    fmax = Clamp(amax + margin, real3(0), limit);
+}
+
+// Encode the state of the body associated with a shape (0 for inactive shapes).
+static inline char ShapeFlags(uint body, const std::vector<char>& active, const std::vector<char>& collide) {
+    if (body == UINT_MAX)
+        return 0;
+    return 1 | (active[body] ? 2 : 0) | (collide[body] ? 4 : 0);
+}
+
+// Check whether the grid from the previous step can be reused (coherent mode).
+// This requires the same number of shapes and that the AABBs of all colliding shapes are inside the old grid.
+bool ChBroadphase::CanReuseGrid() const {
+    if (!cache_valid)
+        return false;
+    if (cd_data->state_data.num_fluid_bodies != 0)
+        return false;
+    if (cd_data->num_rigid_shapes != cache_num_shapes)
+        return false;
+
+    real3 rmin = cd_data->rigid_min_bounding_point - cache_min;
+    real3 rmax = cd_data->rigid_max_bounding_point - cache_min;
+    real3 limit = GridLimit(cache_min, cache_max);
+
+    return rmin.x >= 0 && rmin.y >= 0 && rmin.z >= 0 &&  //
+           rmax.x <= limit.x && rmax.y <= limit.y && rmax.z <= limit.z;
+}
+
+// Temporally coherent broadphase.
+// If the grid is not reused, all fat AABBs are recalculated and the standard algorithm is applied to them. Otherwise:
+// - shapes with a current AABB outside their fat AABB (or with a modified family or body state) are marked as
+//   changed and their fat AABB is recalculated;
+// - changed shapes with a fat AABB covering a different range of bins are re-binned (their entries are removed from
+//   the sorted list of bin - shape intersections and the new ones are merged in);
+// - candidate pairs are re-evaluated in all bins containing a changed shape or left by a re-binned shape and are
+//   copied from the previous step for all other active bins.
+void ChBroadphase::CoherentBroadphase(bool reuse_grid) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const real3 limit = GridLimit(cd_data->min_bounding_point, cd_data->max_bounding_point);
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    if (!reuse_grid) {
+        fat_min.resize(num_shapes);
+        fat_max.resize(num_shapes);
+
+#pragma omp parallel for
+        for (int i = 0; i < num_shapes; i++) {
+            FatAABB(aabb_min[i], aabb_max[i], coherent_margin, limit, fat_min[i], fat_max[i]);
+        }
+
+        OneLevelBroadphase(fat_min, fat_max);
+        cd_data->num_rebinned_shapes = num_shapes;
+        CacheState(true);
+        return;
+    }
+
+    const uint num_bins = cd_data->num_bins;
+
+    // Identify changed and moved shapes
+    shape_changed.resize(num_shapes);
+    shape_moved.resize(num_shapes);
+
+    int num_changed = 0;
+    int num_moved = 0;
+
+#pragma omp parallel for reduction(+ : num_changed, num_moved)
+    for (int i = 0; i < num_shapes; i++) {
+        uint body = obj_data_id[i];
+        char flags = ShapeFlags(body, obj_active, obj_collide);
+        const short2& fam = fam_data[i];
+        bool changed = body != prev_id[i] || flags != prev_flags[i] || fam.x != prev_fam[i].x ||
+                       fam.y != prev_fam[i].y;
+
+        // Only shapes on colliding bodies are guaranteed to be inside the grid
+        if (!changed && body != UINT_MAX && obj_collide[body]) {
+            const real3& fmin = fat_min[i];
+            const real3& fmax = fat_max[i];
+            const real3& amin = aabb_min[i];
+            const real3& amax = aabb_max[i];
+            changed = amin.x < fmin.x || amin.y < fmin.y || amin.z < fmin.z ||  //
+                      amax.x > fmax.x || amax.y > fmax.y || amax.z > fmax.z;
+        }
+
+        shape_changed[i] = changed;
+        shape_moved[i] = false;
+        if (!changed)
+            continue;
+
+        FatAABB(aabb_min[i], aabb_max[i], coherent_margin, limit, fat_min[i], fat_max[i]);
+        vec3 gmin = HashMin(fat_min[i], inv_bin_size);
+        vec3 gmax = HashMax(fat_max[i], inv_bin_size);
+        bool moved = (body == UINT_MAX) != (prev_id[i] == UINT_MAX) ||                    //
+                     gmin.x != shape_gmin[i].x || gmin.y != shape_gmin[i].y || gmin.z != shape_gmin[i].z ||  //
+                     gmax.x != shape_gmax[i].x || gmax.y != shape_gmax[i].y || gmax.z != shape_gmax[i].z;
+
+        shape_moved[i] = moved;
+        num_changed++;
+        if (moved)
+            num_moved++;
+    }
+
+    cd_data->num_rebinned_shapes = num_moved;
+
+    // If no shape changed, the candidate pairs from the previous step are still valid
+    if (num_changed == 0) {
+        cd_data->num_reused_collisions = num_possible_collisions;
+        CacheState(false);
+        return;
+    }
+
+    // Re-bin moved shapes
+    std::vector<uint> dirty_bins;
+    if (num_moved > 0) {
+        prev_bin_active = bin_active;
+
+        // Mark the bins left by moved shapes and collect the new bin intersections of moved shapes
+        std::vector<std::pair<uint, uint>> entries;
+        for (int i = 0; i < num_shapes; i++) {
+            if (!shape_moved[i])
+                continue;
+            if (prev_id[i] != UINT_MAX) {
+                for (int x = shape_gmin[i].x; x <= shape_gmax[i].x; x++) {
+                    for (int y = shape_gmin[i].y; y <= shape_gmax[i].y; y++) {
+                        for (int z = shape_gmin[i].z; z <= shape_gmax[i].z; z++) {
+                            uint bin = Hash_Index(vec3(x, y, z), bins_per_axis);
+                            if (bin < num_bins && !bin_dirty[bin]) {
+                                bin_dirty[bin] = 1;
+                                dirty_bins.push_back(bin);
+                            }
+                        }
+                    }
+                }
+            }
+            shape_gmin[i] = HashMin(fat_min[i], inv_bin_size);
+            shape_gmax[i] = HashMax(fat_max[i], inv_bin_size);
+            if (obj_data_id[i] != UINT_MAX) {
+                for (int x = shape_gmin[i].x; x <= shape_gmax[i].x; x++) {
+                    for (int y = shape_gmin[i].y; y <= shape_gmax[i].y; y++) {
+                        for (int z = shape_gmin[i].z; z <= shape_gmax[i].z; z++) {
+                            entries.push_back(std::make_pair(Hash_Index(vec3(x, y, z), bins_per_axis), (uint)i));
+                        }
+                    }
+                }
+            }
+        }
+        std::sort(entries.begin(), entries.end());
+
+        // Merge the retained and the new bin intersections (both sorted by bin index, then by shape index).
+        // Within each bin, shapes must be kept in increasing order as assumed by the pair storing kernel.
+        size_t num_entries = bin_number.size() + entries.size();
+        std::vector<uint> merged_number;
+        std::vector<uint> merged_aabb;
+        merged_number.reserve(num_entries);
+        merged_aabb.reserve(num_entries);
+        size_t k = 0;
+        for (size_t j = 0; j < bin_number.size(); j++) {
+            if (shape_moved[bin_aabb_number[j]])
+                continue;
+            auto retained = std::make_pair(bin_number[j], bin_aabb_number[j]);
+            for (; k < entries.size() && entries[k] < retained; k++) {
+                merged_number.push_back(entries[k].first);
+                merged_aabb.push_back(entries[k].second);
+            }
+            merged_number.push_back(bin_number[j]);
+            merged_aabb.push_back(bin_aabb_number[j]);
+        }
+        for (; k < entries.size(); k++) {
+            merged_number.push_back(entries[k].first);
+            merged_aabb.push_back(entries[k].second);
+        }
+        bin_number.swap(merged_number);
+        bin_aabb_number.swap(merged_aabb);
+
+        cd_data->num_bin_aabb_intersections = (uint)bin_number.size();
+        FindActiveBins();
+    }
+
+    prev_num_contact.swap(bin_num_contact);
+    prev_pairs.swap(pair_shapeIDs);
+
+    if (num_active_bins <= 0) {
+        num_possible_collisions = 0;
+        pair_shapeIDs.clear();
+    } else {
+        // Flag the active bins that require re-evaluation (-1) and find the index of all other active bins at the
+        // previous step
+        std::vector<int> prev_index(num_active_bins);
+
+#pragma omp parallel for
+        for (int index = 0; index < (signed)num_active_bins; index++) {
+            uint bin = bin_active[index];
+            bool dirty = bin >= num_bins || bin_dirty[bin] != 0;
+            for (uint j = bin_start_index[index]; !dirty && j < bin_start_index[index + 1]; j++)
+                dirty = shape_changed[bin_aabb_number[j]] != 0;
+            if (dirty) {
+                prev_index[index] = -1;
+            } else if (num_moved == 0) {
+                prev_index[index] = index;
+            } else {
+                auto it = std::lower_bound(prev_bin_active.begin(), prev_bin_active.end(), bin);
+                prev_index[index] = (it != prev_bin_active.end() && *it == bin)
+                                        ? (int)std::distance(prev_bin_active.begin(), it)
+                                        : -1;
+            }
+        }
+
+        // Count the number of AABB-AABB intersections in each active bin -> bin_num_contact
+        bin_num_contact.resize(num_active_bins + 1);
+        bin_num_contact[num_active_bins] = 0;
+
+#pragma omp parallel for
+        for (int index = 0; index < (signed)num_active_bins; index++) {
+            int prev = prev_index[index];
+            if (prev >= 0) {
+                bin_num_contact[index] = prev_num_contact[prev + 1] - prev_num_contact[prev];
+                continue;
+            }
+            f_Count_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, fat_min, fat_max, bin_active,
+                                           bin_aabb_number, bin_start_index, fam_data, obj_active, obj_collide,
+                                           obj_data_id, bin_num_contact);
+        }
+
+        thrust::exclusive_scan(bin_num_contact.begin(), bin_num_contact.end(), bin_num_contact.begin());
+        num_possible_collisions = bin_num_contact.back();
+        pair_shapeIDs.resize(num_possible_collisions);
+
+        // Store the list of shape pairs in potential collision, copying the pairs in unchanged bins
+        int num_reused = 0;
+
+#pragma omp parallel for reduction(+ : num_reused)
+        for (int index = 0; index < (signed)num_active_bins; index++) {
+            int prev = prev_index[index];
+            if (prev >= 0) {
+                uint count = bin_num_contact[index + 1] - bin_num_contact[index];
+                std::copy(prev_pairs.begin() + prev_num_contact[prev],
+                          prev_pairs.begin() + prev_num_contact[prev] + count,
+                          pair_shapeIDs.begin() + bin_num_contact[index]);
+                num_reused += count;
+                continue;
+            }
+            f_Store_AABB_AABB_Intersection(index, inv_bin_size, bins_per_axis, fat_min, fat_max, bin_active,
+                                           bin_aabb_number, bin_start_index, bin_num_contact, fam_data, obj_active,
+                                           obj_collide, obj_data_id, pair_shapeIDs);
+        }
+
+        cd_data->num_reused_collisions = num_reused;
+    }
+
+    // Reset the marks of bins left by moved shapes
+    for (auto bin : dirty_bins)
+        bin_dirty[bin] = 0;
+
+    CacheState(false);
+}
+
+// Cache data for the coherent broadphase at the next step.
+void ChBroadphase::CacheState(bool new_grid) {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const int num_shapes = cd_data->num_rigid_shapes;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+
+    prev_id.resize(num_shapes);
+    prev_fam.resize(num_shapes);
+    prev_flags.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        prev_id[i] = obj_data_id[i];
+        prev_fam[i] = fam_data[i];
+        prev_flags[i] = ShapeFlags(obj_data_id[i], obj_active, obj_collide);
+    }
+
+    if (!new_grid)
+        return;
+
+    cache_num_shapes = num_shapes;
+    cache_min = cd_data->min_bounding_point;
+    cache_max = cd_data->max_bounding_point;
+    cache_bins_per_axis = cd_data->bins_per_axis;
+    cache_bin_size = cd_data->bin_size;
+
+    shape_gmin.resize(num_shapes);
+    shape_gmax.resize(num_shapes);
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        shape_gmin[i] = HashMin(fat_min[i], inv_bin_size);
+        shape_gmax[i] = HashMax(fat_max[i], inv_bin_size);
+    }
+
+    bin_dirty.assign(cd_data->num_bins, 0);
+}
+
 }  // end namespace chrono
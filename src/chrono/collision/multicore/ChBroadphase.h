@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/multicore/ChCollisionData.h"
 
@@ -43,7 +45,15 @@ class ChApi ChBroadphase {
     void Process();
 
   private:
-    void OneLevelBroadphase();
+    void OneLevelBroadphase(const std::vector<real3>& box_min,
+                            const std::vector<real3>& box_max,
+                            const std::vector<char>* excluded = nullptr);
+    void TwoLevelBroadphase();
+    void CoarseBroadphase();
+    void CoherentBroadphase(bool reuse_grid);
+    void FindActiveBins();
+    bool CanReuseGrid() const;
+    void CacheState(bool new_grid);
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -56,6 +66,50 @@ class ChApi ChBroadphase {
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
+    bool coherent;         ///< (input) reuse bin assignments and candidate pairs from the previous step
+    real coherent_margin;  ///< (input) relative enlargement of shape AABBs in coherent mode
+    bool two_level;        ///< (input) bin large shapes in a separate, coarse grid
+    real two_level_ratio;  ///< (input) size (in number of top-level bins) above which a shape is considered large
+
+    // Temporally coherent broadphase.
+    // Shapes are binned using enlarged ("fat") AABBs, which are recomputed only when the current shape AABB is no
+    // longer contained in the fat one. While the grid of the previous step encloses all shapes, it is kept unchanged;
+    // only shapes whose fat AABB covers a different range of bins are re-binned, and candidate pairs are re-evaluated
+    // only in bins with modified shapes. The resulting candidate pairs are a superset of the ones found by the
+    // standard broadphase.
+    bool cache_valid;                    ///< data from previous step usable?
+    uint cache_num_shapes;               ///< number of shapes at previous step
+    real3 cache_min;                     ///< grid lower corner at previous step
+    real3 cache_max;                     ///< grid upper corner at previous step
+    vec3 cache_bins_per_axis;            ///< grid resolution at previous step
+    real3 cache_bin_size;                ///< grid bin size at previous step
+    std::vector<real3> fat_min;          ///< [num_shapes] fat AABB lower corners (relative to grid)
+    std::vector<real3> fat_max;          ///< [num_shapes] fat AABB upper corners (relative to grid)
+    std::vector<vec3> shape_gmin;        ///< [num_shapes] lower corners of fat AABB bin ranges
+    std::vector<vec3> shape_gmax;        ///< [num_shapes] upper corners of fat AABB bin ranges
+    std::vector<uint> prev_id;           ///< [num_shapes] body IDs at previous step
+    std::vector<short2> prev_fam;        ///< [num_shapes] collision families at previous step
+    std::vector<char> prev_flags;        ///< [num_shapes] body active/collide flags at previous step
+    std::vector<char> shape_changed;     ///< [num_shapes] shapes with new fat AABB, family, or flags
+    std::vector<char> shape_moved;       ///< [num_shapes] changed shapes with a different bin range
+    std::vector<char> bin_dirty;         ///< [num_bins] bins left by re-binned shapes
+    std::vector<uint> prev_bin_active;   ///< active bins at previous step
+    std::vector<uint> prev_num_contact;  ///< offsets of candidate pairs in active bins at previous step
+    std::vector<long long> prev_pairs;   ///< candidate pairs at previous step
+
+    // Two-level broadphase.
+    // Shapes with an AABB spanning more than `two_level_ratio` bins of the top-level grid in any direction are not
+    // binned in the top-level grid, but in a coarse grid with bins sized by the average AABB of these large shapes.
+    // Candidate pairs involving at least one large shape are found in the coarse grid only, where small shapes are
+    // binned only if they intersect a bin also occupied by a large shape.
+    std::vector<char> shape_large;           ///< [num_shapes] shapes assigned to the coarse grid
+    std::vector<char> coarse_occupied;       ///< [num_coarse_bins] coarse bins intersected by a large shape
+    std::vector<uint> coarse_intersections;  ///< [num_shapes+1] number of coarse bin intersections for each shape
+    std::vector<uint> coarse_bin_number;     ///< bin index for coarse bin - shape AABB intersections
+    std::vector<uint> coarse_aabb_number;    ///< shape ID for coarse bin - shape AABB intersections
+    std::vector<uint> coarse_bin_active;     ///< [num_coarse_active_bins] bin index of active coarse bins
+    std::vector<uint> coarse_start_index;    ///< [num_coarse_active_bins+1]
+    std::vector<uint> coarse_num_contact;    ///< [num_coarse_active_bins+1]
 
     friend class ChCollisionSystemMulticore;
     friend class ChCollisionSystemChronoMulticore;
@@ -107,6 +107,10 @@ class ChApi ChCollisionData {
           num_bin_aabb_intersections(0),
           num_active_bins(0),
           num_possible_collisions(0),
+          num_reused_collisions(0),
+          num_rebinned_shapes(0),
+          coarse_bins_per_axis(vec3(0)),
+          coarse_bin_size(real3(0)),
           //
           rigid_min_bounding_point(real3(0)),
           rigid_max_bounding_point(real3(0)),
@@ -196,6 +200,12 @@ class ChApi ChCollisionData {
     uint num_bin_aabb_intersections;  ///< number of bin - shape AABB intersections
     uint num_active_bins;             ///< number of bins intersecting at least one shape AABB
     uint num_possible_collisions;     ///< number of candidate collisions from broadphase
+    uint num_reused_collisions;       ///< number of candidate collisions reused from previous step (coherent mode)
+    uint num_rebinned_shapes;         ///< number of shapes re-binned at current step (coherent mode)
+
+    std::vector<uint> coarse_shapes;  ///< shapes binned in the coarse grid (two-level mode)
+    vec3 coarse_bins_per_axis;        ///< number of slices along each axis of the coarse grid (two-level mode)
+    real3 coarse_bin_size;            ///< coarse grid bin sizes in each direction (two-level mode)
 
     real3 rigid_min_bounding_point;  ///< LBR (left-bottom-rear) corner of union of rigid AABBs
     real3 rigid_max_bounding_point;  ///< RTF (right-top-front) corner of union of rigid AABBs
@@ -17,10 +17,13 @@
 //
 // =============================================================================
 
+#include <stdexcept>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChParticleCloud.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTrace.h"
 
 #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
 #include "chrono/collision/multicore/ChRayTest.h"
@@ -54,7 +57,7 @@ void ChCollisionSystemMulticore::SetBroadphaseGridResolution(const ChVector3i& n
 
 void ChCollisionSystemMulticore::SetBroadphaseGridSize(const ChVector3d& bin_size) {
     broadphase.bin_size = real3(bin_size.x(), bin_size.y(), bin_size.z());
-    broadphase.grid_type = ChBroadphase::GridType::FIXED_RESOLUTION;
+    broadphase.grid_type = ChBroadphase::GridType::FIXED_BIN_SIZE;
 }
 
 void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
@@ -62,6 +65,28 @@ void ChCollisionSystemMulticore::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemMulticore::EnableBroadphaseCoherence(bool val, double margin) {
+    broadphase.coherent = val;
+    broadphase.coherent_margin = real(margin);
+}
+
+void ChCollisionSystemMulticore::EnableBroadphaseTwoLevel(bool val, double size_ratio) {
+    broadphase.two_level = val;
+    broadphase.two_level_ratio = real(size_ratio);
+}
+
+unsigned int ChCollisionSystemMulticore::GetNumReusedBroadphasePairs() const {
+    return cd_data->num_reused_collisions;
+}
+
+unsigned int ChCollisionSystemMulticore::GetNumRebinnedShapes() const {
+    return cd_data->num_rebinned_shapes;
+}
+
+unsigned int ChCollisionSystemMulticore::GetNumCoarseGridShapes() const {
+    return (unsigned int)cd_data->coarse_shapes.size();
+}
+
 void ChCollisionSystemMulticore::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
@@ -304,6 +329,7 @@ void ChCollisionSystemMulticore::Run() {
     // Broadphase
     {
         CH_PROFILE("Broad-phase");
+        CH_TRACE("Broad-phase");
         m_timer_broad.start();
         GenerateAABB();
         broadphase.Process();
@@ -313,6 +339,7 @@ void ChCollisionSystemMulticore::Run() {
     // Narrowphase
     {
         CH_PROFILE("Narrow-phase");
+        CH_TRACE("Narrow-phase");
         m_timer_narrow.start();
         narrowphase.Process();
         m_timer_narrow.stop();
@@ -571,12 +598,72 @@ std::vector<vec2> ChCollisionSystemMulticore::GetOverlappingPairs() {
 // -----------------------------------------------------------------------------
 
 bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const {
-    if (cd_data->num_active_bins == 0) {
+    ChRayTest tester(cd_data);
+    return RayHit(tester, from, to, result);
+}
+
+bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
+                                        const ChVector3d& to,
+                                        ChCollisionModel* model,
+                                        ChRayhitResult& result) const {
+    if (!model || !model->HasImplementation()) {
         result.hit = false;
         return false;
     }
 
     ChRayTest tester(cd_data);
+    tester.SetBodyFilter(static_cast<ChCollisionModelMulticore*>(model->GetImplementation())->GetBody()->GetIndex());
+    return RayHit(tester, from, to, result);
+}
+
+int ChCollisionSystemMulticore::RayHit(const std::vector<ChVector3d>& from,
+                                       const std::vector<ChVector3d>& to,
+                                       std::vector<ChRayhitResult>& results,
+                                       ChCollisionModel* model,
+                                       int family) const {
+    if (from.size() != to.size())
+        throw std::invalid_argument("Different number of ray start and end points.");
+
+    int num_rays = (int)from.size();
+    results.resize(num_rays);
+
+    int body_id = -1;
+    if (model) {
+        if (!model->HasImplementation()) {
+            for (auto& result : results)
+                result.hit = false;
+            return 0;
+        }
+        body_id = static_cast<ChCollisionModelMulticore*>(model->GetImplementation())->GetBody()->GetIndex();
+    }
+
+    // The ray tests only read the broadphase grid and the shape data; each thread uses its own tester
+    int num_hits = 0;
+#pragma omp parallel reduction(+ : num_hits)
+    {
+        ChRayTest tester(cd_data);
+        tester.SetBodyFilter(body_id);
+        tester.SetFamilyFilter(family);
+
+#pragma omp for
+        for (int i = 0; i < num_rays; i++) {
+            if (RayHit(tester, from[i], to[i], results[i]))
+                num_hits++;
+        }
+    }
+
+    return num_hits;
+}
+
+bool ChCollisionSystemMulticore::RayHit(ChRayTest& tester,
+                                        const ChVector3d& from,
+                                        const ChVector3d& to,
+                                        ChRayhitResult& result) const {
+    if (cd_data->num_active_bins == 0 && cd_data->coarse_shapes.empty()) {
+        result.hit = false;
+        return false;
+    }
+
     ChRayTest::RayHitInfo info;
     if (tester.Check(FromChVector(from), FromChVector(to), info)) {
         // Hit point
@@ -598,13 +685,6 @@ bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from, const ChVector3d
     return false;
 }
 
-bool ChCollisionSystemMulticore::RayHit(const ChVector3d& from,
-                                        const ChVector3d& to,
-                                        ChCollisionModel* model,
-                                        ChRayhitResult& result) const {
-    return false;
-}
-
 // -----------------------------------------------------------------------------
 
 void DrawHemisphere(ChCollisionSystem::VisualizationCallback* vis,
@@ -35,6 +35,7 @@ namespace chrono {
 // forward references
 class ChAssembly;
 class ChParticleCloud;
+class ChRayTest;
 
 /// @addtogroup collision_mc
 /// @{
@@ -77,6 +78,31 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Enable temporally coherent broadphase (default: false).
+    /// If enabled, the broadphase reuses the grid, bin assignments, and candidate pairs from the previous step as long
+    /// as all collision shapes remain inside the grid. Shapes are binned using AABBs enlarged by the specified fraction
+    /// of their size; only shapes whose actual AABB exits the enlarged one are updated, and candidate pairs are
+    /// recalculated only in the grid bins affected by such shapes. The resulting candidate pairs are a superset of
+    /// those obtained with the default broadphase. Not used if the system contains 3-DOF fluid particles.
+    void EnableBroadphaseCoherence(bool val, double margin = 0.1);
+
+    /// Enable two-level broadphase grid (default: false).
+    /// If enabled, collision shapes with an AABB spanning more than `size_ratio` bins of the broadphase grid in any
+    /// direction are excluded from that grid and processed in a separate, coarse grid, with bins sized by the average
+    /// AABB of such large shapes. This keeps the number of bin - shape intersections bounded for scenes with a wide
+    /// range of shape sizes, while producing the same candidate pairs as the default broadphase. Not used with the
+    /// coherent broadphase or if the system contains 3-DOF fluid particles.
+    void EnableBroadphaseTwoLevel(bool val, double size_ratio = 4);
+
+    /// Get the number of candidate pairs reused from the previous step by the coherent broadphase.
+    unsigned int GetNumReusedBroadphasePairs() const;
+
+    /// Get the number of collision shapes re-binned at the last step by the coherent broadphase.
+    unsigned int GetNumRebinnedShapes() const;
+
+    /// Get the number of collision shapes processed in the coarse grid at the last step by the two-level broadphase.
+    unsigned int GetNumCoarseGridShapes() const;
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -126,16 +152,22 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     virtual void ReportProximities(ChProximityContainer* mproximitycontainer) override {}
 
     /// Perform a ray-hit test with all collision models.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const override;
 
     /// Perform a ray-hit test with the specified collision model.
-    /// Currently not implemented.
     virtual bool RayHit(const ChVector3d& from,
                         const ChVector3d& to,
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests for a batch of rays, optionally restricted to a collision model or a collision family.
+    /// The rays are processed in parallel, each thread using its own ray tester to traverse the broadphase grid.
+    virtual int RayHit(const std::vector<ChVector3d>& from,
+                       const std::vector<ChVector3d>& to,
+                       std::vector<ChRayhitResult>& results,
+                       ChCollisionModel* model = nullptr,
+                       int family = -1) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -152,6 +184,9 @@ class ChApi ChCollisionSystemMulticore : public ChCollisionSystem {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   protected:
+    /// Perform a ray-hit test using the given ray tester (with its current filters).
+    bool RayHit(ChRayTest& tester, const ChVector3d& from, const ChVector3d& to, ChRayhitResult& result) const;
+
     /// Mark bodies whose AABB is contained within the specified box.
     virtual void GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax);
 
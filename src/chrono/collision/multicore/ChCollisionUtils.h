@@ -170,6 +170,41 @@ ChApi void f_Store_AABB_AABB_Intersection(const uint index,
                                           const std::vector<uint>& body_id,
                                           std::vector<long long>& potential_contacts);
 
+/// Function to count AABB-AABB intersections involving at least one large shape in a bin of the coarse grid
+/// (two-level broadphase).
+ChApi void f_TL_Count_AABB_AABB_Intersection(const uint index,
+                                             const real3 inv_bin_size_vec,
+                                             const vec3 bins_per_axis,
+                                             const std::vector<real3>& aabb_min_data,
+                                             const std::vector<real3>& aabb_max_data,
+                                             const std::vector<uint>& bin_number,
+                                             const std::vector<uint>& aabb_number,
+                                             const std::vector<uint>& bin_start_index,
+                                             const std::vector<char>& is_large,
+                                             const std::vector<short2>& fam_data,
+                                             const std::vector<char>& body_active,
+                                             const std::vector<char>& body_collide,
+                                             const std::vector<uint>& body_id,
+                                             std::vector<uint>& num_contact);
+
+/// Function to store AABB-AABB intersections involving at least one large shape in a bin of the coarse grid
+/// (two-level broadphase).
+ChApi void f_TL_Store_AABB_AABB_Intersection(const uint index,
+                                             const real3 inv_bin_size_vec,
+                                             const vec3 bins_per_axis,
+                                             const std::vector<real3>& aabb_min_data,
+                                             const std::vector<real3>& aabb_max_data,
+                                             const std::vector<uint>& bin_number,
+                                             const std::vector<uint>& aabb_number,
+                                             const std::vector<uint>& bin_start_index,
+                                             const std::vector<uint>& num_contact,
+                                             const std::vector<char>& is_large,
+                                             const std::vector<short2>& fam_data,
+                                             const std::vector<char>& body_active,
+                                             const std::vector<char>& body_collide,
+                                             const std::vector<uint>& body_id,
+                                             std::vector<long long>& potential_contacts);
+
 /// @}
 
 // =============================================================================
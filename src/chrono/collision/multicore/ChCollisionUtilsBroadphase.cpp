@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <climits>
+#include <utility>
 
 #include "chrono/collision/multicore/ChCollisionUtils.h"
 #include "chrono/collision/multicore/ChCollisionData.h"
@@ -218,6 +219,117 @@ void f_Store_AABB_AABB_Intersection(const uint index,
 
 // TWO LEVEL FUNCTIONS==========================================================
 
+// Check if the shapes in the specified coarse grid bin entries form a candidate pair.
+// Only pairs involving at least one large shape are considered.
+static inline bool TL_Candidate_Pair(uint shapeA,
+                                     uint shapeB,
+                                     const real3& inv_bin_size_vec,
+                                     const vec3& bins_per_axis,
+                                     uint bin,
+                                     const std::vector<real3>& aabb_min_data,
+                                     const std::vector<real3>& aabb_max_data,
+                                     const std::vector<char>& is_large,
+                                     const std::vector<short2>& fam_data,
+                                     const std::vector<char>& body_active,
+                                     const std::vector<char>& body_collide,
+                                     const std::vector<uint>& body_id) {
+    if (!is_large[shapeA] && !is_large[shapeB])
+        return false;
+
+    uint bodyA = body_id[shapeA];
+    uint bodyB = body_id[shapeB];
+
+    if (bodyA == UINT_MAX || bodyB == UINT_MAX)
+        return false;
+    if (shapeA == shapeB)
+        return false;
+    if (bodyA == bodyB)
+        return false;
+    if (body_collide[bodyA] == 0 || body_collide[bodyB] == 0)
+        return false;
+    if (!body_active[bodyA] && !body_active[bodyB])
+        return false;
+    if (!collide(fam_data[shapeA], fam_data[shapeB]))
+        return false;
+
+    real3 Amin = aabb_min_data[shapeA];
+    real3 Amax = aabb_max_data[shapeA];
+    real3 Bmin = aabb_min_data[shapeB];
+    real3 Bmax = aabb_max_data[shapeB];
+
+    if (!overlap(Amin, Amax, Bmin, Bmax))
+        return false;
+
+    return current_bin(Amin, Amax, Bmin, Bmax, inv_bin_size_vec, bins_per_axis, bin);
+}
+
+// Function to count AABB-AABB intersections involving at least one large shape in a coarse grid bin.
+void f_TL_Count_AABB_AABB_Intersection(const uint index,
+                                       const real3 inv_bin_size_vec,
+                                       const vec3 bins_per_axis,
+                                       const std::vector<real3>& aabb_min_data,
+                                       const std::vector<real3>& aabb_max_data,
+                                       const std::vector<uint>& bin_number,
+                                       const std::vector<uint>& aabb_number,
+                                       const std::vector<uint>& bin_start_index,
+                                       const std::vector<char>& is_large,
+                                       const std::vector<short2>& fam_data,
+                                       const std::vector<char>& body_active,
+                                       const std::vector<char>& body_collide,
+                                       const std::vector<uint>& body_id,
+                                       std::vector<uint>& num_contact) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    uint count = 0;
+
+    for (uint i = start; i < end; i++) {
+        for (uint k = i + 1; k < end; k++) {
+            if (TL_Candidate_Pair(aabb_number[i], aabb_number[k], inv_bin_size_vec, bins_per_axis, bin_number[index],
+                                  aabb_min_data, aabb_max_data, is_large, fam_data, body_active, body_collide, body_id))
+                count++;
+        }
+    }
+
+    num_contact[index] = count;
+}
+
+// Function to store AABB-AABB intersections involving at least one large shape in a coarse grid bin.
+void f_TL_Store_AABB_AABB_Intersection(const uint index,
+                                       const real3 inv_bin_size_vec,
+                                       const vec3 bins_per_axis,
+                                       const std::vector<real3>& aabb_min_data,
+                                       const std::vector<real3>& aabb_max_data,
+                                       const std::vector<uint>& bin_number,
+                                       const std::vector<uint>& aabb_number,
+                                       const std::vector<uint>& bin_start_index,
+                                       const std::vector<uint>& num_contact,
+                                       const std::vector<char>& is_large,
+                                       const std::vector<short2>& fam_data,
+                                       const std::vector<char>& body_active,
+                                       const std::vector<char>& body_collide,
+                                       const std::vector<uint>& body_id,
+                                       std::vector<long long>& potential_contacts) {
+    uint start = bin_start_index[index];
+    uint end = bin_start_index[index + 1];
+    uint offset = num_contact[index];
+    uint count = 0;
+
+    for (uint i = start; i < end; i++) {
+        for (uint k = i + 1; k < end; k++) {
+            uint shapeA = aabb_number[i];
+            uint shapeB = aabb_number[k];
+            if (!TL_Candidate_Pair(shapeA, shapeB, inv_bin_size_vec, bins_per_axis, bin_number[index], aabb_min_data,
+                                   aabb_max_data, is_large, fam_data, body_active, body_collide, body_id))
+                continue;
+            if (shapeB < shapeA)
+                std::swap(shapeA, shapeB);
+            // the two indices of the shapes that make up the contact
+            potential_contacts[offset + count] = ((long long)shapeA << 32 | (long long)shapeB);
+            count++;
+        }
+    }
+}
+
 /*
 
 // For each bin determine the grid size and store it.
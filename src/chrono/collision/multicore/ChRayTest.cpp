@@ -23,7 +23,16 @@ namespace chrono {
 
 using namespace chrono::mc_utils;
 
-ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data) : cd_data(data), num_bin_tests(0), num_shape_tests(0) {}
+ChRayTest::ChRayTest(std::shared_ptr<ChCollisionData> data)
+    : cd_data(data), num_bin_tests(0), num_shape_tests(0), filter_body(-1), filter_group(0) {}
+
+bool ChRayTest::Accept(uint shapeID) const {
+    if (filter_body >= 0 && cd_data->shape_data.id_rigid[shapeID] != (uint)filter_body)
+        return false;
+    if (filter_group != 0 && (cd_data->shape_data.fam_rigid[shapeID].x & filter_group) == 0)
+        return false;
+    return true;
+}
 
 // =============================================================================
 
@@ -375,6 +384,22 @@ bool triangle_ray(const real3& A,
 
 // =============================================================================
 
+// Load the ray intersection test results.
+static bool FinalizeHit(bool hit,
+                        uint shapeID,
+                        const real3& start,
+                        const real3& ray,
+                        real mindist2,
+                        ChRayTest::RayHitInfo& info) {
+    if (hit) {
+        info.shapeID = shapeID;             // Identifier of closest hit shape
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+    return hit;
+}
+
 // Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
 // to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
 bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
@@ -386,6 +411,7 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     const real3& rtf = cd_data->max_bounding_point;
     const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
     const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const std::vector<uint>& coarse_shapes = cd_data->coarse_shapes;
 
     // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
     real3 center = 0.5 * (rtf + lbr), loc, normal;
@@ -396,6 +422,27 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     // Ray direction
     real3 ray = end - start;
 
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    bool hit = false;
+    uint hit_shape = 0;
+
+    // Test ray against all shapes binned in the coarse grid (two-level broadphase).
+    for (auto index : coarse_shapes) {
+        if (!Accept(index))
+            continue;
+        num_shape_tests++;
+        shape.index = index;
+        if (CheckShape(shape, start, end, normal, mindist2)) {
+            hit = true;
+            hit_shape = index;
+            info.normal = normal;
+        }
+    }
+
+    if (cd_data->num_active_bins == 0)
+        return FinalizeHit(hit, hit_shape, start, ray, mindist2, info);
+
     // Find entry bin
     auto bin = Clamp(HashMin(start - lbr, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
 
@@ -425,10 +472,6 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     }
 
     // Walk through each bin intersected by the ray (DDA).
-    ConvexShape shape(-1, &cd_data->shape_data);
-    real mindist2 = C_REAL_MAX;
-    bool hit = false;
-
     ////std::cout << "Ray start: [" << start.x << "," << start.y << "," << start.z << "]" << std::endl;
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
@@ -441,23 +484,31 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         auto start_index = bin_start_index_ext[bin_index];
         auto end_index = bin_start_index_ext[bin_index + 1];
 
+        bool bin_hit = false;
         for (uint j = start_index; j < end_index; j++) {
+            if (!Accept(bin_aabb_number[j]))
+                continue;
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
-                hit = true;
+            if (CheckShape(shape, start, end, normal, mindist2)) {
+                bin_hit = true;
+                hit_shape = shape.index;
+                info.normal = normal;
+            }
         }
 
         // If a shape in the current bin was hit, stop.
-        if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
-            info.dist = Sqrt(mindist2);         // Distance from ray origin
-            info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
-            info.point = start + info.t * ray;  // Intersection point
+        if (bin_hit) {
+            hit = true;
             break;
         }
 
+        // If a shape in the coarse grid was hit before reaching the next bin, stop.
+        real t_exit = Min(t_next[0], Min(t_next[1], t_next[2]));
+        if (hit && t_exit * t_exit * Length2(ray) >= mindist2)
+            break;
+
         // Move to the next cell (the one with lowest t_next)
         static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
         int k = ((t_next[0] < t_next[1]) << 2) + ((t_next[0] < t_next[2]) << 1) + ((t_next[1] < t_next[2]));
@@ -468,7 +519,7 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
         t_next[axis] += delta[axis];
     }
 
-    return hit;
+    return FinalizeHit(hit, hit_shape, start, ray, mindist2, info);
 }
 
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
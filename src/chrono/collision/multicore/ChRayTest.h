@@ -48,6 +48,14 @@ class ChApi ChRayTest {
                RayHitInfo& info     ///< [output] test result info
     );
 
+    /// Restrict subsequent ray tests to the shapes of the body with specified index.
+    /// A negative value (default) disables this filter.
+    void SetBodyFilter(int body_id) { filter_body = body_id; }
+
+    /// Restrict subsequent ray tests to the shapes in the specified collision family (0...15).
+    /// A negative value (default) disables this filter.
+    void SetFamilyFilter(int family) { filter_group = (family < 0) ? 0 : (short)(1 << family); }
+
     /// Return the number of bins visited by the DDA algorithm during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
@@ -55,6 +63,9 @@ class ChApi ChRayTest {
     uint GetNumShapeTests() const { return num_shape_tests; }
 
   private:
+    /// Check if the specified shape passes the body and family filters.
+    bool Accept(uint shapeID) const;
+
     /// Dispatcher for analytic functions for ray intersection with primitive shapes.
     bool CheckShape(const ConvexBase& shape,  ///< candidate shape
                     const real3& start,       ///< ray start point
@@ -66,6 +77,8 @@ class ChApi ChRayTest {
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
+    int filter_body;                           ///< if non-negative, only test shapes of this body
+    short filter_group;                        ///< if non-zero, only test shapes in this collision family group
 };
 
 /// @} collision_mc
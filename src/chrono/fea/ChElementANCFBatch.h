@@ -0,0 +1,257 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Batched evaluation of the generalized internal forces of ANCF continuum-based
+// elements using the "Continuous Integration" style method.
+//
+// The elements in a batch are processed in groups of NUM_LANES elements, each
+// element of a group being mapped to one lane of the vectorized operations.
+// The precomputed shape function derivatives and quadrature weights, as well as
+// the nodal coordinates of the elements in a group are stored interleaved by
+// element (structure of arrays), such that all calculations at a given Gauss
+// quadrature point are performed simultaneously for all elements of a group.
+//
+// =============================================================================
+
+#ifndef CH_ELEMENT_ANCF_BATCH_H
+#define CH_ELEMENT_ANCF_BATCH_H
+
+#include <algorithm>
+
+#include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementBatch.h"
+#include "chrono/utils/ChTrace.h"
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Batched evaluation of the internal forces of ANCF elements with NSF shape functions and NIP Gauss quadrature points,
+/// using the "Continuous Integration" style method.
+/// Concrete batch classes (one for each ANCF element type) provide access to the element nodal coordinates, damping
+/// coefficients, material properties, and the shape function derivatives and quadrature weights precomputed by the
+/// elements. A material stiffness matrix (in 6x6 Voigt form) is associated with each quadrature point; this allows
+/// representing both the standard continuum mechanics formulation and the Enhanced Continuum Mechanics method (with
+/// separate quadrature points for the terms which do or do not include the Poisson effect).
+template <int NSF, int NIP>
+class ChElementANCFBatch : public ChElementBatch {
+  public:
+    static const int NUM_LANES = 4;  ///< number of elements evaluated simultaneously
+
+    using Lanes = Eigen::Array<double, NUM_LANES, 1>;
+    using MatrixNx6 = ChMatrixNM<double, NSF, 6>;
+
+    virtual ~ChElementANCFBatch() {}
+
+    /// Precompute the batch data (interleave the precomputed element matrices).
+    virtual void Setup() override;
+
+    /// Compute the internal forces of all elements in this batch and add them, multiplied by a scaling factor c, into
+    /// the global vector R.
+    virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) override;
+
+  protected:
+    ChElementANCFBatch() : m_num_groups(0) {}
+
+    /// Return the structural damping coefficient of the i-th element (0 if damping is disabled).
+    virtual double GetAlphaDamp(unsigned int i) = 0;
+
+    /// Calculate the current Nx6 matrix of nodal coordinates and nodal coordinate time derivatives of the i-th element.
+    virtual void CalcCombinedCoordMatrix(unsigned int i, MatrixNx6& ebar_ebardot) = 0;
+
+    /// Get the precomputed shape function derivatives and scaled quadrature weights of the i-th element.
+    /// Column (3 * ip + k) of SD (NSF x 3*NIP) contains the derivatives of the shape functions with respect to the k-th
+    /// coordinate at the ip-th quadrature point. kGQ (NIP) contains minus the quadrature weight times the determinant
+    /// of the element Jacobian at each quadrature point.
+    virtual void GetPrecomputedData(unsigned int i, ChMatrixDynamic<>& SD, ChVectorDynamic<>& kGQ) = 0;
+
+    /// Get the 6x6 material stiffness matrices (of the material shared by all elements in the batch) and the index of
+    /// the stiffness matrix to be used at each quadrature point.
+    virtual void GetMaterialData(std::vector<ChMatrixDynamic<>>& D, std::vector<int>& D_index) = 0;
+
+  private:
+    /// Compute the internal forces of the elements in the specified group.
+    void ComputeInternalForces(int group);
+
+    static Lanes Dot(const Lanes* a, const Lanes* b) { return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]; }
+
+    int m_num_groups;                                       ///< number of groups of NUM_LANES elements
+    Eigen::Array<double, NUM_LANES, Eigen::Dynamic> m_SD;   ///< interleaved shape function derivatives
+    Eigen::Array<double, NUM_LANES, Eigen::Dynamic> m_kGQ;  ///< interleaved scaled quadrature weights
+    std::vector<ChMatrixDynamic<>> m_D;                     ///< material stiffness matrices
+    std::vector<int> m_D_index;                             ///< stiffness matrix index for each quadrature point
+    ChMatrixDynamic<> m_Fi;                                 ///< element internal forces (one row per element)
+};
+
+/// @} fea_elements
+
+// -----------------------------------------------------------------------------
+
+// The shape function derivatives for the k-th coordinate at the ip-th quadrature point for the elements of group g are
+// stored in columns starting at ((g * NIP + ip) * 3 + k) * NSF of m_SD.
+template <int NSF, int NIP>
+void ChElementANCFBatch<NSF, NIP>::Setup() {
+    unsigned int num_elements = GetNumElements();
+    m_num_groups = (num_elements + NUM_LANES - 1) / NUM_LANES;
+
+    // Lanes not associated with an element have zero weights and therefore do not contribute any forces
+    m_SD.setZero(NUM_LANES, m_num_groups * NIP * 3 * NSF);
+    m_kGQ.setZero(NUM_LANES, m_num_groups * NIP);
+    m_Fi.setZero(num_elements, 3 * NSF);
+
+    ChMatrixDynamic<> SD(NSF, 3 * NIP);
+    ChVectorDynamic<> kGQ(NIP);
+    for (unsigned int i = 0; i < num_elements; i++) {
+        GetPrecomputedData(i, SD, kGQ);
+        int g = i / NUM_LANES;
+        int l = i % NUM_LANES;
+        for (int ip = 0; ip < NIP; ip++) {
+            m_kGQ(l, g * NIP + ip) = kGQ(ip);
+            for (int k = 0; k < 3; k++) {
+                for (int j = 0; j < NSF; j++)
+                    m_SD(l, ((g * NIP + ip) * 3 + k) * NSF + j) = SD(j, 3 * ip + k);
+            }
+        }
+    }
+}
+
+template <int NSF, int NIP>
+void ChElementANCFBatch<NSF, NIP>::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) {
+    m_D.clear();
+    m_D_index.clear();
+    GetMaterialData(m_D, m_D_index);
+
+    // Groups of elements write to separate rows of m_Fi and can be evaluated in parallel
+#pragma omp parallel num_threads(nthreads)
+    {
+        CH_TRACE("ElementBatchInternalForces");
+#pragma omp for schedule(dynamic, 1) nowait
+        for (int g = 0; g < m_num_groups; g++) {
+            ComputeInternalForces(g);
+        }
+    }
+
+    // Sequential load of the element forces into the global vector (elements in a batch typically share nodes)
+    for (unsigned int i = 0; i < GetNumElements(); i++) {
+        LoadElementResidual(*m_elements[i], m_Fi.row(i).transpose(), R, c);
+    }
+}
+
+template <int NSF, int NIP>
+void ChElementANCFBatch<NSF, NIP>::ComputeInternalForces(int group) {
+    unsigned int first = group * NUM_LANES;
+    unsigned int num_lanes = std::min((unsigned int)NUM_LANES, GetNumElements() - first);
+
+    // Load the nodal coordinates and their time derivatives of all elements in the group.
+    // Entry (l, 6 * j + c) is the c-th component of the j-th nodal coordinate (c < 3) or of its time derivative
+    // (c >= 3) for the l-th element in the group.
+    Eigen::Array<double, NUM_LANES, 6 * NSF> e;
+    Lanes alpha;
+    e.setZero();
+    alpha.setZero();
+
+    bool damping = false;
+    MatrixNx6 ebar_ebardot;
+    for (unsigned int l = 0; l < num_lanes; l++) {
+        CalcCombinedCoordMatrix(first + l, ebar_ebardot);
+        e.row(l) = Eigen::Map<const Eigen::Array<double, 1, 6 * NSF>>(ebar_ebardot.data());
+        alpha(l) = GetAlphaDamp(first + l);
+        damping = damping || (alpha(l) != 0);
+    }
+
+    // Accumulate the generalized internal forces, in compact form.
+    // Entry (l, 3 * j + c) is the c-th component of the generalized force for the j-th nodal coordinate of the l-th
+    // element in the group.
+    Eigen::Array<double, NUM_LANES, 3 * NSF> Q;
+    Q.setZero();
+
+    for (int ip = 0; ip < NIP; ip++) {
+        const int sd_offset = (group * NIP + ip) * 3 * NSF;
+
+        // Deformation gradient and its time derivative, in transposed order: F[k][c] = dr_c / dX_k
+        Lanes F[3][3];
+        Lanes Fdot[3][3];
+        for (int k = 0; k < 3; k++) {
+            for (int c = 0; c < 3; c++) {
+                F[k][c].setZero();
+                Fdot[k][c].setZero();
+            }
+        }
+        for (int j = 0; j < NSF; j++) {
+            for (int k = 0; k < 3; k++) {
+                const Lanes sd = m_SD.col(sd_offset + k * NSF + j);
+                for (int c = 0; c < 3; c++)
+                    F[k][c] += sd * e.col(6 * j + c);
+                if (damping) {
+                    for (int c = 0; c < 3; c++)
+                        Fdot[k][c] += sd * e.col(6 * j + 3 + c);
+                }
+            }
+        }
+
+        // Green-Lagrange strains combined with their scaled time derivatives, in Voigt notation, and scaled by the
+        // quadrature factors: kGQ * (E + alpha * Edot) with E = [E11,E22,E33,2*E23,2*E13,2*E12]
+        Lanes E[6];
+        E[0] = 0.5 * (Dot(F[0], F[0]) - 1);
+        E[1] = 0.5 * (Dot(F[1], F[1]) - 1);
+        E[2] = 0.5 * (Dot(F[2], F[2]) - 1);
+        E[3] = Dot(F[1], F[2]);
+        E[4] = Dot(F[0], F[2]);
+        E[5] = Dot(F[0], F[1]);
+        if (damping) {
+            E[0] += alpha * Dot(F[0], Fdot[0]);
+            E[1] += alpha * Dot(F[1], Fdot[1]);
+            E[2] += alpha * Dot(F[2], Fdot[2]);
+            E[3] += alpha * (Dot(F[1], Fdot[2]) + Dot(F[2], Fdot[1]));
+            E[4] += alpha * (Dot(F[0], Fdot[2]) + Dot(F[2], Fdot[0]));
+            E[5] += alpha * (Dot(F[0], Fdot[1]) + Dot(F[1], Fdot[0]));
+        }
+        const Lanes kGQ = m_kGQ.col(group * NIP + ip);
+        for (int r = 0; r < 6; r++)
+            E[r] *= kGQ;
+
+        // Scaled 2nd Piola-Kirchoff stresses (zero entries in the stiffness matrix are skipped)
+        const auto& D = m_D[m_D_index[ip]];
+        Lanes S[6];
+        for (int r = 0; r < 6; r++) {
+            S[r].setZero();
+            for (int s = 0; s < 6; s++) {
+                if (D(r, s) != 0)
+                    S[r] += D(r, s) * E[s];
+            }
+        }
+
+        // Scaled transpose of the 1st Piola-Kirchoff stresses, projected onto the shape function derivatives
+        for (int c = 0; c < 3; c++) {
+            const Lanes P0 = F[0][c] * S[0] + F[1][c] * S[5] + F[2][c] * S[4];
+            const Lanes P1 = F[0][c] * S[5] + F[1][c] * S[1] + F[2][c] * S[3];
+            const Lanes P2 = F[0][c] * S[4] + F[1][c] * S[3] + F[2][c] * S[2];
+            for (int j = 0; j < NSF; j++) {
+                Q.col(3 * j + c) += m_SD.col(sd_offset + j) * P0 + m_SD.col(sd_offset + NSF + j) * P1 +
+                                    m_SD.col(sd_offset + 2 * NSF + j) * P2;
+            }
+        }
+    }
+
+    // Store the element forces
+    for (unsigned int l = 0; l < num_lanes; l++)
+        m_Fi.row(first + l) = Q.row(l).matrix();
+}
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
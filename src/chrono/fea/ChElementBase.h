@@ -24,6 +24,8 @@
 namespace chrono {
 namespace fea {
 
+class ChElementBatch;
+
 /// @addtogroup fea_elements
 /// @{
 
@@ -143,6 +145,18 @@ class ChApi ChElementBase {
     /// WILL BE DEPRECATED
     virtual void VariablesFbIncrementMq() {}
 
+    /// Create a batch for the evaluation of the internal forces of this element and of other compatible elements.
+    /// Used by ChMesh if element batching is enabled (see ChMesh::SetElementBatching). The default implementation
+    /// returns an empty pointer, indicating that this element type does not support batched evaluation.
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() { return nullptr; }
+
+  protected:
+    /// If true (default), element contributions to global vectors in EleIntLoadResidual_F and
+    /// EleIntLoadResidual_F_gravity must be accumulated with atomic updates, since elements sharing nodes may be
+    /// processed concurrently. ChMesh clears this flag when elements are processed by colors (no two elements with
+    /// the same color share a node), in which case plain updates are safe.
+    bool m_atomic_load = true;
+
   private:
     /// Initial setup (called once before start of simulation).
     /// This is used mostly to precompute matrices that do not change during the simulation, i.e. the local stiffness of
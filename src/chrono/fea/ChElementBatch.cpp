@@ -0,0 +1,43 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include "chrono/fea/ChElementBatch.h"
+#include "chrono/fea/ChElementBase.h"
+
+namespace chrono {
+namespace fea {
+
+bool ChElementBatch::IsUpToDate() const {
+    for (unsigned int i = 0; i < GetNumElements(); i++) {
+        if (!IsCompatible(i))
+            return false;
+    }
+    return true;
+}
+
+void ChElementBatch::LoadElementResidual(ChElementBase& element,
+                                         ChVectorConstRef Fi,
+                                         ChVectorDynamic<>& R,
+                                         double c) {
+    unsigned int stride = 0;
+    for (unsigned int in = 0; in < element.GetNumNodes(); in++) {
+        unsigned int node_dofs = element.GetNodeNumCoordsPosLevelActive(in);
+        if (!element.GetNode(in)->IsFixed())
+            R.segment(element.GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += c * Fi.segment(stride, node_dofs);
+        stride += element.GetNodeNumCoordsPosLevel(in);
+    }
+}
+
+}  // end namespace fea
+}  // end namespace chrono
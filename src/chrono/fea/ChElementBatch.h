@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_ELEMENT_BATCH_H
+#define CH_ELEMENT_BATCH_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+
+namespace chrono {
+namespace fea {
+
+class ChElementBase;
+
+/// @addtogroup fea_elements
+/// @{
+
+/// Base class for batched evaluation of the internal forces of a group of homogeneous elements.
+/// A batch is created by an element through ChElementBase::CreateBatch and collects other compatible elements (same
+/// element type and same formulation settings). Element data is stored in a layout which allows evaluating several
+/// elements simultaneously. See ChMesh::SetElementBatching.
+class ChApi ChElementBatch {
+  public:
+    virtual ~ChElementBatch() {}
+
+    /// Add the specified element to this batch.
+    /// Return false (and do not add the element) if the element is not compatible with this batch.
+    virtual bool AddElement(std::shared_ptr<ChElementBase> element) = 0;
+
+    /// Get the number of elements in this batch.
+    unsigned int GetNumElements() const { return (unsigned int)m_elements.size(); }
+
+    /// Return true if all elements in this batch are still compatible with it.
+    /// Element settings (such as the material or the internal force calculation method) may change after the batch was
+    /// created, in which case the batch must be rebuilt.
+    bool IsUpToDate() const;
+
+    /// Precompute the batch data (called once, after all elements were added).
+    virtual void Setup() = 0;
+
+    /// Compute the internal forces of all elements in this batch and add them, multiplied by a scaling factor c, into
+    /// the global vector R:
+    ///   R += forces * c
+    virtual void EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c, int nthreads) = 0;
+
+  protected:
+    /// Return true if the i-th element of this batch is (still) compatible with this batch.
+    virtual bool IsCompatible(unsigned int i) const = 0;
+
+    /// Add the internal force vector Fi of the specified element, multiplied by c, at the global node offsets.
+    static void LoadElementResidual(ChElementBase& element, ChVectorConstRef Fi, ChVectorDynamic<>& R, double c);
+
+    std::vector<std::shared_ptr<ChElementBase>> m_elements;  ///< elements in this batch
+};
+
+/// @} fea_elements
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -31,7 +31,10 @@
 // with Linear Viscoelastic Materials, Simulation Based Engineering Lab, University of Wisconsin-Madison; 2021.
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementANCFBatch.h"
 #include "chrono/physics/ChSystem.h"
 
 namespace chrono {
@@ -1729,6 +1732,77 @@ void ChElementBeamANCF_3333::ComputeInternalForcesContIntPreInt(ChVectorDynamic<
     Fi = QiReshapedLiu;
 }
 
+// -----------------------------------------------------------------------------
+// Batched evaluation of internal forces
+// -----------------------------------------------------------------------------
+
+// Batch of ANCF 3333 beam elements using the "Continuous Integration" style method and sharing the same material.
+// The Enhanced Continuum Mechanics method is represented by associating the diagonal stiffness matrix D0 with the
+// quadrature points for the terms that do not include the Poisson effect and the 3x3 stiffness matrix Dv (padded with
+// zeros to 6x6) with the quadrature points for the terms that include the Poisson effect.
+class ChElementBeamANCF_3333::Batch
+    : public ChElementANCFBatch<ChElementBeamANCF_3333::NSF, ChElementBeamANCF_3333::NIP> {
+  public:
+    virtual bool AddElement(std::shared_ptr<ChElementBase> element) override {
+        auto beam = std::dynamic_pointer_cast<ChElementBeamANCF_3333>(element);
+        if (!beam || beam->m_method != IntFrcMethod::ContInt)
+            return false;
+        if (m_beams.empty())
+            m_material = beam->m_material;
+        else if (beam->m_material != m_material)
+            return false;
+        m_elements.push_back(element);
+        m_beams.push_back(beam.get());
+        return true;
+    }
+
+  private:
+    virtual bool IsCompatible(unsigned int i) const override {
+        return m_beams[i]->m_method == IntFrcMethod::ContInt && m_beams[i]->m_material == m_material;
+    }
+
+    virtual double GetAlphaDamp(unsigned int i) override {
+        return m_beams[i]->m_damping_enabled ? m_beams[i]->m_Alpha : 0.0;
+    }
+
+    virtual void CalcCombinedCoordMatrix(unsigned int i, MatrixNx6& ebar_ebardot) override {
+        m_beams[i]->CalcCombinedCoordMatrix(ebar_ebardot);
+    }
+
+    virtual void GetPrecomputedData(unsigned int i, ChMatrixDynamic<>& SD, ChVectorDynamic<>& kGQ) override {
+        const auto beam = m_beams[i];
+        for (int ip = 0; ip < NIP_D0; ip++) {
+            for (int k = 0; k < 3; k++)
+                SD.col(3 * ip + k) = beam->m_SD.col(k * NIP_D0 + ip);
+            kGQ(ip) = beam->m_kGQ_D0(ip);
+        }
+        for (int ip = 0; ip < NIP_Dv; ip++) {
+            for (int k = 0; k < 3; k++)
+                SD.col(3 * (NIP_D0 + ip) + k) = beam->m_SD.col(3 * NIP_D0 + k * NIP_Dv + ip);
+            kGQ(NIP_D0 + ip) = beam->m_kGQ_Dv(ip);
+        }
+    }
+
+    virtual void GetMaterialData(std::vector<ChMatrixDynamic<>>& D, std::vector<int>& D_index) override {
+        D.resize(2);
+        D[0].setZero(6, 6);
+        D[0].diagonal() = m_material->Get_D0();
+        D[1].setZero(6, 6);
+        D[1].block(0, 0, 3, 3) = m_material->Get_Dv();
+
+        D_index.resize(NIP);
+        std::fill(D_index.begin(), D_index.begin() + NIP_D0, 0);
+        std::fill(D_index.begin() + NIP_D0, D_index.end(), 1);
+    }
+
+    std::vector<ChElementBeamANCF_3333*> m_beams;    ///< elements in this batch
+    std::shared_ptr<ChMaterialBeamANCF> m_material;  ///< material shared by all elements in this batch
+};
+
+std::shared_ptr<ChElementBatch> ChElementBeamANCF_3333::CreateBatch() {
+    return chrono_types::make_shared<Batch>();
+}
+
 // -----------------------------------------------------------------------------
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
@@ -211,6 +211,10 @@ class ChApi ChElementBeamANCF_3333 : public ChElementANCF,
     /// Compute the generalized force vector due to gravity using the efficient ANCF specific method
     virtual void ComputeGravityForces(ChVectorDynamic<>& Fg, const ChVector3d& G_acc) override;
 
+    /// Create a batch for the evaluation of the internal forces of this element and of other elements of this type
+    /// using the "Continuous Integration" style method and the same material (see ChMesh::SetElementBatching).
+    virtual std::shared_ptr<ChElementBatch> CreateBatch() override;
+
     // Interface to ChElementBeam base class (and similar methods)
     // --------------------------------------
 
@@ -320,6 +324,8 @@ class ChApi ChElementBeamANCF_3333 : public ChElementANCF,
     ChVector3d ComputeTangent(const double xi);
 
   private:
+    class Batch;
+
     /// Initial setup. This is used to precompute matrices that do not change during the simulation, such as the local
     /// stiffness of each element (if any), the mass, etc.
     virtual void SetupInitial(ChSystem* system) override;
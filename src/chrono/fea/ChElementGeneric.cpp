@@ -25,15 +25,20 @@ void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c
     Fi *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// Must use atomic increment when updating the global vector R, unless the owning mesh guarantees that no two
+    //// elements sharing a node are processed concurrently (element coloring).
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
         if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
+            if (m_atomic_load) {
+                for (unsigned int j = 0; j < node_dofs; j++)
 #pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
+                    R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fi(stride + j);
+            } else {
+                R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fi.segment(stride, node_dofs);
+            }
         }
         stride += GetNodeNumCoordsPosLevel(in);
     }
@@ -89,15 +94,20 @@ void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const
     Fg *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// Must use atomic increment when updating the global vector R, unless the owning mesh guarantees that no two
+    //// elements sharing a node are processed concurrently (element coloring).
 
     unsigned int stride = 0;
     for (unsigned int in = 0; in < GetNumNodes(); in++) {
         unsigned int node_dofs = GetNodeNumCoordsPosLevelActive(in);
         if (!GetNode(in)->IsFixed()) {
-            for (unsigned int j = 0; j < node_dofs; j++)
+            if (m_atomic_load) {
+                for (unsigned int j = 0; j < node_dofs; j++)
 #pragma omp atomic
-                R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
+                    R(GetNode(in)->NodeGetOffsetVelLevel() + j) += Fg(stride + j);
+            } else {
+                R.segment(GetNode(in)->NodeGetOffsetVelLevel(), node_dofs) += Fg.segment(stride, node_dofs);
+            }
         }
         stride += GetNodeNumCoordsPosLevel(in);
     }
@@ -35,6 +35,7 @@
 // =============================================================================
 
 #include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChElementANCFBatch.h"
 #include "chrono/physics/ChSystem.h"
 
 namespace chrono {
@@ -1431,6 +1432,63 @@ void ChElementHexaANCF_3843::ComputeInternalForcesContIntPreInt(ChVectorDynamic<
     Fi = QiReshapedLiu;
 }
 
+// -----------------------------------------------------------------------------
+// Batched evaluation of internal forces
+// -----------------------------------------------------------------------------
+
+// Batch of ANCF 3843 brick elements using the "Continuous Integration" style method and sharing the same material.
+class ChElementHexaANCF_3843::Batch
+    : public ChElementANCFBatch<ChElementHexaANCF_3843::NSF, ChElementHexaANCF_3843::NIP> {
+  public:
+    virtual bool AddElement(std::shared_ptr<ChElementBase> element) override {
+        auto brick = std::dynamic_pointer_cast<ChElementHexaANCF_3843>(element);
+        if (!brick || brick->m_method != IntFrcMethod::ContInt)
+            return false;
+        if (m_bricks.empty())
+            m_material = brick->m_material;
+        else if (brick->m_material != m_material)
+            return false;
+        m_elements.push_back(element);
+        m_bricks.push_back(brick.get());
+        return true;
+    }
+
+  private:
+    virtual bool IsCompatible(unsigned int i) const override {
+        return m_bricks[i]->m_method == IntFrcMethod::ContInt && m_bricks[i]->m_material == m_material;
+    }
+
+    virtual double GetAlphaDamp(unsigned int i) override {
+        return m_bricks[i]->m_damping_enabled ? m_bricks[i]->m_Alpha : 0.0;
+    }
+
+    virtual void CalcCombinedCoordMatrix(unsigned int i, MatrixNx6& ebar_ebardot) override {
+        m_bricks[i]->CalcCombinedCoordMatrix(ebar_ebardot);
+    }
+
+    virtual void GetPrecomputedData(unsigned int i, ChMatrixDynamic<>& SD, ChVectorDynamic<>& kGQ) override {
+        const auto brick = m_bricks[i];
+        for (int ip = 0; ip < NIP; ip++) {
+            for (int k = 0; k < 3; k++)
+                SD.col(3 * ip + k) = brick->m_SD.col(k * NIP + ip);
+            kGQ(ip) = brick->m_kGQ(ip);
+        }
+    }
+
+    virtual void GetMaterialData(std::vector<ChMatrixDynamic<>>& D, std::vector<int>& D_index) override {
+        D.resize(1);
+        D[0] = m_material->Get_D();
+        D_index.assign(NIP, 0);
+    }
+
+    std::vector<ChElementHexaANCF_3843*> m_bricks;   ///< elements in this batch
+    std::shared_ptr<ChMaterialHexaANCF> m_material;  ///< material shared by all elements in this batch
+};
+
+std::shared_ptr<ChElementBatch> ChElementHexaANCF_3843::CreateBatch() {
+    return chrono_types::make_shared<Batch>();
+}
+
 // -----------------------------------------------------------------------------
 // Jacobians of internal forces
 // -----------------------------------------------------------------------------
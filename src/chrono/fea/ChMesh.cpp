@@ -16,14 +16,18 @@
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChFrame.h"
 #include "chrono/physics/ChLoad.h"
 #include "chrono/physics/ChObject.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/utils/ChTrace.h"
 
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
@@ -47,6 +51,9 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+
+    m_element_coloring = other.m_element_coloring;
+    m_element_batching = other.m_element_batching;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +74,87 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    // force a re-coloring and re-batching of the mesh elements at the next load of element forces
+    m_element_colors.clear();
+    m_element_batches.clear();
+    m_element_batched.clear();
+}
+
+void ChMesh::SetElementColoring(bool val) {
+    m_element_coloring = val;
+    m_element_colors.clear();
+
+    // elements revert to atomic updates of global vectors; they are switched back when colors are recomputed
+    for (auto& elem : velements)
+        elem->m_atomic_load = true;
+}
+
+void ChMesh::SetElementBatching(bool val) {
+    m_element_batching = val;
+    m_element_batches.clear();
+    m_element_batched.clear();
+}
+
+void ChMesh::BatchElements() {
+    m_element_batches.clear();
+    m_element_batched.assign(velements.size(), false);
+
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        // add to the first compatible existing batch
+        for (auto& batch : m_element_batches) {
+            if (batch->AddElement(velements[ie])) {
+                m_element_batched[ie] = true;
+                break;
+            }
+        }
+        if (m_element_batched[ie])
+            continue;
+
+        // otherwise, start a new batch (if supported by this element type)
+        auto batch = velements[ie]->CreateBatch();
+        if (batch && batch->AddElement(velements[ie])) {
+            m_element_batches.push_back(batch);
+            m_element_batched[ie] = true;
+        }
+    }
+
+    for (auto& batch : m_element_batches)
+        batch->Setup();
+}
+
+void ChMesh::ColorElements() {
+    m_element_colors.clear();
+
+    // colors of the elements already processed, for each node (fixed nodes are included, since they may be released
+    // later without a new call to SetupInitial)
+    std::unordered_map<ChNodeFEAbase*, std::vector<unsigned int>> node_colors;
+
+    // colors unavailable for the current element are marked with the element index
+    std::vector<unsigned int> color_mark;
+
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        auto& elem = velements[ie];
+
+        for (unsigned int in = 0; in < elem->GetNumNodes(); in++) {
+            for (auto color : node_colors[elem->GetNode(in).get()])
+                color_mark[color] = ie;
+        }
+
+        unsigned int color = 0;
+        while (color < color_mark.size() && color_mark[color] == ie)
+            color++;
+        if (color == m_element_colors.size()) {
+            m_element_colors.emplace_back();
+            color_mark.push_back(std::numeric_limits<unsigned int>::max());
+        }
+        m_element_colors[color].push_back(ie);
+
+        for (unsigned int in = 0; in < elem->GetNumNodes(); in++)
+            node_colors[elem->GetNode(in).get()].push_back(color);
+
+        elem->m_atomic_load = false;
+    }
 }
 
 void ChMesh::Relax() {
@@ -106,6 +194,9 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> elem) {
 
 void ChMesh::ClearElements() {
     velements.clear();
+    m_element_colors.clear();
+    m_element_batches.clear();
+    m_element_batched.clear();
     vcontactsurfaces.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
@@ -116,6 +207,9 @@ void ChMesh::ClearElements() {
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    m_element_colors.clear();
+    m_element_batches.clear();
+    m_element_batched.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
 
@@ -279,6 +373,8 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    CH_TRACE("MeshLoads");
+
     // nodes applied forces
     unsigned int local_off_v = 0;
     for (unsigned int j = 0; j < vnodes.size(); j++) {
@@ -290,22 +386,77 @@ void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, con
 
     int nthreads = GetSystem()->nthreads_chrono;
 
+    if (m_element_coloring && m_element_colors.empty())
+        ColorElements();
+
+    // (re)create the element batches if elements were added or removed, or if a batched element is no longer
+    // compatible with its batch (e.g., its material was changed)
+    if (m_element_batching) {
+        bool rebatch = m_element_batched.size() != velements.size();
+        for (const auto& batch : m_element_batches)
+            rebatch = rebatch || !batch->IsUpToDate();
+        if (rebatch)
+            BatchElements();
+    }
+
     // elements internal forces
     timer_internal_forces.start();
-    //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+
+    // batched elements (each batch is evaluated in parallel and loaded sequentially into R)
+    for (auto& batch : m_element_batches)
+        batch->EleIntLoadResidual_F(R, c, nthreads);
+
+    // remaining elements
+    // (each thread traces its share of the loop; 'nowait' so that the zone ends when the thread runs out of work and
+    // not at the implicit barrier of the loop, which is replaced by that of the parallel region)
+    bool batched = !m_element_batches.empty();
+    if (m_element_coloring) {
+        //// PARALLEL FOR over elements of same color, no need to use omp atomic when writing to R
+        for (const auto& color : m_element_colors) {
+#pragma omp parallel num_threads(nthreads)
+            {
+                CH_TRACE("ElementInternalForces");
+#pragma omp for schedule(dynamic, 4) nowait
+                for (int i = 0; i < color.size(); i++) {
+                    if (batched && m_element_batched[color[i]])
+                        continue;
+                    velements[color[i]]->EleIntLoadResidual_F(R, c);
+                }
+            }
+        }
+    } else {
+        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel num_threads(nthreads)
+        {
+            CH_TRACE("ElementInternalForces");
+#pragma omp for schedule(dynamic, 4) nowait
+            for (int ie = 0; ie < velements.size(); ie++) {
+                if (batched && m_element_batched[ie])
+                    continue;
+                velements[ie]->EleIntLoadResidual_F(R, c);
+            }
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+        const ChVector3d& G_acc = GetSystem()->GetGravitationalAcceleration();
+        if (m_element_coloring) {
+            //// PARALLEL FOR over elements of same color, no need to use omp atomic when writing to R
+            for (const auto& color : m_element_colors) {
 #pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->GetGravitationalAcceleration(), c);
+                for (int i = 0; i < color.size(); i++) {
+                    velements[color[i]]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+                }
+            }
+        } else {
+            //// PARALLEL FOR, must use omp atomic to avoid race condition in writing to R
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+            for (int ie = 0; ie < velements.size(); ie++) {
+                velements[ie]->EleIntLoadResidual_F_gravity(R, G_acc, c);
+            }
         }
     }
 
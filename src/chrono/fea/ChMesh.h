@@ -23,6 +23,7 @@
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChElementBatch.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -44,7 +45,9 @@ class ChApi ChMesh : public ChIndexedNodes {
           automatic_gravity_load(true),
           num_points_gravity(1),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          m_element_coloring(false),
+          m_element_batching(false) {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -104,6 +107,34 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Enable/disable element coloring for the parallel evaluation of element forces (default: false).
+    /// If enabled, elements are partitioned in colors such that no two elements with the same color share a node.
+    /// Internal and gravity forces are then evaluated one color at a time, with all elements of a given color processed
+    /// in parallel and loaded into the global residual without atomic updates. This improves the parallel scaling of
+    /// large meshes, at the cost of one synchronization point per color.
+    void SetElementColoring(bool val);
+
+    /// Return true if element coloring is enabled for this mesh.
+    bool GetElementColoring() const { return m_element_coloring; }
+
+    /// Get the number of element colors (0 if element coloring is disabled or was not yet computed).
+    unsigned int GetNumElementColors() const { return (unsigned int)m_element_colors.size(); }
+
+    /// Enable/disable batched evaluation of element internal forces (default: false).
+    /// If enabled, elements of the same type and with the same formulation settings are grouped in batches which are
+    /// evaluated together, several elements at a time, using vectorized operations over the elements of a batch. This
+    /// is supported by the ANCF elements ChElementBeamANCF_3333 and ChElementHexaANCF_3843 using the "Continuous
+    /// Integration" style method; all other elements are evaluated individually. Batches are created at the first
+    /// evaluation of internal forces after the mesh initial setup, using the element matrices precomputed at that time,
+    /// and are rebuilt if the material or the internal force calculation method of a batched element is changed.
+    void SetElementBatching(bool val);
+
+    /// Return true if batched evaluation of element internal forces is enabled for this mesh.
+    bool GetElementBatching() const { return m_element_batching; }
+
+    /// Get the number of element batches (0 if element batching is disabled or batches were not yet created).
+    unsigned int GetNumElementBatches() const { return (unsigned int)m_element_batches.size(); }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -276,6 +307,12 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Partition the mesh elements in colors, using a greedy first-fit coloring of the element-node graph.
+    void ColorElements();
+
+    /// Group the mesh elements which support batched evaluation of internal forces in batches of compatible elements.
+    void BatchElements();
+
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
@@ -293,6 +330,13 @@ class ChApi ChMesh : public ChIndexedNodes {
     unsigned int ncalls_internal_forces;
     unsigned int ncalls_KRMload;
 
+    bool m_element_coloring;                                  ///< process elements by colors
+    std::vector<std::vector<unsigned int>> m_element_colors;  ///< element indices, grouped by color
+
+    bool m_element_batching;                                      ///< evaluate internal forces in element batches
+    std::vector<std::shared_ptr<ChElementBatch>> m_element_batches;  ///< batches of compatible elements
+    std::vector<bool> m_element_batched;                          ///< flags for elements included in a batch
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
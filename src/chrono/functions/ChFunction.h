@@ -32,5 +32,6 @@
 #include "chrono/functions/ChFunctionSequence.h"
 #include "chrono/functions/ChFunctionSetpoint.h"
 #include "chrono/functions/ChFunctionSine.h"
+#include "chrono/functions/ChFunctionTable.h"
 
 #endif
@@ -54,6 +54,7 @@ class ChFunction_Type_enum_mapper : public ChFunction {
     CH_ENUM_VAL(Type::SEQUENCE);
     CH_ENUM_VAL(Type::SINE);
     CH_ENUM_VAL(Type::SINE_STEP);
+    CH_ENUM_VAL(Type::TABLE);
     CH_ENUM_MAPPER_END(Type);
 };
 
@@ -52,7 +52,8 @@ class ChApi ChFunction {
         REPEAT,
         SEQUENCE,
         SINE,
-        SINE_STEP
+        SINE_STEP,
+        TABLE
     };
 
     ChFunction() {}
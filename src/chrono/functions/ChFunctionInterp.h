@@ -60,7 +60,7 @@ class ChApi ChFunctionInterp : public ChFunction {
     }
 
     /// Retrieve the underlying table of points.
-    const std::map<double, double>& GetTable() { return m_table; }
+    const std::map<double, double>& GetTable() const { return m_table; }
 
     /// Return the smallest value of x in the table.
     double GetStart() const { return m_table.begin()->first; }
@@ -74,6 +74,9 @@ class ChApi ChFunctionInterp : public ChFunction {
     /// Second derivative in any case will be computed numerically based on first derivative.
     void SetExtrapolate(bool extrapolate) { m_extrapolate = extrapolate; }
 
+    /// Return true if linear extrapolation is enabled.
+    bool GetExtrapolate() const { return m_extrapolate; }
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOut(ChArchiveOut& archive_out) override;
 
@@ -0,0 +1,220 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+#include "chrono/functions/ChFunctionTable.h"
+
+namespace chrono {
+
+CH_FACTORY_REGISTER(ChFunctionTable)
+
+ChFunctionTable::ChFunctionTable(const std::vector<double>& x, const std::vector<double>& y) {
+    SetPoints(x, y);
+}
+
+ChFunctionTable::ChFunctionTable(const ChFunctionInterp& other) : m_extrapolate(other.GetExtrapolate()) {
+    const auto& table = other.GetTable();
+    m_x.reserve(table.size());
+    m_y.reserve(table.size());
+    for (const auto& point : table) {
+        m_x.push_back(point.first);
+        m_y.push_back(point.second);
+    }
+    UpdateSpacing();
+}
+
+void ChFunctionTable::AddPoint(double x, double y, bool overwrite_if_existing) {
+    auto it = std::lower_bound(m_x.begin(), m_x.end(), x);
+    auto i = std::distance(m_x.begin(), it);
+
+    if (it != m_x.end() && *it == x) {
+        // the point already exists
+        if (overwrite_if_existing) {
+            m_y[i] = y;
+            return;
+        } else {
+            throw std::invalid_argument("Point already exists and overwrite flag was not set.");
+        }
+    }
+
+    m_x.insert(it, x);
+    m_y.insert(m_y.begin() + i, y);
+    UpdateSpacing();
+}
+
+void ChFunctionTable::SetPoints(const std::vector<double>& x, const std::vector<double>& y) {
+    if (x.size() != y.size())
+        throw std::invalid_argument("Different number of x and y values.");
+
+    // Sort the points by x value
+    std::vector<size_t> order(x.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&x](size_t a, size_t b) { return x[a] < x[b]; });
+
+    m_x.resize(x.size());
+    m_y.resize(x.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        m_x[i] = x[order[i]];
+        m_y[i] = y[order[i]];
+        if (i > 0 && m_x[i] == m_x[i - 1])
+            throw std::invalid_argument("Duplicate x values in table.");
+    }
+
+    UpdateSpacing();
+}
+
+void ChFunctionTable::Reset() {
+    m_x.clear();
+    m_y.clear();
+    m_uniform = false;
+    m_inv_dx = 0;
+}
+
+void ChFunctionTable::UpdateSpacing() {
+    m_uniform = false;
+    m_inv_dx = 0;
+
+    size_t n = m_x.size();
+    if (n < 2)
+        return;
+
+    double dx = (m_x[n - 1] - m_x[0]) / (n - 1);
+    double tol = 1e-9 * dx;
+    for (size_t i = 1; i < n - 1; i++) {
+        if (std::abs(m_x[i] - (m_x[0] + i * dx)) > tol)
+            return;
+    }
+
+    m_uniform = true;
+    m_inv_dx = 1 / dx;
+}
+
+size_t ChFunctionTable::FindInterval(double x) const {
+    if (!m_uniform)
+        return std::distance(m_x.begin(), std::upper_bound(m_x.begin(), m_x.end(), x)) - 1;
+
+    // Uniform table: estimate the interval and correct for round-off in the (nearly) uniform spacing
+    size_t last = m_x.size() - 2;
+    size_t i = std::min((size_t)((x - m_x[0]) * m_inv_dx), last);
+    if (x < m_x[i])
+        i--;
+    else if (i < last && x >= m_x[i + 1])
+        i++;
+    return i;
+}
+
+double ChFunctionTable::GetEndSlope(bool left) const {
+    size_t n = m_x.size();
+    if (!m_extrapolate || n < 2)
+        return 0.0;
+    if (left)
+        return (m_y[1] - m_y[0]) / (m_x[1] - m_x[0]);
+    return (m_y[n - 1] - m_y[n - 2]) / (m_x[n - 1] - m_x[n - 2]);
+}
+
+double ChFunctionTable::Eval(double x) const {
+    if (m_x.empty())
+        return 0.0;
+
+    // if the extrapolation is not allowed, the end slopes are zero
+    if (x <= m_x.front())
+        return m_y.front() - GetEndSlope(true) * (m_x.front() - x);
+    if (x >= m_x.back())
+        return m_y.back() + GetEndSlope(false) * (x - m_x.back());
+
+    size_t i = FindInterval(x);
+    return m_y[i] + (m_y[i + 1] - m_y[i]) * (x - m_x[i]) / (m_x[i + 1] - m_x[i]);
+}
+
+double ChFunctionTable::GetVal(double x) const {
+    return Eval(x);
+}
+
+void ChFunctionTable::GetVal(const double* x, double* y, size_t n) const {
+    if (m_x.size() < 2 || !m_uniform) {
+        for (size_t k = 0; k < n; k++)
+            y[k] = Eval(x[k]);
+        return;
+    }
+
+    // Uniform table: clamp each input to the table domain, locate its interval directly, and add the (possibly zero)
+    // extrapolation term. The loop body has no data-dependent branches other than the round-off corrections.
+    size_t last = m_x.size() - 2;
+    double x0 = m_x.front();
+    double x1 = m_x.back();
+    double slope0 = GetEndSlope(true);
+    double slope1 = GetEndSlope(false);
+    for (size_t k = 0; k < n; k++) {
+        double xk = std::min(std::max(x[k], x0), x1);
+        size_t i = std::min((size_t)((xk - x0) * m_inv_dx), last);
+        if (xk < m_x[i])
+            i--;
+        else if (i < last && xk >= m_x[i + 1])
+            i++;
+        double val = m_y[i] + (m_y[i + 1] - m_y[i]) * (xk - m_x[i]) / (m_x[i + 1] - m_x[i]);
+        y[k] = val + slope0 * std::min(x[k] - x0, 0.0) + slope1 * std::max(x[k] - x1, 0.0);
+    }
+}
+
+void ChFunctionTable::GetVal(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const {
+    y.resize(x.size());
+    GetVal(x.data(), y.data(), (size_t)x.size());
+}
+
+double ChFunctionTable::GetDer(double x) const {
+    if (m_x.empty())
+        return 0.0;
+
+    if (x <= m_x.front())
+        return GetEndSlope(true);
+    if (x >= m_x.back())
+        return GetEndSlope(false);
+
+    size_t i = FindInterval(x);
+    return (m_y[i + 1] - m_y[i]) / (m_x[i + 1] - m_x[i]);
+}
+
+double ChFunctionTable::GetDer2(double x) const {
+    return ChFunction::GetDer2(x);
+}
+
+void ChFunctionTable::ArchiveOut(ChArchiveOut& archive_out) {
+    // version number
+    archive_out.VersionWrite<ChFunctionTable>();
+    // serialize parent class
+    ChFunction::ArchiveOut(archive_out);
+    // serialize all member data
+    archive_out << CHNVP(m_x);
+    archive_out << CHNVP(m_y);
+    archive_out << CHNVP(m_extrapolate);
+}
+
+void ChFunctionTable::ArchiveIn(ChArchiveIn& archive_in) {
+    // version number
+    /*int version =*/archive_in.VersionRead<ChFunctionTable>();
+    // deserialize parent class
+    ChFunction::ArchiveIn(archive_in);
+    // stream in all member data
+    archive_in >> CHNVP(m_x);
+    archive_in >> CHNVP(m_y);
+    archive_in >> CHNVP(m_extrapolate);
+
+    UpdateSpacing();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CHFUNCT_TABLE_H
+#define CHFUNCT_TABLE_H
+
+#include <vector>
+
+#include "chrono/core/ChMatrix.h"
+#include "chrono/functions/ChFunctionBase.h"
+#include "chrono/functions/ChFunctionInterp.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_functions
+/// @{
+
+/// Tabulated function:
+///
+/// Linear interpolation `y=f(x)` given a table of points `(x,y)`, stored in contiguous arrays sorted by `x`.
+/// This function produces the same results as ChFunctionInterp, but:
+/// - evaluation does not modify any internal state and can therefore be invoked concurrently from multiple threads;
+/// - the interval containing a given `x` is found in constant time if the table points are uniformly spaced and
+///   with a binary search otherwise;
+/// - a batched evaluation function is provided for evaluating the function at multiple points.
+class ChApi ChFunctionTable : public ChFunction {
+  public:
+    ChFunctionTable() {}
+
+    /// Construct a table from the given sets of `x` and `y` values (see SetPoints).
+    ChFunctionTable(const std::vector<double>& x, const std::vector<double>& y);
+
+    /// Construct a table with the points of the given interpolation function.
+    ChFunctionTable(const ChFunctionInterp& other);
+
+    ~ChFunctionTable() {}
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChFunctionTable* Clone() const override { return new ChFunctionTable(*this); }
+
+    virtual Type GetType() const override { return ChFunction::Type::TABLE; }
+
+    virtual double GetVal(double x) const override;
+    virtual double GetDer(double x) const override;
+    virtual double GetDer2(double x) const override;
+
+    /// Evaluate the function at the \a n values in \a x and load the results in \a y.
+    void GetVal(const double* x, double* y, size_t n) const;
+
+    /// Evaluate the function at the values in \a x and load the results in \a y (resized as needed).
+    void GetVal(const ChVectorDynamic<>& x, ChVectorDynamic<>& y) const;
+
+    /// Add a point to the table.
+    /// By default, adding a point with an \a x value that already exists in the table will lead to an exception.
+    /// If \a overwrite_if_existing is set to \c true, the existing point will be overwritten instead.
+    /// Note that each insertion has linear cost; use SetPoints to load a large table.
+    void AddPoint(double x, double y, bool overwrite_if_existing = false);
+
+    /// Set the table points from the given sets of `x` and `y` values (not necessarily sorted).
+    /// An exception is thrown if the two vectors have different sizes or if \a x contains duplicate values.
+    void SetPoints(const std::vector<double>& x, const std::vector<double>& y);
+
+    /// Remove all points from the table.
+    void Reset();
+
+    /// Get the number of points in the table.
+    size_t GetNumPoints() const { return m_x.size(); }
+
+    /// Get the (sorted) table `x` values.
+    const std::vector<double>& GetTableX() const { return m_x; }
+
+    /// Get the table `y` values.
+    const std::vector<double>& GetTableY() const { return m_y; }
+
+    /// Return true if the table points are uniformly spaced.
+    bool IsUniform() const { return m_uniform; }
+
+    /// Return the smallest value of x in the table.
+    double GetStart() const { return m_x.front(); }
+
+    /// Return the biggest value of x in the table.
+    double GetEnd() const { return m_x.back(); }
+
+    /// Enable linear extrapolation.
+    /// If enabled, the function will return linear extrapolation for \a x values outside the domain.
+    /// while the first derivative will be kept equal to the derivative of the nearest two points.
+    /// Second derivative in any case will be computed numerically based on first derivative.
+    void SetExtrapolate(bool extrapolate) { m_extrapolate = extrapolate; }
+
+    /// Return true if linear extrapolation is enabled.
+    bool GetExtrapolate() const { return m_extrapolate; }
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOut(ChArchiveOut& archive_out) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIn(ChArchiveIn& archive_in) override;
+
+  private:
+    /// Check whether the table points are uniformly spaced.
+    void UpdateSpacing();
+
+    /// Return the index i of the table interval such that x(i) <= x < x(i+1).
+    /// The given value must satisfy x(0) < x < x(n-1).
+    size_t FindInterval(double x) const;
+
+    /// Evaluate the slope used for extrapolation at the left (first interval) or right end (last interval).
+    double GetEndSlope(bool left) const;
+
+    /// Evaluate the function (non-virtual, for use in batched evaluation).
+    double Eval(double x) const;
+
+    std::vector<double> m_x;     ///< sorted x values
+    std::vector<double> m_y;     ///< corresponding y values
+    bool m_extrapolate = false;  ///< enable linear extrapolation for out-of-range values
+    bool m_uniform = false;      ///< true if x values are uniformly spaced
+    double m_inv_dx = 0;         ///< inverse of the spacing of x values (uniform table only)
+};
+
+/// @} chrono_functions
+
+CH_CLASS_VERSION(ChFunctionTable, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -637,6 +637,10 @@ void ChAssembly::Setup() {
     }
 }
 
+int ChAssembly::GetNumThreads() const {
+    return (system && system->parallel_assembly) ? system->nthreads_chrono : 1;
+}
+
 // Update assembly's own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -648,11 +652,16 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->Update(ChTime, update_assets);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->Update(ChTime, update_assets);
     }
     for (auto& mesh : meshlist) {
@@ -663,7 +672,9 @@ void ChAssembly::Update(bool update_assets) {
     }
     // The state of links depends on the bodylist,shaftlist,meshlist,otherphysicslist,
     // thus the update of linklist must be at the end.
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->Update(ChTime, update_assets);
     }
 }
@@ -693,18 +704,28 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
                                 double& T) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -732,14 +753,19 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
         else
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T,
                                    full_update);
@@ -759,7 +785,9 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // must be behind of bodylist,shaftlist,meshlist,otherphysicslist; otherwise, the Update() of ChLink() would
     // use the old (un-updated) status of bodylist,shaftlist,meshlist, resulting in a delay of Update() of ChLink()
     // for one time step, then the simulation might diverge!
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatter(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T, full_update);
         else
@@ -771,16 +799,23 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGatherAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGatherAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGatherAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -796,12 +831,17 @@ void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDel
 // From state derivative (acceleration) to system, sometimes might be needed
 void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatterAcceleration(displ_a + body->GetOffset_w(), a);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatterAcceleration(displ_a + shaft->GetOffset_w(), a);
     }
@@ -812,7 +852,9 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
         if (item->IsActive())
             item->IntStateScatterAcceleration(displ_a + item->GetOffset_w(), a);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatterAcceleration(displ_a + link->GetOffset_w(), a);
     }
@@ -821,16 +863,23 @@ void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChS
 // From system to reaction forces (last computed) - some timestepper might need this
 void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGatherReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGatherReactions(displ_L + shaft->GetOffset_L(), L);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGatherReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -846,12 +895,17 @@ void ChAssembly::IntStateGatherReactions(const unsigned int off_L, ChVectorDynam
 // From reaction forces to system, ex. store last computed reactions in ChLinkBase objects for plotting etc.
 void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateScatterReactions(displ_L + body->GetOffset_L(), L);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateScatterReactions(displ_L + shaft->GetOffset_L(), L);
     }
@@ -863,7 +917,9 @@ void ChAssembly::IntStateScatterReactions(const unsigned int off_L, const ChVect
             item->IntStateScatterReactions(displ_L + item->GetOffset_L(), L);
     }
     // The state scatter of reactions of link depends on Body1 and Body2, thus it must be at the end.
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateScatterReactions(displ_L + link->GetOffset_L(), L);
     }
@@ -876,18 +932,25 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
                                    const ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -909,18 +972,25 @@ void ChAssembly::IntStateGetIncrement(const unsigned int off_x,
                                       ChStateDelta& Dv) {
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntStateGetIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntStateGetIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntStateGetIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -940,12 +1010,17 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
                                    const double c)          ///< a scaling factor
 {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -968,16 +1043,23 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
                                     const double c               ///< a scaling factor
 ) {
     unsigned int displ_v = off - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntLoadResidual_Mv(displ_v + body->GetOffset_w(), R, w, c);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntLoadResidual_Mv(displ_v + shaft->GetOffset_w(), R, w, c);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadResidual_Mv(displ_v + link->GetOffset_w(), R, w, c);
     }
@@ -1049,6 +1131,7 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
                                      double recovery_clamp      ///< value for min/max clamping of c*C
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1058,7 +1141,9 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
         if (shaft->IsActive())
             shaft->IntLoadConstraint_C(displ_L + shaft->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_C(displ_L + link->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
     }
@@ -1076,6 +1161,7 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
                                       const double c             ///< a scaling factor
 ) {
     unsigned int displ_L = off_L - this->offset_L;
+    int nthreads = GetNumThreads();
 
     for (auto& body : bodylist) {
         if (body->IsActive())
@@ -1085,7 +1171,9 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
         if (shaft->IsActive())
             shaft->IntLoadConstraint_Ct(displ_L + shaft->GetOffset_L(), Qc, c);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntLoadConstraint_Ct(displ_L + link->GetOffset_L(), Qc, c);
     }
@@ -1106,18 +1194,25 @@ void ChAssembly::IntToDescriptor(const unsigned int off_v,
                                  const ChVectorDynamic<>& Qc) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntToDescriptor(displ_v + body->GetOffset_w(), v, R, displ_L + body->GetOffset_L(), L, Qc);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntToDescriptor(displ_v + shaft->GetOffset_w(), v, R, displ_L + shaft->GetOffset_L(), L, Qc);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntToDescriptor(displ_v + link->GetOffset_w(), v, R, displ_L + link->GetOffset_L(), L, Qc);
     }
@@ -1138,18 +1233,25 @@ void ChAssembly::IntFromDescriptor(const unsigned int off_v,
                                    ChVectorDynamic<>& L) {
     unsigned int displ_L = off_L - this->offset_L;
     unsigned int displ_v = off_v - this->offset_w;
+    int nthreads = GetNumThreads();
 
-    for (auto& body : bodylist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         if (body->IsActive())
             body->IntFromDescriptor(displ_v + body->GetOffset_w(), v, displ_L + body->GetOffset_L(), L);
     }
 
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         if (shaft->IsActive())
             shaft->IntFromDescriptor(displ_v + shaft->GetOffset_w(), v, displ_L + shaft->GetOffset_L(), L);
     }
 
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         if (link->IsActive())
             link->IntFromDescriptor(displ_v + link->GetOffset_w(), v, displ_L + link->GetOffset_L(), L);
     }
@@ -1185,13 +1287,21 @@ void ChAssembly::InjectVariables(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::VariablesFbReset() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbReset();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbReset();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesFbReset();
     }
     for (auto& mesh : meshlist) {
@@ -1203,13 +1313,21 @@ void ChAssembly::VariablesFbReset() {
 }
 
 void ChAssembly::VariablesFbLoadForces(double factor) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbLoadForces(factor);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbLoadForces(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesFbLoadForces(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1221,13 +1339,21 @@ void ChAssembly::VariablesFbLoadForces(double factor) {
 }
 
 void ChAssembly::VariablesFbIncrementMq() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesFbIncrementMq();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesFbIncrementMq();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesFbIncrementMq();
     }
     for (auto& mesh : meshlist) {
@@ -1239,13 +1365,21 @@ void ChAssembly::VariablesFbIncrementMq() {
 }
 
 void ChAssembly::VariablesQbLoadSpeed() {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbLoadSpeed();
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbLoadSpeed();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesQbLoadSpeed();
     }
     for (auto& mesh : meshlist) {
@@ -1257,13 +1391,21 @@ void ChAssembly::VariablesQbLoadSpeed() {
 }
 
 void ChAssembly::VariablesQbSetSpeed(double step) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbSetSpeed(step);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbSetSpeed(step);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesQbSetSpeed(step);
     }
     for (auto& mesh : meshlist) {
@@ -1275,13 +1417,21 @@ void ChAssembly::VariablesQbSetSpeed(double step) {
 }
 
 void ChAssembly::VariablesQbIncrementPosition(double dt_step) {
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreads();
+
+#pragma omp parallel for num_threads(nthreads)
+    for (int ib = 0; ib < (int)bodylist.size(); ib++) {
+        auto& body = bodylist[ib];
         body->VariablesQbIncrementPosition(dt_step);
     }
-    for (auto& shaft : shaftlist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int is = 0; is < (int)shaftlist.size(); is++) {
+        auto& shaft = shaftlist[is];
         shaft->VariablesQbIncrementPosition(dt_step);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->VariablesQbIncrementPosition(dt_step);
     }
     for (auto& mesh : meshlist) {
@@ -1311,13 +1461,17 @@ void ChAssembly::InjectConstraints(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::ConstraintsBiReset() {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->ConstraintsBiReset();
     }
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsBiReset();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiReset();
     }
     for (auto& mesh : meshlist) {
@@ -1329,13 +1483,17 @@ void ChAssembly::ConstraintsBiReset() {
 }
 
 void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
     }
     for (auto& mesh : meshlist) {
@@ -1347,13 +1505,17 @@ void ChAssembly::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool
 }
 
 void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->ConstraintsBiLoad_Ct(factor);
     }
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsBiLoad_Ct(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_Ct(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1365,13 +1527,17 @@ void ChAssembly::ConstraintsBiLoad_Ct(double factor) {
 }
 
 void ChAssembly::ConstraintsBiLoad_Qc(double factor) {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->ConstraintsBiLoad_Qc(factor);
     }
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsBiLoad_Qc(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsBiLoad_Qc(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1401,13 +1567,17 @@ void ChAssembly::ConstraintsFbLoadForces(double factor) {
 }
 
 void ChAssembly::LoadConstraintJacobians() {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->LoadConstraintJacobians();
     }
     for (auto& shaft : shaftlist) {
         shaft->LoadConstraintJacobians();
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->LoadConstraintJacobians();
     }
     for (auto& mesh : meshlist) {
@@ -1419,13 +1589,17 @@ void ChAssembly::LoadConstraintJacobians() {
 }
 
 void ChAssembly::ConstraintsFetch_react(double factor) {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->ConstraintsFetch_react(factor);
     }
     for (auto& shaft : shaftlist) {
         shaft->ConstraintsFetch_react(factor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->ConstraintsFetch_react(factor);
     }
     for (auto& mesh : meshlist) {
@@ -1455,13 +1629,17 @@ void ChAssembly::InjectKRMMatrices(ChSystemDescriptor& descriptor) {
 }
 
 void ChAssembly::LoadKRMMatrices(double Kfactor, double Rfactor, double Mfactor) {
+    int nthreads = GetNumThreads();
+
     for (auto& body : bodylist) {
         body->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
     for (auto& shaft : shaftlist) {
         shaft->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
-    for (auto& link : linklist) {
+#pragma omp parallel for num_threads(nthreads)
+    for (int il = 0; il < (int)linklist.size(); il++) {
+        auto& link = linklist[il];
         link->LoadKRMMatrices(Kfactor, Rfactor, Mfactor);
     }
     for (auto& mesh : meshlist) {
@@ -323,6 +323,13 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Get the number of threads for the parallel passes over bodies, shafts, and links.
+    /// This is 1 (sequential passes) unless enabled with ChSystem::EnableParallelAssemblyPasses.
+    /// Only passes in which each item writes to its own state, residual, or constraint entries are executed in
+    /// parallel; passes in which items may write to other items' entries (e.g., link forces applied to bodies) and
+    /// passes that must preserve the item order (e.g., descriptor injection) are always sequential.
+    int GetNumThreads() const;
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
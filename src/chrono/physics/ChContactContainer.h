@@ -22,6 +22,7 @@
 
 #include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/physics/ChBody.h"
@@ -60,6 +61,15 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) = 0;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container.
+    /// The collision info objects are assumed to contain valid pointers to the colliding shapes. Contacts are added in
+    /// the order in which they appear in the given list. The default implementation calls AddContact for each of them;
+    /// derived classes may override this to process the batch in parallel.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) {
+        for (const auto& cinfo : cinfos)
+            AddContact(cinfo);
+    }
+
     /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
     /// similar).
     virtual void EndAddContact() {}
@@ -141,14 +151,14 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     ReportContactCallback* report_contact_callback;
 
     /// Utility function to accumulate contact forces from a specified list of contacts.
-    /// This function is templated by the contact type (assumed to be derived from ChContactTuple).
+    /// This function is templated by the contact list type, which must provide iterators dereferencing to pointers to
+    /// contacts (assumed to be derived from ChContactTuple), such as std::list<Tcont*> or ChContactPool<Tcont>.
     /// Contact forces are accumulated in a map keyed by the contactable objects.
     /// Derived ChContactContainer classes can use this utility (processing their various lists
     /// of contacts) to cache information used for reporting through GetContactableForce and
     /// GetContactableTorque.
-    template <class Tcont>
-    void SumAllContactForces(std::list<Tcont*>& contactlist,
-                             std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
+    template <class Tlist>
+    void SumAllContactForces(Tlist& contactlist, std::unordered_map<ChContactable*, ForceTorque>& contactforces) {
         for (auto contact = contactlist.begin(); contact != contactlist.end(); ++contact) {
             // Extract information for current contact (expressed in global frame)
             ChMatrix33<> A = (*contact)->GetContactPlane();
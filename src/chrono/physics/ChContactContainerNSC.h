@@ -78,6 +78,13 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container.
+    /// The composite materials are created in parallel (using the number of Chrono threads set for the containing
+    /// system), calling the system's material composition strategy concurrently; a custom strategy must therefore be
+    /// thread-safe. The AddContactCallback (if any) is then invoked and the contacts are inserted sequentially, in the
+    /// given order, so that the result is identical to adding the contacts one at a time.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
     /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
     virtual void EndAddContact() override;
@@ -222,11 +229,15 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
-  private:
-    void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
+    /// Create a contact of the appropriate type for the given collision pair and composite material.
+    virtual void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat);
 
+  private:
     double min_bounce_speed;  ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
 
+    std::vector<ChContactMaterialCompositeNSC> batch_materials;  ///< composite materials for a batch of contacts
+    std::vector<char> batch_valid;                               ///< flags for contacts to be added from a batch
+
     friend class ChSystemNSC;
 };
 
@@ -0,0 +1,626 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include "chrono/physics/ChContactContainerPooledNSC.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChContactContainerPooledNSC)
+
+ChContactContainerPooledNSC::ChContactContainerPooledNSC(const ChContactContainerPooledNSC& other)
+    : ChContactContainerNSC(other) {}
+
+ChContactContainerPooledNSC::~ChContactContainerPooledNSC() {
+    RemoveAllContacts();
+}
+
+template <class Tcont>
+void _RemoveAllContacts(ChContactPool<Tcont>& contactpool, int& n_added) {
+    contactpool.Clear();
+    n_added = 0;
+}
+
+void ChContactContainerPooledNSC::RemoveAllContacts() {
+    _RemoveAllContacts(contactpool_6_6, n_added_6_6);
+    _RemoveAllContacts(contactpool_6_3, n_added_6_3);
+    _RemoveAllContacts(contactpool_3_3, n_added_3_3);
+    _RemoveAllContacts(contactpool_333_3, n_added_333_3);
+    _RemoveAllContacts(contactpool_333_6, n_added_333_6);
+    _RemoveAllContacts(contactpool_333_333, n_added_333_333);
+    _RemoveAllContacts(contactpool_666_3, n_added_666_3);
+    _RemoveAllContacts(contactpool_666_6, n_added_666_6);
+    _RemoveAllContacts(contactpool_666_333, n_added_666_333);
+    _RemoveAllContacts(contactpool_666_666, n_added_666_666);
+    _RemoveAllContacts(contactpool_6_6_rolling, n_added_6_6_rolling);
+}
+
+void ChContactContainerPooledNSC::BeginAddContact() {
+    contactpool_6_6.Rewind();
+    n_added_6_6 = 0;
+
+    contactpool_6_3.Rewind();
+    n_added_6_3 = 0;
+
+    contactpool_3_3.Rewind();
+    n_added_3_3 = 0;
+
+    contactpool_333_3.Rewind();
+    n_added_333_3 = 0;
+
+    contactpool_333_6.Rewind();
+    n_added_333_6 = 0;
+
+    contactpool_333_333.Rewind();
+    n_added_333_333 = 0;
+
+    contactpool_666_3.Rewind();
+    n_added_666_3 = 0;
+
+    contactpool_666_6.Rewind();
+    n_added_666_6 = 0;
+
+    contactpool_666_333.Rewind();
+    n_added_666_333 = 0;
+
+    contactpool_666_666.Rewind();
+    n_added_666_666 = 0;
+
+    contactpool_6_6_rolling.Rewind();
+    n_added_6_6_rolling = 0;
+}
+
+template <class Tcont, class Ta, class Tb>
+void _OptimalContactInsert(ChContactPool<Tcont>& contactpool,         // contact pool
+                           int& n_added,                              // number of contacts inserted
+                           ChContactContainerNSC* container,          // contact container
+                           Ta* objA,                                  // collidable object A
+                           Tb* objB,                                  // collidable object B
+                           const ChCollisionInfo& cinfo,              // collision information
+                           const ChContactMaterialCompositeNSC& cmat  // composite material
+) {
+    if (Tcont* contact = contactpool.Reuse()) {
+        // reuse old contact
+        contact->Reset(objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
+    } else {
+        // construct new contact in the pool
+        contactpool.Emplace(container, objA, objB, cinfo, cmat, container->GetMinBounceSpeed());
+    }
+    n_added++;
+}
+
+void ChContactContainerPooledNSC::InsertContact(const ChCollisionInfo& cinfo,
+                                                const ChContactMaterialCompositeNSC& cmat) {
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    // CREATE THE CONTACTS
+    //
+    // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
+    // or 6 vs 3, etc.
+    // These cases are made distinct to exploit the optimization coming from templates and static data sizes
+    // in contact types.
+    //
+    // Notes:
+    // 1. this was formerly implemented using dynamic casting and introduced a performance bottleneck.
+    // 2. use a switch only for the outer level (nested switch negatively affects performance)
+
+    switch (contactableA->GetContactableType()) {
+        case ChContactable::CONTACTABLE_3: {
+            auto objA = static_cast<ChContactable_1vars<3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 3_3
+                _OptimalContactInsert(contactpool_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 3_6 -> 6_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 3_333 -> 333_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 3_666 -> 666_3
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_6: {
+            auto objA = static_cast<ChContactable_1vars<6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 6_3
+                _OptimalContactInsert(contactpool_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 6_6    ***NOTE: for body-body one could have rolling friction: ***
+                if (cmat.rolling_friction || cmat.spinning_friction) {
+                    _OptimalContactInsert(contactpool_6_6_rolling, n_added_6_6_rolling, this, objA, objB, cinfo, cmat);
+                } else {
+                    _OptimalContactInsert(contactpool_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                }
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 6_333 -> 333_6
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 6_666 -> 666_6
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_333: {
+            auto objA = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 333_3
+                _OptimalContactInsert(contactpool_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 333_6
+                _OptimalContactInsert(contactpool_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 333_333
+                _OptimalContactInsert(contactpool_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 333_666 -> 666_333
+                ChCollisionInfo swapped_cinfo(cinfo, true);
+                _OptimalContactInsert(contactpool_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_666: {
+            auto objA = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 666_3
+                _OptimalContactInsert(contactpool_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 666_6
+                _OptimalContactInsert(contactpool_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 666_333
+                _OptimalContactInsert(contactpool_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 666_666
+                _OptimalContactInsert(contactpool_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+            }
+        } break;
+
+        default: {
+            // No contact pool for this pair of contactable types: the contact is ignored, as in ChContactContainerNSC
+        } break;
+
+    }  // switch (contactableA->GetContactableType())
+}
+
+void ChContactContainerPooledNSC::ComputeContactForces() {
+    contact_forces.clear();
+    SumAllContactForces(contactpool_3_3, contact_forces);
+    SumAllContactForces(contactpool_6_3, contact_forces);
+    SumAllContactForces(contactpool_6_6, contact_forces);
+    SumAllContactForces(contactpool_333_3, contact_forces);
+    SumAllContactForces(contactpool_333_6, contact_forces);
+    SumAllContactForces(contactpool_333_333, contact_forces);
+    SumAllContactForces(contactpool_666_3, contact_forces);
+    SumAllContactForces(contactpool_666_6, contact_forces);
+    SumAllContactForces(contactpool_666_333, contact_forces);
+    SumAllContactForces(contactpool_666_666, contact_forces);
+    SumAllContactForces(contactpool_6_6_rolling, contact_forces);
+}
+
+template <class Tcont>
+void _ReportAllContacts(ChContactPool<Tcont>& contactpool, ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        bool proceed = mcallback->OnReportContact(
+            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
+            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
+            (*itercontact)->GetContactForce(), VNULL, (*itercontact)->GetObjA(), (*itercontact)->GetObjB());
+        if (!proceed)
+            break;
+        ++itercontact;
+    }
+}
+
+template <class Tcont>
+void _ReportAllContactsRolling(ChContactPool<Tcont>& contactpool,
+                               ChContactContainer::ReportContactCallback* mcallback) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        bool proceed = mcallback->OnReportContact(
+            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
+            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
+            (*itercontact)->GetContactForce(), (*itercontact)->GetContactTorque(), (*itercontact)->GetObjA(),
+            (*itercontact)->GetObjB());
+        if (!proceed)
+            break;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) {
+    _ReportAllContacts(contactpool_6_6, callback.get());
+    _ReportAllContacts(contactpool_6_3, callback.get());
+    _ReportAllContacts(contactpool_3_3, callback.get());
+    _ReportAllContacts(contactpool_333_3, callback.get());
+    _ReportAllContacts(contactpool_333_6, callback.get());
+    _ReportAllContacts(contactpool_333_333, callback.get());
+    _ReportAllContacts(contactpool_666_3, callback.get());
+    _ReportAllContacts(contactpool_666_6, callback.get());
+    _ReportAllContacts(contactpool_666_333, callback.get());
+    _ReportAllContacts(contactpool_666_666, callback.get());
+    _ReportAllContactsRolling(contactpool_6_6_rolling, callback.get());
+}
+
+template <class Tcont>
+void _ReportAllContactsNSC(ChContactPool<Tcont>& contactpool,
+                           ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        bool proceed = mcallback->OnReportContact(
+            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
+            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
+            (*itercontact)->GetContactForce(), VNULL, (*itercontact)->GetObjA(), (*itercontact)->GetObjB(),
+            (*itercontact)->GetConstraintNx()->GetOffset());
+        if (!proceed)
+            break;
+        ++itercontact;
+    }
+}
+
+template <class Tcont>
+void _ReportAllContactsRollingNSC(ChContactPool<Tcont>& contactpool,
+                                  ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        bool proceed = mcallback->OnReportContact(
+            (*itercontact)->GetContactP1(), (*itercontact)->GetContactP2(), (*itercontact)->GetContactPlane(),
+            (*itercontact)->GetContactDistance(), (*itercontact)->GetEffectiveCurvatureRadius(),
+            (*itercontact)->GetContactForce(), (*itercontact)->GetContactTorque(), (*itercontact)->GetObjA(),
+            (*itercontact)->GetObjB(), (*itercontact)->GetConstraintNx()->GetOffset());
+        if (!proceed)
+            break;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) {
+    _ReportAllContactsNSC(contactpool_6_6, callback.get());
+    _ReportAllContactsNSC(contactpool_6_3, callback.get());
+    _ReportAllContactsNSC(contactpool_3_3, callback.get());
+    _ReportAllContactsNSC(contactpool_333_3, callback.get());
+    _ReportAllContactsNSC(contactpool_333_6, callback.get());
+    _ReportAllContactsNSC(contactpool_333_333, callback.get());
+    _ReportAllContactsNSC(contactpool_666_3, callback.get());
+    _ReportAllContactsNSC(contactpool_666_6, callback.get());
+    _ReportAllContactsNSC(contactpool_666_333, callback.get());
+    _ReportAllContactsNSC(contactpool_666_666, callback.get());
+    _ReportAllContactsRollingNSC(contactpool_6_6_rolling, callback.get());
+}
+
+////////// STATE INTERFACE ////
+
+template <class Tcont>
+void _IntStateGatherReactions(unsigned int& coffset,
+                              ChContactPool<Tcont>& contactpool,
+                              const unsigned int off_L,
+                              ChVectorDynamic<>& L,
+                              const int stride) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntStateGatherReactions(off_L + coffset, L);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntStateGatherReactions(coffset, contactpool_6_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_6_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_3_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_333_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_333_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_333_333, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_666_3, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_666_6, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_666_333, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_666_666, off_L, L, 3);
+    _IntStateGatherReactions(coffset, contactpool_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _IntStateScatterReactions(unsigned int& coffset,
+                               ChContactPool<Tcont>& contactpool,
+                               const unsigned int off_L,
+                               const ChVectorDynamic<>& L,
+                               const int stride) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntStateScatterReactions(off_L + coffset, L);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntStateScatterReactions(coffset, contactpool_6_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_6_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_3_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_333_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_333_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_333_333, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_666_3, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_666_6, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_666_333, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_666_666, off_L, L, 3);
+    _IntStateScatterReactions(coffset, contactpool_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _IntLoadResidual_CqL(unsigned int& coffset,              // offset of the contacts
+                          ChContactPool<Tcont>& contactpool,  // pool of contacts
+                          const unsigned int off_L,           // offset in L multipliers
+                          ChVectorDynamic<>& R,               // result: the R residual, R += c*Cq'*L
+                          const ChVectorDynamic<>& L,         // the L vector
+                          const double c,                     // a scaling factor
+                          const int stride                    // stride
+) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntLoadResidual_CqL(const unsigned int off_L,
+                                                ChVectorDynamic<>& R,
+                                                const ChVectorDynamic<>& L,
+                                                const double c) {
+    unsigned int coffset = 0;
+    _IntLoadResidual_CqL(coffset, contactpool_6_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_6_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_3_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_333_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_333_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_333_333, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_666_3, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_666_6, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_666_333, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_666_666, off_L, R, L, c, 3);
+    _IntLoadResidual_CqL(coffset, contactpool_6_6_rolling, off_L, R, L, c, 6);
+}
+
+template <class Tcont>
+void _IntLoadConstraint_C(unsigned int& coffset,              // contact offset
+                          ChContactPool<Tcont>& contactpool,  // contact pool
+                          const unsigned int off,             // offset in Qc residual
+                          ChVectorDynamic<>& Qc,              // result: the Qc residual, Qc += c*C
+                          const double c,                     // a scaling factor
+                          bool do_clamp,                      // apply clamping to c*C?
+                          double recovery_clamp,              // value for min/max clamping of c*C
+                          const int stride                    // stride
+) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntLoadConstraint_C(const unsigned int off,
+                                                ChVectorDynamic<>& Qc,
+                                                const double c,
+                                                bool do_clamp,
+                                                double recovery_clamp) {
+    unsigned int coffset = 0;
+    _IntLoadConstraint_C(coffset, contactpool_6_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_6_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_3_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_333_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_333_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_333_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_666_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_666_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_666_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_666_666, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _IntLoadConstraint_C(coffset, contactpool_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6);
+}
+
+template <class Tcont>
+void _IntToDescriptor(unsigned int& coffset,
+                      ChContactPool<Tcont>& contactpool,
+                      const unsigned int off_v,
+                      const ChStateDelta& v,
+                      const ChVectorDynamic<>& R,
+                      const unsigned int off_L,
+                      const ChVectorDynamic<>& L,
+                      const ChVectorDynamic<>& Qc,
+                      const int stride) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntToDescriptor(off_L + coffset, L, Qc);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntToDescriptor(const unsigned int off_v,
+                                            const ChStateDelta& v,
+                                            const ChVectorDynamic<>& R,
+                                            const unsigned int off_L,
+                                            const ChVectorDynamic<>& L,
+                                            const ChVectorDynamic<>& Qc) {
+    unsigned int coffset = 0;
+    _IntToDescriptor(coffset, contactpool_6_6, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_6_3, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_3_3, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_333_3, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_333_6, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_333_333, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_666_3, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_666_6, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_666_333, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_666_666, off_v, v, R, off_L, L, Qc, 3);
+    _IntToDescriptor(coffset, contactpool_6_6_rolling, off_v, v, R, off_L, L, Qc, 6);
+}
+
+template <class Tcont>
+void _IntFromDescriptor(unsigned int& coffset,
+                        ChContactPool<Tcont>& contactpool,
+                        const unsigned int off_v,
+                        ChStateDelta& v,
+                        const unsigned int off_L,
+                        ChVectorDynamic<>& L,
+                        const int stride) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ContIntFromDescriptor(off_L + coffset, L);
+        coffset += stride;
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::IntFromDescriptor(const unsigned int off_v,
+                                              ChStateDelta& v,
+                                              const unsigned int off_L,
+                                              ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _IntFromDescriptor(coffset, contactpool_6_6, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_6_3, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_3_3, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_333_3, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_333_6, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_333_333, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_666_3, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_666_6, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_666_333, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_666_666, off_v, v, off_L, L, 3);
+    _IntFromDescriptor(coffset, contactpool_6_6_rolling, off_v, v, off_L, L, 6);
+}
+
+// SOLVER INTERFACES
+
+template <class Tcont>
+void _InjectConstraints(ChContactPool<Tcont>& contactpool, ChSystemDescriptor& descriptor) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->InjectConstraints(descriptor);
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::InjectConstraints(ChSystemDescriptor& descriptor) {
+    _InjectConstraints(contactpool_6_6, descriptor);
+    _InjectConstraints(contactpool_6_3, descriptor);
+    _InjectConstraints(contactpool_3_3, descriptor);
+    _InjectConstraints(contactpool_333_3, descriptor);
+    _InjectConstraints(contactpool_333_6, descriptor);
+    _InjectConstraints(contactpool_333_333, descriptor);
+    _InjectConstraints(contactpool_666_3, descriptor);
+    _InjectConstraints(contactpool_666_6, descriptor);
+    _InjectConstraints(contactpool_666_333, descriptor);
+    _InjectConstraints(contactpool_666_666, descriptor);
+    _InjectConstraints(contactpool_6_6_rolling, descriptor);
+}
+
+template <class Tcont>
+void _ConstraintsBiReset(ChContactPool<Tcont>& contactpool) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ConstraintsBiReset();
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::ConstraintsBiReset() {
+    _ConstraintsBiReset(contactpool_6_6);
+    _ConstraintsBiReset(contactpool_6_3);
+    _ConstraintsBiReset(contactpool_3_3);
+    _ConstraintsBiReset(contactpool_333_3);
+    _ConstraintsBiReset(contactpool_333_6);
+    _ConstraintsBiReset(contactpool_333_333);
+    _ConstraintsBiReset(contactpool_666_3);
+    _ConstraintsBiReset(contactpool_666_6);
+    _ConstraintsBiReset(contactpool_666_333);
+    _ConstraintsBiReset(contactpool_666_666);
+    _ConstraintsBiReset(contactpool_6_6_rolling);
+}
+
+template <class Tcont>
+void _ConstraintsBiLoad_C(ChContactPool<Tcont>& contactpool, double factor, double recovery_clamp, bool do_clamp) {
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    _ConstraintsBiLoad_C(contactpool_6_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_6_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_3_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_333_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_333_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_333_333, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_666_3, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_666_6, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_666_333, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_666_666, factor, recovery_clamp, do_clamp);
+    _ConstraintsBiLoad_C(contactpool_6_6_rolling, factor, recovery_clamp, do_clamp);
+}
+
+template <class Tcont>
+void _ConstraintsFetch_react(ChContactPool<Tcont>& contactpool, double factor) {
+    // From constraints to react vector:
+    auto itercontact = contactpool.begin();
+    while (itercontact != contactpool.end()) {
+        (*itercontact)->ConstraintsFetch_react(factor);
+        ++itercontact;
+    }
+}
+
+void ChContactContainerPooledNSC::ConstraintsFetch_react(double factor) {
+    _ConstraintsFetch_react(contactpool_6_6, factor);
+    _ConstraintsFetch_react(contactpool_6_3, factor);
+    _ConstraintsFetch_react(contactpool_3_3, factor);
+    _ConstraintsFetch_react(contactpool_333_3, factor);
+    _ConstraintsFetch_react(contactpool_333_6, factor);
+    _ConstraintsFetch_react(contactpool_333_333, factor);
+    _ConstraintsFetch_react(contactpool_666_3, factor);
+    _ConstraintsFetch_react(contactpool_666_6, factor);
+    _ConstraintsFetch_react(contactpool_666_333, factor);
+    _ConstraintsFetch_react(contactpool_666_666, factor);
+    _ConstraintsFetch_react(contactpool_6_6_rolling, factor);
+}
+
+}  // end namespace chrono
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_CONTACTCONTAINER_POOLED_NSC_H
+#define CH_CONTACTCONTAINER_POOLED_NSC_H
+
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChContactPool.h"
+
+namespace chrono {
+
+/// Class representing a container of many non-smooth contacts, with pooled contact storage.
+/// This is a drop-in replacement for ChContactContainerNSC which stores the contacts of each type contiguously (in
+/// chunks of a ChContactPool) rather than as individually heap-allocated objects in linked lists. Contact objects are
+/// reused from one collision detection pass to the next and never relocated, so that all passes over the contacts
+/// (constraint loading, descriptor injection, reaction fetching, reporting) traverse memory sequentially.
+/// This is beneficial for scenes with a large number of contacts (e.g., granular material).
+/// To use it, set it as the contact container of a ChSystemNSC with ChSystem::SetContactContainer().
+class ChApi ChContactContainerPooledNSC : public ChContactContainerNSC {
+  public:
+    ChContactContainerPooledNSC() {}
+    ChContactContainerPooledNSC(const ChContactContainerPooledNSC& other);
+    virtual ~ChContactContainerPooledNSC();
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChContactContainerPooledNSC* Clone() const override { return new ChContactContainerPooledNSC(*this); }
+
+    /// Remove (delete) all contained contact data.
+    virtual void RemoveAllContacts() override;
+
+    /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
+    /// similar). This implementation rewinds all contact pools, so that previous contact objects are reused.
+    virtual void BeginAddContact() override;
+
+    /// The collision system will call EndAddContact() after adding all contacts (for example with AddContact() or
+    /// similar). Unused contact objects are kept in the pools for later reuse.
+    virtual void EndAddContact() override {}
+
+    /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
+
+    /// Scan all the NSC contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) override;
+
+    /// Compute contact forces on all contactable objects in this container.
+    /// This function caches contact forces in a map.
+    virtual void ComputeContactForces() override;
+
+    // STATE FUNCTIONS
+
+    virtual void IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) override;
+    virtual void IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) override;
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override;
+    virtual void IntLoadConstraint_C(const unsigned int off,
+                                     ChVectorDynamic<>& Qc,
+                                     const double c,
+                                     bool do_clamp,
+                                     double recovery_clamp) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    // SOLVER INTERFACE
+
+    virtual void InjectConstraints(ChSystemDescriptor& descriptor) override;
+    virtual void ConstraintsBiReset() override;
+    virtual void ConstraintsBiLoad_C(double factor = 1, double recovery_clamp = 0.1, bool do_clamp = false) override;
+    virtual void ConstraintsFetch_react(double factor = 1) override;
+
+  protected:
+    /// Create a contact of the appropriate type for the given collision pair and composite material.
+    virtual void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeNSC& cmat) override;
+
+    ChContactPool<ChContactNSC_6_6> contactpool_6_6;
+    ChContactPool<ChContactNSC_6_3> contactpool_6_3;
+    ChContactPool<ChContactNSC_3_3> contactpool_3_3;
+    ChContactPool<ChContactNSC_333_3> contactpool_333_3;
+    ChContactPool<ChContactNSC_333_6> contactpool_333_6;
+    ChContactPool<ChContactNSC_333_333> contactpool_333_333;
+    ChContactPool<ChContactNSC_666_3> contactpool_666_3;
+    ChContactPool<ChContactNSC_666_6> contactpool_666_6;
+    ChContactPool<ChContactNSC_666_333> contactpool_666_333;
+    ChContactPool<ChContactNSC_666_666> contactpool_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> contactpool_6_6_rolling;
+};
+
+CH_CLASS_VERSION(ChContactContainerPooledNSC, 0)
+
+}  // end namespace chrono
+
+#endif
@@ -252,6 +252,44 @@ void ChContactContainerSMC::AddContact(const ChCollisionInfo& cinfo) {
     InsertContact(cinfo, cmat);
 }
 
+void ChContactContainerSMC::AddContacts(const std::vector<ChCollisionInfo>& cinfos) {
+    int num_contacts = (int)cinfos.size();
+    batch_materials.resize(num_contacts);
+    batch_valid.resize(num_contacts);
+
+    auto strategy = GetSystem()->composition_strategy.get();
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+
+    // Filter the contacts and create the composite materials
+#pragma omp parallel for num_threads(nthreads)
+    for (int i = 0; i < num_contacts; i++) {
+        const auto& cinfo = cinfos[i];
+        assert(cinfo.modelA->GetContactable());
+        assert(cinfo.modelB->GetContactable());
+
+        batch_valid[i] = cinfo.distance < 0 &&
+                         (cinfo.modelA->GetContactable()->IsContactActive() ||
+                          cinfo.modelB->GetContactable()->IsContactActive()) &&
+                         cinfo.shapeA->GetContactMethod() == ChContactMethod::SMC &&
+                         cinfo.shapeB->GetContactMethod() == ChContactMethod::SMC;
+        if (batch_valid[i]) {
+            batch_materials[i] = ChContactMaterialCompositeSMC(
+                strategy, std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeA->GetMaterial()),
+                std::static_pointer_cast<ChContactMaterialSMC>(cinfo.shapeB->GetMaterial()));
+        }
+    }
+
+    // Invoke the user-provided callback (if any) and insert the contacts in order
+    auto callback = GetAddContactCallback();
+    for (int i = 0; i < num_contacts; i++) {
+        if (!batch_valid[i])
+            continue;
+        if (callback)
+            callback->OnAddContact(cinfos[i], &batch_materials[i]);
+        InsertContact(cinfos[i], batch_materials[i]);
+    }
+}
+
 void ChContactContainerSMC::InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat) {
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
@@ -111,6 +111,13 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// A composite contact material is created from their material properties.
     virtual void AddContact(const ChCollisionInfo& cinfo) override;
 
+    /// Add a batch of contacts between collision shapes, storing them into this container.
+    /// The composite materials are created in parallel (using the number of Chrono threads set for the containing
+    /// system), calling the system's material composition strategy concurrently; a custom strategy must therefore be
+    /// thread-safe. The AddContactCallback (if any) is then invoked and the contacts are inserted sequentially, in the
+    /// given order, so that the result is identical to adding the contacts one at a time.
+    virtual void AddContacts(const std::vector<ChCollisionInfo>& cinfos) override;
+
     /// The collision system will call BeginAddContact() after adding all contacts (for example with AddContact() or
     /// similar). This optimized version purges the end of the list of contacts that were not reused (if any).
     virtual void EndAddContact() override;
@@ -153,6 +160,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
   private:
     void InsertContact(const ChCollisionInfo& cinfo, const ChContactMaterialCompositeSMC& cmat);
+
+    std::vector<ChContactMaterialCompositeSMC> batch_materials;  ///< composite materials for a batch of contacts
+    std::vector<char> batch_valid;                               ///< flags for contacts to be added from a batch
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
@@ -154,6 +154,9 @@ CH_CLASS_VERSION(ChContactMaterialComposite, 0)
 /// Implements the default combination laws for coefficients of friction, cohesion, compliance, etc.
 /// Derived classes can override one or more of these combination laws.
 /// Enabling the use of a customized composition strategy is system type-dependent.
+/// The combination functions may be called concurrently from multiple threads (the NSC and SMC contact containers
+/// create the composite materials of new contacts in parallel), so they must be thread-safe: a derived class must not
+/// modify shared state in these functions without proper synchronization.
 class ChApi ChContactMaterialCompositionStrategy {
   public:
     virtual ~ChContactMaterialCompositionStrategy() {}
@@ -0,0 +1,127 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cassert>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+
+/// Pool of contact objects of a given type, stored contiguously in fixed-size chunks.
+/// Contact objects are constructed in place and never relocated (the solver constraints they own are referenced by
+/// address from the system descriptor). At each collision detection pass, the pool is rewound and previously
+/// constructed objects are reused, in order, before any new object is constructed. Inactive objects at the end of the
+/// pool are kept for later reuse and only destroyed by Clear().
+/// Iteration visits the active contacts in insertion order, with the iterator dereferencing to a pointer to contact,
+/// so that a pool can be traversed exactly like a list of contact pointers.
+template <class Tcont, unsigned int ChunkBits = 8>
+class ChContactPool {
+  public:
+    static constexpr unsigned int ChunkSize = 1u << ChunkBits;
+
+    ChContactPool() : m_num_active(0), m_num_constructed(0) {}
+    ~ChContactPool() { Clear(); }
+
+    ChContactPool(const ChContactPool&) = delete;
+    ChContactPool& operator=(const ChContactPool&) = delete;
+
+    /// Return the number of active contacts.
+    size_t size() const { return m_num_active; }
+
+    /// Return true if there are no active contacts.
+    bool empty() const { return m_num_active == 0; }
+
+    /// Return the number of constructed contact objects (active and inactive).
+    size_t capacity() const { return m_num_constructed; }
+
+    /// Access the i-th active contact.
+    Tcont* operator[](size_t i) const {
+        assert(i < m_num_active);
+        return slot(i);
+    }
+
+    /// Mark all contacts as inactive. Contact objects are kept for reuse.
+    void Rewind() { m_num_active = 0; }
+
+    /// Activate and return the next previously constructed contact, or nullptr if there is none.
+    /// The caller is responsible for reinitializing the returned contact.
+    Tcont* Reuse() {
+        if (m_num_active == m_num_constructed)
+            return nullptr;
+        return slot(m_num_active++);
+    }
+
+    /// Construct a new active contact at the end of the pool, forwarding the provided arguments to its constructor.
+    /// This should only be called after Reuse() returned nullptr.
+    template <typename... Args>
+    Tcont* Emplace(Args&&... args) {
+        assert(m_num_active == m_num_constructed);
+        if (m_num_constructed == m_chunks.size() * ChunkSize)
+            m_chunks.emplace_back(new Storage[ChunkSize]);
+        Tcont* contact = new (slot(m_num_constructed)) Tcont(std::forward<Args>(args)...);
+        m_num_constructed++;
+        m_num_active++;
+        return contact;
+    }
+
+    /// Destroy all contact objects and release the pool memory.
+    void Clear() {
+        for (size_t i = 0; i < m_num_constructed; i++)
+            slot(i)->~Tcont();
+        m_chunks.clear();
+        m_num_active = 0;
+        m_num_constructed = 0;
+    }
+
+    /// Forward iterator over the active contacts (dereferences to a pointer to contact).
+    class iterator {
+      public:
+        iterator(const ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+        Tcont* operator*() const { return m_pool->slot(m_index); }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        const ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    iterator begin() const { return iterator(this, 0); }
+    iterator end() const { return iterator(this, m_num_active); }
+
+  private:
+    typedef typename std::aligned_storage<sizeof(Tcont), alignof(Tcont)>::type Storage;
+
+    Tcont* slot(size_t i) const {
+        return std::launder(reinterpret_cast<Tcont*>(&m_chunks[i >> ChunkBits][i & (ChunkSize - 1)]));
+    }
+
+    std::vector<std::unique_ptr<Storage[]>> m_chunks;  ///< contact storage, in chunks of ChunkSize objects
+    size_t m_num_active;                               ///< number of active contacts
+    size_t m_num_constructed;                          ///< number of constructed contact objects
+};
+
+}  // end namespace chrono
+
+#endif
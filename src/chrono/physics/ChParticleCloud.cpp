@@ -206,6 +206,148 @@ void ChParticle::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(UserTorque);
 }
 
+// -----------------------------------------------------------------------------
+// CLASS FOR A PARTICLE PROXY (COMPACT STORAGE)
+// -----------------------------------------------------------------------------
+
+ChFrame<> ChParticleProxy::GetFrame() const {
+    return ChFrame<>(container->p_pos[index], container->p_rot[index]);
+}
+
+void ChParticleProxy::ContactableGetStateBlockPosLevel(ChState& x) {
+    x.segment(0, 3) = container->p_pos[index].eigen();
+    x.segment(3, 4) = container->p_rot[index].eigen();
+}
+
+void ChParticleProxy::ContactableGetStateBlockVelLevel(ChStateDelta& w) {
+    w.segment(0, 3) = container->p_vel[index].eigen();
+    w.segment(3, 3) = container->p_angvel[index].eigen();
+}
+
+void ChParticleProxy::ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) {
+    // Increment position
+    x_new(0) = x(0) + dw(0);
+    x_new(1) = x(1) + dw(1);
+    x_new(2) = x(2) + dw(2);
+
+    // Increment rotation: rot' = delta*rot  (use quaternion for delta rotation)
+    ChQuaternion<> mdeltarot;
+    ChQuaternion<> moldrot(x.segment(3, 4));
+    ChVector3d newwel_abs = container->p_rot[index].Rotate(ChVector3d(dw.segment(3, 3)));
+    double mangle = newwel_abs.Length();
+    newwel_abs.Normalize();
+    mdeltarot.SetFromAngleAxis(mangle, newwel_abs);
+    ChQuaternion<> mnewrot = mdeltarot * moldrot;  // quaternion product
+    x_new.segment(3, 4) = mnewrot.eigen();
+}
+
+ChVector3d ChParticleProxy::GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    return csys.TransformPointLocalToParent(loc_point);
+}
+
+ChVector3d ChParticleProxy::GetContactPointSpeed(const ChVector3d& loc_point,
+                                                 const ChState& state_x,
+                                                 const ChStateDelta& state_w) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d abs_vel(state_w.segment(0, 3));
+    ChVector3d loc_omg(state_w.segment(3, 3));
+    ChVector3d abs_omg = csys.TransformDirectionLocalToParent(loc_omg);
+
+    return abs_vel + Vcross(abs_omg, loc_point);
+}
+
+ChVector3d ChParticleProxy::GetContactPointSpeed(const ChVector3d& abs_point) {
+    const ChQuaterniond& rot = container->p_rot[index];
+    ChVector3d m_p1_loc = rot.RotateBack(abs_point - container->p_pos[index]);
+    return container->p_vel[index] + rot.Rotate(Vcross(container->p_angvel[index], m_p1_loc));
+}
+
+ChFrame<> ChParticleProxy::GetCollisionModelFrame() {
+    return GetFrame();
+}
+
+void ChParticleProxy::ContactForceLoadResidual_F(const ChVector3d& F,
+                                                 const ChVector3d& T,
+                                                 const ChVector3d& abs_point,
+                                                 ChVectorDynamic<>& R) {
+    ChFrame<> frame = GetFrame();
+    ChVector3d m_p1_loc = frame.TransformPointParentToLocal(abs_point);
+    ChVector3d force1_loc = frame.TransformDirectionParentToLocal(F);
+    ChVector3d torque1_loc = Vcross(m_p1_loc, force1_loc);
+    if (!T.IsNull())
+        torque1_loc += frame.TransformDirectionParentToLocal(T);
+    R.segment(variables.GetOffset() + 0, 3) += F.eigen();
+    R.segment(variables.GetOffset() + 3, 3) += torque1_loc.eigen();
+}
+
+void ChParticleProxy::ContactComputeQ(const ChVector3d& F,
+                                      const ChVector3d& T,
+                                      const ChVector3d& point,
+                                      const ChState& state_x,
+                                      ChVectorDynamic<>& Q,
+                                      int offset) {
+    ChCoordsys<> csys(state_x.segment(0, 7));
+    ChVector3d point_loc = csys.TransformPointParentToLocal(point);
+    ChVector3d force_loc = csys.TransformDirectionParentToLocal(F);
+    ChVector3d torque_loc = Vcross(point_loc, force_loc);
+    if (!T.IsNull())
+        torque_loc += csys.TransformDirectionParentToLocal(T);
+    Q.segment(offset + 0, 3) = F.eigen();
+    Q.segment(offset + 3, 3) = torque_loc.eigen();
+}
+
+void ChParticleProxy::ComputeJacobianForContactPart(
+    const ChVector3d& abs_point,
+    ChMatrix33<>& contact_plane,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+    bool second) {
+    ChFrame<> frame = GetFrame();
+    ChVector3d m_p1_loc = frame.TransformPointParentToLocal(abs_point);
+
+    ChMatrix33<> Jx1 = contact_plane.transpose();
+    if (!second)
+        Jx1 *= -1;
+
+    ChStarMatrix33<> Ps1(m_p1_loc);
+    ChMatrix33<> Jr1 = contact_plane.transpose() * frame.GetRotMat() * Ps1;
+    if (second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3) = Jx1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(0, 3) = Jx1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(0, 3) = Jx1.row(2);
+
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+void ChParticleProxy::ComputeJacobianForRollingContactPart(
+    const ChVector3d& abs_point,
+    ChMatrix33<>& contact_plane,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+    ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+    bool second) {
+    ChMatrix33<> Jr1 = contact_plane.transpose() * ChMatrix33<>(container->p_rot[index]);
+    if (!second)
+        Jr1 *= -1;
+
+    jacobian_tuple_N.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_U.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_V.Get_Cq().segment(0, 3).setZero();
+    jacobian_tuple_N.Get_Cq().segment(3, 3) = Jr1.row(0);
+    jacobian_tuple_U.Get_Cq().segment(3, 3) = Jr1.row(1);
+    jacobian_tuple_V.Get_Cq().segment(3, 3) = Jr1.row(2);
+}
+
+ChPhysicsItem* ChParticleProxy::GetPhysicsItem() {
+    return container;
+}
+
 // -----------------------------------------------------------------------------
 // CLASS FOR PARTICLE CLUSTER
 // -----------------------------------------------------------------------------
@@ -223,7 +365,8 @@ ChParticleCloud::ChParticleCloud()
       sleep_starttime(0),
       sleep_minspeed(0.1f),
       sleep_minwvel(0.04f),
-      particle_collision_model(nullptr) {
+      particle_collision_model(nullptr),
+      compact(false) {
     SetMass(1.0);
     SetInertiaXX(ChVector3d(1.0, 1.0, 1.0));
     SetInertiaXY(ChVector3d(0, 0, 0));
@@ -235,6 +378,7 @@ ChParticleCloud::ChParticleCloud()
 ChParticleCloud::ChParticleCloud(const ChParticleCloud& other) : ChIndexedParticles(other) {
     collide = other.collide;
     limit_speed = other.limit_speed;
+    compact = other.compact;
 
     SetMass(other.GetMass());
     SetInertiaXX(other.GetInertiaXX());
@@ -278,6 +422,23 @@ void ChParticleCloud::ResizeNparticles(int newsize) {
         particles[j] = 0;
     }
 
+    if (compact) {
+        proxies.clear();
+        p_pos.assign(newsize, VNULL);
+        p_rot.assign(newsize, QUNIT);
+        p_vel.assign(newsize, VNULL);
+        p_angvel.assign(newsize, VNULL);
+        p_acc.assign(newsize, VNULL);
+        p_angacc.assign(newsize, VNULL);
+        p_force.assign(newsize, VNULL);
+        p_torque.assign(newsize, VNULL);
+        for (int j = 0; j < newsize; j++)
+            AddParticleProxy();
+        particles.clear();
+        EnableCollision(oldcoll);
+        return;
+    }
+
     particles.resize(newsize);
 
     for (unsigned int j = 0; j < particles.size(); j++) {
@@ -299,6 +460,19 @@ void ChParticleCloud::ResizeNparticles(int newsize) {
 }
 
 void ChParticleCloud::AddParticle(ChCoordsys<double> initial_state) {
+    if (compact) {
+        p_pos.push_back(initial_state.pos);
+        p_rot.push_back(initial_state.rot);
+        p_vel.push_back(VNULL);
+        p_angvel.push_back(VNULL);
+        p_acc.push_back(VNULL);
+        p_angacc.push_back(VNULL);
+        p_force.push_back(VNULL);
+        p_torque.push_back(VNULL);
+        AddParticleProxy();
+        return;
+    }
+
     ChParticle* newp = new ChParticle;
     newp->SetCoordsys(initial_state);
 
@@ -316,6 +490,153 @@ void ChParticleCloud::AddParticle(ChCoordsys<double> initial_state) {
     particles.push_back(newp);
 }
 
+void ChParticleCloud::AddParticleProxy() {
+    proxies.emplace_back();
+    auto& proxy = proxies.back();
+
+    proxy.container = this;
+    proxy.index = (unsigned int)(proxies.size() - 1);
+
+    proxy.variables.SetSharedMass(&particle_mass);
+    proxy.variables.SetUserData((void*)this);
+
+    if (particle_collision_model) {
+        auto collision_model = chrono_types::make_shared<ChCollisionModel>();
+        collision_model->AddShapes(particle_collision_model);
+        proxy.AddCollisionModel(collision_model);
+    }
+}
+
+void ChParticleCloud::EnableCompactStorage(bool val) {
+    if (val == compact)
+        return;
+
+    unsigned int n = (unsigned int)GetNumParticles();
+
+    // The collision models of the existing particles are replaced below, since they are bound to the old
+    // contactables. If already processed by the collision system, remove them now and add the new ones at the end.
+    ChCollisionSystem* coll_sys = nullptr;
+    if (n > 0 && particle_collision_model && ParticleCollisionModel(0)->HasImplementation()) {
+        coll_sys = GetSystem()->GetCollisionSystem().get();
+        for (unsigned int j = 0; j < n; j++)
+            coll_sys->Remove(ParticleCollisionModel(j));
+    }
+
+    if (val) {
+        // Move the particle states into the compact arrays
+        p_pos.resize(n);
+        p_rot.resize(n);
+        p_vel.resize(n);
+        p_angvel.resize(n);
+        p_acc.resize(n);
+        p_angacc.resize(n);
+        p_force.resize(n);
+        p_torque.resize(n);
+        for (unsigned int j = 0; j < n; j++) {
+            p_pos[j] = particles[j]->GetPos();
+            p_rot[j] = particles[j]->GetRot();
+            p_vel[j] = particles[j]->GetPosDt();
+            p_angvel[j] = particles[j]->GetAngVelLocal();
+            p_acc[j] = particles[j]->GetPosDt2();
+            p_angacc[j] = particles[j]->GetAngAccLocal();
+            p_force[j] = particles[j]->UserForce;
+            p_torque[j] = particles[j]->UserTorque;
+            delete particles[j];
+        }
+        particles.clear();
+        compact = true;
+        for (unsigned int j = 0; j < n; j++)
+            AddParticleProxy();
+    } else {
+        // Create ChParticle objects from the compact arrays
+        particles.resize(n);
+        for (unsigned int j = 0; j < n; j++) {
+            auto p = new ChParticle;
+            p->SetCoordsys(ChCoordsys<>(p_pos[j], p_rot[j]));
+            p->SetPosDt(p_vel[j]);
+            p->SetAngVelLocal(p_angvel[j]);
+            p->SetPosDt2(p_acc[j]);
+            p->SetAngAccLocal(p_angacc[j]);
+            p->UserForce = p_force[j];
+            p->UserTorque = p_torque[j];
+            p->SetContainer(this);
+            p->variables.SetSharedMass(&particle_mass);
+            p->variables.SetUserData((void*)this);
+            if (particle_collision_model) {
+                auto collision_model = chrono_types::make_shared<ChCollisionModel>();
+                collision_model->AddShapes(particle_collision_model);
+                p->AddCollisionModel(collision_model);
+            }
+            particles[j] = p;
+        }
+        proxies.clear();
+        compact = false;
+        p_pos.clear();
+        p_rot.clear();
+        p_vel.clear();
+        p_angvel.clear();
+        p_acc.clear();
+        p_angacc.clear();
+        p_force.clear();
+        p_torque.clear();
+    }
+
+    if (coll_sys) {
+        for (unsigned int j = 0; j < n; j++)
+            coll_sys->Add(ParticleCollisionModel(j));
+    }
+}
+
+void ChParticleCloud::SetParticlePos(unsigned int n, const ChVector3d& pos) {
+    if (compact)
+        p_pos[n] = pos;
+    else
+        particles[n]->SetPos(pos);
+}
+
+void ChParticleCloud::SetParticleRot(unsigned int n, const ChQuaterniond& rot) {
+    if (compact)
+        p_rot[n] = rot;
+    else
+        particles[n]->SetRot(rot);
+}
+
+void ChParticleCloud::SetParticleVel(unsigned int n, const ChVector3d& vel) {
+    if (compact)
+        p_vel[n] = vel;
+    else
+        particles[n]->SetPosDt(vel);
+}
+
+void ChParticleCloud::SetParticleAngVel(unsigned int n, const ChVector3d& angvel) {
+    if (compact)
+        p_angvel[n] = angvel;
+    else
+        particles[n]->SetAngVelLocal(angvel);
+}
+
+void ChParticleCloud::SetParticleForce(unsigned int n, const ChVector3d& force) {
+    if (compact)
+        p_force[n] = force;
+    else
+        particles[n]->UserForce = force;
+}
+
+void ChParticleCloud::SetParticleTorque(unsigned int n, const ChVector3d& torque) {
+    if (compact)
+        p_torque[n] = torque;
+    else
+        particles[n]->UserTorque = torque;
+}
+
+ChFrame<> ChParticleCloud::GetVisualModelFrame(unsigned int nclone) const {
+    return ChFrame<>(GetParticlePos(nclone), GetParticleRot(nclone));
+}
+
+int ChParticleCloud::GetNumThreads() const {
+    return system ? system->GetNumThreadsChrono() : 1;
+}
+
 ChColor ChParticleCloud::GetVisualColor(unsigned int n) const {
     if (m_color_fun)
         return m_color_fun->get(n, *this);
@@ -334,6 +655,20 @@ void ChParticleCloud::IntStateGather(const unsigned int off_x,  // offset in x s
                                      ChStateDelta& v,           // state vector, speed part
                                      double& T                  // time
 ) {
+    if (compact) {
+        int n = (int)p_pos.size();
+#pragma omp parallel for num_threads(GetNumThreads())
+        for (int j = 0; j < n; j++) {
+            x.segment(off_x + 7 * j + 0, 3) = p_pos[j].eigen();
+            x.segment(off_x + 7 * j + 3, 4) = p_rot[j].eigen();
+
+            v.segment(off_v + 6 * j + 0, 3) = p_vel[j].eigen();
+            v.segment(off_v + 6 * j + 3, 3) = p_angvel[j].eigen();
+        }
+        T = GetChTime();
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         x.segment(off_x + 7 * j + 0, 3) = particles[j]->GetPos().eigen();
         x.segment(off_x + 7 * j + 3, 4) = particles[j]->GetRot().eigen();
@@ -352,6 +687,20 @@ void ChParticleCloud::IntStateScatter(const unsigned int off_x,  // offset in x
                                       const double T,            // time
                                       bool full_update           // perform complete update
 ) {
+    if (compact) {
+        int n = (int)p_pos.size();
+#pragma omp parallel for num_threads(GetNumThreads())
+        for (int j = 0; j < n; j++) {
+            p_pos[j] = x.segment(off_x + 7 * j + 0, 3);
+            p_rot[j] = x.segment(off_x + 7 * j + 3, 4);
+            p_vel[j] = v.segment(off_v + 6 * j + 0, 3);
+            p_angvel[j] = v.segment(off_v + 6 * j + 3, 3);
+        }
+        SetChTime(T);
+        Update(T, full_update);
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         particles[j]->SetCoordsys(x.segment(off_x + 7 * j, 7));
         particles[j]->SetPosDt(v.segment(off_v + 6 * j, 3));
@@ -362,6 +711,14 @@ void ChParticleCloud::IntStateScatter(const unsigned int off_x,  // offset in x
 }
 
 void ChParticleCloud::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
+    if (compact) {
+        for (unsigned int j = 0; j < p_acc.size(); j++) {
+            a.segment(off_a + 6 * j + 0, 3) = p_acc[j].eigen();
+            a.segment(off_a + 6 * j + 3, 3) = p_angacc[j].eigen();
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         a.segment(off_a + 6 * j + 0, 3) = particles[j]->GetPosDt2().eigen();
         a.segment(off_a + 6 * j + 3, 3) = particles[j]->GetAngAccLocal().eigen();
@@ -369,6 +726,14 @@ void ChParticleCloud::IntStateGatherAcceleration(const unsigned int off_a, ChSta
 }
 
 void ChParticleCloud::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
+    if (compact) {
+        for (unsigned int j = 0; j < p_acc.size(); j++) {
+            p_acc[j] = a.segment(off_a + 6 * j + 0, 3);
+            p_angacc[j] = a.segment(off_a + 6 * j + 3, 3);
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         particles[j]->SetPosDt2(a.segment(off_a + 6 * j, 3));
         particles[j]->SetAngAccLocal(a.segment(off_a + 6 * j + 3, 3));
@@ -381,7 +746,9 @@ void ChParticleCloud::IntStateIncrement(const unsigned int off_x,  // offset in
                                         const unsigned int off_v,  // offset in v state vector
                                         const ChStateDelta& Dv     // state vector, increment
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int n = (int)GetNumParticles();
+#pragma omp parallel for num_threads(GetNumThreads())
+    for (int j = 0; j < n; j++) {
         // ADVANCE POSITION:
         x_new(off_x + 7 * j) = x(off_x + 7 * j) + Dv(off_v + 6 * j);
         x_new(off_x + 7 * j + 1) = x(off_x + 7 * j + 1) + Dv(off_v + 6 * j + 1);
@@ -403,7 +770,9 @@ void ChParticleCloud::IntStateGetIncrement(const unsigned int off_x,  // offset
                                            const unsigned int off_v,  // offset in v state vector
                                            ChStateDelta& Dv           // state vector, increment
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int n = (int)GetNumParticles();
+#pragma omp parallel for num_threads(GetNumThreads())
+    for (int j = 0; j < n; j++) {
         // POSITION:
         Dv(off_v + 6 * j) = x_new(off_x + 7 * j) - x(off_x + 7 * j);
         Dv(off_v + 6 * j + 1) = x_new(off_x + 7 * j + 1) - x(off_x + 7 * j + 1);
@@ -426,6 +795,20 @@ void ChParticleCloud::IntLoadResidual_F(const unsigned int off,  // offset in R
     if (GetSystem())
         Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
 
+    if (compact) {
+        int n = (int)p_pos.size();
+#pragma omp parallel for num_threads(GetNumThreads())
+        for (int j = 0; j < n; j++) {
+            // particle gyroscopic force:
+            ChVector3d gyro = Vcross(p_angvel[j], particle_mass.GetBodyInertia() * p_angvel[j]);
+
+            // add applied forces and torques (and also the gyroscopic torque and gravity!) to 'fb' vector
+            R.segment(off + 6 * j + 0, 3) += c * (p_force[j] + Gforce).eigen();
+            R.segment(off + 6 * j + 3, 3) += c * (p_torque[j] - gyro).eigen();
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         // particle gyroscopic force:
         ChVector3d Wvel = particles[j]->GetAngVelLocal();
@@ -442,7 +825,8 @@ void ChParticleCloud::IntLoadResidual_Mv(const unsigned int off,      // offset
                                          const ChVectorDynamic<>& w,  // the w vector
                                          const double c               // a scaling factor
 ) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
         R(off + 6 * j + 0) += c * GetMass() * w(off + 6 * j + 0);
         R(off + 6 * j + 1) += c * GetMass() * w(off + 6 * j + 1);
         R(off + 6 * j + 2) += c * GetMass() * w(off + 6 * j + 2);
@@ -451,7 +835,8 @@ void ChParticleCloud::IntLoadResidual_Mv(const unsigned int off,      // offset
     }
 }
 void ChParticleCloud::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynamic<>& Md, double& err, const double c) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
         Md(off + 6 * j + 0) += c * particle_mass.GetBodyMass();
         Md(off + 6 * j + 1) += c * particle_mass.GetBodyMass();
         Md(off + 6 * j + 2) += c * particle_mass.GetBodyMass();
@@ -460,8 +845,8 @@ void ChParticleCloud::IntLoadLumpedMass_Md(const unsigned int off, ChVectorDynam
         Md(off + 6 * j + 5) += c * particle_mass.GetBodyInertia()(2, 2);
     }
     // if there is off-diagonal inertia, add to error, as lumping can give inconsistent results
-    err += particles.size() * (particle_mass.GetBodyInertia()(0, 1) + particle_mass.GetBodyInertia()(0, 2) +
-                               particle_mass.GetBodyInertia()(1, 2));
+    err += n * (particle_mass.GetBodyInertia()(0, 1) + particle_mass.GetBodyInertia()(0, 2) +
+                particle_mass.GetBodyInertia()(1, 2));
 }
 
 void ChParticleCloud::IntToDescriptor(const unsigned int off_v,  // offset in v, R
@@ -470,9 +855,11 @@ void ChParticleCloud::IntToDescriptor(const unsigned int off_v,  // offset in v,
                                       const unsigned int off_L,  // offset in L, Qc
                                       const ChVectorDynamic<>& L,
                                       const ChVectorDynamic<>& Qc) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.State() = v.segment(off_v + 6 * j, 6);
-        particles[j]->variables.Force() = R.segment(off_v + 6 * j, 6);
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
+        auto& variables = ParticleVariables(j);
+        variables.State() = v.segment(off_v + 6 * j, 6);
+        variables.Force() = R.segment(off_v + 6 * j, 6);
     }
 }
 
@@ -480,21 +867,25 @@ void ChParticleCloud::IntFromDescriptor(const unsigned int off_v,  // offset in
                                         ChStateDelta& v,
                                         const unsigned int off_L,  // offset in L
                                         ChVectorDynamic<>& L) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        v.segment(off_v + 6 * j, 6) = particles[j]->variables.State();
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
+        v.segment(off_v + 6 * j, 6) = ParticleVariables(j).State();
     }
 }
 
 void ChParticleCloud::InjectVariables(ChSystemDescriptor& descriptor) {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.SetDisabled(!IsActive());
-        descriptor.InsertVariables(&(particles[j]->variables));
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
+        auto& variables = ParticleVariables(j);
+        variables.SetDisabled(!IsActive());
+        descriptor.InsertVariables(&variables);
     }
 }
 
 void ChParticleCloud::VariablesFbReset() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.Force().setZero();
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
+        ParticleVariables(j).Force().setZero();
     }
 }
 
@@ -503,6 +894,18 @@ void ChParticleCloud::VariablesFbLoadForces(double factor) {
     if (GetSystem())
         Gforce = GetSystem()->GetGravitationalAcceleration() * particle_mass.GetBodyMass();
 
+    if (compact) {
+        for (unsigned int j = 0; j < proxies.size(); j++) {
+            // particle gyroscopic force:
+            ChVector3d gyro = Vcross(p_angvel[j], particle_mass.GetBodyInertia() * p_angvel[j]);
+
+            // add applied forces and torques (and also the gyroscopic torque and gravity!) to 'fb' vector
+            proxies[j].variables.Force().segment(0, 3) += factor * (p_force[j] + Gforce).eigen();
+            proxies[j].variables.Force().segment(3, 3) += factor * (p_torque[j] - gyro).eigen();
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         // particle gyroscopic force:
         ChVector3d Wvel = particles[j]->GetAngVelLocal();
@@ -515,6 +918,15 @@ void ChParticleCloud::VariablesFbLoadForces(double factor) {
 }
 
 void ChParticleCloud::VariablesQbLoadSpeed() {
+    if (compact) {
+        for (unsigned int j = 0; j < proxies.size(); j++) {
+            // set current speed in 'qb', it can be used by the solver when working in incremental mode
+            proxies[j].variables.State().segment(0, 3) = p_vel[j].eigen();
+            proxies[j].variables.State().segment(3, 3) = p_angvel[j].eigen();
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         // set current speed in 'qb', it can be used by the solver when working in incremental mode
         particles[j]->variables.State().segment(0, 3) = particles[j]->GetCoordsysDt().pos.eigen();
@@ -523,12 +935,32 @@ void ChParticleCloud::VariablesQbLoadSpeed() {
 }
 
 void ChParticleCloud::VariablesFbIncrementMq() {
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.AddMassTimesVector(particles[j]->variables.Force(), particles[j]->variables.State());
+    int n = (int)GetNumParticles();
+    for (int j = 0; j < n; j++) {
+        auto& variables = ParticleVariables(j);
+        variables.AddMassTimesVector(variables.Force(), variables.State());
     }
 }
 
 void ChParticleCloud::VariablesQbSetSpeed(double step) {
+    if (compact) {
+        for (unsigned int j = 0; j < proxies.size(); j++) {
+            ChVector3d old_vel = p_vel[j];
+            ChVector3d old_angvel = p_angvel[j];
+
+            // from 'qb' vector, sets body speed
+            p_vel[j] = proxies[j].variables.State().segment(0, 3);
+            p_angvel[j] = proxies[j].variables.State().segment(3, 3);
+
+            // Compute accel. by BDF (approximate by differentiation);
+            if (step) {
+                p_acc[j] = (p_vel[j] - old_vel) / step;
+                p_angacc[j] = (p_angvel[j] - old_angvel) / step;
+            }
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         ChCoordsys<> old_coord_dt = particles[j]->GetCoordsysDt();
 
@@ -551,6 +983,25 @@ void ChParticleCloud::VariablesQbIncrementPosition(double dt_step) {
     if (!IsActive())
         return;
 
+    if (compact) {
+        for (unsigned int j = 0; j < proxies.size(); j++) {
+            ChVector3d newspeed(proxies[j].variables.State().segment(0, 3));
+            ChVector3d newwel(proxies[j].variables.State().segment(3, 3));
+
+            // ADVANCE POSITION: pos' = pos + dt * vel
+            p_pos[j] += newspeed * dt_step;
+
+            // ADVANCE ROTATION: rot' = [dt*wwel]%rot  (use quaternion for delta rotation)
+            ChQuaternion<> mdeltarot;
+            ChVector3d newwel_abs = p_rot[j].Rotate(newwel);
+            double mangle = newwel_abs.Length() * dt_step;
+            newwel_abs.Normalize();
+            mdeltarot.SetFromAngleAxis(mangle, newwel_abs);
+            p_rot[j] = mdeltarot * p_rot[j];
+        }
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         // Updates position with incremental action of speed contained in the
         // 'qb' vector:  pos' = pos + dt * speed   , like in an Euler step.
@@ -574,6 +1025,14 @@ void ChParticleCloud::VariablesQbIncrementPosition(double dt_step) {
 }
 
 void ChParticleCloud::ForceToRest() {
+    if (compact) {
+        std::fill(p_vel.begin(), p_vel.end(), VNULL);
+        std::fill(p_angvel.begin(), p_angvel.end(), VNULL);
+        std::fill(p_acc.begin(), p_acc.end(), VNULL);
+        std::fill(p_angacc.begin(), p_angacc.end(), VNULL);
+        return;
+    }
+
     for (unsigned int j = 0; j < particles.size(); j++) {
         particles[j]->SetPosDt(VNULL);
         particles[j]->SetAngVelLocal(VNULL);
@@ -583,6 +1042,19 @@ void ChParticleCloud::ForceToRest() {
 }
 
 void ChParticleCloud::ClampSpeed() {
+    if (limit_speed && compact) {
+        for (unsigned int j = 0; j < p_vel.size(); j++) {
+            double w = p_angvel[j].Length();
+            if (w > max_wvel)
+                p_angvel[j] *= max_wvel / w;
+
+            double v = p_vel[j].Length();
+            if (v > max_speed)
+                p_vel[j] *= max_speed / v;
+        }
+        return;
+    }
+
     if (limit_speed) {
         for (unsigned int j = 0; j < particles.size(); j++) {
             double w = 2.0 * particles[j]->GetRotDt().Length();
@@ -667,31 +1139,32 @@ void ChParticleCloud::EnableCollision(bool state) {
         return;
 
     // If enabling collision, add to collision system if not already processed
-    if (collide && !particles.empty() && !particles[0]->GetCollisionModel()->HasImplementation()) {
-        for (auto particle : particles)
-            coll_sys->Add(particle->GetCollisionModel());
+    unsigned int n = (unsigned int)GetNumParticles();
+    if (collide && n > 0 && !ParticleCollisionModel(0)->HasImplementation()) {
+        for (unsigned int j = 0; j < n; j++)
+            coll_sys->Add(ParticleCollisionModel(j));
         return;
     }
 
     // If disabling collision, remove the from collision system if already processed
-    if (!collide && !particles.empty() && particles[0]->GetCollisionModel()->HasImplementation()) {
-        for (auto particle : particles)
-            coll_sys->Remove(particle->GetCollisionModel());
+    if (!collide && n > 0 && ParticleCollisionModel(0)->HasImplementation()) {
+        for (unsigned int j = 0; j < n; j++)
+            coll_sys->Remove(ParticleCollisionModel(j));
         return;
     }
 }
 
 void ChParticleCloud::AddCollisionModelsToSystem(ChCollisionSystem* coll_sys) const {
     if (collide && particle_collision_model) {
-        for (const auto& p : particles)
-            coll_sys->Add(p->GetCollisionModel());
+        for (unsigned int j = 0; j < GetNumParticles(); j++)
+            coll_sys->Add(ParticleCollisionModel(j));
     }
 }
 
 void ChParticleCloud::RemoveCollisionModelsFromSystem(ChCollisionSystem* coll_sys) const {
     if (particle_collision_model) {
-        for (const auto& p : particles)
-            coll_sys->Remove(p->GetCollisionModel());
+        for (unsigned int j = 0; j < GetNumParticles(); j++)
+            coll_sys->Remove(ParticleCollisionModel(j));
     }
 }
 
@@ -703,8 +1176,9 @@ void ChParticleCloud::SyncCollisionModels() {
     if (!particle_collision_model)
         return;
 
-    for (auto particle : particles)
-        particle->GetCollisionModel()->SyncPosition();
+    unsigned int n = (unsigned int)GetNumParticles();
+    for (unsigned int j = 0; j < n; j++)
+        ParticleCollisionModel(j)->SyncPosition();
 }
 
 void ChParticleCloud::ArchiveOut(ChArchiveOut& archive_out) {
@@ -726,11 +1200,20 @@ void ChParticleCloud::ArchiveOut(ChArchiveOut& archive_out) {
     archive_out << CHNVP(sleep_minspeed);
     archive_out << CHNVP(sleep_minwvel);
     archive_out << CHNVP(sleep_starttime);
+    archive_out << CHNVP(compact);
+    if (compact) {
+        archive_out << CHNVP(p_pos);
+        archive_out << CHNVP(p_rot);
+        archive_out << CHNVP(p_vel);
+        archive_out << CHNVP(p_angvel);
+        archive_out << CHNVP(p_force);
+        archive_out << CHNVP(p_torque);
+    }
 }
 
 void ChParticleCloud::ArchiveIn(ChArchiveIn& archive_in) {
     // version number
-    /*int version =*/archive_in.VersionRead<ChParticleCloud>();
+    int version = archive_in.VersionRead<ChParticleCloud>();
 
     // deserialize parent class:
     ChIndexedParticles::ArchiveIn(archive_in);
@@ -747,6 +1230,22 @@ void ChParticleCloud::ArchiveIn(ChArchiveIn& archive_in) {
     archive_in >> CHNVP(sleep_minspeed);
     archive_in >> CHNVP(sleep_minwvel);
     archive_in >> CHNVP(sleep_starttime);
+    compact = false;
+    if (version > 0)
+        archive_in >> CHNVP(compact);
+    if (compact) {
+        archive_in >> CHNVP(p_pos);
+        archive_in >> CHNVP(p_rot);
+        archive_in >> CHNVP(p_vel);
+        archive_in >> CHNVP(p_angvel);
+        archive_in >> CHNVP(p_force);
+        archive_in >> CHNVP(p_torque);
+        p_acc.assign(p_pos.size(), VNULL);
+        p_angacc.assign(p_pos.size(), VNULL);
+        proxies.clear();
+        for (unsigned int j = 0; j < p_pos.size(); j++)
+            AddParticleProxy();
+    }
 
     for (unsigned int j = 0; j < particles.size(); j++) {
         particles[j]->SetContainer(this);
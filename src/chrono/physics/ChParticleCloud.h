@@ -16,6 +16,9 @@
 #define CH_PARTICLE_CLOUD_H
 
 #include <cmath>
+#include <deque>
+#include <stdexcept>
+#include <vector>
 
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/physics/ChContactable.h"
@@ -149,12 +152,91 @@ class ChApi ChParticle : public ChParticleBase, public ChContactable_1vars<6> {
     ChVector3d UserTorque;
 };
 
+/// Lightweight particle in a ChParticleCloud with compact storage.
+/// It only carries the solver variables and the collision model of a particle. The particle state (position, rotation,
+/// velocities, accelerations, and applied forces) is stored in contiguous arrays owned by the container.
+/// See ChParticleCloud::EnableCompactStorage.
+class ChApi ChParticleProxy : public ChContactable_1vars<6> {
+  public:
+    ChParticleProxy() : container(nullptr), index(0) {}
+    ~ChParticleProxy() {}
+
+    /// Get the container.
+    ChParticleCloud* GetContainer() const { return container; }
+
+    /// Get the index of this particle in its container.
+    unsigned int GetIndex() const { return index; }
+
+    /// Access the variables of the particle.
+    ChVariablesBodySharedMass& Variables() { return variables; }
+
+    // INTERFACE TO ChContactable
+
+    virtual ChContactable::eChContactableType GetContactableType() const override { return CONTACTABLE_6; }
+    virtual ChVariables* GetVariables1() override { return &variables; }
+    virtual bool IsContactActive() override { return true; }
+    virtual int GetContactableNumCoordsPosLevel() override { return 7; }
+    virtual int GetContactableNumCoordsVelLevel() override { return 6; }
+    virtual void ContactableGetStateBlockPosLevel(ChState& x) override;
+    virtual void ContactableGetStateBlockVelLevel(ChStateDelta& w) override;
+    virtual void ContactableIncrementState(const ChState& x, const ChStateDelta& dw, ChState& x_new) override;
+    virtual ChVector3d GetContactPoint(const ChVector3d& loc_point, const ChState& state_x) override;
+    virtual ChVector3d GetContactPointSpeed(const ChVector3d& loc_point,
+                                            const ChState& state_x,
+                                            const ChStateDelta& state_w) override;
+    virtual ChVector3d GetContactPointSpeed(const ChVector3d& abs_point) override;
+    virtual ChFrame<> GetCollisionModelFrame() override;
+    virtual void ContactForceLoadResidual_F(const ChVector3d& F,
+                                            const ChVector3d& T,
+                                            const ChVector3d& abs_point,
+                                            ChVectorDynamic<>& R) override;
+    virtual void ContactComputeQ(const ChVector3d& F,
+                                 const ChVector3d& T,
+                                 const ChVector3d& point,
+                                 const ChState& state_x,
+                                 ChVectorDynamic<>& Q,
+                                 int offset) override;
+    virtual void ComputeJacobianForContactPart(const ChVector3d& abs_point,
+                                               ChMatrix33<>& contact_plane,
+                                               ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+                                               ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+                                               ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+                                               bool second) override;
+    virtual void ComputeJacobianForRollingContactPart(
+        const ChVector3d& abs_point,
+        ChMatrix33<>& contact_plane,
+        ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_N,
+        ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_U,
+        ChVariableTupleCarrier_1vars<6>::type_constraint_tuple& jacobian_tuple_V,
+        bool second) override;
+    virtual double GetContactableMass() override { return variables.GetBodyMass(); }
+    virtual ChPhysicsItem* GetPhysicsItem() override;
+
+  private:
+    /// Return the current frame of the particle (from the container arrays).
+    ChFrame<> GetFrame() const;
+
+    ChParticleCloud* container;
+    unsigned int index;
+    ChVariablesBodySharedMass variables;
+
+    friend class ChParticleCloud;
+};
+
 /// Class for clusters of 'clone' particles, that is many rigid objects with the same shape and mass.
 /// This can be used to make granular flows, where you have thousands of objects with the same shape. In fact, a single
 /// ChParticleCloud object can be more memory-efficient than many ChBody objects, because they share many features,
 /// such as mass and collision shape. If you have N different families of shapes in your granular simulations (ex. 50%
 /// of particles are large spheres, 25% are small spheres and 25% are polyhedrons) you can simply add three
 /// ChParticleCloud objects to the ChSystem. This would be more efficient anyway than creating all shapes as ChBody.
+///
+/// With compact storage enabled (see EnableCompactStorage), the particle states are stored in contiguous arrays
+/// (structure-of-arrays layout) and each particle only keeps a lightweight ChParticleProxy with its solver variables
+/// and collision model, instead of a full ChParticle (moving frame, variables, user loads, collision model). This
+/// speeds up the state gather/scatter operations and reduces the memory held by the cloud itself. It does not reduce
+/// the collision memory: in both storage modes, the collision shapes of the template model are shared by all
+/// particles, but each particle needs its own ChCollisionModel and its own object in the collision system, which
+/// usually dominate the per-particle memory. See btest_CH_particle_cloud for a measurement.
 class ChApi ChParticleCloud : public ChIndexedParticles {
   public:
     ChParticleCloud();
@@ -179,30 +261,80 @@ class ChApi ChParticleCloud : public ChIndexedParticles {
     /// Enable limiting the linear speed (default: false).
     void SetLimitSpeed(bool state) { limit_speed = state; }
 
+    /// Enable/disable compact (structure-of-arrays) storage of the particle states (default: false).
+    /// In compact mode, particles are not represented by ChParticle objects and GetParticles() returns an empty
+    /// vector; use instead the GetParticleXXX and SetParticleXXX accessors. Calling the non-const Particle() switches
+    /// the cloud back to the default storage.
+    /// If the cloud already has particles, their states (including user forces) are converted to the new storage and
+    /// new per-particle collision models are created (and rebound to the collision system, if needed). Contacts
+    /// involving the cloud are regenerated at the next collision detection.
+    void EnableCompactStorage(bool val);
+
+    /// Return true if the particle states are stored in compact form.
+    bool IsCompactStorage() const { return compact; }
+
     /// Get the number of particles.
-    size_t GetNumParticles() const override { return particles.size(); }
+    size_t GetNumParticles() const override { return compact ? p_pos.size() : particles.size(); }
 
     /// Get all particles in the cluster.
+    /// Note that this returns an empty vector if compact storage is enabled.
     std::vector<ChParticle*> GetParticles() const { return particles; }
 
     /// Get particle position.
-    const ChVector3d& GetParticlePos(unsigned int n) const { return particles[n]->GetPos(); }
+    const ChVector3d& GetParticlePos(unsigned int n) const { return compact ? p_pos[n] : particles[n]->GetPos(); }
+
+    /// Get particle rotation.
+    const ChQuaterniond& GetParticleRot(unsigned int n) const { return compact ? p_rot[n] : particles[n]->GetRot(); }
 
     /// Get particle linear velocity.
-    const ChVector3d& GetParticleVel(unsigned int n) const { return particles[n]->GetPosDt(); }
+    const ChVector3d& GetParticleVel(unsigned int n) const { return compact ? p_vel[n] : particles[n]->GetPosDt(); }
+
+    /// Get particle angular velocity (expressed in the particle frame).
+    ChVector3d GetParticleAngVel(unsigned int n) const {
+        return compact ? p_angvel[n] : particles[n]->GetAngVelLocal();
+    }
+
+    /// Set particle position.
+    void SetParticlePos(unsigned int n, const ChVector3d& pos);
+
+    /// Set particle rotation.
+    void SetParticleRot(unsigned int n, const ChQuaterniond& rot);
+
+    /// Set particle linear velocity.
+    void SetParticleVel(unsigned int n, const ChVector3d& vel);
+
+    /// Set particle angular velocity (expressed in the particle frame).
+    void SetParticleAngVel(unsigned int n, const ChVector3d& angvel);
+
+    /// Set the user force applied to a particle (expressed in the absolute frame).
+    void SetParticleForce(unsigned int n, const ChVector3d& force);
+
+    /// Set the user torque applied to a particle (expressed in the particle frame).
+    void SetParticleTorque(unsigned int n, const ChVector3d& torque);
 
     /// Access the N-th particle.
+    /// If compact storage is enabled, the cloud is first switched back to the default storage (see
+    /// EnableCompactStorage), so that the returned particle can be read and modified as usual.
     ChParticleBase& Particle(unsigned int n) override {
+        if (compact)
+            EnableCompactStorage(false);
         assert(n < particles.size());
         return *particles[n];
     }
 
     /// Access the N-th particle.
+    /// This read-only overload cannot change the storage mode: if compact storage is enabled, an exception is thrown
+    /// (use the non-const overload or the GetParticleXXX accessors).
     const ChParticleBase& Particle(unsigned int n) const override {
+        if (compact)
+            throw std::runtime_error("ChParticleCloud::Particle (const) not available with compact storage.");
         assert(n < particles.size());
         return *particles[n];
     }
 
+    /// Get the reference frame of the N-th particle (used for the visualization clones).
+    virtual ChFrame<> GetVisualModelFrame(unsigned int nclone = 0) const override;
+
     /// Add a collision model for particles in this cloud.
     /// This is the "template" collision model that is used by all particles.
     void AddCollisionModel(std::shared_ptr<ChCollisionModel> model) { particle_collision_model = model; }
@@ -373,6 +505,22 @@ class ChApi ChParticleCloud : public ChIndexedParticles {
     virtual void ArchiveIn(ChArchiveIn& archive_in) override;
 
   private:
+    /// Access the solver variables of the N-th particle.
+    ChVariablesBodySharedMass& ParticleVariables(unsigned int n) {
+        return compact ? proxies[n].variables : particles[n]->variables;
+    }
+
+    /// Get the collision model of the N-th particle.
+    std::shared_ptr<ChCollisionModel> ParticleCollisionModel(unsigned int n) const {
+        return compact ? proxies[n].GetCollisionModel() : particles[n]->GetCollisionModel();
+    }
+
+    /// Create a particle proxy for the last particle in the compact arrays.
+    void AddParticleProxy();
+
+    /// Get the number of threads for the loops over particles.
+    int GetNumThreads() const;
+
     std::vector<ChParticle*> particles;  ///< the particles
     ChSharedMassBody particle_mass;      ///< shared mass of particles
 
@@ -391,6 +539,19 @@ class ChApi ChParticleCloud : public ChIndexedParticles {
     float sleep_minspeed;
     float sleep_minwvel;
     float sleep_starttime;
+
+    bool compact;                                 ///< compact (structure-of-arrays) storage of particle states
+    std::vector<ChVector3d> p_pos;                ///< [compact] particle positions
+    std::vector<ChQuaterniond> p_rot;             ///< [compact] particle rotations
+    std::vector<ChVector3d> p_vel;                ///< [compact] particle linear velocities
+    std::vector<ChVector3d> p_angvel;             ///< [compact] particle angular velocities (local)
+    std::vector<ChVector3d> p_acc;                ///< [compact] particle linear accelerations
+    std::vector<ChVector3d> p_angacc;             ///< [compact] particle angular accelerations (local)
+    std::vector<ChVector3d> p_force;              ///< [compact] user forces (absolute)
+    std::vector<ChVector3d> p_torque;             ///< [compact] user torques (local)
+    std::deque<ChParticleProxy> proxies;          ///< [compact] particle variables and collision models
+
+    friend class ChParticleProxy;
 };
 
 /// Predefined particle cloud dynamic coloring based on particle height.
@@ -441,7 +602,7 @@ class ChApi VelocityColorCallback : public ChParticleCloud::ColorCallback {
     ChVector3d m_up;
 };
 
-CH_CLASS_VERSION(ChParticleCloud, 0)
+CH_CLASS_VERSION(ChParticleCloud, 1)
 
 }  // end namespace chrono
 
@@ -33,6 +33,7 @@
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/utils/ChProfiler.h"
+#include "chrono/utils/ChTrace.h"
 #include "chrono/physics/ChLinkMate.h"
 
 namespace chrono {
@@ -66,6 +67,7 @@ ChSystem::ChSystem()
       nthreads_chrono(1),
       nthreads_eigen(1),
       nthreads_collision(1),
+      parallel_assembly(false),
       applied_forces_current(false) {
     assembly.system = this;
 
@@ -99,6 +101,7 @@ ChSystem::ChSystem(const ChSystem& other) : m_RTF(0), collision_system(nullptr),
     nthreads_chrono = other.nthreads_chrono;
     nthreads_eigen = other.nthreads_eigen;
     nthreads_collision = other.nthreads_collision;
+    parallel_assembly = other.parallel_assembly;
     is_initialized = false;
     is_updated = false;
     applied_forces_current = false;
@@ -386,8 +389,11 @@ void ChSystem::Initialize() {
     if (is_initialized)
         return;
 
-    // Set num threads for Eigen
-    Eigen::setNbThreads(nthreads_eigen);
+    // Set num threads for Eigen.
+    // This is a global setting, so it is only written if it changes (systems initialized concurrently on different
+    // threads with the same setting, e.g. in an ensemble, then do not write it at the same time).
+    if (Eigen::nbThreads() != nthreads_eigen)
+        Eigen::setNbThreads(nthreads_eigen);
 
     assembly.SetupInitial();
 
@@ -600,6 +606,8 @@ bool ChSystem::ManageSleepingBodies() {
 // -----------------------------------------------------------------------------
 
 void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor) {
+    CH_TRACE("DescriptorPrepareInject");
+
     sys_descriptor.BeginInsertion();  // This resets the vectors of constr. and var. pointers.
 
     InjectConstraints(sys_descriptor);
@@ -619,6 +627,7 @@ void ChSystem::DescriptorPrepareInject(ChSystemDescriptor& sys_descriptor) {
 
 void ChSystem::Setup() {
     CH_PROFILE("Setup");
+    CH_TRACE("Setup");
 
     timer_setup.start();
 
@@ -699,6 +708,7 @@ void ChSystem::Update(double mytime, bool update_assets) {
 
 void ChSystem::Update(bool update_assets) {
     CH_PROFILE("Update");
+    CH_TRACE("Update");
 
     Initialize();
 
@@ -1020,6 +1030,7 @@ bool ChSystem::StateSolveCorrection(
     bool force_setup              // if true, call the solver's Setup() function
 ) {
     CH_PROFILE("StateSolveCorrection");
+    CH_TRACE("StateSolveCorrection");
 
     if (force_state_scatter)
         StateScatter(x, v, T, full_update);
@@ -1030,6 +1041,7 @@ bool ChSystem::StateSolveCorrection(
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
+        CH_TRACE("LoadJacobians");
         timer_jacobian.start();
 
         // Cq  matrix
@@ -1070,6 +1082,7 @@ bool ChSystem::StateSolveCorrection(
     // If indicated, first perform a solver setup.
     // Return 'false' if the setup phase fails.
     if (force_setup) {
+        CH_TRACE("SolverSetup");
         timer_ls_setup.start();
         bool success = GetSolver()->Setup(*descriptor);
         timer_ls_setup.stop();
@@ -1080,9 +1093,12 @@ bool ChSystem::StateSolveCorrection(
 
     // Solve the problem
     // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+    {
+        CH_TRACE("SolverSolve");
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and Dl vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, Dl);
@@ -1231,6 +1247,7 @@ unsigned int ChSystem::GetNumContacts() {
 
 double ChSystem::ComputeCollisions() {
     CH_PROFILE("ComputeCollisions");
+    CH_TRACE("ComputeCollisions");
 
     double mretC = 0.0;
 
@@ -1249,6 +1266,7 @@ double ChSystem::ComputeCollisions() {
     // for ChBody and ChParticles is used always.
     {
         CH_PROFILE("ReportContacts");
+        CH_TRACE("ReportContacts");
 
         collision_system->ReportContacts(contact_container.get());
 
@@ -1295,6 +1313,13 @@ double ChSystem::GetTimerCollisionNarrow() const {
     return 0;
 }
 
+double ChSystem::GetTimerCollisionReport() const {
+    if (collision_system)
+        return collision_system->GetTimerCollisionReport();
+
+    return 0;
+}
+
 void ChSystem::ResetTimers() {
     timer_step.reset();
     timer_advance.reset();
@@ -1552,6 +1577,7 @@ unsigned int ChSystem::RemoveRedundantConstraints(bool remove_links, double qr_t
 
 bool ChSystem::AdvanceDynamics() {
     CH_PROFILE("AdvanceDynamics");
+    CH_TRACE("AdvanceDynamics");
 
     ResetTimers();
 
@@ -1605,6 +1631,7 @@ bool ChSystem::AdvanceDynamics() {
     // Advance system state by one step
     {
         CH_PROFILE("Advance");
+        CH_TRACE("Advance");
         timer_advance.start();
         timestepper->Advance(step);
         timer_advance.stop();
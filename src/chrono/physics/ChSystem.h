@@ -104,6 +104,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Change the default composition laws for contact surface materials
     /// (coefficient of friction, cohesion, compliance, etc.)
+    /// The strategy is invoked concurrently from the Chrono threads (see SetNumThreads) and must be thread-safe.
     virtual void SetMaterialCompositionStrategy(std::unique_ptr<ChContactMaterialCompositionStrategy>&& strategy);
 
     /// Accessor for the current composition laws for contact surface material.
@@ -250,8 +251,9 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     /// Set the number of OpenMP threads used by Chrono itself, Eigen, and the collision detection system.
     /// <pre>
-    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians) and
-    ///                           in SCM deformable terrain calculations.
+    ///   num_threads_chrono    - used in FEA (parallel evaluation of internal forces and Jacobians),
+    ///                           in SCM deformable terrain calculations, and (only if enabled with
+    ///                           EnableParallelAssemblyPasses) in the per-item passes over bodies, shafts, and links.
     ///   num_threads_collision - used in parallelization of collision detection (if applicable).
     ///                           If passing 0, then num_threads_collision = num_threads_chrono.
     ///   num_threads_eigen     - used in the Eigen sparse direct solvers and a few linear algebra operations.
@@ -270,6 +272,17 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     unsigned int GetNumThreadsCollision() const { return nthreads_collision; }
     unsigned int GetNumThreadsEigen() const { return nthreads_eigen; }
 
+    /// Enable parallel execution of the per-item passes over bodies, shafts, and links (default: false).
+    /// If enabled, the update, state gather/scatter, and descriptor loading passes of an assembly use
+    /// num_threads_chrono threads (see SetNumThreads). Items of the same kind are then updated concurrently, so all
+    /// user-provided callbacks invoked from these passes (e.g., the force functors of ChLinkTSDA and ChLinkRSDA, motor
+    /// and actuator functions, body forces) must be thread-safe. In particular, a functor shared by several links
+    /// must not modify internal state when evaluated (as ChFunctionInterp does, for example).
+    void EnableParallelAssemblyPasses(bool val) { parallel_assembly = val; }
+
+    /// Return true if the per-item passes over bodies, shafts, and links are executed in parallel.
+    bool IsParallelAssemblyPassesEnabled() const { return parallel_assembly; }
+
     // DATABASE HANDLING
 
     /// Get the underlying assembly containing all physics items.
@@ -501,6 +514,8 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     double GetTimerCollisionBroad() const;
     /// Return the time (in seconds) for narrowphase collision detection, within the time step.
     double GetTimerCollisionNarrow() const;
+    /// Return the time (in seconds) for reporting contacts to the contact container, within the time step.
+    double GetTimerCollisionReport() const;
 
     /// Get current estimated RTF (real time factor).
     /// This represents the real time factor for advancing the dynamic state of the system only and as such does not
@@ -833,6 +848,7 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int nthreads_chrono;
     int nthreads_eigen;
     int nthreads_collision;
+    bool parallel_assembly;  ///< if true, use nthreads_chrono in the per-item passes of assemblies
 
     // timers for profiling execution speed
     ChTimer timer_step;       ///< timer for integration step
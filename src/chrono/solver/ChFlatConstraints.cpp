@@ -0,0 +1,179 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+#include <limits>
+
+#include "chrono/solver/ChFlatConstraints.h"
+#include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
+
+namespace chrono {
+
+void ChFlatConstraints::Build(ChSystemDescriptor& sysd, bool build_transpose, bool build_colors) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariables();
+
+    m_num_dofs = sysd.CountActiveVariables();
+    unsigned int num_rows = sysd.CountActiveConstraints();
+
+    // Active variables and, for each entry in the state vector, the index of the owning variable
+    std::vector<ChVariables*> variables;
+    std::vector<unsigned int> dof_var(m_num_dofs);
+    for (auto var : mvariables) {
+        if (var->IsActive()) {
+            for (unsigned int k = 0; k < var->GetDOF(); k++)
+                dof_var[var->GetOffset() + k] = (unsigned int)variables.size();
+            variables.push_back(var);
+        }
+    }
+
+    // Per-row constraint data
+    m_constraints.resize(num_rows);
+    m_g.resize(num_rows);
+    m_b.resize(num_rows);
+    m_cfm.resize(num_rows);
+    m_mode.resize(num_rows);
+    for (auto constr : mconstraints) {
+        if (constr->IsActive()) {
+            unsigned int row = constr->GetOffset();
+            m_constraints[row] = constr;
+            m_g[row] = constr->GetSchurComplement();
+            m_b[row] = constr->GetRightHandSide();
+            m_cfm[row] = constr->GetComplianceTerm();
+            m_mode[row] = constr->GetMode();
+        }
+    }
+
+    // Collect the constraint Jacobians (at least one 6-DOF variable pair per row)
+    m_jacobian.resize(num_rows, m_num_dofs);
+    m_jacobian.reserve(Eigen::VectorXi::Constant(num_rows, 12));
+    sysd.PasteConstraintsJacobianMatrixInto(m_jacobian);
+    m_jacobian.makeCompressed();
+
+    // Expand each Jacobian row to full variable blocks and compute the corresponding [invM]*[Cq_i]'
+    m_row_start.assign(1, 0);
+    m_col.clear();
+    m_Cq.clear();
+    m_Eq.clear();
+    ChVectorDynamic<> cq;
+    ChVectorDynamic<> eq;
+    for (unsigned int row = 0; row < num_rows; row++) {
+        ChSparseMatrix::InnerIterator it(m_jacobian, row);
+        while (it) {
+            ChVariables* var = variables[dof_var[it.col()]];
+            unsigned int offset = var->GetOffset();
+            unsigned int ndof = var->GetDOF();
+            cq.setZero(ndof);
+            for (; it && (unsigned int)it.col() < offset + ndof; ++it)
+                cq(it.col() - offset) = it.value();
+            eq.resize(ndof);
+            var->ComputeMassInverseTimesVector(eq, cq);
+            for (unsigned int k = 0; k < ndof; k++) {
+                m_col.push_back(offset + k);
+                m_Cq.push_back(cq(k));
+                m_Eq.push_back(eq(k));
+            }
+        }
+        m_row_start.push_back((unsigned int)m_col.size());
+    }
+
+    // Group rows in units (the 3 rows of a friction triplet N,U,V are always contiguous).
+    // For a rolling contact, the rolling triplet Rx,Ru,Rv follows the N,U,V triplet and its projection also modifies
+    // the N,U,V multipliers, so the 6 rows are kept in a single unit.
+    m_unit_start.clear();
+    for (unsigned int row = 0; row < num_rows;) {
+        m_unit_start.push_back(row);
+        if (m_mode[row] == ChConstraint::Mode::FRICTION && row + 2 < num_rows) {
+            bool rolling = row + 5 < num_rows && m_mode[row + 3] == ChConstraint::Mode::FRICTION &&
+                           dynamic_cast<ChConstraintTwoTuplesRollingNall*>(m_constraints[row + 3]);
+            row += rolling ? 6 : 3;
+        } else {
+            row += 1;
+        }
+    }
+    m_unit_start.push_back(num_rows);
+
+    // Transposed [Eq] arrays, with entries for each state index sorted by row
+    m_dof_start.clear();
+    m_row.clear();
+    m_EqT.clear();
+    if (build_transpose) {
+        m_dof_start.assign(m_num_dofs + 1, 0);
+        for (auto col : m_col)
+            m_dof_start[col + 1]++;
+        for (unsigned int i = 0; i < m_num_dofs; i++)
+            m_dof_start[i + 1] += m_dof_start[i];
+        m_row.resize(m_col.size());
+        m_EqT.resize(m_col.size());
+        std::vector<unsigned int> pos(m_dof_start.begin(), m_dof_start.end() - 1);
+        for (unsigned int row = 0; row < num_rows; row++) {
+            for (unsigned int k = m_row_start[row]; k < m_row_start[row + 1]; k++) {
+                unsigned int p = pos[m_col[k]]++;
+                m_row[p] = row;
+                m_EqT[p] = m_Eq[k];
+            }
+        }
+    }
+
+    // Greedy first-fit coloring of the units, such that units with the same color share no variable
+    m_colors.clear();
+    if (build_colors) {
+        // colors of the units already processed, for each variable
+        std::vector<std::vector<unsigned int>> var_colors(variables.size());
+
+        // colors unavailable for the current unit are marked with the unit index
+        std::vector<unsigned int> color_mark;
+
+        std::vector<unsigned int> unit_vars;
+        for (unsigned int iu = 0; iu < GetNumUnits(); iu++) {
+            unit_vars.clear();
+            for (unsigned int k = m_row_start[m_unit_start[iu]]; k < m_row_start[m_unit_start[iu + 1]]; k++) {
+                unsigned int iv = dof_var[m_col[k]];
+                if (std::find(unit_vars.begin(), unit_vars.end(), iv) == unit_vars.end())
+                    unit_vars.push_back(iv);
+            }
+
+            for (auto iv : unit_vars) {
+                for (auto color : var_colors[iv])
+                    color_mark[color] = iu;
+            }
+
+            unsigned int color = 0;
+            while (color < color_mark.size() && color_mark[color] == iu)
+                color++;
+            if (color == m_colors.size()) {
+                m_colors.emplace_back();
+                color_mark.push_back(std::numeric_limits<unsigned int>::max());
+            }
+            m_colors[color].push_back(iu);
+
+            for (auto iv : unit_vars)
+                var_colors[iv].push_back(color);
+        }
+    }
+}
+
+void ChFlatConstraints::IncrementStateAll(const ChVectorDynamic<>& deltas, ChVectorDynamic<>& q, int num_threads) const {
+    assert(m_dof_start.size() == m_num_dofs + 1);
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)m_num_dofs; i++) {
+        double sum = 0;
+        for (unsigned int k = m_dof_start[i]; k < m_dof_start[i + 1]; k++)
+            sum += m_EqT[k] * deltas(m_row[k]);
+        q(i) += sum;
+    }
+}
+
+}  // end namespace chrono
@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#ifndef CH_FLAT_CONSTRAINTS_H
+#define CH_FLAT_CONSTRAINTS_H
+
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Flattened representation of the active constraints in a system descriptor.
+/// The Jacobian rows [Cq_i] and the corresponding vectors [Eq_i] = [invM]*[Cq_i]' of all active constraints are
+/// compiled in contiguous compressed-row arrays, indexed by the offsets of the active variables in the system-level
+/// state vector. This allows the projected fixed-point iterative solvers (ChSolverPSOR, ChSolverPJacobi) to iterate
+/// on a single state vector, without per-constraint virtual calls.
+///
+/// Constraints are grouped in units, updated together by the solvers: a unit is either a single constraint, a
+/// friction triplet (N,U,V), or the 6 rows (N,U,V,Rx,Ru,Rv) of a rolling contact. Optionally, units can be colored
+/// such that no two units with the same color act on the same variable; all units of a given color can then be
+/// processed concurrently in a Gauss-Seidel sweep.
+class ChApi ChFlatConstraints {
+  public:
+    ChFlatConstraints() {}
+    ~ChFlatConstraints() {}
+
+    /// Compile the flattened constraint data for the active constraints and variables in the given descriptor.
+    /// Must be called after Update_auxiliary() was invoked for all constraints. Optionally, construct the transposed
+    /// [Eq] arrays (required by IncrementStateAll) and the unit coloring.
+    void Build(ChSystemDescriptor& sysd, bool build_transpose, bool build_colors);
+
+    /// Get the number of active variable DOFs (size of the state vector).
+    unsigned int GetNumDOFs() const { return m_num_dofs; }
+
+    /// Get the number of active constraints (rows).
+    unsigned int GetNumRows() const { return (unsigned int)m_constraints.size(); }
+
+    /// Get the constraint corresponding to the specified row.
+    ChConstraint* GetConstraint(unsigned int row) const { return m_constraints[row]; }
+
+    /// Get the Schur complement g_i of the specified row.
+    double GetSchurComplement(unsigned int row) const { return m_g[row]; }
+
+    /// Get the right-hand side b_i of the specified row.
+    double GetRightHandSide(unsigned int row) const { return m_b[row]; }
+
+    /// Get the compliance term cfm_i of the specified row.
+    double GetComplianceTerm(unsigned int row) const { return m_cfm[row]; }
+
+    /// Get the mode of the constraint at the specified row.
+    ChConstraint::Mode GetMode(unsigned int row) const { return m_mode[row]; }
+
+    /// Get the number of constraint units (single constraints, friction triplets, or rolling contacts).
+    unsigned int GetNumUnits() const { return (unsigned int)m_unit_start.size() - 1; }
+
+    /// Get the first row of the specified unit.
+    unsigned int GetUnitStart(unsigned int unit) const { return m_unit_start[unit]; }
+
+    /// Get the number of rows in the specified unit (1, 3, or 6).
+    unsigned int GetUnitSize(unsigned int unit) const { return m_unit_start[unit + 1] - m_unit_start[unit]; }
+
+    /// Get the number of unit colors (0 if coloring was not requested).
+    unsigned int GetNumColors() const { return (unsigned int)m_colors.size(); }
+
+    /// Get the list of units with the specified color.
+    const std::vector<unsigned int>& GetColorUnits(unsigned int color) const { return m_colors[color]; }
+
+    /// Compute [Cq_i]*q for the specified row.
+    double ComputeJacobianTimesState(unsigned int row, const ChVectorDynamic<>& q) const {
+        double result = 0;
+        for (unsigned int k = m_row_start[row]; k < m_row_start[row + 1]; k++)
+            result += m_Cq[k] * q(m_col[k]);
+        return result;
+    }
+
+    /// Increment the state vector for the specified row: q += [Eq_i]*delta.
+    void IncrementState(unsigned int row, double delta, ChVectorDynamic<>& q) const {
+        for (unsigned int k = m_row_start[row]; k < m_row_start[row + 1]; k++)
+            q(m_col[k]) += m_Eq[k] * delta;
+    }
+
+    /// Increment the state vector for all rows: q += [Eq]*deltas.
+    /// Requires the transposed arrays (see Build). Each entry of q is updated by a single thread.
+    void IncrementStateAll(const ChVectorDynamic<>& deltas, ChVectorDynamic<>& q, int num_threads) const;
+
+  private:
+    unsigned int m_num_dofs = 0;
+
+    std::vector<ChConstraint*> m_constraints;  ///< active constraints, in row order
+    std::vector<double> m_g;                   ///< Schur complements
+    std::vector<double> m_b;                   ///< right-hand sides
+    std::vector<double> m_cfm;                 ///< compliance terms
+    std::vector<ChConstraint::Mode> m_mode;    ///< constraint modes
+
+    std::vector<unsigned int> m_row_start;  ///< start of each row in the compressed arrays
+    std::vector<unsigned int> m_col;        ///< state vector index of each entry
+    std::vector<double> m_Cq;               ///< Jacobian entries
+    std::vector<double> m_Eq;               ///< entries of [invM]*[Cq]'
+
+    std::vector<unsigned int> m_dof_start;  ///< start of each state entry in the transposed arrays
+    std::vector<unsigned int> m_row;        ///< row index of each transposed entry
+    std::vector<double> m_EqT;              ///< transposed entries of [invM]*[Cq]'
+
+    std::vector<unsigned int> m_unit_start;           ///< first row of each unit
+    std::vector<std::vector<unsigned int>> m_colors;  ///< units of each color
+
+    ChSparseMatrix m_jacobian;  ///< scratch matrix for collecting the constraint Jacobians
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
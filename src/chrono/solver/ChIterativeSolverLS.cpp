@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a diagonal or a block-Jacobi preconditioner.
 //
 // Available solvers:
 //   GMRES
@@ -24,6 +24,8 @@
 //
 // =============================================================================
 
+#include <Eigen/LU>
+
 #include "chrono/solver/ChIterativeSolverLS.h"
 
 // =============================================================================
@@ -80,7 +82,7 @@ class ChMatrixSPMV : public Eigen::EigenBase<ChMatrixSPMV> {
     chrono::ChVectorDynamic<> m_vect;    // workspace for the result of the SPMV operation
 };
 
-/// Simple diagonal preconditioner
+/// Simple diagonal or block-diagonal preconditioner
 class ChDiagonalPreconditioner {
     typedef double Scalar;
 
@@ -88,12 +90,18 @@ class ChDiagonalPreconditioner {
     typedef int StorageIndex;
     enum { ColsAtCompileTime = Eigen::Dynamic, MaxColsAtCompileTime = Eigen::Dynamic };
 
-    ChDiagonalPreconditioner() : m_N(0), m_diag_precond(false), m_invdiag(nullptr) {}
+    ChDiagonalPreconditioner()
+        : m_N(0), m_diag_precond(false), m_invdiag(nullptr), m_block_offsets(nullptr), m_invblocks(nullptr) {}
 
-    void Setup(Eigen::Index N, const ChVectorDynamic<>& invdiag) {
+    void Setup(Eigen::Index N,
+               const ChVectorDynamic<>& invdiag,
+               const std::vector<unsigned int>& block_offsets,
+               const std::vector<ChMatrixDynamic<>>& invblocks) {
         m_N = N;
         m_invdiag = &invdiag;
         m_diag_precond = (invdiag.size() > 0);
+        m_block_offsets = &block_offsets;
+        m_invblocks = &invblocks;
     }
 
     Eigen::Index rows() const { return m_N; }
@@ -119,6 +127,14 @@ class ChDiagonalPreconditioner {
         } else {
             x = b;
         }
+
+        // Overwrite the rows of the diagonal blocks
+        for (size_t i = 0; i < m_invblocks->size(); i++) {
+            const auto& invblock = (*m_invblocks)[i];
+            auto offset = (*m_block_offsets)[i];
+            auto size = invblock.rows();
+            x.segment(offset, size).noalias() = invblock * b.segment(offset, size);
+        }
     }
 
     template <typename Rhs>
@@ -129,9 +145,11 @@ class ChDiagonalPreconditioner {
     Eigen::ComputationInfo info() { return Eigen::Success; }
 
   protected:
-    Eigen::Index m_N;                    // problem dimension
-    const ChVectorDynamic<>* m_invdiag;  // pointer to (invcerse) diagonal entries
-    bool m_diag_precond;                 // if false, no preconditioning
+    Eigen::Index m_N;                                   // problem dimension
+    const ChVectorDynamic<>* m_invdiag;                 // pointer to (invcerse) diagonal entries
+    bool m_diag_precond;                                // if false, no diagonal preconditioning
+    const std::vector<unsigned int>* m_block_offsets;   // pointer to offsets of diagonal blocks
+    const std::vector<ChMatrixDynamic<>>* m_invblocks;  // pointer to inverse diagonal blocks
 };
 
 }  // namespace chrono
@@ -172,7 +190,7 @@ CH_FACTORY_REGISTER(ChSolverGMRES)
 CH_FACTORY_REGISTER(ChSolverBiCGSTAB)
 CH_FACTORY_REGISTER(ChSolverMINRES)
 
-ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false) {
+ChIterativeSolverLS::ChIterativeSolverLS() : ChIterativeSolver(-1, -1.0, true, false), m_use_block_precond(false) {
     m_spmv = new ChMatrixSPMV();
 }
 
@@ -188,7 +206,7 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     m_spmv->Setup(dim, sysd);
 
     // If needed, evaluate the inverse diagonal entries
-    if (m_use_precond) {
+    if (m_use_precond || m_use_block_precond) {
         m_invdiag.resize(dim);
         sysd.BuildDiagonalVector(m_invdiag);
         for (int i = 0; i < dim; i++) {
@@ -199,6 +217,12 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
         }
     }
 
+    // If needed, evaluate the inverse diagonal blocks
+    m_block_offsets.clear();
+    m_invblocks.clear();
+    if (m_use_block_precond)
+        SetupBlockPreconditioner(sysd);
+
     // If needed, evaluate the initial guess
     if (m_warm_start) {
         m_initguess.resize(dim);
@@ -215,6 +239,64 @@ bool ChIterativeSolverLS::Setup(ChSystemDescriptor& sysd) {
     return result;
 }
 
+// Assemble the diagonal block of the system matrix for each active variable object (from the variable mass and all KRM
+// blocks referencing that variable) and store its inverse. Singular blocks are skipped (diagonal preconditioning is
+// used for the corresponding rows). Variables with a single DOF are already handled by the diagonal preconditioner.
+void ChIterativeSolverLS::SetupBlockPreconditioner(ChSystemDescriptor& sysd) {
+    unsigned int n_q = sysd.CountActiveVariables();
+    double c_a = sysd.GetMassFactor();
+
+    // Mass contributions (evaluated column by column through mass-vector products)
+    std::vector<int> block_index(n_q, -1);  // index of the block starting at a given offset
+    std::vector<ChVariables*> block_vars;
+    std::vector<ChMatrixDynamic<>> blocks;
+    for (const auto& var : sysd.GetVariables()) {
+        if (!var->IsActive() || var->GetDOF() < 2)
+            continue;
+        unsigned int ndof = var->GetDOF();
+        ChMatrixDynamic<> block(ndof, ndof);
+        ChVectorDynamic<> e(ndof);
+        ChVectorDynamic<> col(ndof);
+        for (unsigned int k = 0; k < ndof; k++) {
+            e.setZero();
+            e(k) = 1;
+            col.setZero();
+            var->AddMassTimesVector(col, e);
+            block.col(k) = c_a * col;
+        }
+        block_index[var->GetOffset()] = (int)blocks.size();
+        block_vars.push_back(var);
+        blocks.push_back(block);
+    }
+
+    // KRM contributions
+    for (const auto& krm_block : sysd.GetKRMBlocks()) {
+        auto KRM = krm_block->GetMatrix();
+        unsigned int kio = 0;
+        for (unsigned int iv = 0; iv < krm_block->GetNumVariables(); iv++) {
+            auto var = krm_block->GetVariable(iv);
+            unsigned int in = var->GetDOF();
+            if (var->IsActive() && in > 1) {
+                int index = block_index[var->GetOffset()];
+                if (index >= 0)
+                    blocks[index] += KRM.block(kio, kio, in, in);
+            }
+            kio += in;
+        }
+    }
+
+    // Invert diagonal blocks
+    m_block_offsets.reserve(blocks.size());
+    m_invblocks.reserve(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++) {
+        Eigen::FullPivLU<ChMatrixDynamic<>> lu(blocks[i]);
+        if (!lu.isInvertible())
+            continue;
+        m_block_offsets.push_back(block_vars[i]->GetOffset());
+        m_invblocks.push_back(lu.inverse());
+    }
+}
+
 double ChIterativeSolverLS::Solve(ChSystemDescriptor& sysd) {
     // Assemble the problem right-hand side vector
     sysd.BuildSystemMatrix(nullptr, &m_rhs);
@@ -251,7 +333,7 @@ ChSolverGMRES::~ChSolverGMRES() {
 }
 
 bool ChSolverGMRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -296,7 +378,7 @@ ChSolverBiCGSTAB::~ChSolverBiCGSTAB() {
 }
 
 bool ChSolverBiCGSTAB::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -342,7 +424,7 @@ ChSolverMINRES::~ChSolverMINRES() {
 }
 
 bool ChSolverMINRES::SetupProblem() {
-    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag);
+    m_engine->preconditioner().Setup(m_rhs.size(), m_invdiag, m_block_offsets, m_invblocks);
     m_engine->compute(*m_spmv);
     return (m_engine->info() == Eigen::Success);
 }
@@ -15,7 +15,7 @@
 // Chrono solvers based on Eigen iterative linear solvers.
 // All iterative linear solvers are implemented in a matrix-free context and
 // rely on the system descriptor for the required SPMV operations.
-// They can optionally use a diagonal preconditioner.
+// They can optionally use a diagonal or a block-Jacobi preconditioner.
 //
 // Available solvers:
 //   GMRES
@@ -54,7 +54,10 @@ Cannot handle VI and complementarity problems, so they cannot be used with NSC f
 
 All iterative solvers are implemented in a matrix-free context and rely on the system descriptor for the required
 SPMV operations. See ChSystemDescriptor for more information about the problem formulation and the data structures
-passed to the solver.
+passed to the solver. In particular, the system matrix is never assembled: products with the system matrix are
+evaluated from the variable masses, the element-level KRM blocks (e.g., FEA element stiffness matrices), and the
+constraint Jacobians. For large FEA problems, this avoids the memory and time required for assembling and factorizing
+the global sparse matrix, as done by the direct sparse solvers.
 
 The default value for the maximum number of iterations is twice the matrix size.
 
@@ -63,6 +66,10 @@ residual error: |Ax - b|/|b|. Default: machine precision.
 
 By default, these solvers use a diagonal preconditioner and no warm start. Recall that the warm start option should
 be used **only** in conjunction with the Euler implicit linearized integrator.
+
+Optionally, a block-Jacobi preconditioner can be used (see #EnableBlockJacobiPreconditioner). This uses the inverses
+of the diagonal blocks of the system matrix corresponding to each variable object (e.g., 3x3 blocks for FEA xyz nodes,
+6x6 blocks for rigid bodies and xyzD nodes), which better captures the coupling between the coordinates of a node.
 */
 class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
   public:
@@ -77,9 +84,19 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     /// Return the maximum constraint violation after termination.
     virtual double Solve(ChSystemDescriptor& sysd) override;
 
+    /// Enable/disable use of a block-Jacobi preconditioner (default: false).
+    /// If enabled, the preconditioner uses the inverses of the diagonal blocks of the system matrix associated with
+    /// each variable object, assembled from the variable masses and the KRM blocks. Rows without an invertible diagonal
+    /// block (e.g., constraint rows) use the diagonal preconditioner. This setting takes precedence over
+    /// EnableDiagonalPreconditioner.
+    void EnableBlockJacobiPreconditioner(bool val) { m_use_block_precond = val; }
+
   protected:
     ChIterativeSolverLS();
 
+    /// Evaluate the inverse diagonal blocks for block-Jacobi preconditioning.
+    void SetupBlockPreconditioner(ChSystemDescriptor& sysd);
+
     virtual bool IsIterative() const override { return true; }
     virtual bool IsDirect() const override { return false; }
     virtual ChIterativeSolver* AsIterative() override { return this; }
@@ -99,6 +116,10 @@ class ChApi ChIterativeSolverLS : public ChIterativeSolver, public ChSolverLS {
     ChVectorDynamic<double> m_rhs;        ///< right-hand side vector
     ChVectorDynamic<double> m_invdiag;    ///< inverse diagonal entries (for preconditioning)
     ChVectorDynamic<double> m_initguess;  ///< initial guess (for warm start)
+
+    bool m_use_block_precond;                          ///< use block-Jacobi preconditioning?
+    std::vector<unsigned int> m_block_offsets;         ///< offsets of diagonal blocks (for block-Jacobi)
+    std::vector<ChMatrixDynamic<double>> m_invblocks;  ///< inverse diagonal blocks (for block-Jacobi)
 };
 
 // ---------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 #include "chrono/core/ChSparsityPatternLearner.h"
 
 #include "chrono/solver/ChSolverADMM.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
@@ -287,6 +288,7 @@ double ChSolverADMM::_SolveBasic(ChSystemDescriptor& sysd) {
     */
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // diagnostic
         l_old = l;
         z_old = z;
@@ -698,6 +700,7 @@ double ChSolverADMM::_SolveFast(ChSystemDescriptor& sysd) {
     */
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // diagnostic
         l_old = l;
         z_old = z;
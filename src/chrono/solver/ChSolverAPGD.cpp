@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverAPGD.h"
+#include "chrono/utils/ChTrace.h"
 
 #include <iostream>
 #include <sstream>
@@ -153,6 +154,7 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
 
     // (7) for k := 0 to N_max
     for (m_iterations = 0; m_iterations < m_max_iterations; m_iterations++) {
+        CH_TRACE("SolverIteration");
         // (8) g = N * y_k - r
         // (9) gamma_(k+1) = ProjectionOperator(y_k - t_k * g)
         sysd.SchurComplementProduct(g, y);  // g = N * y
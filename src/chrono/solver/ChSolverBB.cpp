@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverBB.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
@@ -158,6 +159,7 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
     std::vector<double> f_hist;
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // Dg = Di*g;
         mDg = mg;
         if (m_use_precond)
@@ -13,13 +13,14 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPJacobi)
 
-ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0) {
+ChSolverPJacobi::ChSolverPJacobi() : maxviolation(0), m_flat_kernel(false), m_num_threads(1) {
     m_omega = 0.2;
 }
 
@@ -63,6 +64,10 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
         if (mvariables[iv]->IsActive())
             mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
 
+    // Use the flattened constraint kernel for steps 3) and 4), if so requested
+    if (m_flat_kernel)
+        return SolveFlat(sysd);
+
     // 3)  For all items with variables, add the effect of initial (guessed)
     //     lagrangian reactions of constraints, if a warm start is desired.
     //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
@@ -79,6 +84,7 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     delta_gammas.resize(mconstraints.size());
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // The iteration on all constraints
         //
 
@@ -186,4 +192,122 @@ double ChSolverPJacobi::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+double ChSolverPJacobi::SolveFlat(ChSystemDescriptor& sysd) {
+    // Compile the flattened constraint data (with transposed arrays for the state update)
+    m_flat.Build(sysd, true, false);
+
+    unsigned int num_rows = m_flat.GetNumRows();
+    unsigned int num_units = m_flat.GetNumUnits();
+
+    // Gather the unconstrained state q = [M]'*fb and the initial lagrangian multipliers
+    // (as in the sequential implementation, the state is not updated for a warm start)
+    ChVectorDynamic<> q;
+    ChVectorDynamic<> l;
+    sysd.FromVariablesToVector(q);
+    if (m_warm_start) {
+        sysd.FromConstraintsToVector(l);
+    } else {
+        for (auto constr : sysd.GetConstraints())
+            constr->SetLagrangeMultiplier(0.);
+        l.setZero(num_rows);
+    }
+
+    ChVectorDynamic<> delta_gammas(num_rows);
+    std::vector<double> unit_violation(num_units);
+    std::vector<double> unit_deltalambda(num_units);
+
+    // Update the lagrangian multipliers of a single constraint or friction triplet starting at the given row, using
+    // the state at the previous iteration. Accumulate the constraint violation and the largest multiplier change.
+    auto update_rows = [&](unsigned int row, unsigned int size, double& violation, double& deltalambda) {
+        double old_lambda[3];
+
+        for (unsigned int i = 0; i < size; i++) {
+            ChConstraint* constr = m_flat.GetConstraint(row + i);
+
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = m_flat.ComputeJacobianTimesState(row + i, q) + m_flat.GetRightHandSide(row + i) +
+                               m_flat.GetComplianceTerm(row + i) * l(row + i);
+            if (size == 3) {
+                if (i == 0)
+                    violation = std::max(violation, fabs(std::min(0.0, mresidual)));
+            } else {
+                violation = std::max(violation, fabs(constr->Violation(mresidual)));
+            }
+
+            // update:   lambda += delta_lambda;
+            double deltal = (m_omega / m_flat.GetSchurComplement(row + i)) * (-mresidual);
+            old_lambda[i] = l(row + i);
+            constr->SetLagrangeMultiplier(old_lambda[i] + deltal);
+        }
+
+        // If new lagrangian multipliers do not satisfy inequalities, project them onto the admissible set
+        // (for a friction triplet, the N normal component will take care of N,U,V)
+        m_flat.GetConstraint(row)->Project();
+
+        for (unsigned int i = 0; i < size; i++) {
+            double new_lambda = m_flat.GetConstraint(row + i)->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0)
+                new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[i];
+            l(row + i) = new_lambda;
+            delta_gammas(row + i) = new_lambda - old_lambda[i];
+            deltalambda = std::max(deltalambda, fabs(delta_gammas(row + i)));
+        }
+    };
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
+        // Update all units using the state at the previous iteration
+#pragma omp parallel for num_threads(m_num_threads)
+        for (int iu = 0; iu < (int)num_units; iu++) {
+            unsigned int row = m_flat.GetUnitStart(iu);
+            unsigned int size = m_flat.GetUnitSize(iu);
+            double violation = 0;
+            double deltalambda = 0;
+
+            if (size == 6) {
+                // Rolling contact: the projection of the rolling triplet Rx,Ru,Rv also corrects the N,U,V multipliers.
+                // As in the sequential sweep, these corrections are kept but do not contribute to the state update.
+                update_rows(row, 3, violation, deltalambda);
+                for (unsigned int i = 0; i < 3; i++)
+                    m_flat.GetConstraint(row + i)->SetLagrangeMultiplier(l(row + i));
+                update_rows(row + 3, 3, violation, deltalambda);
+                for (unsigned int i = 0; i < 3; i++)
+                    l(row + i) = m_flat.GetConstraint(row + i)->GetLagrangeMultiplier();
+            } else {
+                update_rows(row, size, violation, deltalambda);
+            }
+
+            unit_violation[iu] = violation;
+            unit_deltalambda[iu] = deltalambda;
+        }
+
+        // Now, after all deltas are updated, increment  q += [invM][Cq]'* delta_l
+        m_flat.IncrementStateAll(delta_gammas, q, m_num_threads);
+
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+        for (unsigned int iu = 0; iu < num_units; iu++) {
+            maxviolation = std::max(maxviolation, unit_violation[iu]);
+            maxdeltalambda = std::max(maxdeltalambda, unit_deltalambda[iu]);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+
+    // Scatter the final state and lagrangian multipliers
+    sysd.FromVectorToVariables(q);
+    sysd.FromVectorToConstraints(l);
+
+    return maxviolation;
+}
+
 }  // end namespace chrono
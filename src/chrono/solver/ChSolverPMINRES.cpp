@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPMINRES.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
@@ -165,6 +166,7 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     std::vector<double> f_hist;
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // MNp = Mi*Np; % = Mi*N*p                  %% -- Precond
         if (m_use_precond)
             mMNp = mNp.array() * mDi.array();
@@ -375,6 +377,7 @@ double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
     //
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // MZp = Mi*Zp; % = Mi*Z*p                  %% -- Precond
         if (m_use_precond)
             mMZp = mZp.array() * mDi.array();
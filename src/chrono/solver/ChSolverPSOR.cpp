@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
@@ -20,7 +21,7 @@ namespace chrono {
 CH_FACTORY_REGISTER(ChSolverPSOR)
 CH_UPCASTING(ChSolverPSOR, ChIterativeSolverVI)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_flat_kernel(false), m_num_threads(1) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraints();
@@ -63,6 +64,10 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
             mvariables[iv]->ComputeMassInverseTimesVector(mvariables[iv]->State(), mvariables[iv]->Force());  // q = [M]'*fb
     }
 
+    // Use the flattened constraint kernel for steps 3) and 4), if so requested
+    if (m_flat_kernel)
+        return SolveFlat(sysd);
+
     // 3)  For all items with variables, add the effect of initial (guessed)
     //     lagrangian reactions of constraints, if a warm start is desired.
     //     Otherwise, if no warm start, simply resets initial lagrangians to zero.
@@ -79,6 +84,7 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     //
 
     for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
         // The iteration on all constraints
         //
 
@@ -207,4 +213,141 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     return maxviolation;
 }
 
+double ChSolverPSOR::SolveFlat(ChSystemDescriptor& sysd) {
+    // Compile the flattened constraint data (with unit coloring for a concurrent sweep)
+    m_flat.Build(sysd, false, m_num_threads > 1);
+
+    unsigned int num_rows = m_flat.GetNumRows();
+    unsigned int num_units = m_flat.GetNumUnits();
+
+    // Gather the unconstrained state q = [M]'*fb and the initial lagrangian multipliers
+    ChVectorDynamic<> q;
+    ChVectorDynamic<> l;
+    sysd.FromVariablesToVector(q);
+    if (m_warm_start) {
+        sysd.FromConstraintsToVector(l);
+        for (unsigned int row = 0; row < num_rows; row++)
+            m_flat.IncrementState(row, l(row), q);
+    } else {
+        for (auto constr : sysd.GetConstraints())
+            constr->SetLagrangeMultiplier(0.);
+        l.setZero(num_rows);
+    }
+
+    std::vector<double> unit_violation(num_units);
+    std::vector<double> unit_deltalambda(num_units);
+
+    // Update the lagrangian multipliers of a single constraint or friction triplet starting at the given row and the
+    // state q. Accumulate the constraint violation and the largest multiplier change.
+    auto update_rows = [&](unsigned int row, unsigned int size, double& violation, double& deltalambda) {
+        double old_lambda[3];
+        double new_lambda[3];
+
+        if (size == 3) {
+            for (unsigned int i = 0; i < 3; i++) {
+                // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+                double mresidual = m_flat.ComputeJacobianTimesState(row + i, q) + m_flat.GetRightHandSide(row + i) +
+                                   m_flat.GetComplianceTerm(row + i) * l(row + i);
+                if (i == 0)
+                    violation = std::max(violation, fabs(std::min(0.0, mresidual)));
+
+                // update:   lambda += delta_lambda;
+                double deltal = (m_omega / m_flat.GetSchurComplement(row + i)) * (-mresidual);
+                old_lambda[i] = l(row + i);
+                m_flat.GetConstraint(row + i)->SetLagrangeMultiplier(old_lambda[i] + deltal);
+            }
+            m_flat.GetConstraint(row)->Project();  // the N normal component will take care of N,U,V
+        } else {
+            ChConstraint* constr = m_flat.GetConstraint(row);
+            double mresidual = m_flat.ComputeJacobianTimesState(row, q) + m_flat.GetRightHandSide(row) +
+                               m_flat.GetComplianceTerm(row) * l(row);
+            if (m_flat.GetMode(row) == ChConstraint::Mode::UNILATERAL)
+                violation = std::max(violation, fabs(std::min(0.0, mresidual)));
+            else
+                violation = std::max(violation, fabs(constr->Violation(mresidual)));
+
+            double deltal = (m_omega / m_flat.GetSchurComplement(row)) * (-mresidual);
+            old_lambda[0] = l(row);
+            constr->SetLagrangeMultiplier(old_lambda[0] + deltal);
+            constr->Project();
+        }
+
+        for (unsigned int i = 0; i < size; i++) {
+            new_lambda[i] = m_flat.GetConstraint(row + i)->GetLagrangeMultiplier();
+            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+            if (m_shlambda != 1.0)
+                new_lambda[i] = m_shlambda * new_lambda[i] + (1.0 - m_shlambda) * old_lambda[i];
+            l(row + i) = new_lambda[i];
+        }
+        for (unsigned int i = 0; i < size; i++) {
+            double true_delta = new_lambda[i] - old_lambda[i];
+            m_flat.IncrementState(row + i, true_delta, q);
+            deltalambda = std::max(deltalambda, fabs(true_delta));
+        }
+    };
+
+    // Update the lagrangian multipliers of a unit and the state q.
+    // Units of the same color do not share variables and can be updated concurrently.
+    auto update_unit = [&](unsigned int iu) {
+        unsigned int row = m_flat.GetUnitStart(iu);
+        unsigned int size = m_flat.GetUnitSize(iu);
+        double violation = 0;
+        double deltalambda = 0;
+
+        if (size == 6) {
+            // Rolling contact: the projection of the rolling triplet Rx,Ru,Rv also corrects the N,U,V multipliers.
+            // As in the sequential sweep, these corrections are kept but do not increment the state.
+            update_rows(row, 3, violation, deltalambda);
+            for (unsigned int i = 0; i < 3; i++)
+                m_flat.GetConstraint(row + i)->SetLagrangeMultiplier(l(row + i));
+            update_rows(row + 3, 3, violation, deltalambda);
+            for (unsigned int i = 0; i < 3; i++)
+                l(row + i) = m_flat.GetConstraint(row + i)->GetLagrangeMultiplier();
+        } else {
+            update_rows(row, size, violation, deltalambda);
+        }
+
+        unit_violation[iu] = violation;
+        unit_deltalambda[iu] = deltalambda;
+    };
+
+    for (int iter = 0; iter < m_max_iterations; iter++) {
+        CH_TRACE("SolverIteration");
+        if (m_flat.GetNumColors() > 0) {
+            for (unsigned int color = 0; color < m_flat.GetNumColors(); color++) {
+                const auto& units = m_flat.GetColorUnits(color);
+#pragma omp parallel for num_threads(m_num_threads)
+                for (int i = 0; i < (int)units.size(); i++)
+                    update_unit(units[i]);
+            }
+        } else {
+            for (unsigned int iu = 0; iu < num_units; iu++)
+                update_unit(iu);
+        }
+
+        maxviolation = 0;
+        double maxdeltalambda = 0;
+        for (unsigned int iu = 0; iu < num_units; iu++) {
+            maxviolation = std::max(maxviolation, unit_violation[iu]);
+            maxdeltalambda = std::max(maxdeltalambda, unit_deltalambda[iu]);
+        }
+
+        // For recording into violation history, if debugging
+        if (this->record_violation_history)
+            AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+        m_iterations++;
+
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < m_tolerance)
+            break;
+    }
+
+    // Scatter the final state and lagrangian multipliers
+    sysd.FromVectorToVariables(q);
+    sysd.FromVectorToConstraints(l);
+
+    return maxviolation;
+}
+
 }  // end namespace chrono
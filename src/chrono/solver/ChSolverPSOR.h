@@ -15,7 +15,10 @@
 #ifndef CHSOLVER_PSOR_H
 #define CHSOLVER_PSOR_H
 
+#include <algorithm>
+
 #include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/solver/ChFlatConstraints.h"
 
 namespace chrono {
 
@@ -44,8 +47,25 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable the flattened constraint kernel (default: false).
+    /// If enabled, the constraint Jacobians are compiled at each call to Solve() into contiguous arrays (see
+    /// ChFlatConstraints) and the iterations operate on a single system-level state vector. With more than one thread,
+    /// groups of constraints which do not share variables are updated concurrently (colored Gauss-Seidel sweep). This
+    /// changes the order of the updates with respect to the sequential sweep, but not the converged solution.
+    void EnableFlatKernel(bool val) { m_flat_kernel = val; }
+
+    /// Set the number of OpenMP threads used by the flattened constraint kernel (default: 1).
+    void SetNumThreads(int num_threads) { m_num_threads = std::max(num_threads, 1); }
+
   private:
+    /// Perform the solver iterations using the flattened constraint kernel.
+    double SolveFlat(ChSystemDescriptor& sysd);
+
     double maxviolation;
+
+    bool m_flat_kernel;        ///< use the flattened constraint kernel
+    int m_num_threads;         ///< number of threads for the flattened constraint kernel
+    ChFlatConstraints m_flat;  ///< flattened constraint data
 };
 
 /// @} chrono_solver
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChSolverPSSOR.h"
+#include "chrono/utils/ChTrace.h"
 
 namespace chrono {
 
@@ -74,6 +75,7 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
 
     // 4)  Perform the iteration loops
     for (int iter = 0; iter < m_max_iterations;) {
+        CH_TRACE("SolverIteration");
         //
         // Forward sweep, for symmetric SOR
         //
@@ -53,6 +53,7 @@ class ChBenchmarkTest {
     double m_timer_collision;         ///< time for collision detection
     double m_timer_collision_broad;   ///< time for broad-phase collision
     double m_timer_collision_narrow;  ///< time for narrow-phase collision
+    double m_timer_collision_report;  ///< time for reporting contacts
     double m_timer_setup;             ///< time for system update
     double m_timer_update;            ///< time for system update
 };
@@ -66,6 +67,7 @@ inline ChBenchmarkTest::ChBenchmarkTest()
       m_timer_collision(0),
       m_timer_collision_broad(0),
       m_timer_collision_narrow(0),
+      m_timer_collision_report(0),
       m_timer_setup(0),
       m_timer_update(0) {}
 
@@ -82,6 +84,7 @@ inline void ChBenchmarkTest::Simulate(int num_steps) {
         m_timer_collision += GetSystem()->GetTimerCollision();
         m_timer_collision_broad += GetSystem()->GetTimerCollisionBroad();
         m_timer_collision_narrow += GetSystem()->GetTimerCollisionNarrow();
+        m_timer_collision_report += GetSystem()->GetTimerCollisionReport();
         m_timer_setup += GetSystem()->GetTimerSetup();
         m_timer_update += GetSystem()->GetTimerUpdate();
     }
@@ -96,6 +99,7 @@ inline void ChBenchmarkTest::ResetTimers() {
     m_timer_collision = 0;
     m_timer_collision_broad = 0;
     m_timer_collision_narrow = 0;
+    m_timer_collision_report = 0;
     m_timer_setup = 0;
     m_timer_update = 0;
 }
@@ -171,6 +175,7 @@ class ChBenchmarkFixture : public ::benchmark::Fixture {
         st.counters["CD_Total"] = m_test->m_timer_collision * 1e3;
         st.counters["CD_Broad"] = m_test->m_timer_collision_broad * 1e3;
         st.counters["CD_Narrow"] = m_test->m_timer_collision_narrow * 1e3;
+        st.counters["CD_Report"] = m_test->m_timer_collision_report * 1e3;
     }
 
     void Reset(int num_init_steps) {
@@ -0,0 +1,242 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+#include <iomanip>
+#include <thread>
+
+#include <Eigen/Core>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+#include "chrono/utils/ChOpenMP.h"
+
+namespace chrono {
+namespace utils {
+
+ChEnsembleRunner::ChEnsembleRunner(unsigned int num_workers)
+    : m_num_workers(num_workers), m_steps_per_task(100), m_num_active(0), m_num_steals(0), m_wall_time(0) {
+    if (m_num_workers == 0)
+        m_num_workers = std::max(std::thread::hardware_concurrency(), 1u);
+}
+
+ChEnsembleRunner::~ChEnsembleRunner() {}
+
+void ChEnsembleRunner::AddMember(std::shared_ptr<ChEnsembleMember> member) {
+    m_members.push_back(member);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChEnsembleRunner::Run() {
+    auto num_members = m_members.size();
+
+    m_stats.assign(num_members, ChEnsembleMemberStats());
+    m_initialized.assign(num_members, 0);
+    m_num_active = num_members;
+    m_num_steals = 0;
+
+    // Distribute the members round-robin over the worker queues
+    unsigned int num_workers = (unsigned int)std::min<size_t>(m_num_workers, std::max<size_t>(num_members, 1));
+    m_queues.clear();
+    for (unsigned int w = 0; w < num_workers; w++)
+        m_queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue));
+    for (size_t i = 0; i < num_members; i++)
+        m_queues[i % num_workers]->tasks.push_back(i);
+
+    // The number of Eigen threads is a global setting. It is set here, before the workers start, so that member
+    // systems (which use a single Eigen thread) find it already set and do not write it from the worker threads.
+    int eigen_threads = Eigen::nbThreads();
+    Eigen::setNbThreads(1);
+
+    ChTimer timer;
+    timer.start();
+
+    // All workers run on new threads, so that the OpenMP settings of the calling thread are not modified
+    std::vector<std::thread> threads;
+    for (unsigned int w = 0; w < num_workers; w++)
+        threads.push_back(std::thread(&ChEnsembleRunner::Work, this, w));
+    for (auto& t : threads)
+        t.join();
+
+    timer.stop();
+    m_wall_time = timer.GetTimeSeconds();
+
+    Eigen::setNbThreads(eigen_threads);
+}
+
+// Worker loop: execute tasks from the local queue, steal from other queues when it is empty.
+void ChEnsembleRunner::Work(unsigned int worker) {
+    // OpenMP settings are per thread (and this thread is owned by the runner); members run single-threaded
+    ChOMP::SetNumThreads(1);
+
+    size_t task;
+    while (m_num_active > 0) {
+        if (!PopTask(worker, task) && !StealTask(worker, task)) {
+            // All remaining tasks are in progress on other workers
+            std::this_thread::yield();
+            continue;
+        }
+        if (ExecuteTask(worker, task))
+            PushTask(worker, task);
+        else
+            m_num_active--;
+    }
+}
+
+// The owner works at the back of its queue, thieves take from the front.
+bool ChEnsembleRunner::PopTask(unsigned int worker, size_t& task) {
+    auto& queue = *m_queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.tasks.empty())
+        return false;
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+    return true;
+}
+
+bool ChEnsembleRunner::StealTask(unsigned int worker, size_t& task) {
+    auto num_workers = (unsigned int)m_queues.size();
+    for (unsigned int k = 1; k < num_workers; k++) {
+        auto& queue = *m_queues[(worker + k) % num_workers];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.tasks.empty()) {
+            task = queue.tasks.front();
+            queue.tasks.pop_front();
+            m_num_steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void ChEnsembleRunner::PushTask(unsigned int worker, size_t task) {
+    auto& queue = *m_queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.push_back(task);
+}
+
+// Advance a member by (up to) the prescribed number of steps.
+// Return true if the member must be advanced further.
+bool ChEnsembleRunner::ExecuteTask(unsigned int worker, size_t task) {
+    auto& member = m_members[task];
+    auto& stats = m_stats[task];
+
+    ChTimer timer;
+    timer.start();
+
+    bool active = true;
+    try {
+        if (!m_initialized[task]) {
+            member->Initialize(*this);
+            if (auto sys = member->GetSystem())
+                sys->SetNumThreads(1, 1, 1);
+            m_initialized[task] = 1;
+        }
+
+        for (unsigned int i = 0; i < m_steps_per_task && active; i++) {
+            active = member->Advance();
+            stats.num_steps++;
+        }
+
+        if (auto sys = member->GetSystem())
+            stats.sim_time = sys->GetChTime();
+
+        if (!active)
+            member->Finalize();
+    } catch (const std::exception& e) {
+        stats.failed = true;
+        stats.error = e.what();
+        active = false;
+    }
+
+    timer.stop();
+    stats.wall_time += timer.GetTimeSeconds();
+    if (!active)
+        stats.worker = (int)worker;
+
+    return active;
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<ChTriangleMeshConnected> ChEnsembleRunner::GetMesh(const std::string& filename,
+                                                                   bool load_normals,
+                                                                   bool load_uv) {
+    auto key = "mesh:" + filename + (load_normals ? ":n" : "") + (load_uv ? ":uv" : "");
+    return GetAsset<ChTriangleMeshConnected>(key, [&]() {
+        return ChTriangleMeshConnected::CreateFromWavefrontFile(filename, load_normals, load_uv);
+    });
+}
+
+void ChEnsembleRunner::ClearAssets() {
+    std::lock_guard<std::mutex> lock(m_assets_mutex);
+    m_assets.clear();
+}
+
+// -----------------------------------------------------------------------------
+
+unsigned int ChEnsembleRunner::GetNumFailed() const {
+    return (unsigned int)std::count_if(m_stats.begin(), m_stats.end(),
+                                       [](const ChEnsembleMemberStats& s) { return s.failed; });
+}
+
+double ChEnsembleRunner::GetThroughput() const {
+    return m_wall_time > 0 ? m_stats.size() / m_wall_time : 0;
+}
+
+double ChEnsembleRunner::GetStepRate() const {
+    if (m_wall_time <= 0)
+        return 0;
+    double num_steps = 0;
+    for (const auto& s : m_stats)
+        num_steps += s.num_steps;
+    return num_steps / m_wall_time;
+}
+
+double ChEnsembleRunner::GetSimulationRate() const {
+    if (m_wall_time <= 0)
+        return 0;
+    double sim_time = 0;
+    for (const auto& s : m_stats)
+        sim_time += s.sim_time;
+    return sim_time / m_wall_time;
+}
+
+void ChEnsembleRunner::PrintStats(std::ostream& os, bool per_member) const {
+    if (per_member) {
+        os << "  member  worker     steps   sim time  wall time        RTF" << std::endl;
+        for (size_t i = 0; i < m_stats.size(); i++) {
+            const auto& s = m_stats[i];
+            os << std::setw(8) << i << std::setw(8) << s.worker << std::setw(10) << s.num_steps;
+            os << std::fixed << std::setprecision(4);
+            os << std::setw(11) << s.sim_time << std::setw(11) << s.wall_time;
+            os << std::setw(11) << (s.sim_time > 0 ? s.wall_time / s.sim_time : 0);
+            os << std::defaultfloat;
+            if (s.failed)
+                os << "  FAILED: " << s.error;
+            os << std::endl;
+        }
+    }
+
+    os << "Ensemble members:   " << m_stats.size() << " (" << GetNumFailed() << " failed)" << std::endl;
+    os << "Worker threads:     " << m_queues.size() << " (" << m_num_steals << " tasks stolen)" << std::endl;
+    os << "Wall time:          " << m_wall_time << " s" << std::endl;
+    os << "Throughput:         " << GetThroughput() << " members/s" << std::endl;
+    os << "Step rate:          " << GetStepRate() << " steps/s" << std::endl;
+    os << "Simulation rate:    " << GetSimulationRate() << " simulated s / s" << std::endl;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,220 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Ensemble runner: advance many independent Chrono systems concurrently, on a
+// pool of worker threads with work stealing.
+//
+// =============================================================================
+
+#ifndef CH_ENSEMBLE_RUNNER_H
+#define CH_ENSEMBLE_RUNNER_H
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+class ChEnsembleRunner;
+
+/// Base class for a member of an ensemble simulation.
+/// A member owns an independent Chrono system (and any other objects needed to advance it, e.g. a vehicle, driver,
+/// and terrain). All virtual functions are called on a worker thread, but never concurrently for the same member.
+class ChApi ChEnsembleMember {
+  public:
+    virtual ~ChEnsembleMember() {}
+
+    /// Construct the member's system.
+    /// Called once, before the first call to Advance. Read-only data common to all members (meshes, parsed input
+    /// files, etc.) should be obtained through the runner's asset cache.
+    virtual void Initialize(ChEnsembleRunner& runner) = 0;
+
+    /// Return the Chrono system of this member.
+    virtual ChSystem* GetSystem() = 0;
+
+    /// Advance the member by one step.
+    /// Return false when the member simulation is complete.
+    virtual bool Advance() = 0;
+
+    /// Process the member after its simulation is complete (e.g., extract results and release the system).
+    virtual void Finalize() {}
+};
+
+/// Execution statistics for one member of an ensemble.
+struct ChApi ChEnsembleMemberStats {
+    double wall_time = 0;        ///< total wall-clock time spent in Initialize, Advance, and Finalize (s)
+    double sim_time = 0;         ///< simulated time reached by the member system
+    unsigned int num_steps = 0;  ///< number of calls to Advance
+    int worker = -1;             ///< worker thread which completed the member
+    bool failed = false;         ///< true if the member threw an exception
+    std::string error;           ///< exception message, for a failed member
+};
+
+/// Ensemble runner for many independent Chrono systems.
+/// Members are advanced concurrently on a pool of worker threads. Each worker has a queue of tasks (a task advances a
+/// member for a given number of steps); a worker whose queue is empty steals tasks from the other workers, so that
+/// members with different costs are balanced automatically.
+///
+/// Each member system is run single-threaded (i.e., with ChSystem::SetNumThreads(1)) and OpenMP parallel regions on
+/// the worker threads use a single thread, which avoids oversubscription and conflicts between the thread settings of
+/// different systems. The workers always run on threads created by Run, so the OpenMP settings of the calling thread
+/// are not modified. The number of Eigen threads is a global setting: it is set to 1 for the duration of Run and
+/// restored afterwards. Members must therefore not request more than one Eigen thread for their systems.
+class ChApi ChEnsembleRunner {
+  public:
+    /// Construct an ensemble runner with the given number of worker threads.
+    /// If 0, use the number of hardware threads.
+    ChEnsembleRunner(unsigned int num_workers = 0);
+
+    ~ChEnsembleRunner();
+
+    /// Add a member to the ensemble.
+    void AddMember(std::shared_ptr<ChEnsembleMember> member);
+
+    /// Set the number of member steps in a task (default: 100).
+    /// Smaller values improve load balancing at the cost of more scheduling overhead.
+    void SetStepsPerTask(unsigned int num_steps) { m_steps_per_task = std::max(num_steps, 1u); }
+
+    /// Run all members to completion.
+    /// The calling thread blocks until all workers are done.
+    /// An exception thrown by a member marks it as failed (see GetMemberStats) and does not affect the other members.
+    void Run();
+
+    /// Get a shared asset with the given key, loading it on first request.
+    /// The loader function is called only once per key, even if several members request the asset concurrently.
+    /// Assets are shared by all members and must be treated as read-only.
+    template <typename T>
+    std::shared_ptr<T> GetAsset(const std::string& key, std::function<std::shared_ptr<T>()> loader);
+
+    /// Get a shared triangle mesh loaded from a Wavefront OBJ file.
+    /// Return an empty pointer if the mesh cannot be loaded.
+    std::shared_ptr<ChTriangleMeshConnected> GetMesh(const std::string& filename,
+                                                     bool load_normals = true,
+                                                     bool load_uv = false);
+
+    /// Remove all cached assets.
+    void ClearAssets();
+
+    /// Get the number of members.
+    size_t GetNumMembers() const { return m_members.size(); }
+
+    /// Get the number of worker threads.
+    unsigned int GetNumWorkers() const { return m_num_workers; }
+
+    /// Get the execution statistics for the specified member.
+    const ChEnsembleMemberStats& GetMemberStats(size_t i) const { return m_stats[i]; }
+
+    /// Get the number of failed members in the last run.
+    unsigned int GetNumFailed() const;
+
+    /// Get the wall-clock time of the last run (s).
+    double GetWallTime() const { return m_wall_time; }
+
+    /// Get the ensemble throughput in the last run (members per second of wall-clock time).
+    double GetThroughput() const;
+
+    /// Get the total number of member steps per second of wall-clock time in the last run.
+    double GetStepRate() const;
+
+    /// Get the total simulated time (over all members) per second of wall-clock time in the last run.
+    double GetSimulationRate() const;
+
+    /// Get the number of tasks stolen by idle workers in the last run.
+    unsigned int GetNumSteals() const { return m_num_steals; }
+
+    /// Print per-member and ensemble statistics.
+    void PrintStats(std::ostream& os = std::cout, bool per_member = false) const;
+
+  private:
+    struct WorkerQueue {
+        std::mutex mutex;
+        std::deque<size_t> tasks;
+    };
+
+    void Work(unsigned int worker);
+    bool PopTask(unsigned int worker, size_t& task);
+    bool StealTask(unsigned int worker, size_t& task);
+    void PushTask(unsigned int worker, size_t task);
+    bool ExecuteTask(unsigned int worker, size_t task);
+
+    unsigned int m_num_workers;
+    unsigned int m_steps_per_task;
+
+    std::vector<std::shared_ptr<ChEnsembleMember>> m_members;
+    std::vector<ChEnsembleMemberStats> m_stats;
+    std::vector<char> m_initialized;  // not vector<bool>, elements are written by different workers
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+    std::atomic<size_t> m_num_active;
+    std::atomic<unsigned int> m_num_steals;
+    double m_wall_time;
+
+    std::mutex m_assets_mutex;
+    std::unordered_map<std::string, std::shared_future<std::shared_ptr<void>>> m_assets;
+};
+
+/// @} chrono_utils
+
+// -----------------------------------------------------------------------------
+
+template <typename T>
+std::shared_ptr<T> ChEnsembleRunner::GetAsset(const std::string& key, std::function<std::shared_ptr<T>()> loader) {
+    std::shared_future<std::shared_ptr<void>> asset;
+    std::promise<std::shared_ptr<void>> promise;
+    bool load = false;
+
+    {
+        std::lock_guard<std::mutex> lock(m_assets_mutex);
+        auto it = m_assets.find(key);
+        if (it == m_assets.end()) {
+            asset = promise.get_future().share();
+            m_assets.emplace(key, asset);
+            load = true;
+        } else {
+            asset = it->second;
+        }
+    }
+
+    // Load outside the lock, so that different assets can be loaded concurrently.
+    // Other members requesting the same asset wait on the shared future.
+    if (load) {
+        try {
+            promise.set_value(std::static_pointer_cast<void>(loader()));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+        }
+    }
+
+    return std::static_pointer_cast<T>(asset.get());
+}
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
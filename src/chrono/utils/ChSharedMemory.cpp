@@ -0,0 +1,378 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Layout of the shared memory segment:
+//   - header (segment parameters and barrier state)
+//   - num_nodes x num_nodes channel control blocks (head and tail counters)
+//   - num_nodes x num_nodes ring buffers, each of 'capacity' bytes
+//
+// Head and tail are monotonically increasing byte counters; the ring buffer
+// offset is the counter modulo the capacity. A record consists of an 8-byte
+// size followed by the message data, padded to a multiple of 8 bytes. A record
+// never wraps around the end of the ring buffer: if it does not fit, a padding
+// marker is written and the record starts at the beginning of the buffer.
+//
+// =============================================================================
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <thread>
+
+#ifdef _WIN32
+    #define NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/utils/ChSharedMemory.h"
+
+namespace chrono {
+namespace utils {
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Shared memory transport requires lock-free 64-bit atomics");
+
+static const uint64_t kMagic = 0x43684d656d303031;  // "ChMem001"
+static const uint64_t kPadding = ~uint64_t(0);      // record size marking the padding at the end of a ring buffer
+static const size_t kCacheLine = 64;
+
+struct ChSharedMemoryTransport::Header {
+    std::atomic<uint64_t> ready;                                   // set to kMagic once the segment is initialized
+    uint64_t key;                                                  // key identifying the run
+    uint64_t num_nodes;                                            // number of nodes
+    uint64_t capacity;                                             // ring buffer capacity
+    alignas(kCacheLine) std::atomic<uint64_t> barrier_count;       // number of nodes arrived at the barrier
+    alignas(kCacheLine) std::atomic<uint64_t> barrier_generation;  // incremented when all nodes arrived
+};
+
+struct ChSharedMemoryTransport::Channel {
+    alignas(kCacheLine) std::atomic<uint64_t> head;  // written by the producer only
+    alignas(kCacheLine) std::atomic<uint64_t> tail;  // written by the consumer only
+};
+
+// Round up to a multiple of 8 bytes
+static size_t Align8(size_t size) {
+    return (size + 7) & ~size_t(7);
+}
+
+// Wait until the predicate is satisfied, spinning first and then yielding the processor.
+template <typename Predicate>
+static void WaitUntil(Predicate&& pred) {
+    for (int i = 0; !pred(); i++) {
+        if (i > 1000)
+            std::this_thread::yield();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+ChSharedMemoryTransport::ChSharedMemoryTransport(const std::string& name,
+                                                 int node,
+                                                 int num_nodes,
+                                                 size_t capacity,
+                                                 double timeout,
+                                                 uint64_t key)
+    : m_name(name),
+      m_node(node),
+      m_num_nodes(num_nodes),
+      m_capacity(Align8(capacity)),
+      m_timeout(timeout),
+      m_key(key),
+      m_memory(nullptr),
+#ifdef _WIN32
+      m_handle(nullptr),
+#else
+      m_fd(-1),
+#endif
+      m_peeked(num_nodes, 0),
+      m_bytes_sent(0),
+      m_bytes_received(0) {
+    if (num_nodes < 1 || node < 0 || node >= num_nodes)
+        throw std::runtime_error("ChSharedMemoryTransport: invalid node index " + std::to_string(node));
+    if (m_capacity < 64)
+        throw std::runtime_error("ChSharedMemoryTransport: ring buffer capacity too small");
+
+#ifndef _WIN32
+    // POSIX shared memory object names must start with a slash
+    if (m_name.empty() || m_name[0] != '/')
+        m_name = "/" + m_name;
+#endif
+
+    size_t num_channels = (size_t)num_nodes * num_nodes;
+    m_size = sizeof(Header) + num_channels * sizeof(Channel) + num_channels * m_capacity;
+
+    try {
+        Map(node == 0);
+
+        // Make sure every node is attached before any node proceeds (node 0 may unlink the segment when destroyed)
+        Barrier();
+    } catch (const std::exception&) {
+        Unmap();
+        throw;
+    }
+}
+
+ChSharedMemoryTransport::~ChSharedMemoryTransport() {
+    Unmap();
+}
+
+void ChSharedMemoryTransport::Map(bool create) {
+    auto start = std::chrono::steady_clock::now();
+    auto expired = [&]() {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() > m_timeout;
+    };
+
+    Header* header = nullptr;
+    size_t num_channels = (size_t)m_num_nodes * m_num_nodes;
+
+    if (create) {
+#ifdef _WIN32
+        m_handle = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, (DWORD)((uint64_t)m_size >> 32),
+                                      (DWORD)(m_size & 0xFFFFFFFF), m_name.c_str());
+        if (!m_handle)
+            throw std::runtime_error("ChSharedMemoryTransport: cannot create shared memory segment " + m_name);
+        m_memory = (uint8_t*)MapViewOfFile(m_handle, FILE_MAP_ALL_ACCESS, 0, 0, m_size);
+        if (!m_memory)
+            throw std::runtime_error("ChSharedMemoryTransport: cannot map shared memory segment " + m_name);
+#else
+        // Remove a segment left over by a previous run which did not terminate cleanly
+        shm_unlink(m_name.c_str());
+        m_fd = shm_open(m_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (m_fd < 0 || ftruncate(m_fd, (off_t)m_size) != 0)
+            throw std::runtime_error("ChSharedMemoryTransport: cannot create shared memory segment " + m_name);
+        void* memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+        if (memory == MAP_FAILED)
+            throw std::runtime_error("ChSharedMemoryTransport: cannot map shared memory segment " + m_name);
+        m_memory = (uint8_t*)memory;
+#endif
+
+        // The new segment is zero-filled; construct the atomic counters in place and publish the parameters
+        header = (Header*)m_memory;
+        new (&header->ready) std::atomic<uint64_t>(0);
+        new (&header->barrier_count) std::atomic<uint64_t>(0);
+        new (&header->barrier_generation) std::atomic<uint64_t>(0);
+        header->key = m_key;
+        header->num_nodes = m_num_nodes;
+        header->capacity = m_capacity;
+        Channel* channels = (Channel*)(m_memory + sizeof(Header));
+        for (size_t i = 0; i < num_channels; i++)
+            new (&channels[i]) Channel{{0}, {0}};
+        header->ready.store(kMagic, std::memory_order_release);
+        return;
+    }
+
+    // Wait for node 0 to create and initialize the segment for this run. A segment which is not yet initialized or
+    // was left over by a previous run (to be replaced by node 0) is closed and opened again.
+    while (true) {
+        if (Attach()) {
+            header = (Header*)m_memory;
+            if (header->ready.load(std::memory_order_acquire) == kMagic && header->key == m_key)
+                break;
+            Unmap();
+        }
+        if (expired())
+            throw std::runtime_error("ChSharedMemoryTransport: cannot open shared memory segment " + m_name);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    if (header->num_nodes != (uint64_t)m_num_nodes || header->capacity != (uint64_t)m_capacity)
+        throw std::runtime_error("ChSharedMemoryTransport: inconsistent parameters for shared memory segment " +
+                                 m_name);
+}
+
+bool ChSharedMemoryTransport::Attach() {
+#ifdef _WIN32
+    m_handle = OpenFileMappingA(FILE_MAP_ALL_ACCESS, FALSE, m_name.c_str());
+    if (!m_handle)
+        return false;
+    m_memory = (uint8_t*)MapViewOfFile(m_handle, FILE_MAP_ALL_ACCESS, 0, 0, m_size);
+    if (!m_memory) {
+        Unmap();
+        return false;
+    }
+#else
+    m_fd = shm_open(m_name.c_str(), O_RDWR, 0600);
+    if (m_fd < 0)
+        return false;
+
+    // Node 0 may not have set the size of the segment yet
+    struct stat st;
+    if (fstat(m_fd, &st) != 0 || (size_t)st.st_size < m_size) {
+        Unmap();
+        return false;
+    }
+
+    void* memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (memory == MAP_FAILED) {
+        Unmap();
+        return false;
+    }
+    m_memory = (uint8_t*)memory;
+#endif
+    return true;
+}
+
+void ChSharedMemoryTransport::Unmap() {
+#ifdef _WIN32
+    if (m_memory)
+        UnmapViewOfFile(m_memory);
+    if (m_handle)
+        CloseHandle(m_handle);
+    m_handle = nullptr;
+#else
+    if (m_memory)
+        munmap(m_memory, m_size);
+    if (m_fd >= 0)
+        close(m_fd);
+    m_fd = -1;
+    // The segment is removed once all nodes have unmapped it
+    if (m_node == 0)
+        shm_unlink(m_name.c_str());
+#endif
+    m_memory = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+
+ChSharedMemoryTransport::Channel& ChSharedMemoryTransport::GetChannel(int source, int dest) const {
+    Channel* channels = (Channel*)(m_memory + sizeof(Header));
+    return channels[(size_t)source * m_num_nodes + dest];
+}
+
+uint8_t* ChSharedMemoryTransport::GetChannelData(int source, int dest) const {
+    size_t num_channels = (size_t)m_num_nodes * m_num_nodes;
+    uint8_t* data = m_memory + sizeof(Header) + num_channels * sizeof(Channel);
+    return data + ((size_t)source * m_num_nodes + dest) * m_capacity;
+}
+
+void ChSharedMemoryTransport::Send(int dest, const void* data, size_t size) {
+    size_t record = sizeof(uint64_t) + Align8(size);
+    if (record > m_capacity)
+        throw std::runtime_error("ChSharedMemoryTransport: message of " + std::to_string(size) +
+                                 " bytes exceeds the ring buffer capacity of " + std::to_string(m_capacity) + " bytes");
+
+    Channel& channel = GetChannel(m_node, dest);
+    uint8_t* buffer = GetChannelData(m_node, dest);
+    uint64_t head = channel.head.load(std::memory_order_relaxed);
+
+    // If the record does not fit before the end of the ring buffer, pad to the end and start over
+    size_t offset = head % m_capacity;
+    size_t remaining = m_capacity - offset;
+    if (record > remaining) {
+        WaitUntil([&]() { return m_capacity - (head - channel.tail.load(std::memory_order_acquire)) >= remaining; });
+        std::memcpy(buffer + offset, &kPadding, sizeof(uint64_t));
+        head += remaining;
+        channel.head.store(head, std::memory_order_release);
+        offset = 0;
+    }
+
+    WaitUntil([&]() { return m_capacity - (head - channel.tail.load(std::memory_order_acquire)) >= record; });
+
+    uint64_t size64 = size;
+    std::memcpy(buffer + offset, &size64, sizeof(uint64_t));
+    std::memcpy(buffer + offset + sizeof(uint64_t), data, size);
+    channel.head.store(head + record, std::memory_order_release);
+
+    m_bytes_sent += size;
+}
+
+const void* ChSharedMemoryTransport::Peek(int source, size_t& size) {
+    Channel& channel = GetChannel(source, m_node);
+    uint8_t* buffer = GetChannelData(source, m_node);
+
+    while (true) {
+        uint64_t tail = channel.tail.load(std::memory_order_relaxed);
+        WaitUntil([&]() { return channel.head.load(std::memory_order_acquire) != tail; });
+
+        size_t offset = tail % m_capacity;
+        uint64_t size64;
+        std::memcpy(&size64, buffer + offset, sizeof(uint64_t));
+
+        if (size64 == kPadding) {
+            // Skip to the beginning of the ring buffer
+            channel.tail.store(tail + (m_capacity - offset), std::memory_order_release);
+            continue;
+        }
+
+        size = (size_t)size64;
+        m_peeked[source] = sizeof(uint64_t) + Align8(size);
+        return buffer + offset + sizeof(uint64_t);
+    }
+}
+
+void ChSharedMemoryTransport::Release(int source) {
+    if (m_peeked[source] == 0)
+        return;
+
+    Channel& channel = GetChannel(source, m_node);
+    uint64_t tail = channel.tail.load(std::memory_order_relaxed);
+    m_bytes_received += m_peeked[source] - sizeof(uint64_t);
+    channel.tail.store(tail + m_peeked[source], std::memory_order_release);
+    m_peeked[source] = 0;
+}
+
+void ChSharedMemoryTransport::Recv(int source, void* data, size_t size) {
+    size_t msg_size;
+    const void* msg = Peek(source, msg_size);
+    if (msg_size != size)
+        throw std::runtime_error("ChSharedMemoryTransport: expected message of " + std::to_string(size) +
+                                 " bytes from node " + std::to_string(source) + ", received " +
+                                 std::to_string(msg_size) + " bytes");
+    std::memcpy(data, msg, size);
+    Release(source);
+}
+
+bool ChSharedMemoryTransport::Probe(int source) const {
+    Channel& channel = GetChannel(source, m_node);
+    uint64_t head = channel.head.load(std::memory_order_acquire);
+    uint64_t tail = channel.tail.load(std::memory_order_relaxed);
+    if (head == tail)
+        return false;
+
+    // A padding marker alone is not a message
+    size_t offset = tail % m_capacity;
+    uint64_t size64;
+    std::memcpy(&size64, GetChannelData(source, m_node) + offset, sizeof(uint64_t));
+    return size64 != kPadding || head - tail > m_capacity - offset;
+}
+
+void ChSharedMemoryTransport::Barrier() {
+    Header* header = (Header*)m_memory;
+    uint64_t generation = header->barrier_generation.load(std::memory_order_acquire);
+
+    if (header->barrier_count.fetch_add(1, std::memory_order_acq_rel) + 1 == (uint64_t)m_num_nodes) {
+        header->barrier_count.store(0, std::memory_order_relaxed);
+        header->barrier_generation.fetch_add(1, std::memory_order_release);
+        return;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; header->barrier_generation.load(std::memory_order_acquire) == generation; i++) {
+        if (i > 1000) {
+            if (std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() > m_timeout)
+                throw std::runtime_error("ChSharedMemoryTransport: timeout waiting for all nodes at barrier on " +
+                                         m_name);
+            std::this_thread::yield();
+        }
+    }
+}
+
+}  // end namespace utils
+}  // end namespace chrono
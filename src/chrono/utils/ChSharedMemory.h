@@ -0,0 +1,145 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Message transport between processes running on the same machine, through a
+// named shared memory segment. Each ordered pair of nodes communicates through
+// a lock-free single-producer single-consumer ring buffer.
+//
+// =============================================================================
+
+#ifndef CH_SHARED_MEMORY_H
+#define CH_SHARED_MEMORY_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Shared memory message transport between the nodes (processes) of a simulation running on a single machine.
+/// All nodes map the same named shared memory segment (POSIX shm_open on Linux and macOS, a named file mapping on
+/// Windows), which holds one ring buffer for each ordered pair of nodes. A ring buffer has a single producer (the
+/// sending node) and a single consumer (the receiving node) and is therefore synchronized with atomic head and tail
+/// counters only, without locks or system calls.
+///
+/// Messages are received in the order in which they were sent by a given node. A message is always stored
+/// contiguously in the ring buffer, so that the receiver can process it in place (see Peek and Release) instead of
+/// copying it out. Sending blocks only if the ring buffer to the destination node is full; receiving blocks until a
+/// message is available.
+///
+/// Node 0 creates the segment, all other nodes attach to it. The constructor returns once all nodes are attached.
+/// A segment left over by a previous run which did not terminate cleanly is replaced by node 0; to make sure the
+/// other nodes do not attach to such a stale segment, all nodes should pass a key unique to the current run (e.g., the
+/// process ID of node 0, distributed to the other nodes at launch).
+class ChApi ChSharedMemoryTransport {
+  public:
+    /// Create (node 0) or attach to (other nodes) the shared memory segment with the given name.
+    /// All nodes must use the same name, key, number of nodes, and capacity. The name must be unique among the
+    /// simulations running concurrently on the machine. Nodes other than node 0 only attach to a segment initialized
+    /// with the same key. A std::runtime_error is thrown if the segment cannot be created or attached to, or if not
+    /// all nodes are attached, within the specified timeout.
+    ChSharedMemoryTransport(const std::string& name,    ///< name of the shared memory segment
+                            int node,                   ///< index of this node, in [0, num_nodes)
+                            int num_nodes,              ///< number of nodes sharing the segment
+                            size_t capacity = 1 << 20,  ///< capacity (bytes) of the ring buffer of each node pair
+                            double timeout = 60,        ///< maximum time (s) to wait for the other nodes
+                            uint64_t key = 0            ///< key identifying the current run
+    );
+
+    ~ChSharedMemoryTransport();
+
+    /// Send a message to the specified node.
+    /// The data is copied into the ring buffer, so the send buffer can be reused as soon as this function returns.
+    /// Blocks while there is not enough free space in the ring buffer. Throws a std::runtime_error if the message
+    /// exceeds the capacity of the ring buffer.
+    void Send(int dest, const void* data, size_t size);
+
+    /// Receive a message from the specified node into the provided buffer.
+    /// Blocks until a message is available. Throws a std::runtime_error if the size of the message does not match.
+    void Recv(int source, void* data, size_t size);
+
+    /// Access the next message from the specified node, without copying it.
+    /// Blocks until a message is available and returns a pointer to the message data, valid until Release is called.
+    /// Calling Peek again before Release returns the same message.
+    const void* Peek(int source, size_t& size);
+
+    /// Release the message last returned by Peek for the specified node, making its space available to the sender.
+    void Release(int source);
+
+    /// Check whether a message from the specified node is available (non-blocking).
+    bool Probe(int source) const;
+
+    /// Block until all nodes have called Barrier.
+    /// Throws a std::runtime_error if not all nodes arrive at the barrier within the timeout specified at construction.
+    void Barrier();
+
+    /// Get the index of this node.
+    int GetNode() const { return m_node; }
+
+    /// Get the number of nodes sharing the segment.
+    int GetNumNodes() const { return m_num_nodes; }
+
+    /// Get the capacity (bytes) of the ring buffer of each node pair.
+    size_t GetCapacity() const { return m_capacity; }
+
+    /// Get the total number of bytes sent by this node.
+    size_t GetNumBytesSent() const { return m_bytes_sent; }
+
+    /// Get the total number of bytes received by this node.
+    size_t GetNumBytesReceived() const { return m_bytes_received; }
+
+  private:
+    struct Header;
+    struct Channel;
+
+    void Map(bool create);
+    bool Attach();
+    void Unmap();
+
+    Channel& GetChannel(int source, int dest) const;
+    uint8_t* GetChannelData(int source, int dest) const;
+
+    std::string m_name;  ///< name of the shared memory segment
+    int m_node;          ///< index of this node
+    int m_num_nodes;     ///< number of nodes sharing the segment
+    size_t m_capacity;   ///< capacity of each ring buffer (multiple of 8 bytes)
+    size_t m_size;       ///< total size of the shared memory segment
+    double m_timeout;    ///< maximum time (s) to wait for the other nodes
+    uint64_t m_key;      ///< key identifying the current run
+
+    uint8_t* m_memory;  ///< start of the mapped segment
+#ifdef _WIN32
+    void* m_handle;  ///< file mapping handle
+#else
+    int m_fd;  ///< shared memory file descriptor
+#endif
+
+    std::vector<size_t> m_peeked;  ///< size of the record returned by Peek, for each source node (0 if none)
+    size_t m_bytes_sent;           ///< total number of bytes sent
+    size_t m_bytes_received;       ///< total number of bytes received
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,208 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "chrono/utils/ChStateSnapshot.h"
+#include "chrono/timestepper/ChTimestepper.h"
+
+namespace chrono {
+namespace utils {
+
+// Snapshot file signature and format version
+static const char SNAPSHOT_MAGIC[8] = {'C', 'H', 'S', 'N', 'A', 'P', 'S', 'H'};
+static const uint64_t SNAPSHOT_VERSION = 2;
+
+ChStateSnapshot::ChStateSnapshot() : m_time(0) {
+    std::memset(&m_structure, 0, sizeof(Structure));
+}
+
+ChStateSnapshot::Structure ChStateSnapshot::GetStructure(ChSystem& sys) {
+    // Make sure the system counters and state offsets are up to date
+    sys.Setup();
+
+    auto num_constr_contact = sys.GetContactContainer()->GetNumConstraints();
+
+    Structure s;
+    s.num_bodies = sys.GetNumBodies();
+    s.num_shafts = sys.GetNumShafts();
+    s.num_links = sys.GetNumLinks();
+    s.num_meshes = sys.GetNumMeshes();
+    s.num_other = sys.GetNumOtherPhysicsItems();
+    s.num_coords_pos = sys.GetNumCoordsPosLevel();
+    s.num_coords_vel = sys.GetNumCoordsVelLevel();
+    s.num_constr = sys.GetNumConstraints() - num_constr_contact;
+    return s;
+}
+
+void ChStateSnapshot::Capture(ChSystem& sys) {
+    m_structure = GetStructure(sys);
+
+    m_x.setZero(m_structure.num_coords_pos, &sys);
+    m_v.setZero(m_structure.num_coords_vel, &sys);
+    m_a.setZero(m_structure.num_coords_vel, &sys);
+    m_L.setZero(m_structure.num_constr);
+
+    // Reactions of the assembly constraints come first, followed by the contact reactions (see ChSystem::Setup)
+    ChVectorDynamic<> L(sys.GetNumConstraints());
+    sys.StateGather(m_x, m_v, m_time);
+    sys.StateGatherAcceleration(m_a);
+    sys.StateGatherReactions(L);
+    m_L = L.head(m_structure.num_constr);
+}
+
+bool ChStateSnapshot::IsCompatible(ChSystem& sys) const {
+    auto s = GetStructure(sys);
+    return s.num_bodies == m_structure.num_bodies &&          //
+           s.num_shafts == m_structure.num_shafts &&          //
+           s.num_links == m_structure.num_links &&            //
+           s.num_meshes == m_structure.num_meshes &&          //
+           s.num_other == m_structure.num_other &&            //
+           s.num_coords_pos == m_structure.num_coords_pos &&  //
+           s.num_coords_vel == m_structure.num_coords_vel &&  //
+           s.num_constr == m_structure.num_constr;
+}
+
+bool ChStateSnapshot::Restore(ChSystem& sys) const {
+    if (!IsCompatible(sys))
+        return false;
+
+    // The contacts currently in the system belong to a different configuration, so their reactions are cleared
+    ChVectorDynamic<> L(sys.GetNumConstraints());
+    L.setZero();
+    L.head(m_structure.num_constr) = m_L;
+
+    // Bind the stored state vectors to the target system (the snapshot may come from a file or another system)
+    ChState x(m_x, &sys);
+    ChStateDelta v(m_v, &sys);
+    ChStateDelta a(m_a, &sys);
+
+    sys.StateScatter(x, v, m_time, true);
+    sys.StateScatterAcceleration(a);
+    sys.StateScatterReactions(L);
+
+    // Constraint Jacobians are cached in the ChConstraint objects and only refreshed by the solver; reload them so that
+    // quantities such as Cq'*L evaluated at the beginning of the next step do not use the discarded configuration.
+    sys.LoadConstraintJacobians();
+
+    // Reset the state cached by the timestepper
+    auto timestepper = sys.GetTimestepper();
+    if (auto ts2 = std::dynamic_pointer_cast<ChTimestepperIIorder>(timestepper)) {
+        ts2->GetStatePos() = x;
+        ts2->GetStateVel() = v;
+        ts2->GetStateAcc() = a;
+        ts2->GetLagrangeMultipliers() = L;
+    } else if (auto ts1 = std::dynamic_pointer_cast<ChTimestepperIorder>(timestepper)) {
+        auto nx = m_x.size();
+        auto nv = m_v.size();
+        ts1->GetState().setZero(nx + nv, &sys);
+        ts1->GetStateDt().setZero(nv + nv, &sys);
+        ts1->GetState().segment(0, nx) = m_x;
+        ts1->GetState().segment(nx, nv) = m_v;
+        ts1->GetStateDt().segment(0, nv) = m_v;
+        ts1->GetStateDt().segment(nv, nv) = m_a;
+        ts1->GetLagrangeMultipliers() = L;
+    }
+    if (timestepper)
+        timestepper->SetTime(m_time);
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t ChStateSnapshot::GetFileSize() const {
+    return sizeof(SNAPSHOT_MAGIC) + sizeof(SNAPSHOT_VERSION) + sizeof(Structure) + sizeof(double) +
+           sizeof(double) * (m_x.size() + m_v.size() + m_a.size() + m_L.size());
+}
+
+bool ChStateSnapshot::Write(const std::string& filename) const {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile.is_open()) {
+        std::cerr << "ChStateSnapshot::Write ERROR: cannot open file " << filename << std::endl;
+        return false;
+    }
+
+    ofile.write(SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    ofile.write(reinterpret_cast<const char*>(&SNAPSHOT_VERSION), sizeof(SNAPSHOT_VERSION));
+    ofile.write(reinterpret_cast<const char*>(&m_structure), sizeof(Structure));
+    ofile.write(reinterpret_cast<const char*>(&m_time), sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(m_x.data()), sizeof(double) * m_x.size());
+    ofile.write(reinterpret_cast<const char*>(m_v.data()), sizeof(double) * m_v.size());
+    ofile.write(reinterpret_cast<const char*>(m_a.data()), sizeof(double) * m_a.size());
+    ofile.write(reinterpret_cast<const char*>(m_L.data()), sizeof(double) * m_L.size());
+
+    return ofile.good();
+}
+
+bool ChStateSnapshot::Read(const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile.is_open()) {
+        std::cerr << "ChStateSnapshot::Read ERROR: cannot open file " << filename << std::endl;
+        return false;
+    }
+
+    char magic[8];
+    uint64_t version;
+    ifile.read(magic, sizeof(magic));
+    ifile.read(reinterpret_cast<char*>(&version), sizeof(version));
+    if (!ifile.good() || std::memcmp(magic, SNAPSHOT_MAGIC, sizeof(magic)) != 0 || version != SNAPSHOT_VERSION) {
+        std::cerr << "ChStateSnapshot::Read ERROR: " << filename << " is not a valid snapshot file" << std::endl;
+        return false;
+    }
+
+    Structure s;
+    double time;
+    ifile.read(reinterpret_cast<char*>(&s), sizeof(Structure));
+    ifile.read(reinterpret_cast<char*>(&time), sizeof(double));
+    if (!ifile.good()) {
+        std::cerr << "ChStateSnapshot::Read ERROR: truncated snapshot file " << filename << std::endl;
+        return false;
+    }
+
+    // Check the vector sizes in the header against the size of the data in the file before allocating
+    auto data_begin = ifile.tellg();
+    ifile.seekg(0, std::ios::end);
+    uint64_t max_values = (uint64_t)(ifile.tellg() - data_begin) / sizeof(double);
+    ifile.seekg(data_begin);
+    if (s.num_coords_pos > max_values || s.num_coords_vel > max_values || s.num_constr > max_values ||
+        s.num_coords_pos + 2 * s.num_coords_vel + s.num_constr != max_values) {
+        std::cerr << "ChStateSnapshot::Read ERROR: size mismatch in snapshot file " << filename << std::endl;
+        return false;
+    }
+
+    m_structure = s;
+    m_time = time;
+    m_x.resize(s.num_coords_pos);
+    m_v.resize(s.num_coords_vel);
+    m_a.resize(s.num_coords_vel);
+    m_L.resize(s.num_constr);
+
+    ifile.read(reinterpret_cast<char*>(m_x.data()), sizeof(double) * m_x.size());
+    ifile.read(reinterpret_cast<char*>(m_v.data()), sizeof(double) * m_v.size());
+    ifile.read(reinterpret_cast<char*>(m_a.data()), sizeof(double) * m_a.size());
+    ifile.read(reinterpret_cast<char*>(m_L.data()), sizeof(double) * m_L.size());
+
+    if (!ifile.good()) {
+        std::cerr << "ChStateSnapshot::Read ERROR: truncated snapshot file " << filename << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+}  // end namespace utils
+}  // end namespace chrono
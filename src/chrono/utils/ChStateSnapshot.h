@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Binary snapshot of the state of a Chrono system, for fast checkpoint/restore
+// and rollback of simulations with unchanged system structure.
+//
+// =============================================================================
+
+#ifndef CH_STATE_SNAPSHOT_H
+#define CH_STATE_SNAPSHOT_H
+
+#include <cstdint>
+#include <string>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Snapshot of the state of a Chrono system.
+/// A snapshot stores the system-level state vectors (positions, velocities, accelerations, and the Lagrange multipliers
+/// of the non-contact constraints) as gathered with ChSystem::StateGather and related functions. Unlike WriteCheckpoint
+/// or the ChArchive serializers, it does not record the system topology (bodies, links, meshes, collision shapes), so
+/// a snapshot can only be restored into a system with the same structure as the one it was captured from; in exchange,
+/// capture and restore reduce to copying a few contiguous vectors.
+///
+/// The contact set and the contact reactions (i.e., the solver warm-start data) are not captured: the contacts are
+/// recomputed by the collision detection at the next step after a restore. Simulations using a warm-started
+/// iterative solver may therefore not reproduce the original trajectory exactly after a rollback.
+///
+/// A snapshot can be kept in memory (e.g., to roll back or branch a simulation) or saved to a binary file. The file
+/// consists of a fixed-size header followed by the raw state vectors (all 8-byte aligned), so that it can also be
+/// memory-mapped.
+class ChApi ChStateSnapshot {
+  public:
+    ChStateSnapshot();
+
+    /// Capture the current state of the given system.
+    void Capture(ChSystem& sys);
+
+    /// Return true if the snapshot can be restored into the given system (same number of physics items, state
+    /// coordinates, and non-contact constraints).
+    bool IsCompatible(ChSystem& sys) const;
+
+    /// Restore the captured state into the given system.
+    /// The reactions of the contacts currently in the system are reset to zero, since they do not correspond to the
+    /// restored configuration. The state cached by the system timestepper (e.g., HHT accelerations) is also reset.
+    /// Return false (and leave the system state unchanged) if the snapshot is not compatible with the system.
+    bool Restore(ChSystem& sys) const;
+
+    /// Write the snapshot to a binary file.
+    bool Write(const std::string& filename) const;
+
+    /// Read a snapshot from a binary file.
+    /// Return false if the file is not a valid snapshot file, or if its size does not match the size recorded in the
+    /// header (e.g., a truncated file).
+    bool Read(const std::string& filename);
+
+    /// Get the simulation time at which the snapshot was captured.
+    double GetTime() const { return m_time; }
+
+    /// Get the size (in bytes) of the snapshot file.
+    size_t GetFileSize() const;
+
+  private:
+    /// Counters describing the system structure, stored in the file header.
+    struct Structure {
+        uint64_t num_bodies;
+        uint64_t num_shafts;
+        uint64_t num_links;
+        uint64_t num_meshes;
+        uint64_t num_other;
+        uint64_t num_coords_pos;
+        uint64_t num_coords_vel;
+        uint64_t num_constr;  ///< number of constraints, excluding contacts
+    };
+
+    static Structure GetStructure(ChSystem& sys);
+
+    Structure m_structure;
+    double m_time;
+    ChState m_x;
+    ChStateDelta m_v;
+    ChStateDelta m_a;
+    ChVectorDynamic<> m_L;  ///< reactions of the non-contact constraints
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,204 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Timeline tracing of scoped zones, recorded per thread and exported in the
+// Chrome trace event format (viewable in chrome://tracing or Perfetto).
+//
+// =============================================================================
+
+#include "chrono/utils/ChTrace.h"
+
+#ifndef CH_NO_TRACE
+
+    #include <algorithm>
+    #include <chrono>
+    #include <cstdio>
+    #include <fstream>
+    #include <memory>
+    #include <mutex>
+    #include <vector>
+
+namespace chrono {
+namespace utils {
+
+namespace {
+
+// A completed zone
+struct Zone {
+    const char* name;
+    int64_t begin;
+    int64_t end;
+};
+
+// Ring buffer of zones recorded by one thread.
+// Only the owning thread writes zones; the head counter is published with release semantics so that the exporter
+// sees complete zones.
+struct ThreadBuffer {
+    ThreadBuffer(int id, size_t capacity) : id(id), name("Thread " + std::to_string(id)), zones(capacity), head(0) {}
+
+    int id;
+    std::string name;
+    std::vector<Zone> zones;
+    std::atomic<uint64_t> head;
+};
+
+struct TraceData {
+    std::mutex mutex;                                    // protects the list of buffers (not the buffers themselves)
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // buffers of all threads that recorded a zone
+    size_t capacity = 65536;                             // capacity of newly created buffers
+};
+
+TraceData& GetTraceData() {
+    static TraceData data;
+    return data;
+}
+
+thread_local ThreadBuffer* t_buffer = nullptr;
+
+ThreadBuffer* GetThreadBuffer() {
+    if (!t_buffer) {
+        auto& data = GetTraceData();
+        std::lock_guard<std::mutex> lock(data.mutex);
+        data.buffers.push_back(std::make_unique<ThreadBuffer>((int)data.buffers.size(), data.capacity));
+        t_buffer = data.buffers.back().get();
+    }
+    return t_buffer;
+}
+
+void WriteEscaped(std::ostream& stream, const char* str) {
+    for (const char* c = str; *c; c++) {
+        if (*c == '"' || *c == '\\')
+            stream << '\\';
+        stream << *c;
+    }
+}
+
+// Write a time in nanoseconds as microseconds (the unit of the trace format)
+void WriteTime(std::ostream& stream, int64_t ns) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.3f", ns * 1e-3);
+    stream << buf;
+}
+
+}  // end anonymous namespace
+
+std::atomic<bool> ChTraceManager::m_enabled(false);
+
+void ChTraceManager::Enable(bool val) {
+    // Make sure the trace clock is started before the first zone
+    Now();
+    m_enabled.store(val, std::memory_order_relaxed);
+}
+
+void ChTraceManager::SetCapacity(size_t num_zones) {
+    auto& data = GetTraceData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    data.capacity = std::max(num_zones, (size_t)1);
+}
+
+void ChTraceManager::SetThreadName(const std::string& name) {
+    GetThreadBuffer()->name = name;
+}
+
+void ChTraceManager::Clear() {
+    auto& data = GetTraceData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    for (auto& buffer : data.buffers) {
+        buffer->zones.assign(data.capacity, Zone());
+        buffer->head.store(0, std::memory_order_release);
+    }
+}
+
+size_t ChTraceManager::GetNumZones() {
+    auto& data = GetTraceData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    size_t num_zones = 0;
+    for (const auto& buffer : data.buffers)
+        num_zones += std::min(buffer->head.load(std::memory_order_acquire), (uint64_t)buffer->zones.size());
+    return num_zones;
+}
+
+size_t ChTraceManager::GetNumDroppedZones() {
+    auto& data = GetTraceData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+    size_t num_dropped = 0;
+    for (const auto& buffer : data.buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        num_dropped += head - std::min(head, (uint64_t)buffer->zones.size());
+    }
+    return num_dropped;
+}
+
+void ChTraceManager::WriteChromeTrace(std::ostream& stream) {
+    auto& data = GetTraceData();
+    std::lock_guard<std::mutex> lock(data.mutex);
+
+    size_t num_dropped = 0;
+    bool first = true;
+
+    stream << "{\"traceEvents\":[";
+
+    for (const auto& buffer : data.buffers) {
+        uint64_t head = buffer->head.load(std::memory_order_acquire);
+        uint64_t capacity = buffer->zones.size();
+        uint64_t num_zones = std::min(head, capacity);
+        num_dropped += head - num_zones;
+
+        // Thread name (metadata event)
+        stream << (first ? "\n" : ",\n");
+        first = false;
+        stream << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << buffer->id << ",\"args\":{\"name\":\"";
+        WriteEscaped(stream, buffer->name.c_str());
+        stream << "\"}}";
+
+        // Zones, oldest first (complete events)
+        for (uint64_t i = head - num_zones; i < head; i++) {
+            const Zone& zone = buffer->zones[i % capacity];
+            stream << ",\n{\"name\":\"";
+            WriteEscaped(stream, zone.name);
+            stream << "\",\"cat\":\"chrono\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id << ",\"ts\":";
+            WriteTime(stream, zone.begin);
+            stream << ",\"dur\":";
+            WriteTime(stream, zone.end - zone.begin);
+            stream << "}";
+        }
+    }
+
+    stream << "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"dropped_zones\":" << num_dropped << "}}\n";
+}
+
+bool ChTraceManager::WriteChromeTrace(const std::string& filename) {
+    std::ofstream stream(filename);
+    if (!stream.is_open())
+        return false;
+    WriteChromeTrace(stream);
+    return true;
+}
+
+int64_t ChTraceManager::Now() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+}
+
+void ChTraceManager::Record(const char* name, int64_t begin, int64_t end) {
+    ThreadBuffer* buffer = GetThreadBuffer();
+    uint64_t head = buffer->head.load(std::memory_order_relaxed);
+    buffer->zones[head % buffer->zones.size()] = {name, begin, end};
+    buffer->head.store(head + 1, std::memory_order_release);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif  // #ifndef CH_NO_TRACE
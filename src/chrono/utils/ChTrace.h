@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Timeline tracing of scoped zones, recorded per thread and exported in the
+// Chrome trace event format (viewable in chrome://tracing or Perfetto).
+//
+// =============================================================================
+
+#ifndef CH_TRACE_H
+#define CH_TRACE_H
+
+// To disable built-in tracing, please comment out next line
+// #define CH_NO_TRACE 1
+
+#ifndef CH_NO_TRACE
+
+    #include <atomic>
+    #include <cstdint>
+    #include <ostream>
+    #include <string>
+
+    #include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+namespace utils {
+
+/// @addtogroup chrono_utils
+/// @{
+
+/// Manager for timeline tracing.
+/// Unlike ChProfileManager, which accumulates the time spent in each zone, the trace manager records the begin and
+/// end time of every zone execution, separately for each thread, so that the timeline of a single step (including
+/// load imbalance between threads) can be inspected. Zones are recorded with ChTraceZone (see the CH_TRACE macro).
+///
+/// Tracing is disabled by default, in which case a zone costs a single relaxed atomic load. When enabled, each thread
+/// records its zones in its own ring buffer, without locks; when a ring buffer is full, the oldest zones of that thread
+/// are overwritten. The recorded zones can be exported with WriteChromeTrace, after the traced section completed.
+class ChApi ChTraceManager {
+  public:
+    /// Enable or disable zone recording (default: disabled).
+    static void Enable(bool val);
+
+    /// Return true if zone recording is enabled.
+    static bool IsEnabled() { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Set the capacity (number of zones) of the ring buffer of each thread (default: 65536).
+    /// This setting applies to threads recording their first zone after this call, and to all threads after Clear.
+    static void SetCapacity(size_t num_zones);
+
+    /// Set the name of the calling thread, as displayed in the trace viewer (default: "Thread N").
+    static void SetThreadName(const std::string& name);
+
+    /// Discard all recorded zones.
+    /// This function must not be called while other threads are recording zones.
+    static void Clear();
+
+    /// Get the number of zones currently stored, over all threads.
+    static size_t GetNumZones();
+
+    /// Get the number of zones overwritten because of full ring buffers, over all threads.
+    static size_t GetNumDroppedZones();
+
+    /// Write the recorded zones to the given stream, in the Chrome trace event (JSON) format.
+    /// This function should not be called while other threads are recording zones.
+    static void WriteChromeTrace(std::ostream& stream);
+
+    /// Write the recorded zones to the specified file, in the Chrome trace event (JSON) format.
+    /// Return false if the file could not be opened.
+    static bool WriteChromeTrace(const std::string& filename);
+
+    /// Get the current time (in nanoseconds) relative to the start of the trace clock.
+    static int64_t Now();
+
+    /// Record a completed zone on the calling thread.
+    /// The zone name must have static storage duration (e.g., a string literal), as only its address is stored.
+    static void Record(const char* name, int64_t begin, int64_t end);
+
+  private:
+    static std::atomic<bool> m_enabled;
+};
+
+/// Scoped trace zone.
+/// Records the begin and end times of the enclosing scope on the calling thread, if tracing is enabled at the time the
+/// zone is entered. The zone name must have static storage duration (e.g., a string literal).
+class ChApi ChTraceZone {
+  public:
+    explicit ChTraceZone(const char* name) : m_name(ChTraceManager::IsEnabled() ? name : nullptr), m_begin(0) {
+        if (m_name)
+            m_begin = ChTraceManager::Now();
+    }
+
+    ~ChTraceZone() {
+        if (m_name)
+            ChTraceManager::Record(m_name, m_begin, ChTraceManager::Now());
+    }
+
+  private:
+    const char* m_name;
+    int64_t m_begin;
+};
+
+/// @} chrono_utils
+
+}  // end namespace utils
+}  // end namespace chrono
+
+    #define CH_TRACE_CONCAT_IMPL(a, b) a##b
+    #define CH_TRACE_CONCAT(a, b) CH_TRACE_CONCAT_IMPL(a, b)
+    #define CH_TRACE(name) chrono::utils::ChTraceZone CH_TRACE_CONCAT(__ch_trace_, __LINE__)(name)
+
+#else
+
+    #define CH_TRACE(name)
+
+#endif  // #ifndef CH_NO_TRACE
+
+#endif
@@ -17,9 +17,11 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 
 #include "chrono/core/ChTypes.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono/utils/ChUtilsCreators.h"
 #include "chrono/utils/ChUtilsGenerators.h"
@@ -86,6 +88,7 @@ void ChSystemFsi::InitParams() {
     //// Provide default values for *all* parameters!
 
     m_paramsH->output_length = 1;
+    m_paramsH->num_threads = ChOMP::GetNumProcs();
 
     // Fluid properties
     m_paramsH->rho0 = Real(1000.0);
@@ -506,6 +509,10 @@ void ChSystemFsi::SetVerbose(bool verbose) {
     m_fsi_interface->m_verbose = verbose;
 }
 
+void ChSystemFsi::SetNumThreads(int num_threads) {
+    m_paramsH->num_threads = std::max(1, num_threads);
+}
+
 void ChSystemFsi::SetSPHLinearSolver(SolverType lin_solver) {
     m_paramsH->LinearSolver = lin_solver;
 }
@@ -20,10 +20,11 @@
 #ifndef CH_SYSTEM_FSI_H
 #define CH_SYSTEM_FSI_H
 
+#include "chrono_fsi/ChConfigFSI.h"
+
 #include <thrust/host_vector.h>
 #include <thrust/device_vector.h>
 
-#include "chrono/ChConfig.h"
 #include "chrono/physics/ChSystem.h"
 
 #include "chrono_fsi/ChApiFsi.h"
@@ -106,6 +107,10 @@ class CH_FSI_API ChSystemFsi {
     /// Enable/disable verbose terminal output.
     void SetVerbose(bool verbose);
 
+    /// Set the number of OpenMP threads used by the SPH solver (default: number of processors).
+    /// Only used if Chrono::FSI was built for CPU execution (USE_FSI_CPU); ignored in the CUDA version.
+    void SetNumThreads(int num_threads);
+
     /// Read Chrono::FSI parameters from the specified JSON file.
     void ReadParametersFromFile(const std::string& json_file);
 
@@ -175,6 +180,7 @@ class CH_FSI_API ChSystemFsi {
     void SetSPHLinearSolver(SolverType lin_solver);
 
     /// Set the SPH method and, optionally, the linear solver type.
+    /// Note that the CPU version of Chrono::FSI (USE_FSI_CPU) only supports the explicit WCSPH method.
     void SetSPHMethod(FluidDynamics SPH_method, SolverType lin_solver = SolverType::BICGSTAB);
 
     /// Enable solution of elastic SPH (for continuum representation of granular dynamics).
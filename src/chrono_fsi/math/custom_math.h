@@ -23,6 +23,7 @@
 #include <cuda_runtime.h>
 #ifndef __CUDACC__
     #include <cmath>
+using std::isfinite;
 #endif
 #include "chrono_fsi/ChConfigFSI.h"
 
@@ -24,6 +24,21 @@ namespace chrono {
 namespace fsi {
 
 //--------------------------------------------------------------------------------------------------------------------------------
+#ifdef CHRONO_FSI_USE_CPU
+// In the CPU version, the FSI force accumulation loops are executed serially (so that the resulting
+// forces do not depend on the number of threads) and the atomic additions reduce to plain additions.
+inline double atomicAdd_double(double* address, double val) {
+    double old = *address;
+    *address = old + val;
+    return old;
+}
+
+inline float atomicAdd(float* address, float val) {
+    float old = *address;
+    *address = old + val;
+    return old;
+}
+#else
 __device__ double atomicAdd_double(double* address, double val) {
     unsigned long long int* address_as_ull = (unsigned long long int*)address;
     unsigned long long int old = *address_as_ull, assumed;
@@ -35,17 +50,15 @@ __device__ double atomicAdd_double(double* address, double val) {
 
     return __longlong_as_double(old);
 }
+#endif
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Populate_RigidSPH_MeshPos_LRF_D(Real3* rigidSPH_MeshPos_LRF_D,
-                                                Real4* posRadD,
-                                                uint* rigidIdentifierD,
-                                                Real3* posRigidD,
-                                                Real4* qD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numRigidMarkers)
-        return;
-
+__device__ inline void f_Populate_RigidSPH_MeshPos_LRF(uint index,
+                                                       Real3* rigidSPH_MeshPos_LRF_D,
+                                                       Real4* posRadD,
+                                                       uint* rigidIdentifierD,
+                                                       Real3* posRigidD,
+                                                       Real4* qD) {
     int rigidIndex = rigidIdentifierD[index];
     uint rigidMarkerIndex = index + numObjectsD.startRigidMarkers;
     Real4 q4 = qD[rigidIndex];
@@ -57,18 +70,29 @@ __global__ void Populate_RigidSPH_MeshPos_LRF_D(Real3* rigidSPH_MeshPos_LRF_D,
     rigidSPH_MeshPos_LRF_D[index] = dist3LF;
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Populate_FlexSPH_MeshPos_LRF_D(Real3* FlexSPH_MeshPos_LRF_D,
-                                               Real3* FlexSPH_MeshPos_LRF_H,
-                                               Real4* posRadD,
-                                               uint* FlexIdentifierD,
-                                               uint2* CableElementsNodesD,
-                                               uint4* ShellElementsNodesD,
-                                               Real3* pos_fsi_fea_D) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void Populate_RigidSPH_MeshPos_LRF_D(Real3* rigidSPH_MeshPos_LRF_D,
+                                                Real4* posRadD,
+                                                uint* rigidIdentifierD,
+                                                Real3* posRigidD,
+                                                Real4* qD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numFlexMarkers)
+    if (index >= numObjectsD.numRigidMarkers)
         return;
 
+    f_Populate_RigidSPH_MeshPos_LRF(index, rigidSPH_MeshPos_LRF_D, posRadD, rigidIdentifierD, posRigidD, qD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_Populate_FlexSPH_MeshPos_LRF(uint index,
+                                                      Real3* FlexSPH_MeshPos_LRF_D,
+                                                      Real3* FlexSPH_MeshPos_LRF_H,
+                                                      Real4* posRadD,
+                                                      uint* FlexIdentifierD,
+                                                      uint2* CableElementsNodesD,
+                                                      uint4* ShellElementsNodesD,
+                                                      Real3* pos_fsi_fea_D) {
     // The coordinates of BCE in local reference frame is already calculated when created,
     // So only need to copy from host to device here
     FlexSPH_MeshPos_LRF_D[index] = FlexSPH_MeshPos_LRF_H[index];
@@ -130,19 +154,33 @@ __global__ void Populate_FlexSPH_MeshPos_LRF_D(Real3* FlexSPH_MeshPos_LRF_D,
     }*/
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Calc_Rigid_FSI_Forces_Torques_D(Real3* rigid_FSI_ForcesD,
-                                                Real3* rigid_FSI_TorquesD,
-                                                Real4* derivVelRhoD,
-                                                Real4* derivVelRhoD_old,
-                                                Real4* posRadD,
-                                                uint* rigidIdentifierD,
-                                                Real3* posRigidD,
-                                                Real3* rigidSPH_MeshPos_LRF_D) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void Populate_FlexSPH_MeshPos_LRF_D(Real3* FlexSPH_MeshPos_LRF_D,
+                                               Real3* FlexSPH_MeshPos_LRF_H,
+                                               Real4* posRadD,
+                                               uint* FlexIdentifierD,
+                                               uint2* CableElementsNodesD,
+                                               uint4* ShellElementsNodesD,
+                                               Real3* pos_fsi_fea_D) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numRigidMarkers)
+    if (index >= numObjectsD.numFlexMarkers)
         return;
 
+    f_Populate_FlexSPH_MeshPos_LRF(index, FlexSPH_MeshPos_LRF_D, FlexSPH_MeshPos_LRF_H, posRadD, FlexIdentifierD,
+                                   CableElementsNodesD, ShellElementsNodesD, pos_fsi_fea_D);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_Calc_Rigid_FSI_Forces_Torques(uint index,
+                                                       Real3* rigid_FSI_ForcesD,
+                                                       Real3* rigid_FSI_TorquesD,
+                                                       Real4* derivVelRhoD,
+                                                       Real4* derivVelRhoD_old,
+                                                       Real4* posRadD,
+                                                       uint* rigidIdentifierD,
+                                                       Real3* posRigidD,
+                                                       Real3* rigidSPH_MeshPos_LRF_D) {
     int RigidIndex = rigidIdentifierD[index];
     uint rigidMarkerIndex = index + numObjectsD.startRigidMarkers;
     Real3 Force = (mR3(derivVelRhoD[rigidMarkerIndex]) * paramsD.Beta + 
@@ -171,19 +209,34 @@ __global__ void Calc_Rigid_FSI_Forces_Torques_D(Real3* rigid_FSI_ForcesD,
     }
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Calc_Flex_FSI_ForcesD(Real3* FlexSPH_MeshPos_LRF_D,
-                                      uint* FlexIdentifierD,
-                                      uint2* CableElementsNodesD,
-                                      uint4* ShellElementsNodesD,
-                                      Real4* derivVelRhoD,
-                                      Real4* derivVelRhoD_old,
-                                      Real3* pos_fsi_fea_D,
-                                      Real3* Flex_FSI_ForcesD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void Calc_Rigid_FSI_Forces_Torques_D(Real3* rigid_FSI_ForcesD,
+                                                Real3* rigid_FSI_TorquesD,
+                                                Real4* derivVelRhoD,
+                                                Real4* derivVelRhoD_old,
+                                                Real4* posRadD,
+                                                uint* rigidIdentifierD,
+                                                Real3* posRigidD,
+                                                Real3* rigidSPH_MeshPos_LRF_D) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numFlexMarkers)
+    if (index >= numObjectsD.numRigidMarkers)
         return;
 
+    f_Calc_Rigid_FSI_Forces_Torques(index, rigid_FSI_ForcesD, rigid_FSI_TorquesD, derivVelRhoD, derivVelRhoD_old,
+                                    posRadD, rigidIdentifierD, posRigidD, rigidSPH_MeshPos_LRF_D);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_Calc_Flex_FSI_Forces(uint index,
+                                              Real3* FlexSPH_MeshPos_LRF_D,
+                                              uint* FlexIdentifierD,
+                                              uint2* CableElementsNodesD,
+                                              uint4* ShellElementsNodesD,
+                                              Real4* derivVelRhoD,
+                                              Real4* derivVelRhoD_old,
+                                              Real3* pos_fsi_fea_D,
+                                              Real3* Flex_FSI_ForcesD) {
     int FlexIndex = FlexIdentifierD[index];
     uint FlexMarkerIndex = index + numObjectsD.startFlexMarkers;
     Real3 Force = (mR3(derivVelRhoD[FlexMarkerIndex]) * paramsD.Beta + 
@@ -268,6 +321,24 @@ __global__ void Calc_Flex_FSI_ForcesD(Real3* FlexSPH_MeshPos_LRF_D,
     }
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void Calc_Flex_FSI_ForcesD(Real3* FlexSPH_MeshPos_LRF_D,
+                                      uint* FlexIdentifierD,
+                                      uint2* CableElementsNodesD,
+                                      uint4* ShellElementsNodesD,
+                                      Real4* derivVelRhoD,
+                                      Real4* derivVelRhoD_old,
+                                      Real3* pos_fsi_fea_D,
+                                      Real3* Flex_FSI_ForcesD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numFlexMarkers)
+        return;
+
+    f_Calc_Flex_FSI_Forces(index, FlexSPH_MeshPos_LRF_D, FlexIdentifierD, CableElementsNodesD, ShellElementsNodesD,
+                           derivVelRhoD, derivVelRhoD_old, pos_fsi_fea_D, Flex_FSI_ForcesD);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
 __device__ void BCE_modification_Share(Real3& sumVW,
                                        Real3& sumRhoRW,
@@ -312,26 +383,24 @@ __device__ void BCE_modification_Share(Real3& sumVW,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void BCE_VelocityPressureStress(Real3* velMas_ModifiedBCE,
-                                           Real4* rhoPreMu_ModifiedBCE,
-                                           Real3* tauXxYyZz_ModifiedBCE,
-                                           Real3* tauXyXzYz_ModifiedBCE,
-                                           Real4* sortedPosRad,
-                                           Real3* sortedVelMas,
-                                           Real4* sortedRhoPreMu,
-                                           Real3* sortedTauXxYyZz,
-                                           Real3* sortedTauXyXzYz,
-                                           uint* cellStart,
-                                           uint* cellEnd,
-                                           uint* mapOriginalToSorted,
-                                           uint* extendedActivityIdD,
-                                           Real3* bceAcc,
-                                           int2 newPortion,
-                                           volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+__device__ inline void f_BCE_VelocityPressureStress(uint index,
+                                                    Real3* velMas_ModifiedBCE,
+                                                    Real4* rhoPreMu_ModifiedBCE,
+                                                    Real3* tauXxYyZz_ModifiedBCE,
+                                                    Real3* tauXyXzYz_ModifiedBCE,
+                                                    Real4* sortedPosRad,
+                                                    Real3* sortedVelMas,
+                                                    Real4* sortedRhoPreMu,
+                                                    Real3* sortedTauXxYyZz,
+                                                    Real3* sortedTauXyXzYz,
+                                                    uint* cellStart,
+                                                    uint* cellEnd,
+                                                    uint* mapOriginalToSorted,
+                                                    uint* extendedActivityIdD,
+                                                    Real3* bceAcc,
+                                                    int2 newPortion,
+                                                    volatile bool* isErrorD) {
     uint sphIndex = index + newPortion.x;
-    if (index >= newPortion.y - newPortion.x)
-        return;
 
     // no need to do anything if it is not an active particle
     uint originalIndex = sphIndex;
@@ -429,18 +498,43 @@ __global__ void BCE_VelocityPressureStress(Real3* velMas_ModifiedBCE,
     }
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void CalcRigidBceAccelerationD(Real3* bceAcc,
-                                          Real4* q_fsiBodies_D,
-                                          Real3* accRigid_fsiBodies_D,
-                                          Real3* omegaVelLRF_fsiBodies_D,
-                                          Real3* omegaAccLRF_fsiBodies_D,
-                                          Real3* rigidSPH_MeshPos_LRF_D,
-                                          const uint* rigidIdentifierD) {
-    uint bceIndex = blockIdx.x * blockDim.x + threadIdx.x;
-    if (bceIndex >= numObjectsD.numRigidMarkers)
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void BCE_VelocityPressureStress(Real3* velMas_ModifiedBCE,
+                                           Real4* rhoPreMu_ModifiedBCE,
+                                           Real3* tauXxYyZz_ModifiedBCE,
+                                           Real3* tauXyXzYz_ModifiedBCE,
+                                           Real4* sortedPosRad,
+                                           Real3* sortedVelMas,
+                                           Real4* sortedRhoPreMu,
+                                           Real3* sortedTauXxYyZz,
+                                           Real3* sortedTauXyXzYz,
+                                           uint* cellStart,
+                                           uint* cellEnd,
+                                           uint* mapOriginalToSorted,
+                                           uint* extendedActivityIdD,
+                                           Real3* bceAcc,
+                                           int2 newPortion,
+                                           volatile bool* isErrorD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= newPortion.y - newPortion.x)
         return;
 
+    f_BCE_VelocityPressureStress(index, velMas_ModifiedBCE, rhoPreMu_ModifiedBCE, tauXxYyZz_ModifiedBCE,
+                                 tauXyXzYz_ModifiedBCE, sortedPosRad, sortedVelMas, sortedRhoPreMu, sortedTauXxYyZz,
+                                 sortedTauXyXzYz, cellStart, cellEnd, mapOriginalToSorted, extendedActivityIdD, bceAcc,
+                                 newPortion, isErrorD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_CalcRigidBceAcceleration(uint bceIndex,
+                                                  Real3* bceAcc,
+                                                  Real4* q_fsiBodies_D,
+                                                  Real3* accRigid_fsiBodies_D,
+                                                  Real3* omegaVelLRF_fsiBodies_D,
+                                                  Real3* omegaAccLRF_fsiBodies_D,
+                                                  Real3* rigidSPH_MeshPos_LRF_D,
+                                                  const uint* rigidIdentifierD) {
     int rigidBodyIndex = rigidIdentifierD[bceIndex];
 
     // linear acceleration (CM)
@@ -466,17 +560,31 @@ __global__ void CalcRigidBceAccelerationD(Real3* bceAcc,
     bceAcc[bceIndex] = acc3;
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void CalcFlexBceAccelerationD(Real3* bceAcc,
-                                         Real3* acc_fsi_fea_D,
-                                         Real3* FlexSPH_MeshPos_LRF_D,
-                                         uint2* CableElementsNodesD,
-                                         uint4* ShellElementsNodesD,
-                                         const uint* FlexIdentifierD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void CalcRigidBceAccelerationD(Real3* bceAcc,
+                                          Real4* q_fsiBodies_D,
+                                          Real3* accRigid_fsiBodies_D,
+                                          Real3* omegaVelLRF_fsiBodies_D,
+                                          Real3* omegaAccLRF_fsiBodies_D,
+                                          Real3* rigidSPH_MeshPos_LRF_D,
+                                          const uint* rigidIdentifierD) {
     uint bceIndex = blockIdx.x * blockDim.x + threadIdx.x;
-    if (bceIndex >= numObjectsD.numFlexMarkers)
+    if (bceIndex >= numObjectsD.numRigidMarkers)
         return;
 
+    f_CalcRigidBceAcceleration(bceIndex, bceAcc, q_fsiBodies_D, accRigid_fsiBodies_D, omegaVelLRF_fsiBodies_D,
+                               omegaAccLRF_fsiBodies_D, rigidSPH_MeshPos_LRF_D, rigidIdentifierD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_CalcFlexBceAcceleration(uint bceIndex,
+                                                 Real3* bceAcc,
+                                                 Real3* acc_fsi_fea_D,
+                                                 Real3* FlexSPH_MeshPos_LRF_D,
+                                                 uint2* CableElementsNodesD,
+                                                 uint4* ShellElementsNodesD,
+                                                 const uint* FlexIdentifierD) {
     int FlexIndex = FlexIdentifierD[bceIndex];
     int numFlex1D = numObjectsD.numFlexBodies1D;
     int numFlex2D = numObjectsD.numFlexBodies2D;
@@ -515,19 +623,32 @@ __global__ void CalcFlexBceAccelerationD(Real3* bceAcc,
     }
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void UpdateRigidMarkersPositionVelocityD(Real4* posRadD,
-                                                    Real3* velMasD,
-                                                    Real3* rigidSPH_MeshPos_LRF_D,
-                                                    uint* rigidIdentifierD,
-                                                    Real3* posRigidD,
-                                                    Real4* velMassRigidD,
-                                                    Real3* omegaLRF_D,
-                                                    Real4* qD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numRigidMarkers)
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void CalcFlexBceAccelerationD(Real3* bceAcc,
+                                         Real3* acc_fsi_fea_D,
+                                         Real3* FlexSPH_MeshPos_LRF_D,
+                                         uint2* CableElementsNodesD,
+                                         uint4* ShellElementsNodesD,
+                                         const uint* FlexIdentifierD) {
+    uint bceIndex = blockIdx.x * blockDim.x + threadIdx.x;
+    if (bceIndex >= numObjectsD.numFlexMarkers)
         return;
 
+    f_CalcFlexBceAcceleration(bceIndex, bceAcc, acc_fsi_fea_D, FlexSPH_MeshPos_LRF_D, CableElementsNodesD,
+                              ShellElementsNodesD, FlexIdentifierD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_UpdateRigidMarkersPositionVelocity(uint index,
+                                                            Real4* posRadD,
+                                                            Real3* velMasD,
+                                                            Real3* rigidSPH_MeshPos_LRF_D,
+                                                            uint* rigidIdentifierD,
+                                                            Real3* posRigidD,
+                                                            Real4* velMassRigidD,
+                                                            Real3* omegaLRF_D,
+                                                            Real4* qD) {
     uint rigidMarkerIndex = index + numObjectsD.startRigidMarkers;
     int rigidBodyIndex = rigidIdentifierD[index];
 
@@ -551,20 +672,35 @@ __global__ void UpdateRigidMarkersPositionVelocityD(Real4* posRadD,
     velMasD[rigidMarkerIndex] = mR3(vM_Rigid) + mR3(dot(a1, omegaCrossS), dot(a2, omegaCrossS), dot(a3, omegaCrossS));
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void UpdateFlexMarkersPositionVelocityD(Real4* posRadD,
-                                                   Real3* FlexSPH_MeshPos_LRF_D,
-                                                   Real3* velMasD,
-                                                   const uint* FlexIdentifierD,
-                                                   uint2* CableElementsNodesD,
-                                                   uint4* ShellElementsNodesD,
-                                                   Real3* pos_fsi_fea_D,
-                                                   Real3* vel_fsi_fea_D,
-                                                   Real3* dir_fsi_fea_D) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void UpdateRigidMarkersPositionVelocityD(Real4* posRadD,
+                                                    Real3* velMasD,
+                                                    Real3* rigidSPH_MeshPos_LRF_D,
+                                                    uint* rigidIdentifierD,
+                                                    Real3* posRigidD,
+                                                    Real4* velMassRigidD,
+                                                    Real3* omegaLRF_D,
+                                                    Real4* qD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numFlexMarkers)
+    if (index >= numObjectsD.numRigidMarkers)
         return;
 
+    f_UpdateRigidMarkersPositionVelocity(index, posRadD, velMasD, rigidSPH_MeshPos_LRF_D, rigidIdentifierD, posRigidD,
+                                         velMassRigidD, omegaLRF_D, qD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_UpdateFlexMarkersPositionVelocity(uint index,
+                                                           Real4* posRadD,
+                                                           Real3* FlexSPH_MeshPos_LRF_D,
+                                                           Real3* velMasD,
+                                                           const uint* FlexIdentifierD,
+                                                           uint2* CableElementsNodesD,
+                                                           uint4* ShellElementsNodesD,
+                                                           Real3* pos_fsi_fea_D,
+                                                           Real3* vel_fsi_fea_D,
+                                                           Real3* dir_fsi_fea_D) {
     uint FlexMarkerIndex = index + numObjectsD.startFlexMarkers;
     uint FlexIndex = FlexIdentifierD[index];
     uint numFlex1D = numObjectsD.numFlexBodies1D;
@@ -649,6 +785,26 @@ __global__ void UpdateFlexMarkersPositionVelocityD(Real4* posRadD,
     }
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void UpdateFlexMarkersPositionVelocityD(Real4* posRadD,
+                                                   Real3* FlexSPH_MeshPos_LRF_D,
+                                                   Real3* velMasD,
+                                                   const uint* FlexIdentifierD,
+                                                   uint2* CableElementsNodesD,
+                                                   uint4* ShellElementsNodesD,
+                                                   Real3* pos_fsi_fea_D,
+                                                   Real3* vel_fsi_fea_D,
+                                                   Real3* dir_fsi_fea_D) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numFlexMarkers)
+        return;
+
+    f_UpdateFlexMarkersPositionVelocity(index, posRadD, FlexSPH_MeshPos_LRF_D, velMasD, FlexIdentifierD,
+                                        CableElementsNodesD, ShellElementsNodesD, pos_fsi_fea_D, vel_fsi_fea_D,
+                                        dir_fsi_fea_D);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
 ChBce::ChBce(std::shared_ptr<SphMarkerDataD> otherSortedSphMarkersD,
              std::shared_ptr<ProximityDataD> otherMarkersProximityD,
@@ -675,8 +831,13 @@ void ChBce::Initialize(std::shared_ptr<SphMarkerDataD> sphMarkersD,
                        std::vector<int> fsiBodyBceNum,
                        std::vector<int> fsiShellBceNum,
                        std::vector<int> fsiCableBceNum) {
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
+#endif
     CopyParams_NumberOfObjects(paramsH, numObjectsH);
 
     // Resizing the arrays used to modify the BCE velocity and pressure according to ADAMI
@@ -738,6 +899,14 @@ void ChBce::Populate_RigidSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMar
         start_bce = end_bce;
     }
 
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < (int)numObjectsH->numRigidMarkers; index++) {
+        f_Populate_RigidSPH_MeshPos_LRF(index, mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D),
+                                        mR4CAST(sphMarkersD->posRadD), U1CAST(fsiGeneralData->rigidIdentifierD),
+                                        mR3CAST(fsiBodiesD->posRigid_fsiBodies_D), mR4CAST(fsiBodiesD->q_fsiBodies_D));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
@@ -748,6 +917,7 @@ void ChBce::Populate_RigidSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMar
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 
     UpdateRigidMarkersPositionVelocity(sphMarkersD, fsiBodiesD);
 }
@@ -773,10 +943,20 @@ void ChBce::Populate_FlexSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMark
         start_bce = end_bce;
     }
 
+    thrust::device_vector<Real3> FlexSPH_MeshPos_LRF_H = fsiGeneralData->FlexSPH_MeshPos_LRF_H;
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < (int)numObjectsH->numFlexMarkers; index++) {
+        f_Populate_FlexSPH_MeshPos_LRF(index, mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D),
+                                       mR3CAST(FlexSPH_MeshPos_LRF_H), mR4CAST(sphMarkersD->posRadD),
+                                       U1CAST(fsiGeneralData->FlexIdentifierD),
+                                       U2CAST(fsiGeneralData->CableElementsNodesD),
+                                       U4CAST(fsiGeneralData->ShellElementsNodesD), mR3CAST(fsiMeshD->pos_fsi_fea_D));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
-    thrust::device_vector<Real3> FlexSPH_MeshPos_LRF_H = fsiGeneralData->FlexSPH_MeshPos_LRF_H;
     Populate_FlexSPH_MeshPos_LRF_D<<<nBlocks, nThreads>>>(
         mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D), mR3CAST(FlexSPH_MeshPos_LRF_H), mR4CAST(sphMarkersD->posRadD),
         U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
@@ -784,6 +964,7 @@ void ChBce::Populate_FlexSPH_MeshPos_LRF(std::shared_ptr<SphMarkerDataD> sphMark
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 
     UpdateFlexMarkersPositionVelocity(sphMarkersD, fsiMeshD);
 }
@@ -804,13 +985,6 @@ void ChBce::ReCalcVelocityPressureStress_BCE(thrust::device_vector<Real3>& velMa
                                              const thrust::device_vector<uint>& extendedActivityIdD,
                                              const thrust::device_vector<Real3>& bceAcc,
                                              int4 updatePortion) {
-    bool *isErrorH, *isErrorD;
-    isErrorH = (bool*)malloc(sizeof(bool));
-    cudaMalloc((void**)&isErrorD, sizeof(bool));
-    *isErrorH = false;
-    cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
-
-    // thread per particle
     int2 newPortion = mI2(updatePortion.x, updatePortion.w);
     if (paramsH->bceTypeWall == BceVersion::ORIGINAL) {
         // Only implement ADAMI BC for rigid body boundary.
@@ -818,6 +992,27 @@ void ChBce::ReCalcVelocityPressureStress_BCE(thrust::device_vector<Real3>& velMa
         newPortion = mI2(updatePortion.y, updatePortion.w);
     }
     uint numBCE = newPortion.y - newPortion.x;
+
+#ifdef CHRONO_FSI_USE_CPU
+    bool isError = false;
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < (int)numBCE; index++) {
+        f_BCE_VelocityPressureStress(
+            index, mR3CAST(velMas_ModifiedBCE), mR4CAST(rhoPreMu_ModifiedBCE), mR3CAST(tauXxYyZz_ModifiedBCE),
+            mR3CAST(tauXyXzYz_ModifiedBCE), mR4CAST(sortedPosRad), mR3CAST(sortedVelMas), mR4CAST(sortedRhoPreMu),
+            mR3CAST(sortedTauXxYyZz), mR3CAST(sortedTauXyXzYz), U1CAST(cellStart), U1CAST(cellEnd),
+            U1CAST(mapOriginalToSorted), U1CAST(extendedActivityIdD), mR3CAST(bceAcc), newPortion, &isError);
+    }
+    if (isError)
+        throw std::runtime_error("Error! program crashed in new_BCE_VelocityPressure!\n");
+#else
+    bool *isErrorH, *isErrorD;
+    isErrorH = (bool*)malloc(sizeof(bool));
+    cudaMalloc((void**)&isErrorD, sizeof(bool));
+    *isErrorH = false;
+    cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
+
+    // thread per particle
     uint numThreads, numBlocks;
     computeGridSize(numBCE, 256, numBlocks, numThreads);
 
@@ -836,6 +1031,7 @@ void ChBce::ReCalcVelocityPressureStress_BCE(thrust::device_vector<Real3>& velMa
 
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -846,6 +1042,14 @@ void ChBce::CalcRigidBceAcceleration(thrust::device_vector<Real3>& bceAcc,
                                      const thrust::device_vector<Real3>& omegaAccLRF_fsiBodies_D,
                                      const thrust::device_vector<Real3>& rigidSPH_MeshPos_LRF_D,
                                      const thrust::device_vector<uint>& rigidIdentifierD) {
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int bceIndex = 0; bceIndex < (int)numObjectsH->numRigidMarkers; bceIndex++) {
+        f_CalcRigidBceAcceleration(bceIndex, mR3CAST(bceAcc), mR4CAST(q_fsiBodies_D), mR3CAST(accRigid_fsiBodies_D),
+                                   mR3CAST(omegaVelLRF_fsiBodies_D), mR3CAST(omegaAccLRF_fsiBodies_D),
+                                   mR3CAST(rigidSPH_MeshPos_LRF_D), U1CAST(rigidIdentifierD));
+    }
+#else
     // thread per particle
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, numBlocks, numThreads);
@@ -856,6 +1060,7 @@ void ChBce::CalcRigidBceAcceleration(thrust::device_vector<Real3>& bceAcc,
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -865,6 +1070,13 @@ void ChBce::CalcFlexBceAcceleration(thrust::device_vector<Real3>& bceAcc,
                                     const thrust::device_vector<int2>& CableElementsNodesD,
                                     const thrust::device_vector<int4>& ShellElementsNodesD,
                                     const thrust::device_vector<uint>& FlexIdentifierD) {
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int bceIndex = 0; bceIndex < (int)numObjectsH->numFlexMarkers; bceIndex++) {
+        f_CalcFlexBceAcceleration(bceIndex, mR3CAST(bceAcc), mR3CAST(acc_fsi_fea_D), mR3CAST(FlexSPH_MeshPos_LRF_D),
+                                  U2CAST(CableElementsNodesD), U4CAST(ShellElementsNodesD), U1CAST(FlexIdentifierD));
+    }
+#else
     // thread per particle
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numFlexMarkers, 256, numBlocks, numThreads);
@@ -875,6 +1087,7 @@ void ChBce::CalcFlexBceAcceleration(thrust::device_vector<Real3>& bceAcc,
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -988,6 +1201,16 @@ void ChBce::Rigid_Forces_Torques(std::shared_ptr<SphMarkerDataD> sphMarkersD,
     thrust::fill(fsiGeneralData->rigid_FSI_ForcesD.begin(), fsiGeneralData->rigid_FSI_ForcesD.end(), mR3(0));
     thrust::fill(fsiGeneralData->rigid_FSI_TorquesD.begin(), fsiGeneralData->rigid_FSI_TorquesD.end(), mR3(0));
 
+#ifdef CHRONO_FSI_USE_CPU
+    // Serial accumulation of the BCE marker forces (see atomicAdd_double)
+    for (int index = 0; index < (int)numObjectsH->numRigidMarkers; index++) {
+        f_Calc_Rigid_FSI_Forces_Torques(
+            index, mR3CAST(fsiGeneralData->rigid_FSI_ForcesD), mR3CAST(fsiGeneralData->rigid_FSI_TorquesD),
+            mR4CAST(fsiGeneralData->derivVelRhoD), mR4CAST(fsiGeneralData->derivVelRhoD_old),
+            mR4CAST(sphMarkersD->posRadD), U1CAST(fsiGeneralData->rigidIdentifierD),
+            mR3CAST(fsiBodiesD->posRigid_fsiBodies_D), mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((uint)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
@@ -999,6 +1222,7 @@ void ChBce::Rigid_Forces_Torques(std::shared_ptr<SphMarkerDataD> sphMarkersD,
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -1008,6 +1232,16 @@ void ChBce::Flex_Forces(std::shared_ptr<SphMarkerDataD> sphMarkersD, std::shared
 
     thrust::fill(fsiGeneralData->Flex_FSI_ForcesD.begin(), fsiGeneralData->Flex_FSI_ForcesD.end(), mR3(0));
 
+#ifdef CHRONO_FSI_USE_CPU
+    // Serial accumulation of the BCE marker forces (see atomicAdd_double)
+    for (int index = 0; index < (int)numObjectsH->numFlexMarkers; index++) {
+        f_Calc_Flex_FSI_Forces(index, mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D),
+                               U1CAST(fsiGeneralData->FlexIdentifierD), U2CAST(fsiGeneralData->CableElementsNodesD),
+                               U4CAST(fsiGeneralData->ShellElementsNodesD), mR4CAST(fsiGeneralData->derivVelRhoD),
+                               mR4CAST(fsiGeneralData->derivVelRhoD_old), mR3CAST(fsiMeshD->pos_fsi_fea_D),
+                               mR3CAST(fsiGeneralData->Flex_FSI_ForcesD));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
@@ -1019,6 +1253,7 @@ void ChBce::Flex_Forces(std::shared_ptr<SphMarkerDataD> sphMarkersD, std::shared
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -1027,6 +1262,16 @@ void ChBce::UpdateRigidMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> s
     if (numObjectsH->numRigidBodies == 0)
         return;
 
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < (int)numObjectsH->numRigidMarkers; index++) {
+        f_UpdateRigidMarkersPositionVelocity(
+            index, mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
+            mR3CAST(fsiGeneralData->rigidSPH_MeshPos_LRF_D), U1CAST(fsiGeneralData->rigidIdentifierD),
+            mR3CAST(fsiBodiesD->posRigid_fsiBodies_D), mR4CAST(fsiBodiesD->velMassRigid_fsiBodies_D),
+            mR3CAST(fsiBodiesD->omegaVelLRF_fsiBodies_D), mR4CAST(fsiBodiesD->q_fsiBodies_D));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numRigidMarkers, 256, nBlocks, nThreads);
 
@@ -1038,6 +1283,7 @@ void ChBce::UpdateRigidMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> s
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -1046,6 +1292,16 @@ void ChBce::UpdateFlexMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> sp
     if ((numObjectsH->numFlexBodies1D + numObjectsH->numFlexBodies2D) == 0)
         return;
 
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < (int)numObjectsH->numFlexMarkers; index++) {
+        f_UpdateFlexMarkersPositionVelocity(
+            index, mR4CAST(sphMarkersD->posRadD), mR3CAST(fsiGeneralData->FlexSPH_MeshPos_LRF_D),
+            mR3CAST(sphMarkersD->velMasD), U1CAST(fsiGeneralData->FlexIdentifierD),
+            U2CAST(fsiGeneralData->CableElementsNodesD), U4CAST(fsiGeneralData->ShellElementsNodesD),
+            mR3CAST(fsiMeshD->pos_fsi_fea_D), mR3CAST(fsiMeshD->vel_fsi_fea_D), mR3CAST(fsiMeshD->dir_fsi_fea_D));
+    }
+#else
     uint nBlocks, nThreads;
     computeGridSize((int)numObjectsH->numFlexMarkers, 256, nBlocks, nThreads);
 
@@ -1057,6 +1313,7 @@ void ChBce::UpdateFlexMarkersPositionVelocity(std::shared_ptr<SphMarkerDataD> sp
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 }  // end namespace fsi
@@ -28,15 +28,11 @@ namespace fsi {
 // 2. From x, y, z position, determine which bin it is in.
 // 3. Calculate hash from bin index.
 // 4. Store hash and particle index associated with it.
-__global__ void calcHashD(uint* gridMarkerHashD,   // store particle hash here
-                          uint* gridMarkerIndexD,  // store particle index here
-                          Real4* posRad,           // vector containing the positions of all particles (SPH and BCE)
-                          volatile bool* isErrorD) {
-    // Calculate the index of where the particle is stored in posRad.
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numAllMarkers)
-        return;
-
+__device__ inline void f_calcHash(uint index,              // particle index
+                                  uint* gridMarkerHashD,   // store particle hash here
+                                  uint* gridMarkerIndexD,  // store particle index here
+                                  Real4* posRad,           // positions of all particles (SPH and BCE)
+                                  volatile bool* isErrorD) {
     Real3 p = mR3(posRad[index]);
 
     if (!(isfinite(p.x) && isfinite(p.y) && isfinite(p.z))) {
@@ -76,6 +72,19 @@ __global__ void calcHashD(uint* gridMarkerHashD,   // store particle hash here
     // Store particle index associated to the hash we stored in gridMarkerHashD
     gridMarkerIndexD[index] = index;
 }
+
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void calcHashD(uint* gridMarkerHashD,   // store particle hash here
+                          uint* gridMarkerIndexD,  // store particle index here
+                          Real4* posRad,           // vector containing the positions of all particles (SPH and BCE)
+                          volatile bool* isErrorD) {
+    // Calculate the index of where the particle is stored in posRad.
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numAllMarkers)
+        return;
+
+    f_calcHash(index, gridMarkerHashD, gridMarkerIndexD, posRad, isErrorD);
+}
 // ------------------------------------------------------------------------------
 __global__ void reorderDataAndFindCellStartD(uint* cellStartD,          // output: cell start index
                                              uint* cellEndD,            // output: cell end index
@@ -213,25 +222,40 @@ __global__ void findCellStartEndD(uint* cellStartD,         // output: cell star
             cellEndD[hash] = index + 1;
     }
 }
-// ------------------------------------------------------------------------------
-__global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted particle indices
-                             uint* extendedActivityIdD,  // input: particles in an extended active sub-domain
-                             uint* mapOriginalToSorted,  // input: original index to sorted index
-                             Real4* sortedPosRadD,       // output: sorted positions
-                             Real3* sortedVelMasD,       // output: sorted velocities
-                             Real4* sortedRhoPreMuD,     // output: sorted density pressure
-                             Real3* sortedTauXxYyZzD,    // output: sorted total stress xxyyzz
-                             Real3* sortedTauXyXzYzD,    // output: sorted total stress xyzxyz
-                             Real4* posRadD,             // input: original position array
-                             Real3* velMasD,             // input: original velocity array
-                             Real4* rhoPresMuD,          // input: original density pressure
-                             Real3* tauXxYyZzD,          // input: original total stress xxyyzz
-                             Real3* tauXyXzYzD           // input: original total stress xyzxyz
-                             ) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers)
-        return;
+#endif
+
+// Host version of findCellStartEndD (the neighbor hash is read directly instead of from shared memory)
+__device__ inline void f_findCellStartEnd(uint index,             // particle index
+                                          uint* cellStartD,       // output: cell start index
+                                          uint* cellEndD,         // output: cell end index
+                                          uint* gridMarkerHashD,  // input: sorted grid hashes
+                                          uint numAllMarkers) {
+    uint hash = gridMarkerHashD[index];
+    if (index == 0 || hash != gridMarkerHashD[index - 1]) {
+        cellStartD[hash] = index;
+        if (index > 0)
+            cellEndD[gridMarkerHashD[index - 1]] = index;
+    }
 
+    if (index == numAllMarkers - 1)
+        cellEndD[hash] = index + 1;
+}
+// ------------------------------------------------------------------------------
+__device__ inline void f_reorderData(uint id,                    // original particle index
+                                     uint* gridMarkerIndexD,     // input: sorted particle indices
+                                     uint* extendedActivityIdD,  // input: particles in an extended active sub-domain
+                                     uint* mapOriginalToSorted,  // input: original index to sorted index
+                                     Real4* sortedPosRadD,       // output: sorted positions
+                                     Real3* sortedVelMasD,       // output: sorted velocities
+                                     Real4* sortedRhoPreMuD,     // output: sorted density pressure
+                                     Real3* sortedTauXxYyZzD,    // output: sorted total stress xxyyzz
+                                     Real3* sortedTauXyXzYzD,    // output: sorted total stress xyzxyz
+                                     Real4* posRadD,             // input: original position array
+                                     Real3* velMasD,             // input: original velocity array
+                                     Real4* rhoPresMuD,          // input: original density pressure
+                                     Real3* tauXxYyZzD,          // input: original total stress xxyyzz
+                                     Real3* tauXyXzYzD           // input: original total stress xyzxyz
+                                     ) {
     // Now use the sorted index to reorder the pos and vel data
     uint originalIndex = id;
 
@@ -286,6 +310,30 @@ __global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted partic
         sortedTauXyXzYzD[index] = tauXyXzYz; 
     }
 }
+
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void reorderDataD(uint* gridMarkerIndexD,     // input: sorted particle indices
+                             uint* extendedActivityIdD,  // input: particles in an extended active sub-domain
+                             uint* mapOriginalToSorted,  // input: original index to sorted index
+                             Real4* sortedPosRadD,       // output: sorted positions
+                             Real3* sortedVelMasD,       // output: sorted velocities
+                             Real4* sortedRhoPreMuD,     // output: sorted density pressure
+                             Real3* sortedTauXxYyZzD,    // output: sorted total stress xxyyzz
+                             Real3* sortedTauXyXzYzD,    // output: sorted total stress xyzxyz
+                             Real4* posRadD,             // input: original position array
+                             Real3* velMasD,             // input: original velocity array
+                             Real4* rhoPresMuD,          // input: original density pressure
+                             Real3* tauXxYyZzD,          // input: original total stress xxyyzz
+                             Real3* tauXyXzYzD           // input: original total stress xyzxyz
+                             ) {
+    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+    if (id >= numObjectsD.numAllMarkers)
+        return;
+
+    f_reorderData(id, gridMarkerIndexD, extendedActivityIdD, mapOriginalToSorted, sortedPosRadD, sortedVelMasD,
+                  sortedRhoPreMuD, sortedTauXxYyZzD, sortedTauXyXzYzD, posRadD, velMasD, rhoPresMuD, tauXxYyZzD,
+                  tauXyXzYzD);
+}
 // ------------------------------------------------------------------------------
 __global__ void OriginalToSortedD(uint* mapOriginalToSorted,
                                   uint* gridMarkerIndex) {
@@ -297,6 +345,7 @@ __global__ void OriginalToSortedD(uint* mapOriginalToSorted,
 
     mapOriginalToSorted[index] = id;
 }
+#endif
 // ------------------------------------------------------------------------------
 ChCollisionSystemFsi::ChCollisionSystemFsi(std::shared_ptr<SphMarkerDataD> otherSortedSphMarkersD,
                                            std::shared_ptr<ProximityDataD> otherMarkersProximityD,
@@ -313,8 +362,13 @@ ChCollisionSystemFsi::ChCollisionSystemFsi(std::shared_ptr<SphMarkerDataD> other
 ChCollisionSystemFsi::~ChCollisionSystemFsi() {}
 // ------------------------------------------------------------------------------
 void ChCollisionSystemFsi::Initialize() {
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
+#endif
 }
 //-------------------------------------------------------------------------------
 void ChCollisionSystemFsi::calcHash() {
@@ -329,6 +383,17 @@ void ChCollisionSystemFsi::calcHash() {
         throw std::runtime_error("Error! size error, calcHash!");
     }
 
+#ifdef CHRONO_FSI_USE_CPU
+    bool isError = false;
+    int numAllMarkers = (int)numObjectsH->numAllMarkers;
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < numAllMarkers; index++) {
+        f_calcHash(index, U1CAST(markersProximityD->gridMarkerHashD), U1CAST(markersProximityD->gridMarkerIndexD),
+                   mR4CAST(sphMarkersD->posRadD), &isError);
+    }
+    if (isError)
+        throw std::runtime_error("Error! program crashed in  calcHashD!\n");
+#else
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -351,6 +416,7 @@ void ChCollisionSystemFsi::calcHash() {
         throw std::runtime_error("Error! program crashed in  calcHashD!\n");
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 // ------------------------------------------------------------------------------
 void ChCollisionSystemFsi::ResetCellSize(int s) {
@@ -372,6 +438,32 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
     thrust::fill(markersProximityD->cellEndD.begin(), 
         markersProximityD->cellEndD.end(), 0);
 
+#ifdef CHRONO_FSI_USE_CPU
+    int numAllMarkers = (int)numObjectsH->numAllMarkers;
+    uint* gridMarkerHashD = U1CAST(markersProximityD->gridMarkerHashD);
+    uint* gridMarkerIndexD = U1CAST(markersProximityD->gridMarkerIndexD);
+    uint* mapOriginalToSorted = U1CAST(markersProximityD->mapOriginalToSorted);
+
+    // Find the start index and the end index of the sorted array in each cell,
+    // and the location of original particles in the sorted arrays
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < numAllMarkers; index++) {
+        f_findCellStartEnd(index, U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD),
+                           gridMarkerHashD, numAllMarkers);
+        mapOriginalToSorted[gridMarkerIndexD[index]] = index;
+    }
+
+    // Reorder the arrays according to the sorted index of all particles
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int id = 0; id < numAllMarkers; id++) {
+        f_reorderData(id, gridMarkerIndexD, U1CAST(fsiGeneralData->extendedActivityIdD), mapOriginalToSorted,
+                      mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
+                      mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(sortedSphMarkersD->tauXxYyZzD),
+                      mR3CAST(sortedSphMarkersD->tauXyXzYzD), mR4CAST(sphMarkersD->posRadD),
+                      mR3CAST(sphMarkersD->velMasD), mR4CAST(sphMarkersD->rhoPresMuD),
+                      mR3CAST(sphMarkersD->tauXxYyZzD), mR3CAST(sphMarkersD->tauXyXzYzD));
+    }
+#else
     uint numThreads, numBlocks;
     computeGridSize((uint)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
@@ -401,6 +493,7 @@ void ChCollisionSystemFsi::reorderDataAndFindCellStart() {
         mR3CAST(sphMarkersD->tauXxYyZzD), mR3CAST(sphMarkersD->tauXyXzYzD));
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 // ------------------------------------------------------------------------------
 void ChCollisionSystemFsi::ArrangeData(std::shared_ptr<SphMarkerDataD> otherSphMarkersD) {
@@ -57,13 +57,10 @@ __device__ void collideCellDensityReInit(Real& numerator,
 
 // -----------------------------------------------------------------------------
 // Kernel to apply periodic BC along x
-__global__ void ApplyPeriodicBoundaryXKernel(Real4* posRadD, 
-                                             Real4* rhoPresMuD, 
-                                             uint* activityIdentifierD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numAllMarkers)
-        return;
-
+__device__ inline void f_ApplyPeriodicBoundaryX(uint index,
+                                                Real4* posRadD,
+                                                Real4* rhoPresMuD,
+                                                uint* activityIdentifierD) {
     uint activity = activityIdentifierD[index];
     if (activity == 0)
         return; // no need to do anything if it is not an active particle
@@ -91,15 +88,24 @@ __global__ void ApplyPeriodicBoundaryXKernel(Real4* posRadD,
     }
 }
 
-// -----------------------------------------------------------------------------
-// Kernel to apply inlet/outlet BC along x
-__global__ void ApplyInletBoundaryXKernel(Real4* posRadD, 
-                                          Real3* VelMassD, 
-                                          Real4* rhoPresMuD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ApplyPeriodicBoundaryXKernel(Real4* posRadD, 
+                                             Real4* rhoPresMuD, 
+                                             uint* activityIdentifierD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_ApplyPeriodicBoundaryX(index, posRadD, rhoPresMuD, activityIdentifierD);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Kernel to apply inlet/outlet BC along x
+__device__ inline void f_ApplyInletBoundaryX(uint index,
+                                             Real4* posRadD,
+                                             Real3* VelMassD,
+                                             Real4* rhoPresMuD) {
     Real4 rhoPresMu = rhoPresMuD[index];
     if (rhoPresMu.w > 0.0)
         return; // no need to do anything if it is a boundary particle
@@ -132,15 +138,24 @@ __global__ void ApplyInletBoundaryXKernel(Real4* posRadD,
         VelMassD[index] = mR3(paramsD.V_in.x, 0, 0);
 }
 
-// -----------------------------------------------------------------------------
-// Kernel to apply periodic BC along y
-__global__ void ApplyPeriodicBoundaryYKernel(Real4* posRadD, 
-                                             Real4* rhoPresMuD, 
-                                             uint* activityIdentifierD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ApplyInletBoundaryXKernel(Real4* posRadD, 
+                                          Real3* VelMassD, 
+                                          Real4* rhoPresMuD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_ApplyInletBoundaryX(index, posRadD, VelMassD, rhoPresMuD);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Kernel to apply periodic BC along y
+__device__ inline void f_ApplyPeriodicBoundaryY(uint index,
+                                                Real4* posRadD,
+                                                Real4* rhoPresMuD,
+                                                uint* activityIdentifierD) {
     uint activity = activityIdentifierD[index];
     if (activity == 0)
         return; // no need to do anything if it is not an active particle
@@ -172,15 +187,24 @@ __global__ void ApplyPeriodicBoundaryYKernel(Real4* posRadD,
     }
 }
 
-// -----------------------------------------------------------------------------
-// Kernel to apply periodic BC along z
-__global__ void ApplyPeriodicBoundaryZKernel(Real4* posRadD, 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ApplyPeriodicBoundaryYKernel(Real4* posRadD, 
                                              Real4* rhoPresMuD, 
                                              uint* activityIdentifierD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_ApplyPeriodicBoundaryY(index, posRadD, rhoPresMuD, activityIdentifierD);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Kernel to apply periodic BC along z
+__device__ inline void f_ApplyPeriodicBoundaryZ(uint index,
+                                                Real4* posRadD,
+                                                Real4* rhoPresMuD,
+                                                uint* activityIdentifierD) {
     uint activity = activityIdentifierD[index];
     if (activity == 0)
         return; // no need to do anything if it is not an active particle
@@ -212,15 +236,24 @@ __global__ void ApplyPeriodicBoundaryZKernel(Real4* posRadD,
     }
 }
 
-// -----------------------------------------------------------------------------
-// Kernel to keep particle inside the simulation domain
-__global__ void ApplyOutOfBoundaryKernel(Real4* posRadD, 
-                                         Real4* rhoPresMuD, 
-                                         Real3* velMasD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ApplyPeriodicBoundaryZKernel(Real4* posRadD, 
+                                             Real4* rhoPresMuD, 
+                                             uint* activityIdentifierD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_ApplyPeriodicBoundaryZ(index, posRadD, rhoPresMuD, activityIdentifierD);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Kernel to keep particle inside the simulation domain
+__device__ inline void f_ApplyOutOfBoundary(uint index,
+                                            Real4* posRadD,
+                                            Real4* rhoPresMuD,
+                                            Real3* velMasD) {
     Real4 rhoPresMu = rhoPresMuD[index];
     if (fabs(rhoPresMu.w) < .1)
         return; // no need to do anything if it is a boundary particle
@@ -247,30 +280,38 @@ __global__ void ApplyOutOfBoundaryKernel(Real4* posRadD,
     return;
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ApplyOutOfBoundaryKernel(Real4* posRadD, 
+                                         Real4* rhoPresMuD, 
+                                         Real3* velMasD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numAllMarkers)
+        return;
+
+    f_ApplyOutOfBoundary(index, posRadD, rhoPresMuD, velMasD);
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // Kernel to update the fluid properities. It updates the stress tensor,
 // density, velocity and position relying on explicit Euler scheme.
 // Pressure is obtained from the density and an Equation of State.
-__global__ void UpdateFluidD(Real4* posRadD,
-                             Real3* velMasD,
-                             Real4* rhoPresMuD,
-                             Real3* tauXxYyZzD,
-                             Real3* tauXyXzYzD,
-                             Real3* vel_XSPH_D,
-                             Real4* derivVelRhoD,
-                             Real3* derivTauXxYyZzD,
-                             Real3* derivTauXyXzYzD,
-                             Real4* sr_tau_I_mu_iD,
-                             uint* activityIdentifierD,
-                             uint* freeSurfaceIdD,
-                             int2 updatePortion,
-                             Real dT,
-                             volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    index += updatePortion.x;
-    if (index >= updatePortion.y)
-        return;
-
+__device__ inline void f_UpdateFluid(uint index,
+                                     Real4* posRadD,
+                                     Real3* velMasD,
+                                     Real4* rhoPresMuD,
+                                     Real3* tauXxYyZzD,
+                                     Real3* tauXyXzYzD,
+                                     Real3* vel_XSPH_D,
+                                     Real4* derivVelRhoD,
+                                     Real3* derivTauXxYyZzD,
+                                     Real3* derivTauXyXzYzD,
+                                     Real4* sr_tau_I_mu_iD,
+                                     uint* activityIdentifierD,
+                                     uint* freeSurfaceIdD,
+                                     int2 updatePortion,
+                                     Real dT,
+                                     volatile bool* isErrorD) {
     uint activity = activityIdentifierD[index];
     if (activity == 0)
         return;
@@ -434,7 +475,35 @@ __global__ void UpdateFluidD(Real4* posRadD,
     // derivVelRhoD[index] *= paramsD.markerMass;
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void UpdateFluidD(Real4* posRadD,
+                             Real3* velMasD,
+                             Real4* rhoPresMuD,
+                             Real3* tauXxYyZzD,
+                             Real3* tauXyXzYzD,
+                             Real3* vel_XSPH_D,
+                             Real4* derivVelRhoD,
+                             Real3* derivTauXxYyZzD,
+                             Real3* derivTauXyXzYzD,
+                             Real4* sr_tau_I_mu_iD,
+                             uint* activityIdentifierD,
+                             uint* freeSurfaceIdD,
+                             int2 updatePortion,
+                             Real dT,
+                             volatile bool* isErrorD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    index += updatePortion.x;
+    if (index >= updatePortion.y)
+        return;
+
+    f_UpdateFluid(index, posRadD, velMasD, rhoPresMuD, tauXxYyZzD, tauXyXzYzD, vel_XSPH_D, derivVelRhoD,
+                  derivTauXxYyZzD, derivTauXyXzYzD, sr_tau_I_mu_iD, activityIdentifierD, freeSurfaceIdD, updatePortion,
+                  dT, isErrorD);
+}
+#endif
+
 //------------------------------------------------------------------------------
+#ifndef CHRONO_FSI_USE_CPU
 __global__ void Update_Fluid_State(Real3* new_vel,
                                    Real4* posRad,
                                    Real3* velMas,
@@ -469,22 +538,20 @@ __global__ void Update_Fluid_State(Real3* new_vel,
             i_idx, velMas[i_idx].x, velMas[i_idx].y, velMas[i_idx].z);
     }
 }
+#endif
 
 // -----------------------------------------------------------------------------
 // Kernel for updating the density.
 // It calculates the density of the particle. It does include the normalization
 // close to the boundaries and free surface.
-__global__ void ReCalcDensityD_F1(Real4* dummySortedRhoPreMu,
-                                  Real4* sortedPosRad,
-                                  Real3* sortedVelMas,
-                                  Real4* sortedRhoPreMu,
-                                  uint* gridMarkerIndex,
-                                  uint* cellStart,
-                                  uint* cellEnd) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numAllMarkers)
-        return;
-
+__device__ inline void f_ReCalcDensity_F1(uint index,
+                                          Real4* dummySortedRhoPreMu,
+                                          Real4* sortedPosRad,
+                                          Real3* sortedVelMas,
+                                          Real4* sortedRhoPreMu,
+                                          uint* gridMarkerIndex,
+                                          uint* cellStart,
+                                          uint* cellEnd) {
     // read particle data from sorted arrays
     Real3 posRadA = mR3(sortedPosRad[index]);
     Real4 rhoPreMuA = sortedRhoPreMu[index];
@@ -510,22 +577,35 @@ __global__ void ReCalcDensityD_F1(Real4* dummySortedRhoPreMu,
     dummySortedRhoPreMu[index] = rhoPreMuA;
 }
 
-// -----------------------------------------------------------------------------
-// Kernel for updating the activity of all particles.
-__global__ void UpdateActivityD(Real4* posRadD,
-                                Real3* velMasD,
-                                Real3* posRigidBodiesD,
-                                Real3* pos_fsi_fea_D,
-                                uint* activityIdentifierD,
-                                uint* extendedActivityIdD,
-                                int2 updatePortion,
-                                Real Time,
-                                volatile bool* isErrorD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void ReCalcDensityD_F1(Real4* dummySortedRhoPreMu,
+                                  Real4* sortedPosRad,
+                                  Real3* sortedVelMas,
+                                  Real4* sortedRhoPreMu,
+                                  uint* gridMarkerIndex,
+                                  uint* cellStart,
+                                  uint* cellEnd) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    index += updatePortion.x;
-    if (index >= updatePortion.y)
+    if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_ReCalcDensity_F1(index, dummySortedRhoPreMu, sortedPosRad, sortedVelMas, sortedRhoPreMu, gridMarkerIndex,
+                       cellStart, cellEnd);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+// Kernel for updating the activity of all particles.
+__device__ inline void f_UpdateActivity(uint index,
+                                        Real4* posRadD,
+                                        Real3* velMasD,
+                                        Real3* posRigidBodiesD,
+                                        Real3* pos_fsi_fea_D,
+                                        uint* activityIdentifierD,
+                                        uint* extendedActivityIdD,
+                                        int2 updatePortion,
+                                        Real Time,
+                                        volatile bool* isErrorD) {
     // Set the particle as an active particle
     activityIdentifierD[index] = 1;
     extendedActivityIdD[index] = 1;
@@ -578,6 +658,26 @@ __global__ void UpdateActivityD(Real4* posRadD,
     return;
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void UpdateActivityD(Real4* posRadD,
+                                Real3* velMasD,
+                                Real3* posRigidBodiesD,
+                                Real3* pos_fsi_fea_D,
+                                uint* activityIdentifierD,
+                                uint* extendedActivityIdD,
+                                int2 updatePortion,
+                                Real Time,
+                                volatile bool* isErrorD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    index += updatePortion.x;
+    if (index >= updatePortion.y)
+        return;
+
+    f_UpdateActivity(index, posRadD, velMasD, posRigidBodiesD, pos_fsi_fea_D, activityIdentifierD, extendedActivityIdD,
+                     updatePortion, Time, isErrorD);
+}
+#endif
+
 // -----------------------------------------------------------------------------
 // CLASS FOR FLUID DYNAMICS SYSTEM
 // -----------------------------------------------------------------------------
@@ -593,6 +693,7 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
       integrator_type(type),
       verbose(verb) {
     switch (integrator_type) {
+#ifndef CHRONO_FSI_USE_CPU
         case TimeIntegrator::I2SPH:
             forceSystem = chrono_types::make_shared<ChFsiForceI2SPH>(
                 otherBceWorker, fsiSystem.sortedSphMarkersD, fsiSystem.markersProximityD, 
@@ -610,6 +711,11 @@ ChFluidDynamics::ChFluidDynamics(std::shared_ptr<ChBce> otherBceWorker,
                 cout << "====== Created an IISPH framework" << endl;
             }
             break;
+#else
+        case TimeIntegrator::I2SPH:
+        case TimeIntegrator::IISPH:
+            throw std::runtime_error("Implicit SPH methods are not available in the CPU version of Chrono::FSI");
+#endif
 
         case TimeIntegrator::EXPLICITSPH:
             forceSystem = chrono_types::make_shared<ChFsiForceExplicitSPH>(
@@ -635,9 +741,14 @@ ChFluidDynamics::~ChFluidDynamics() {}
 // -----------------------------------------------------------------------------
 void ChFluidDynamics::Initialize() {
     forceSystem->Initialize();
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
     cudaMemcpyFromSymbol(paramsH.get(), paramsD, sizeof(SimParams));
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -670,6 +781,18 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
     // Update portion of the SPH particles (should be all particles here)
     int2 updatePortion = mI2(0, (int)numObjectsH->numAllMarkers);
 
+#ifdef CHRONO_FSI_USE_CPU
+    bool isError = false;
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = updatePortion.x; index < updatePortion.y; index++) {
+        f_UpdateActivity(index, mR4CAST(sphMarkersD2->posRadD), mR3CAST(sphMarkersD1->velMasD),
+                         mR3CAST(fsiBodiesD->posRigid_fsiBodies_D), mR3CAST(fsiMeshD->pos_fsi_fea_D),
+                         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD),
+                         U1CAST(fsiSystem.fsiGeneralData->extendedActivityIdD), updatePortion, Time, &isError);
+    }
+    if (isError)
+        throw std::runtime_error("Error! program crashed in UpdateActivityD!\n");
+#else
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -695,6 +818,7 @@ void ChFluidDynamics::UpdateActivity(std::shared_ptr<SphMarkerDataD> sphMarkersD
         throw std::runtime_error("Error! program crashed in UpdateActivityD!\n");
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -702,6 +826,23 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
     // Update portion of the SPH particles (should be fluid particles only here)
     int2 updatePortion = mI2(0, fsiSystem.fsiGeneralData->referenceArray[0].y);
 
+#ifdef CHRONO_FSI_USE_CPU
+    bool isError = false;
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = updatePortion.x; index < updatePortion.y; index++) {
+        f_UpdateFluid(index, mR4CAST(sphMarkersD->posRadD), mR3CAST(sphMarkersD->velMasD),
+                      mR4CAST(sphMarkersD->rhoPresMuD), mR3CAST(sphMarkersD->tauXxYyZzD),
+                      mR3CAST(sphMarkersD->tauXyXzYzD), mR3CAST(fsiSystem.fsiGeneralData->vel_XSPH_D),
+                      mR4CAST(fsiSystem.fsiGeneralData->derivVelRhoD),
+                      mR3CAST(fsiSystem.fsiGeneralData->derivTauXxYyZzD),
+                      mR3CAST(fsiSystem.fsiGeneralData->derivTauXyXzYzD),
+                      mR4CAST(fsiSystem.fsiGeneralData->sr_tau_I_mu_i),
+                      U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD),
+                      U1CAST(fsiSystem.fsiGeneralData->freeSurfaceIdD), updatePortion, dT, &isError);
+    }
+    if (isError)
+        throw std::runtime_error("Error! program crashed in UpdateFluidD!\n");
+#else
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -733,10 +874,14 @@ void ChFluidDynamics::UpdateFluid(std::shared_ptr<SphMarkerDataD> sphMarkersD, R
         throw std::runtime_error("Error! program crashed in UpdateFluidD!\n");
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 // -----------------------------------------------------------------------------
 void ChFluidDynamics::UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
+#ifdef CHRONO_FSI_USE_CPU
+    throw std::runtime_error("Implicit SPH methods are not available in the CPU version of Chrono::FSI");
+#else
     uint numThreads, numBlocks;
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
 
@@ -764,11 +909,24 @@ void ChFluidDynamics::UpdateFluid_Implicit(std::shared_ptr<SphMarkerDataD> sphMa
         throw std::runtime_error("Error! program crashed in Update_Fluid_State!\n");
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 // -----------------------------------------------------------------------------
 // Apply periodic boundary conditions in x, y, and z directions
 void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
+#ifdef CHRONO_FSI_USE_CPU
+    int numAllMarkers = (int)numObjectsH->numAllMarkers;
+    Real4* posRadD = mR4CAST(sphMarkersD->posRadD);
+    Real4* rhoPresMuD = mR4CAST(sphMarkersD->rhoPresMuD);
+    uint* activityIdentifierD = U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD);
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < numAllMarkers; index++) {
+        f_ApplyPeriodicBoundaryX(index, posRadD, rhoPresMuD, activityIdentifierD);
+        f_ApplyPeriodicBoundaryY(index, posRadD, rhoPresMuD, activityIdentifierD);
+        f_ApplyPeriodicBoundaryZ(index, posRadD, rhoPresMuD, activityIdentifierD);
+    }
+#else
     uint numBlocks, numThreads;
 
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
@@ -794,6 +952,7 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
     //     (mR4CAST(sphMarkersD->posRadD), mR4CAST(sphMarkersD->rhoPresMuD), mR3CAST(sphMarkersD->velMasD));
     // cudaDeviceSynchronize();
     // cudaCheckError();
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -801,6 +960,18 @@ void ChFluidDynamics::ApplyBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> s
 // The inlet/outlet BC is applied in the x direction.
 // This functions needs to be tested.
 void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(std::shared_ptr<SphMarkerDataD> sphMarkersD) {
+#ifdef CHRONO_FSI_USE_CPU
+    int numAllMarkers = (int)numObjectsH->numAllMarkers;
+    Real4* posRadD = mR4CAST(sphMarkersD->posRadD);
+    Real4* rhoPresMuD = mR4CAST(sphMarkersD->rhoPresMuD);
+    uint* activityIdentifierD = U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD);
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < numAllMarkers; index++) {
+        f_ApplyInletBoundaryX(index, posRadD, mR3CAST(sphMarkersD->velMasD), rhoPresMuD);
+        f_ApplyPeriodicBoundaryY(index, posRadD, rhoPresMuD, activityIdentifierD);
+        f_ApplyPeriodicBoundaryZ(index, posRadD, rhoPresMuD, activityIdentifierD);
+    }
+#else
     uint numBlocks, numThreads;
     computeGridSize((int)numObjectsH->numAllMarkers, 256, numBlocks, numThreads);
     ApplyInletBoundaryXKernel<<<numBlocks, numThreads>>>(
@@ -821,6 +992,7 @@ void ChFluidDynamics::ApplyModifiedBoundarySPH_Markers(std::shared_ptr<SphMarker
         U1CAST(fsiSystem.fsiGeneralData->activityIdentifierD));
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
 }
 
 // -----------------------------------------------------------------------------
@@ -831,6 +1003,18 @@ void ChFluidDynamics::DensityReinitialization() {
     thrust::device_vector<Real4> dummySortedRhoPreMu(numObjectsH->numAllMarkers);
     thrust::fill(dummySortedRhoPreMu.begin(), dummySortedRhoPreMu.end(), mR4(0.0));
 
+#ifdef CHRONO_FSI_USE_CPU
+    int numAllMarkers = (int)numObjectsH->numAllMarkers;
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int index = 0; index < numAllMarkers; index++) {
+        f_ReCalcDensity_F1(index, mR4CAST(dummySortedRhoPreMu), mR4CAST(fsiSystem.sortedSphMarkersD->posRadD),
+                           mR3CAST(fsiSystem.sortedSphMarkersD->velMasD),
+                           mR4CAST(fsiSystem.sortedSphMarkersD->rhoPresMuD),
+                           U1CAST(fsiSystem.markersProximityD->gridMarkerIndexD),
+                           U1CAST(fsiSystem.markersProximityD->cellStartD),
+                           U1CAST(fsiSystem.markersProximityD->cellEndD));
+    }
+#else
     ReCalcDensityD_F1<<<numBlocks, numThreads>>>(
         mR4CAST(dummySortedRhoPreMu), 
         mR4CAST(fsiSystem.sortedSphMarkersD->posRadD),
@@ -842,6 +1026,7 @@ void ChFluidDynamics::DensityReinitialization() {
 
     cudaDeviceSynchronize();
     cudaCheckError();
+#endif
     ChFsiForce::CopySortedToOriginal_NonInvasive_R4(
         fsiSystem.sphMarkersD1->rhoPresMuD, dummySortedRhoPreMu,
         fsiSystem.markersProximityD->gridMarkerIndexD);
@@ -46,8 +46,13 @@ ChFsiForce::ChFsiForce(std::shared_ptr<ChBce> otherBceWorker,
 //--------------------------------------------------------------------------------------------------------------------------------
 
 void ChFsiForce::Initialize() {
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
+#endif
 
     vel_XSPH_Sorted_D.resize(numObjectsH->numAllMarkers);
     vel_vis_Sorted_D.resize(numObjectsH->numAllMarkers);
@@ -30,13 +30,7 @@ __device__ __inline__ void calc_G_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
-        return;
-
-    uint index = indexOfIndex[id];
-
+                                         uint index) {
     Real3 posRadA = mR3(sortedPosRad[index]);
     Real h_i = sortedPosRad[index].w;
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
@@ -108,13 +102,7 @@ __device__ __inline__ void calc_A_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
-        return;
-
-    uint index = indexOfIndex[id];
-
+                                         uint index) {
     Real3 posRadA = mR3(sortedPosRad[index]);
     Real h_i = sortedPosRad[index].w;
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
@@ -190,13 +178,7 @@ __device__ __inline__ void calc_L_Matrix(Real4* sortedPosRad,
                                          Real* G_i,
                                          uint* cellStart,
                                          uint* cellEnd,
-                                         uint* indexOfIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
-        return;
-
-    uint index = indexOfIndex[id];
-
+                                         uint index) {
     Real3 posRadA = mR3(sortedPosRad[index]);
     Real h_i = sortedPosRad[index].w;
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
@@ -327,13 +309,10 @@ __device__ __inline__ void calc_L_Matrix(Real4* sortedPosRad,
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void calIndexOfIndex(uint* indexOfIndex,
-                                uint* identityOfIndex,
-                                uint* gridMarkerIndex) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers)
-        return;
-
+__device__ inline void f_calIndexOfIndex(uint id,
+                                         uint* indexOfIndex,
+                                         uint* identityOfIndex,
+                                         uint* gridMarkerIndex) {
     indexOfIndex[id] = id;
     if (gridMarkerIndex[id] >= numObjectsD.numFluidMarkers && 
         gridMarkerIndex[id] < numObjectsD.numFluidMarkers + numObjectsD.numBoundaryMarkers) {
@@ -343,7 +322,20 @@ __global__ void calIndexOfIndex(uint* indexOfIndex,
     }
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void calIndexOfIndex(uint* indexOfIndex,
+                                uint* identityOfIndex,
+                                uint* gridMarkerIndex) {
+    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+    if (id >= numObjectsD.numAllMarkers)
+        return;
+
+    f_calIndexOfIndex(id, indexOfIndex, identityOfIndex, gridMarkerIndex);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
+#ifndef CHRONO_FSI_USE_CPU
 __global__ void Shear_Stress_Rate(uint* indexOfIndex,
                                   Real4* sortedPosRad,
                                   Real4* sortedRhoPreMu,
@@ -390,7 +382,7 @@ __global__ void Shear_Stress_Rate(uint* indexOfIndex,
 
     Real G_i[9] = {0.0};
     calc_G_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, G_i, cellStart, 
-        cellEnd, indexOfIndex);
+        cellEnd, index);
 
     // get address in grid
     int3 gridPos = calcGridPos(posRadA);
@@ -470,19 +462,17 @@ __global__ void Shear_Stress_Rate(uint* indexOfIndex,
     sortedDerivTauXxYyZz[index] = mR3(dTauxx, dTauyy, dTauzz);
     sortedDerivTauXyXzYz[index] = mR3(dTauxy, dTauxz, dTauyz);
 }
+#endif
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void calcRho_kernel(Real4* sortedPosRad,
-                               Real4* sortedRhoPreMu,
-                               Real4* sortedRhoPreMu_old,
-                               uint* cellStart,
-                               uint* cellEnd,
-                               int density_reinit,
-                               volatile bool* isErrorD) {
-    uint index = blockIdx.x * blockDim.x + threadIdx.x;
-    if (index >= numObjectsD.numAllMarkers)
-        return;
-
+__device__ inline void f_calcRho(uint index,
+                                 Real4* sortedPosRad,
+                                 Real4* sortedRhoPreMu,
+                                 Real4* sortedRhoPreMu_old,
+                                 uint* cellStart,
+                                 uint* cellEnd,
+                                 int density_reinit,
+                                 volatile bool* isErrorD) {
     if (sortedRhoPreMu[index].w > -0.5 && sortedRhoPreMu[index].w < 0.5)
         return;
 
@@ -541,17 +531,30 @@ __global__ void calcRho_kernel(Real4* sortedPosRad,
             index, sum_mW, sum_W, h_i);
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void calcKernelSupport(Real4* sortedPosRad,
-                                  Real4* sortedRhoPreMu,
-                                  Real3* sortedKernelSupport,
-                                  uint* cellStart,
-                                  uint* cellEnd,
-                                  volatile bool* isErrorD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void calcRho_kernel(Real4* sortedPosRad,
+                               Real4* sortedRhoPreMu,
+                               Real4* sortedRhoPreMu_old,
+                               uint* cellStart,
+                               uint* cellEnd,
+                               int density_reinit,
+                               volatile bool* isErrorD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
 
+    f_calcRho(index, sortedPosRad, sortedRhoPreMu, sortedRhoPreMu_old, cellStart, cellEnd, density_reinit, isErrorD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_calcKernelSupport(uint index,
+                                           Real4* sortedPosRad,
+                                           Real4* sortedRhoPreMu,
+                                           Real3* sortedKernelSupport,
+                                           uint* cellStart,
+                                           uint* cellEnd,
+                                           volatile bool* isErrorD) {
     Real h_i = sortedPosRad[index].w;
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
     Real SqRadii = SuppRadii * SuppRadii;
@@ -593,6 +596,21 @@ __global__ void calcKernelSupport(Real4* sortedPosRad,
     sortedKernelSupport[index].y = sum_W_identical;
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void calcKernelSupport(Real4* sortedPosRad,
+                                  Real4* sortedRhoPreMu,
+                                  Real3* sortedKernelSupport,
+                                  uint* cellStart,
+                                  uint* cellEnd,
+                                  volatile bool* isErrorD) {
+    uint index = blockIdx.x * blockDim.x + threadIdx.x;
+    if (index >= numObjectsD.numAllMarkers)
+        return;
+
+    f_calcKernelSupport(index, sortedPosRad, sortedRhoPreMu, sortedKernelSupport, cellStart, cellEnd, isErrorD);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
 __device__ __inline__ void modifyPressure(Real4& rhoPresMuB, const Real3& dist3Alpha) {
     // body force in x direction
@@ -975,32 +993,28 @@ __device__ inline Real4 LaplacianOperator(float G_i[9],
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
+#ifndef CHRONO_FSI_USE_CPU
 __global__ void EOS(Real4* sortedRhoPreMu, volatile bool* isErrorD) {
     uint index = blockIdx.x * blockDim.x + threadIdx.x;
     if (index >= numObjectsD.numAllMarkers)
         return;
     sortedRhoPreMu[index].y = Eos(sortedRhoPreMu[index].x, sortedRhoPreMu[index].w);
 }
+#endif
 
 //--------------------------------------------------------------------------------------------------------------------------------
-__global__ void Navier_Stokes(uint* indexOfIndex,
-                              Real4* sortedDerivVelRho,
-                              Real3* sortedXSPHandShift,
-                              Real4* sortedPosRad,
-                              Real3* sortedVelMas,
-                              Real4* sortedRhoPreMu,
-                              Real3* velMas_ModifiedBCE,
-                              Real4* rhoPreMu_ModifiedBCE,
-                              uint* gridMarkerIndex,
-                              uint* cellStart,
-                              uint* cellEnd,
-                              volatile bool* isErrorD) {
-    uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
-        return;
-
-    uint index = indexOfIndex[id];
-    
+__device__ inline void f_Navier_Stokes(uint index,
+                                       Real4* sortedDerivVelRho,
+                                       Real3* sortedXSPHandShift,
+                                       Real4* sortedPosRad,
+                                       Real3* sortedVelMas,
+                                       Real4* sortedRhoPreMu,
+                                       Real3* velMas_ModifiedBCE,
+                                       Real4* rhoPreMu_ModifiedBCE,
+                                       uint* gridMarkerIndex,
+                                       uint* cellStart,
+                                       uint* cellEnd,
+                                       volatile bool* isErrorD) {
     // Do nothing for fixed wall BCE particles 
     if (sortedRhoPreMu[index].w > -0.5 && sortedRhoPreMu[index].w < 0.5) {
         sortedDerivVelRho[index] = mR4(0.0);
@@ -1018,14 +1032,14 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
     Real L_i[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
     if (paramsD.USE_Consistent_G)
         calc_G_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, index);
 
     if (paramsD.USE_Consistent_L) {
         Real A_i[27] = {0.0};
         calc_A_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, A_i, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, index);
         calc_L_Matrix(sortedPosRad, sortedVelMas, sortedRhoPreMu, A_i, L_i, G_i, cellStart, 
-            cellEnd, indexOfIndex);
+            cellEnd, index);
     }
     float Gi[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
     float Li[9] = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
@@ -1170,32 +1184,53 @@ __global__ void Navier_Stokes(uint* indexOfIndex,
     }
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void NS_SSR(uint* activityIdentifierD,
-                       Real4* sortedDerivVelRho,
-                       Real3* sortedDerivTauXxYyZz,
-                       Real3* sortedDerivTauXyXzYz,
-                       Real3* sortedXSPHandShift,
-                       Real3* sortedKernelSupport,
-                       Real4* sortedPosRad,
-                       Real3* sortedVelMas,
-                       Real4* sortedRhoPreMu,
-                       Real3* velMas_ModifiedBCE,
-                       Real4* rhoPreMu_ModifiedBCE,
-                       Real3* tauXxYyZz_ModifiedBCE,
-                       Real3* tauXyXzYz_ModifiedBCE,
-                       Real3* sortedTauXxYyZz,
-                       Real3* sortedTauXyXzYz,
-                       uint* gridMarkerIndex,
-                       uint* cellStart,
-                       uint* cellEnd,
-                       uint* mapOriginalToSorted,
-                       uint* sortedFreeSurfaceIdD,
-                       volatile bool* isErrorD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void Navier_Stokes(uint* indexOfIndex,
+                              Real4* sortedDerivVelRho,
+                              Real3* sortedXSPHandShift,
+                              Real4* sortedPosRad,
+                              Real3* sortedVelMas,
+                              Real4* sortedRhoPreMu,
+                              Real3* velMas_ModifiedBCE,
+                              Real4* rhoPreMu_ModifiedBCE,
+                              uint* gridMarkerIndex,
+                              uint* cellStart,
+                              uint* cellEnd,
+                              volatile bool* isErrorD) {
     uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers)
+    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
         return;
 
+    uint index = indexOfIndex[id];
+
+    f_Navier_Stokes(index, sortedDerivVelRho, sortedXSPHandShift, sortedPosRad, sortedVelMas, sortedRhoPreMu,
+                    velMas_ModifiedBCE, rhoPreMu_ModifiedBCE, gridMarkerIndex, cellStart, cellEnd, isErrorD);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_NS_SSR(uint id,
+                                uint* activityIdentifierD,
+                                Real4* sortedDerivVelRho,
+                                Real3* sortedDerivTauXxYyZz,
+                                Real3* sortedDerivTauXyXzYz,
+                                Real3* sortedXSPHandShift,
+                                Real3* sortedKernelSupport,
+                                Real4* sortedPosRad,
+                                Real3* sortedVelMas,
+                                Real4* sortedRhoPreMu,
+                                Real3* velMas_ModifiedBCE,
+                                Real4* rhoPreMu_ModifiedBCE,
+                                Real3* tauXxYyZz_ModifiedBCE,
+                                Real3* tauXyXzYz_ModifiedBCE,
+                                Real3* sortedTauXxYyZz,
+                                Real3* sortedTauXyXzYz,
+                                uint* gridMarkerIndex,
+                                uint* cellStart,
+                                uint* cellEnd,
+                                uint* mapOriginalToSorted,
+                                uint* sortedFreeSurfaceIdD,
+                                volatile bool* isErrorD) {
     // no need to do anything if it is not an active particle
     uint activity = activityIdentifierD[id];
     if (activity == 0)
@@ -1462,23 +1497,50 @@ __global__ void NS_SSR(uint* activityIdentifierD,
     sortedDerivTauXyXzYz[index] = mR3(dTauxy, dTauxz, dTauyz);
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
-__global__ void CalcVel_XSPH_D(uint* indexOfIndex,
-                               Real3* vel_XSPH_Sorted_D,
-                               Real4* sortedPosRad,
-                               Real3* sortedVelMas,
-                               Real4* sortedRhoPreMu,
-                               Real3* sortedXSPHandShift,
-                               uint* gridMarkerIndex,
-                               uint* cellStart,
-                               uint* cellEnd,
-                               volatile bool* isErrorD) {
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void NS_SSR(uint* activityIdentifierD,
+                       Real4* sortedDerivVelRho,
+                       Real3* sortedDerivTauXxYyZz,
+                       Real3* sortedDerivTauXyXzYz,
+                       Real3* sortedXSPHandShift,
+                       Real3* sortedKernelSupport,
+                       Real4* sortedPosRad,
+                       Real3* sortedVelMas,
+                       Real4* sortedRhoPreMu,
+                       Real3* velMas_ModifiedBCE,
+                       Real4* rhoPreMu_ModifiedBCE,
+                       Real3* tauXxYyZz_ModifiedBCE,
+                       Real3* tauXyXzYz_ModifiedBCE,
+                       Real3* sortedTauXxYyZz,
+                       Real3* sortedTauXyXzYz,
+                       uint* gridMarkerIndex,
+                       uint* cellStart,
+                       uint* cellEnd,
+                       uint* mapOriginalToSorted,
+                       uint* sortedFreeSurfaceIdD,
+                       volatile bool* isErrorD) {
     uint id = blockIdx.x * blockDim.x + threadIdx.x;
-    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
+    if (id >= numObjectsD.numAllMarkers)
         return;
 
-    uint index = indexOfIndex[id];
+    f_NS_SSR(id, activityIdentifierD, sortedDerivVelRho, sortedDerivTauXxYyZz, sortedDerivTauXyXzYz, sortedXSPHandShift,
+             sortedKernelSupport, sortedPosRad, sortedVelMas, sortedRhoPreMu, velMas_ModifiedBCE, rhoPreMu_ModifiedBCE,
+             tauXxYyZz_ModifiedBCE, tauXyXzYz_ModifiedBCE, sortedTauXxYyZz, sortedTauXyXzYz, gridMarkerIndex, cellStart,
+             cellEnd, mapOriginalToSorted, sortedFreeSurfaceIdD, isErrorD);
+}
+#endif
 
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_CalcVel_XSPH(uint index,
+                                      Real3* vel_XSPH_Sorted_D,
+                                      Real4* sortedPosRad,
+                                      Real3* sortedVelMas,
+                                      Real4* sortedRhoPreMu,
+                                      Real3* sortedXSPHandShift,
+                                      uint* gridMarkerIndex,
+                                      uint* cellStart,
+                                      uint* cellEnd,
+                                      volatile bool* isErrorD) {
     Real4 rhoPreMuA = sortedRhoPreMu[index];
     Real3 velMasA = sortedVelMas[index];
     Real SuppRadii = RESOLUTION_LENGTH_MULT * paramsD.HSML;
@@ -1531,7 +1593,58 @@ __global__ void CalcVel_XSPH_D(uint* indexOfIndex,
     }
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+__global__ void CalcVel_XSPH_D(uint* indexOfIndex,
+                               Real3* vel_XSPH_Sorted_D,
+                               Real4* sortedPosRad,
+                               Real3* sortedVelMas,
+                               Real4* sortedRhoPreMu,
+                               Real3* sortedXSPHandShift,
+                               uint* gridMarkerIndex,
+                               uint* cellStart,
+                               uint* cellEnd,
+                               volatile bool* isErrorD) {
+    uint id = blockIdx.x * blockDim.x + threadIdx.x;
+    if (id >= numObjectsD.numAllMarkers - numObjectsD.numBoundaryMarkers)
+        return;
+
+    uint index = indexOfIndex[id];
+
+    f_CalcVel_XSPH(index, vel_XSPH_Sorted_D, sortedPosRad, sortedVelMas, sortedRhoPreMu, sortedXSPHandShift,
+                   gridMarkerIndex, cellStart, cellEnd, isErrorD);
+}
+#endif
+
 //--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_CopySortedToOriginal(uint id,
+                                              Real4* sortedDerivVelRho,
+                                              Real3* sortedDerivTauXxYyZz,
+                                              Real3* sortedDerivTauXyXzYz,
+                                              Real4* originalDerivVelRho,
+                                              Real3* originalDerivTauXxYyZz,
+                                              Real3* originalDerivTauXyXzYz,
+                                              uint* gridMarkerIndex,
+                                              uint* activityIdentifierD,
+                                              uint* mapOriginalToSorted,
+                                              uint* originalFreeSurfaceId,
+                                              uint* sortedFreeSurfaceId) {
+    // Check the activity of this particle
+    uint activity = activityIdentifierD[id];
+    if (activity == 0)
+        return;
+
+    uint index = mapOriginalToSorted[id];
+
+    originalDerivVelRho[id] = sortedDerivVelRho[index];
+    if (paramsD.elastic_SPH) {
+        originalDerivTauXxYyZz[id] = sortedDerivTauXxYyZz[index];
+        originalDerivTauXyXzYz[id] = sortedDerivTauXyXzYz[index];
+        originalFreeSurfaceId[id] = sortedFreeSurfaceId[index];
+    }
+    return;
+}
+
+#ifndef CHRONO_FSI_USE_CPU
 __global__ void CopySortedToOriginal_D(Real4* sortedDerivVelRho,
                                        Real3* sortedDerivTauXxYyZz,
                                        Real3* sortedDerivTauXyXzYz,
@@ -1547,6 +1660,19 @@ __global__ void CopySortedToOriginal_D(Real4* sortedDerivVelRho,
     if (id >= numObjectsD.numAllMarkers)
         return;
 
+    f_CopySortedToOriginal(id, sortedDerivVelRho, sortedDerivTauXxYyZz, sortedDerivTauXyXzYz, originalDerivVelRho,
+                           originalDerivTauXxYyZz, originalDerivTauXyXzYz, gridMarkerIndex, activityIdentifierD,
+                           mapOriginalToSorted, originalFreeSurfaceId, sortedFreeSurfaceId);
+}
+#endif
+
+//--------------------------------------------------------------------------------------------------------------------------------
+__device__ inline void f_CopySortedToOriginal_XSPH(uint id,
+                                                   Real3* sortedXSPH,
+                                                   Real3* originalXSPH,
+                                                   uint* gridMarkerIndex,
+                                                   uint* activityIdentifierD,
+                                                   uint* mapOriginalToSorted) {
     // Check the activity of this particle
     uint activity = activityIdentifierD[id];
     if (activity == 0)
@@ -1554,16 +1680,10 @@ __global__ void CopySortedToOriginal_D(Real4* sortedDerivVelRho,
 
     uint index = mapOriginalToSorted[id];
 
-    originalDerivVelRho[id] = sortedDerivVelRho[index];
-    if (paramsD.elastic_SPH) {
-        originalDerivTauXxYyZz[id] = sortedDerivTauXxYyZz[index];
-        originalDerivTauXyXzYz[id] = sortedDerivTauXyXzYz[index];
-        originalFreeSurfaceId[id] = sortedFreeSurfaceId[index];
-    }
-    return;
+    originalXSPH[id] = sortedXSPH[index];
 }
 
-//--------------------------------------------------------------------------------------------------------------------------------
+#ifndef CHRONO_FSI_USE_CPU
 __global__ void CopySortedToOriginal_XSPH_D(Real3* sortedXSPH,
                                             Real3* originalXSPH,
                                             uint* gridMarkerIndex,
@@ -1573,15 +1693,10 @@ __global__ void CopySortedToOriginal_XSPH_D(Real3* sortedXSPH,
     if (id >= numObjectsD.numAllMarkers)
         return;
 
-    // Check the activity of this particle
-    uint activity = activityIdentifierD[id];
-    if (activity == 0)
-        return;
-
-    uint index = mapOriginalToSorted[id];
-
-    originalXSPH[id] = sortedXSPH[index];
+    f_CopySortedToOriginal_XSPH(id, sortedXSPH, originalXSPH, gridMarkerIndex, activityIdentifierD,
+                                mapOriginalToSorted);
 }
+#endif
 
 //--------------------------------------------------------------------------------------------------------------------------------
 ChFsiForceExplicitSPH::ChFsiForceExplicitSPH(std::shared_ptr<ChBce> otherBceWorker,
@@ -1607,10 +1722,15 @@ ChFsiForceExplicitSPH::~ChFsiForceExplicitSPH() {}
 //--------------------------------------------------------------------------------------------------------------------------------
 void ChFsiForceExplicitSPH::Initialize() {
     ChFsiForce::Initialize();
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
     cudaMemcpyFromSymbol(paramsH.get(), paramsD, sizeof(SimParams));
     cudaDeviceSynchronize();
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -1628,6 +1748,14 @@ void ChFsiForceExplicitSPH::ForceSPH(std::shared_ptr<SphMarkerDataD> otherSphMar
 
 //--------------------------------------------------------------------------------------------------------------------------------
 void ChFsiForceExplicitSPH::CollideWrapper() {
+#ifdef CHRONO_FSI_USE_CPU
+    // Host and device error flags are the same host variable
+    bool isError = false;
+    bool* isErrorH = &isError;
+    bool* isErrorD = &isError;
+    int numAll = (int)numObjectsH->numAllMarkers;
+    int numNonBoundary = (int)numObjectsH->numAllMarkers - (int)numObjectsH->numBoundaryMarkers;
+#else
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -1640,6 +1768,7 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     uint numBlocks1, numThreads1;
     computeGridSize((int)numObjectsH->numAllMarkers -
         (int)numObjectsH->numBoundaryMarkers, 256, numBlocks1, numThreads1);
+#endif
 
     // Execute the kernel
     thrust::device_vector<Real4> sortedDerivVelRho(numObjectsH->numAllMarkers);
@@ -1651,10 +1780,19 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
 
     // Calculate the kernel support of each particle
     if (paramsH->bceTypeWall == BceVersion::ADAMI || paramsH->bceType == BceVersion::ADAMI){
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int index = 0; index < numAll; index++) {
+            f_calcKernelSupport(index, mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
+                                mR3CAST(sortedKernelSupport), U1CAST(markersProximityD->cellStartD),
+                                U1CAST(markersProximityD->cellEndD), isErrorD);
+        }
+#else
         calcKernelSupport<<<numBlocks, numThreads>>>(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
             mR3CAST(sortedKernelSupport), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), isErrorD);
+#endif
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "calcKernelSupport");
     }
 
@@ -1662,10 +1800,19 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     if (density_initialization >= paramsH->densityReinit) {
         thrust::device_vector<Real4> rhoPresMuD_old = sortedSphMarkersD->rhoPresMuD;
         printf("Re-initializing density after %d steps.\n", paramsH->densityReinit);
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int index = 0; index < numAll; index++) {
+            f_calcRho(index, mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
+                      mR4CAST(rhoPresMuD_old), U1CAST(markersProximityD->cellStartD),
+                      U1CAST(markersProximityD->cellEndD), density_initialization, isErrorD);
+        }
+#else
         calcRho_kernel<<<numBlocks, numThreads>>>(
             mR4CAST(sortedSphMarkersD->posRadD), mR4CAST(sortedSphMarkersD->rhoPresMuD), 
             mR4CAST(rhoPresMuD_old), U1CAST(markersProximityD->cellStartD), 
             U1CAST(markersProximityD->cellEndD), density_initialization, isErrorD);
+#endif
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "calcRho_kernel");
         density_initialization = 0;
     }
@@ -1674,6 +1821,22 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
     // Execute the kernel
     if (paramsH->elastic_SPH) {  // For granular material
         *isErrorH = false;
+#ifdef CHRONO_FSI_USE_CPU
+        // execute Navier_Stokes and Shear_Stress_Rate in one loop
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numAll; id++) {
+            f_NS_SSR(id, U1CAST(fsiGeneralData->activityIdentifierD), mR4CAST(sortedDerivVelRho),
+                     mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz), mR3CAST(sortedXSPHandShift),
+                     mR3CAST(sortedKernelSupport), mR4CAST(sortedSphMarkersD->posRadD),
+                     mR3CAST(sortedSphMarkersD->velMasD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
+                     mR3CAST(bceWorker->velMas_ModifiedBCE), mR4CAST(bceWorker->rhoPreMu_ModifiedBCE),
+                     mR3CAST(bceWorker->tauXxYyZz_ModifiedBCE), mR3CAST(bceWorker->tauXyXzYz_ModifiedBCE),
+                     mR3CAST(sortedSphMarkersD->tauXxYyZzD), mR3CAST(sortedSphMarkersD->tauXyXzYzD),
+                     U1CAST(markersProximityD->gridMarkerIndexD), U1CAST(markersProximityD->cellStartD),
+                     U1CAST(markersProximityD->cellEndD), U1CAST(markersProximityD->mapOriginalToSorted),
+                     U1CAST(sortedFreeSurfaceId), isErrorD);
+        }
+#else
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
 
         // execute the kernel Navier_Stokes and Shear_Stress_Rate in one kernel
@@ -1688,45 +1851,83 @@ void ChFsiForceExplicitSPH::CollideWrapper() {
             U1CAST(markersProximityD->gridMarkerIndexD), U1CAST(markersProximityD->cellStartD),
             U1CAST(markersProximityD->cellEndD), U1CAST(markersProximityD->mapOriginalToSorted),
             U1CAST(sortedFreeSurfaceId), isErrorD);
+#endif
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "Navier_Stokes and Shear_Stress_Rate");
     } else {  // For fluid
         *isErrorH = false;
+#ifndef CHRONO_FSI_USE_CPU
         cudaMemcpy(isErrorD, isErrorH, sizeof(bool), cudaMemcpyHostToDevice);
+#endif
 
         // Find the index which is related to the wall boundary particle
         thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
         thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numAll; id++) {
+            f_calIndexOfIndex(id, U1CAST(indexOfIndex), U1CAST(identityOfIndex),
+                              U1CAST(markersProximityD->gridMarkerIndexD));
+        }
+#else
         calIndexOfIndex<<<numBlocks, numThreads>>>(
             U1CAST(indexOfIndex), U1CAST(identityOfIndex), U1CAST(markersProximityD->gridMarkerIndexD));
+#endif
         thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
             identityOfIndex.begin(), thrust::identity<int>());
 
         // execute the kernel
+#ifdef CHRONO_FSI_USE_CPU
+        uint* indexOfIndexPtr = U1CAST(indexOfIndex);
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numNonBoundary; id++) {
+            f_Navier_Stokes(indexOfIndexPtr[id], mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
+                            mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
+                            mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
+                            mR4CAST(bceWorker->rhoPreMu_ModifiedBCE), U1CAST(markersProximityD->gridMarkerIndexD),
+                            U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), isErrorD);
+        }
+#else
         Navier_Stokes<<<numBlocks1, numThreads1>>>(
             U1CAST(indexOfIndex), mR4CAST(sortedDerivVelRho), mR3CAST(sortedXSPHandShift),
             mR4CAST(sortedSphMarkersD->posRadD), mR3CAST(sortedSphMarkersD->velMasD),
             mR4CAST(sortedSphMarkersD->rhoPresMuD), mR3CAST(bceWorker->velMas_ModifiedBCE),
             mR4CAST(bceWorker->rhoPreMu_ModifiedBCE), U1CAST(markersProximityD->gridMarkerIndexD),
             U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), isErrorD);
+#endif
         ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "Navier_Stokes");
     }
 
     // Launch a kernel to copy data from sorted arrays to original arrays.
     // This is faster than using thrust::sort_by_key()
+#ifdef CHRONO_FSI_USE_CPU
+#pragma omp parallel for num_threads(paramsH->num_threads)
+    for (int id = 0; id < numAll; id++) {
+        f_CopySortedToOriginal(id, mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz),
+                               mR3CAST(sortedDerivTauXyXzYz), mR4CAST(fsiGeneralData->derivVelRhoD),
+                               mR3CAST(fsiGeneralData->derivTauXxYyZzD), mR3CAST(fsiGeneralData->derivTauXyXzYzD),
+                               U1CAST(markersProximityD->gridMarkerIndexD),
+                               U1CAST(fsiGeneralData->activityIdentifierD),
+                               U1CAST(markersProximityD->mapOriginalToSorted), U1CAST(fsiGeneralData->freeSurfaceIdD),
+                               U1CAST(sortedFreeSurfaceId));
+    }
+#else
     CopySortedToOriginal_D<<<numBlocks, numThreads>>>(
         mR4CAST(sortedDerivVelRho), mR3CAST(sortedDerivTauXxYyZz), mR3CAST(sortedDerivTauXyXzYz),
         mR4CAST(fsiGeneralData->derivVelRhoD), mR3CAST(fsiGeneralData->derivTauXxYyZzD),
         mR3CAST(fsiGeneralData->derivTauXyXzYzD), U1CAST(markersProximityD->gridMarkerIndexD),
         U1CAST(fsiGeneralData->activityIdentifierD), U1CAST(markersProximityD->mapOriginalToSorted),
         U1CAST(fsiGeneralData->freeSurfaceIdD), U1CAST(sortedFreeSurfaceId));
+#endif
 
     sortedDerivVelRho.clear();
     sortedDerivTauXxYyZz.clear();
     sortedDerivTauXyXzYz.clear();
     sortedKernelSupport.clear();
     sortedFreeSurfaceId.clear();
+#ifndef CHRONO_FSI_USE_CPU
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
@@ -1740,6 +1941,61 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
             "CalculateXSPH_velocity!\n");
     }
 
+#ifdef CHRONO_FSI_USE_CPU
+    // Host and device error flags are the same host variable
+    bool isError = false;
+    bool* isErrorH = &isError;
+    bool* isErrorD = &isError;
+    int numAll = (int)numObjectsH->numAllMarkers;
+    int numNonBoundary = (int)numObjectsH->numAllMarkers - (int)numObjectsH->numBoundaryMarkers;
+
+    //------------------------------------------------------------------------
+    if (paramsH->elastic_SPH) {
+        // The XSPH vector already included in the shifting vector
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numAll; id++) {
+            f_CopySortedToOriginal_XSPH(id, mR3CAST(sortedXSPHandShift), mR3CAST(fsiGeneralData->vel_XSPH_D),
+                                        U1CAST(markersProximityD->gridMarkerIndexD),
+                                        U1CAST(fsiGeneralData->activityIdentifierD),
+                                        U1CAST(markersProximityD->mapOriginalToSorted));
+        }
+    } else {
+        thrust::fill(vel_XSPH_Sorted_D.begin(), vel_XSPH_Sorted_D.end(), mR3(0.0));
+
+        // Find the index which is related to the wall boundary particle
+        thrust::device_vector<uint> indexOfIndex(numObjectsH->numAllMarkers);
+        thrust::device_vector<uint> identityOfIndex(numObjectsH->numAllMarkers);
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numAll; id++) {
+            f_calIndexOfIndex(id, U1CAST(indexOfIndex), U1CAST(identityOfIndex),
+                              U1CAST(markersProximityD->gridMarkerIndexD));
+        }
+        thrust::remove_if(indexOfIndex.begin(), indexOfIndex.end(), 
+            identityOfIndex.begin(), thrust::identity<int>());
+
+        uint* indexOfIndexPtr = U1CAST(indexOfIndex);
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numNonBoundary; id++) {
+            f_CalcVel_XSPH(indexOfIndexPtr[id], mR3CAST(vel_XSPH_Sorted_D), mR4CAST(sortedSphMarkersD->posRadD),
+                           mR3CAST(sortedSphMarkersD->velMasD), mR4CAST(sortedSphMarkersD->rhoPresMuD),
+                           mR3CAST(sortedXSPHandShift), U1CAST(markersProximityD->gridMarkerIndexD),
+                           U1CAST(markersProximityD->cellStartD), U1CAST(markersProximityD->cellEndD), isErrorD);
+        }
+        ChUtilsDevice::Sync_CheckError(isErrorH, isErrorD, "CalcVel_XSPH_D");
+
+#pragma omp parallel for num_threads(paramsH->num_threads)
+        for (int id = 0; id < numAll; id++) {
+            f_CopySortedToOriginal_XSPH(id, mR3CAST(vel_XSPH_Sorted_D), mR3CAST(fsiGeneralData->vel_XSPH_D),
+                                        U1CAST(markersProximityD->gridMarkerIndexD),
+                                        U1CAST(fsiGeneralData->activityIdentifierD),
+                                        U1CAST(markersProximityD->mapOriginalToSorted));
+        }
+    }
+
+    if (density_initialization % paramsH->densityReinit == 0)
+        CopySortedToOriginal_NonInvasive_R4(sphMarkersD->rhoPresMuD, 
+            sortedSphMarkersD->rhoPresMuD, markersProximityD->gridMarkerIndexD);
+#else
     bool *isErrorH, *isErrorD;
     isErrorH = (bool*)malloc(sizeof(bool));
     cudaMalloc((void**)&isErrorD, sizeof(bool));
@@ -1795,6 +2051,7 @@ void ChFsiForceExplicitSPH::CalculateXSPH_velocity() {
             sortedSphMarkersD->rhoPresMuD, markersProximityD->gridMarkerIndexD);
     cudaFree(isErrorD);
     free(isErrorH);
+#endif
 }
 
 //--------------------------------------------------------------------------------------------------------------------------------
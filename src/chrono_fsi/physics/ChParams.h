@@ -220,6 +220,8 @@ struct SimParams {
 
     Real3 bodyActiveDomain;  ///< Size of the active domain that influenced by an FSI body
     Real settlingTime;       ///< Time for the granular to settle down
+
+    int num_threads;  ///< Number of OpenMP threads (CPU version only)
 };
 
 /// @} fsi_physics
@@ -25,11 +25,19 @@ namespace fsi {
 
 void CopyParams_NumberOfObjects(std::shared_ptr<SimParams> paramsH, 
     std::shared_ptr<ChCounters> numObjectsH) {
+#ifdef CHRONO_FSI_USE_CPU
+    paramsD = *paramsH;
+    numObjectsD = *numObjectsH;
+#else
     cudaMemcpyToSymbolAsync(paramsD, paramsH.get(), sizeof(SimParams));
     cudaMemcpyToSymbolAsync(numObjectsD, numObjectsH.get(), sizeof(ChCounters));
     cudaDeviceSynchronize();
+#endif
 }
 
+// The following kernels are only used by the implicit SPH solvers (CUDA version only)
+#ifndef CHRONO_FSI_USE_CPU
+
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calc_A_tensor(Real* A_tensor,
                               Real* G_tensor,
@@ -882,6 +890,8 @@ __global__ void UpdateDensity(Real3* vis_vel,
             "type=%f\n", i_idx, sortedRhoPreMu[i_idx].w);
 }
 
+#endif
+
 }  // namespace fsi
 }  // namespace chrono
 #endif
@@ -427,6 +427,8 @@ inline __device__ void BCE_Vel_Acc(int i_idx,
     }
 }
 
+#ifndef CHRONO_FSI_USE_CPU
+
 //--------------------------------------------------------------------------------------------------------------------------------
 __global__ void calc_A_tensor(Real* A_tensor,
                               Real* G_tensor,
@@ -542,6 +544,8 @@ __global__ void UpdateDensity(Real3* vis_vel,
                               size_t numAllMarkers,
                               volatile bool* isErrorD);
 
+#endif
+
 }  // namespace fsi
 }  // namespace chrono
 #endif
@@ -20,7 +20,7 @@
 #ifndef CH_SYSTEMFSI_IMPL_H_
 #define CH_SYSTEMFSI_IMPL_H_
 
-#include "chrono/ChConfig.h"
+#include "chrono_fsi/ChConfigFSI.h"
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
@@ -20,6 +20,27 @@
 namespace chrono {
 namespace fsi {
 
+#ifdef CHRONO_FSI_USE_CPU
+
+GpuTimer::GpuTimer(cudaStream_t stream) : m_stream(stream) {}
+
+GpuTimer::~GpuTimer() {}
+
+void GpuTimer::Start() {
+    m_timer.reset();
+    m_timer.start();
+}
+
+void GpuTimer::Stop() {
+    m_timer.stop();
+}
+
+float GpuTimer::Elapsed() {
+    return (float)(1000 * m_timer.GetTimeSeconds());
+}
+
+#else
+
 GpuTimer::GpuTimer(cudaStream_t stream) : m_stream(stream) {
     cudaEventCreate(&m_start);
     cudaEventCreate(&m_stop);
@@ -45,6 +66,8 @@ float GpuTimer::Elapsed() {
     return elapsed;
 }
 
+#endif
+
 void ChUtilsDevice::FillVector(thrust::device_vector<Real3>& vector, const Real3& value) {
     thrust::fill(vector.begin(), vector.end(), value);
 }
@@ -54,6 +77,13 @@ void ChUtilsDevice::FillVector(thrust::device_vector<Real4>& vector, const Real4
 }
 
 void ChUtilsDevice::Sync_CheckError(bool* isErrorH, bool* isErrorD, std::string carshReport) {
+#ifdef CHRONO_FSI_USE_CPU
+    // Host and device flags are both in host memory
+    if (*isErrorD == true) {
+        throw std::runtime_error("Error! program crashed after " + carshReport + " !\n");
+    }
+    return;
+#endif
     cudaDeviceSynchronize();
     cudaMemcpy(isErrorH, isErrorD, sizeof(bool), cudaMemcpyDeviceToHost);
     if (*isErrorH == true) {
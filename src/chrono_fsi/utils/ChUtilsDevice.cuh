@@ -20,10 +20,13 @@
 
 #include <cuda_runtime.h>
 
+#include "chrono_fsi/ChConfigFSI.h"
+
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
 
 #include "chrono/core/ChTypes.h"
+#include "chrono/core/ChTimer.h"
 
 #include "chrono_fsi/ChApiFsi.h"
 #include "chrono_fsi/math/custom_math.h"
@@ -122,8 +125,12 @@ class GpuTimer {
 
   private:
     cudaStream_t m_stream;
+#ifdef CHRONO_FSI_USE_CPU
+    ChTimer m_timer;
+#else
     cudaEvent_t m_start;
     cudaEvent_t m_stop;
+#endif
 };
 
 /// Utilities for thrust device vectors.
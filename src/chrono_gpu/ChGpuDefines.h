@@ -47,6 +47,9 @@ enum class CHGPU_FRICTION_MODE { FRICTIONLESS, SINGLE_STEP, MULTI_STEP };
 /// Rolling resistance models -- ELASTIC_PLASTIC not implemented yet.
 enum class CHGPU_ROLLING_MODE { NO_RESISTANCE, SCHWARTZ, ELASTIC_PLASTIC };
 
+/// Execution backend of the granular dynamics solver.
+enum class CHGPU_BACKEND { CUDA, CPU };
+
 /// Simulation mode.
 enum CHGPU_RUN_MODE { FRICTIONLESS = 0, ONE_STEP = 1, MULTI_STEP = 2 };
 
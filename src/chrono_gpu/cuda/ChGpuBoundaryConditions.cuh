@@ -34,17 +34,17 @@ using chrono::gpu::Plane_BC_params_t;
 using chrono::gpu::ChSystemGpu_impl;
 
 // add bc forces material based only
-inline __device__ bool addBCForces_Sphere_matBased(unsigned int sphID,
-                                                   unsigned int BC_id,
-                                                   const int64_t3& sphPos,
-                                                   const float3& sphVel,
-                                                   const float3& sphOmega,
-                                                   float3& force_from_BCs,
-                                                   float3& ang_acc_from_BCs,
-                                                   ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                   ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                                   BC_params_t<int64_t, int64_t3>& bc_params,
-                                                   bool track_forces) {
+inline __host__ __device__ bool addBCForces_Sphere_matBased(unsigned int sphID,
+                                                            unsigned int BC_id,
+                                                            const int64_t3& sphPos,
+                                                            const float3& sphVel,
+                                                            const float3& sphOmega,
+                                                            float3& force_from_BCs,
+                                                            float3& ang_acc_from_BCs,
+                                                            ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                            ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                            BC_params_t<int64_t, int64_t3>& bc_params,
+                                                            bool track_forces) {
     Sphere_BC_params_t<int64_t, int64_t3> sphere_params = bc_params.sphere_params;
     bool contact = false;
 
@@ -134,14 +134,14 @@ inline __device__ bool addBCForces_Sphere_matBased(unsigned int sphID,
 
         if (track_forces) {
             // accumulate force
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
 
             // accumulate torque
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.x), torque_accum.x);
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.y), torque_accum.y);
-            atomicAdd(&(bc_params.sphere_params.reaction_torques.z), torque_accum.z);
+            chgpuAtomicAdd(&(bc_params.sphere_params.reaction_torques.x), torque_accum.x);
+            chgpuAtomicAdd(&(bc_params.sphere_params.reaction_torques.y), torque_accum.y);
+            chgpuAtomicAdd(&(bc_params.sphere_params.reaction_torques.z), torque_accum.z);
         }
 
         return true;
@@ -150,12 +150,12 @@ inline __device__ bool addBCForces_Sphere_matBased(unsigned int sphID,
     return false;
 }
 
-inline __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
-                                                       const float3& sphVel,
-                                                       float3& force_from_BCs,
-                                                       ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                       BC_params_t<int64_t, int64_t3>& bc_params,
-                                                       bool track_forces) {
+inline __host__ __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
+                                                                const float3& sphVel,
+                                                                float3& force_from_BCs,
+                                                                ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                BC_params_t<int64_t, int64_t3>& bc_params,
+                                                                bool track_forces) {
     Sphere_BC_params_t<int64_t, int64_t3> sphere_params = bc_params.sphere_params;
     bool contact = false;
     // classic radius grab, this must be signed to avoid false conversions
@@ -171,7 +171,7 @@ inline __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
         double3 delta = int64_t3_to_double3(delta_int) / (sphere_params.radius + sphereRadius_SU);
         double d2 = Dot(delta, delta);
         // this needs to be computed in double, then cast to float
-        reciplength = (float)rsqrt(d2);
+        reciplength = (float)chgpuRsqrt(d2);
     }
     // recompute in float to be cheaper
     float3 delta = int64_t3_to_float3(delta_int) / (sphere_params.radius + sphereRadius_SU);
@@ -203,9 +203,9 @@ inline __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
@@ -214,14 +214,14 @@ inline __device__ bool addBCForces_Sphere_frictionless(const int64_t3& sphPos,
 
 /// compute frictionless cone normal forces
 // NOTE: overloaded below
-inline __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
-                                                      const float3& sphVel,
-                                                      float3& force_from_BCs,
-                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                      BC_params_t<int64_t, int64_t3>& bc_params,
-                                                      bool track_forces,
-                                                      float3& contact_normal,
-                                                      float& dist) {
+inline __host__ __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
+                                                               const float3& sphVel,
+                                                               float3& force_from_BCs,
+                                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                               BC_params_t<int64_t, int64_t3>& bc_params,
+                                                               bool track_forces,
+                                                               float3& contact_normal,
+                                                               float& dist) {
     Z_Cone_BC_params_t<int64_t, int64_t3> cone_params = bc_params.cone_params;
     bool contact = false;
     // classic radius grab, this must be signed to avoid false conversions
@@ -283,21 +283,21 @@ inline __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
             force_accum + -gran_params->Gamma_n_s2w_SU * projection * contact_normal * m_eff * force_model_multiplier;
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
     return contact;
 }
 // overload of above if we don't care about dist and contact normal
-inline __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
-                                                      const float3& sphVel,
-                                                      float3& force_from_BCs,
-                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                      BC_params_t<int64_t, int64_t3>& bc_params,
-                                                      bool track_forces) {
+inline __host__ __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
+                                                               const float3& sphVel,
+                                                               float3& force_from_BCs,
+                                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                               BC_params_t<int64_t, int64_t3>& bc_params,
+                                                               bool track_forces) {
     float3 contact_normal = {0, 0, 0};
     float dist;
     return addBCForces_ZCone_frictionless(sphPos, sphVel, force_from_BCs, gran_params, bc_params, track_forces,
@@ -305,17 +305,17 @@ inline __device__ bool addBCForces_ZCone_frictionless(const int64_t3& sphPos,
 }
 
 /// TODO check damping, adhesion
-inline __device__ bool addBCForces_ZCone(unsigned int sphID,
-                                         unsigned int BC_id,
-                                         const int64_t3& sphPos,
-                                         const float3& sphVel,
-                                         const float3& sphOmega,
-                                         float3& force_from_BCs,
-                                         float3& ang_acc_from_BCs,
-                                         ChSystemGpu_impl::GranParamsPtr gran_params,
-                                         ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                         BC_params_t<int64_t, int64_t3>& bc_params,
-                                         bool track_forces) {
+inline __host__ __device__ bool addBCForces_ZCone(unsigned int sphID,
+                                                  unsigned int BC_id,
+                                                  const int64_t3& sphPos,
+                                                  const float3& sphVel,
+                                                  const float3& sphOmega,
+                                                  float3& force_from_BCs,
+                                                  float3& ang_acc_from_BCs,
+                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                  ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                  BC_params_t<int64_t, int64_t3>& bc_params,
+                                                  bool track_forces) {
     // determine these from frictionless helper
     float3 force_accum = {0, 0, 0};
     float3 contact_normal = {0, 0, 0};
@@ -358,9 +358,9 @@ inline __device__ bool addBCForces_ZCone(unsigned int sphID,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
@@ -368,13 +368,13 @@ inline __device__ bool addBCForces_ZCone(unsigned int sphID,
 }
 
 /// TODO check damping, adhesion
-inline __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
-                                                      const float3& sphVel,
-                                                      float3& force_from_BCs,
-                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                      BC_params_t<int64_t, int64_t3>& bc_params,
-                                                      bool track_forces,
-                                                      float& dist) {
+inline __host__ __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
+                                                               const float3& sphVel,
+                                                               float3& force_from_BCs,
+                                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                               BC_params_t<int64_t, int64_t3>& bc_params,
+                                                               bool track_forces,
+                                                               float& dist) {
     Plane_BC_params_t<int64_t3> plane_params = bc_params.plane_params;
 
     bool contact = false;
@@ -417,9 +417,9 @@ inline __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
@@ -427,15 +427,15 @@ inline __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
 }
 
 /// LULUTODO: material_based model
-inline __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sphPos,
-                                                             const float3& sphVel,
-                                                             float3& force_from_BCs,
-                                                             ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                             BC_params_t<int64_t, int64_t3>& bc_params,
-                                                             bool track_forces,
-                                                             float& dist,
-                                                             float& sqrt_Rd,
-                                                             float& beta) {
+inline __host__ __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sphPos,
+                                                                      const float3& sphVel,
+                                                                      float3& force_from_BCs,
+                                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                      BC_params_t<int64_t, int64_t3>& bc_params,
+                                                                      bool track_forces,
+                                                                      float& dist,
+                                                                      float& sqrt_Rd,
+                                                                      float& beta) {
     Plane_BC_params_t<int64_t3> plane_params = bc_params.plane_params;
     bool contact = false;
     // classic radius grab, this must be signed to avoid false conversions
@@ -483,9 +483,9 @@ inline __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sph
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
@@ -493,34 +493,34 @@ inline __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sph
 }
 
 /// overload of above in case we don't care about dist
-inline __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
-                                                      const float3& sphVel,
-                                                      float3& force_from_BCs,
-                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                      BC_params_t<int64_t, int64_t3>& bc_params,
-                                                      bool track_forces) {
+inline __host__ __device__ bool addBCForces_Plane_frictionless(const int64_t3& sphPos,
+                                                               const float3& sphVel,
+                                                               float3& force_from_BCs,
+                                                               ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                               BC_params_t<int64_t, int64_t3>& bc_params,
+                                                               bool track_forces) {
     float dist;
     return addBCForces_Plane_frictionless(sphPos, sphVel, force_from_BCs, gran_params, bc_params, track_forces, dist);
 }
 
 /// overload of above in case we don't care about dist, sqrt_Rd and beta
-inline __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sphPos,
-                                                             const float3& sphVel,
-                                                             float3& force_from_BCs,
-                                                             ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                             BC_params_t<int64_t, int64_t3>& bc_params,
-                                                             bool track_forces) {
+inline __host__ __device__ bool addBCForces_Plane_frictionless_mbased(const int64_t3& sphPos,
+                                                                      const float3& sphVel,
+                                                                      float3& force_from_BCs,
+                                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                      BC_params_t<int64_t, int64_t3>& bc_params,
+                                                                      bool track_forces) {
     float dist, sqrt_Rd, beta;
     return addBCForces_Plane_frictionless_mbased(sphPos, sphVel, force_from_BCs, gran_params, bc_params, track_forces,
                                                  dist, sqrt_Rd, beta);
 }
 
-inline __device__ bool EvaluateRollingFriction(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                               const float& E_eff,
-                                               const float& R_eff,
-                                               const float& beta,
-                                               const float& m_eff,
-                                               const float& time_contact) {
+inline __host__ __device__ bool EvaluateRollingFriction(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                        const float& E_eff,
+                                                        const float& R_eff,
+                                                        const float& beta,
+                                                        const float& m_eff,
+                                                        const float& time_contact) {
     float kn_simple = 4.f / 3.f * E_eff * sqrtf(R_eff);
     float gn_simple = -2.f * sqrtf(5.f / 3.f * m_eff * E_eff) * beta * powf(R_eff, 1.f / 4.f);
 
@@ -536,17 +536,17 @@ inline __device__ bool EvaluateRollingFriction(ChSystemGpu_impl::GranParamsPtr g
     return true;
 }
 
-inline __device__ bool addBCForces_Plane(unsigned int sphID,
-                                         unsigned int BC_id,
-                                         const int64_t3& sphPos,
-                                         const float3& sphVel,
-                                         const float3& sphOmega,
-                                         float3& force_from_BCs,
-                                         float3& ang_acc_from_BCs,
-                                         ChSystemGpu_impl::GranParamsPtr gran_params,
-                                         ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                         BC_params_t<int64_t, int64_t3>& bc_params,
-                                         bool track_forces) {
+inline __host__ __device__ bool addBCForces_Plane(unsigned int sphID,
+                                                  unsigned int BC_id,
+                                                  const int64_t3& sphPos,
+                                                  const float3& sphVel,
+                                                  const float3& sphOmega,
+                                                  float3& force_from_BCs,
+                                                  float3& ang_acc_from_BCs,
+                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                  ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                  BC_params_t<int64_t, int64_t3>& bc_params,
+                                                  bool track_forces) {
     float3 force_accum = {0, 0, 0};
     float3 contact_normal = bc_params.plane_params.normal;
 
@@ -636,23 +636,23 @@ inline __device__ bool addBCForces_Plane(unsigned int sphID,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
 
     return contact;
 }
 
-inline __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
-                                                     const float3& sphVel,
-                                                     float3& force_from_BCs,
-                                                     ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                     BC_params_t<int64_t, int64_t3>& bc_params,
-                                                     bool track_forces,
-                                                     float3& contact_normal,
-                                                     float& dist) {
+inline __host__ __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
+                                                              const float3& sphVel,
+                                                              float3& force_from_BCs,
+                                                              ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                              BC_params_t<int64_t, int64_t3>& bc_params,
+                                                              bool track_forces,
+                                                              float3& contact_normal,
+                                                              float& dist) {
     Z_Cylinder_BC_params_t<int64_t, int64_t3> cyl_params = bc_params.cyl_params;
     bool contact = false;
     // classic radius grab
@@ -693,23 +693,23 @@ inline __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
 
         force_from_BCs = force_from_BCs + force_accum;
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
     return contact;
 }
 
-inline __device__ bool addBCForces_Zcyl_frictionless_mbased(const int64_t3& sphPos,
-                                                            const float3& sphVel,
-                                                            float3& force_from_BCs,
-                                                            ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                            BC_params_t<int64_t, int64_t3>& bc_params,
-                                                            bool track_forces,
-                                                            float& dist,
-                                                            float& sqrt_Rd,
-                                                            float& beta) {
+inline __host__ __device__ bool addBCForces_Zcyl_frictionless_mbased(const int64_t3& sphPos,
+                                                                     const float3& sphVel,
+                                                                     float3& force_from_BCs,
+                                                                     ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                     BC_params_t<int64_t, int64_t3>& bc_params,
+                                                                     bool track_forces,
+                                                                     float& dist,
+                                                                     float& sqrt_Rd,
+                                                                     float& beta) {
     Z_Cylinder_BC_params_t<int64_t, int64_t3> cyl_params = bc_params.cyl_params;
     bool contact = false;
     // classic radius grab
@@ -752,21 +752,21 @@ inline __device__ bool addBCForces_Zcyl_frictionless_mbased(const int64_t3& sphP
         force_from_BCs = force_from_BCs + force_accum;
 
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
     return contact;
 }
 
 /// minimal overload for dist and contact_normal params
-inline __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
-                                                     const float3& sphVel,
-                                                     float3& force_from_BCs,
-                                                     ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                     BC_params_t<int64_t, int64_t3>& bc_params,
-                                                     bool track_forces) {
+inline __host__ __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
+                                                              const float3& sphVel,
+                                                              float3& force_from_BCs,
+                                                              ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                              BC_params_t<int64_t, int64_t3>& bc_params,
+                                                              bool track_forces) {
     float3 contact_normal = {0, 0, 0};
     float dist;
     return addBCForces_Zcyl_frictionless(sphPos, sphVel, force_from_BCs, gran_params, bc_params, track_forces,
@@ -774,17 +774,17 @@ inline __device__ bool addBCForces_Zcyl_frictionless(const int64_t3& sphPos,
 }
 
 /// TODO check damping, adhesion
-inline __device__ bool addBCForces_Zcyl(unsigned int sphID,
-                                        unsigned int BC_id,
-                                        const int64_t3& sphPos,
-                                        const float3& sphVel,
-                                        const float3& sphOmega,
-                                        float3& force_from_BCs,
-                                        float3& ang_acc_from_BCs,
-                                        ChSystemGpu_impl::GranParamsPtr gran_params,
-                                        ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                        BC_params_t<int64_t, int64_t3>& bc_params,
-                                        bool track_forces) {
+inline __host__ __device__ bool addBCForces_Zcyl(unsigned int sphID,
+                                                 unsigned int BC_id,
+                                                 const int64_t3& sphPos,
+                                                 const float3& sphVel,
+                                                 const float3& sphOmega,
+                                                 float3& force_from_BCs,
+                                                 float3& ang_acc_from_BCs,
+                                                 ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                 ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                 BC_params_t<int64_t, int64_t3>& bc_params,
+                                                 bool track_forces) {
     float3 force_accum = {0, 0, 0};
     float3 contact_normal = {0, 0, 0};
 
@@ -866,9 +866,9 @@ inline __device__ bool addBCForces_Zcyl(unsigned int sphID,
         force_from_BCs = force_from_BCs + force_accum;
 
         if (track_forces) {
-            atomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
-            atomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
-            atomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.x), -force_accum.x);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.y), -force_accum.y);
+            chgpuAtomicAdd(&(bc_params.reaction_forces.z), -force_accum.z);
         }
     }
     return contact;
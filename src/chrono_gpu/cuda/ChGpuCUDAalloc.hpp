@@ -20,12 +20,45 @@
 
 #include <cuda_runtime_api.h>
 #include <climits>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <new>
 #include <type_traits>
 #include <utility>
 
+/// Check (once) whether a CUDA device is available.
+/// Without a device, managed allocations fall back to plain host memory so that the CPU backend can run on machines
+/// without a GPU.
+inline bool chgpuDeviceAvailable() {
+    static const bool available = []() {
+        int count = 0;
+        return cudaGetDeviceCount(&count) == cudaSuccess && count > 0;
+    }();
+    return available;
+}
+
+/// Allocate memory accessible from both host and device (host memory if no CUDA device is available).
+inline cudaError_t chgpuMallocManaged(void** ptr, size_t size) {
+    if (chgpuDeviceAvailable())
+        return cudaMallocManaged(ptr, size, cudaMemAttachGlobal);
+    *ptr = std::malloc(size);
+    return (*ptr != nullptr || size == 0) ? cudaSuccess : cudaErrorMemoryAllocation;
+}
+
+template <class T>
+inline cudaError_t chgpuMallocManaged(T** ptr, size_t size) {
+    return chgpuMallocManaged((void**)ptr, size);
+}
+
+/// Free memory allocated with chgpuMallocManaged.
+inline cudaError_t chgpuFree(void* ptr) {
+    if (chgpuDeviceAvailable())
+        return cudaFree(ptr);
+    std::free(ptr);
+    return cudaSuccess;
+}
+
 ////#if (__cplusplus >= 201703L)  // C++17 or newer
 ////template <class T>
 ////struct cudallocator {
@@ -84,14 +117,14 @@ class cudallocator {
 
     pointer allocate(size_type n, std::allocator<void>::const_pointer hint = 0) {
         void* vptr;
-        cudaError_t err = cudaMallocManaged(&vptr, n * sizeof(T), cudaMemAttachGlobal);
+        cudaError_t err = chgpuMallocManaged(&vptr, n * sizeof(T));
         if (err == cudaErrorMemoryAllocation || err == cudaErrorNotSupported) {
             throw std::bad_alloc();
         }
         return (T*)vptr;
     }
 
-    void deallocate(pointer p, size_type n) { cudaFree(p); }
+    void deallocate(pointer p, size_type n) { chgpuFree(p); }
 
     bool operator==(const cudallocator& other) const { return true; }
     bool operator!=(const cudallocator& other) const { return false; }
@@ -29,7 +29,11 @@
 /// result is on an edge of this face and 'false' if the result is inside the
 /// triangle.
 /// Code from Ericson, "real-time collision detection", 2005, pp. 141
-__device__ bool snap_to_face(const double3& A, const double3& B, const double3& C, const double3& P, double3& res) {
+__host__ __device__ bool snap_to_face(const double3& A,
+                                      const double3& B,
+                                      const double3& C,
+                                      const double3& P,
+                                      double3& res) {
     double3 AB = B - A;
     double3 AC = C - A;
 
@@ -89,9 +93,15 @@ __device__ bool snap_to_face(const double3& A, const double3& B, const double3&
 
     // P inside face region. Return projection of P onto face
     // barycentric coordinates (u,v,w)
+#ifdef __CUDA_ARCH__
     double denom = __drcp_ru(va + vb + vc);
     double v = __dmul_ru(vb, denom);
     double w = __dmul_ru(vc, denom);
+#else
+    double denom = 1.0 / (va + vb + vc);
+    double v = vb * denom;
+    double w = vc * denom;
+#endif
     res = A + v * AB + w * AC;  // = u*A + v*B + w*C  where  (u = 1 - v - w)
     return false;
 }
@@ -111,14 +121,14 @@ Output:
   - normal:     contact normal, from pt2 to pt1
 A return value of "true" signals collision.
 */
-__device__ bool face_sphere_cd(const double3& A,           ///< First vertex of the triangle
-                               const double3& B,           ///< Second vertex of the triangle
-                               const double3& C,           ///< Third vertex of the triangle
-                               const double3& sphere_pos,  ///< Location of the center of the sphere
-                               const int radius,           ///< Sphere radius
-                               float3& normal,             ///< contact normal
-                               float& depth,               ///< penetration
-                               double3& pt1                ///< contact point on triangle
+__host__ __device__ bool face_sphere_cd(const double3& A,           ///< First vertex of the triangle
+                                        const double3& B,           ///< Second vertex of the triangle
+                                        const double3& C,           ///< Third vertex of the triangle
+                                        const double3& sphere_pos,  ///< Location of the center of the sphere
+                                        const int radius,           ///< Sphere radius
+                                        float3& normal,             ///< contact normal
+                                        float& depth,               ///< penetration
+                                        double3& pt1                ///< contact point on triangle
 ) {
     // Calculate face normal using RHR
     double3 face_n = face_normal(A, B, C);
@@ -22,27 +22,85 @@
 
 #include <cub/cub.cuh>
 
+#if defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
 using chrono::gpu::ChSystemGpu_impl;
 using chrono::gpu::CHGPU_TIME_INTEGRATOR;
 using chrono::gpu::CHGPU_FRICTION_MODE;
 using chrono::gpu::CHGPU_ROLLING_MODE;
 
 // Print a user-given error message and crash
-#define ABORTABORTABORT(...) \
-    {                        \
-        printf(__VA_ARGS__); \
-        __threadfence();     \
-        cub::ThreadTrap();   \
-    }
+#ifdef __CUDA_ARCH__
+    #define ABORTABORTABORT(...) \
+        {                        \
+            printf(__VA_ARGS__); \
+            __threadfence();     \
+            cub::ThreadTrap();   \
+        }
+#else
+    #define ABORTABORTABORT(...) \
+        {                        \
+            printf(__VA_ARGS__); \
+            std::abort();        \
+        }
+#endif
+
+// The functions below wrap the CUDA atomics and intrinsics used by the sphere and mesh kernels, so that the same
+// per-sphere and per-SD code can also be executed on the host by the CPU (OpenMP) backend.
+
+// Atomically add a value to a float in global memory
+inline __host__ __device__ void chgpuAtomicAdd(float* address, float val) {
+#ifdef __CUDA_ARCH__
+    atomicAdd(address, val);
+#else
+    #pragma omp atomic
+    *address += val;
+#endif
+}
+
+// Atomically add a value to an unsigned int in global memory and return the old value
+inline __host__ __device__ unsigned int chgpuAtomicAdd(unsigned int* address, unsigned int val) {
+#if defined(__CUDA_ARCH__)
+    return atomicAdd(address, val);
+#elif defined(_MSC_VER)
+    return (unsigned int)_InterlockedExchangeAdd((volatile long*)address, (long)val);
+#else
+    return __atomic_fetch_add(address, val, __ATOMIC_RELAXED);
+#endif
+}
+
+// Atomic compare-and-swap; return the old value
+inline __host__ __device__ unsigned int chgpuAtomicCAS(unsigned int* address, unsigned int compare, unsigned int val) {
+#if defined(__CUDA_ARCH__)
+    return atomicCAS(address, compare, val);
+#elif defined(_MSC_VER)
+    return (unsigned int)_InterlockedCompareExchange((volatile long*)address, (long)val, (long)compare);
+#else
+    // on failure, 'compare' is overwritten with the current value; either way it ends up holding the old value
+    __atomic_compare_exchange_n(address, &compare, val, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return compare;
+#endif
+}
+
+// Reciprocal square root
+inline __host__ __device__ double chgpuRsqrt(double x) {
+#ifdef __CUDA_ARCH__
+    return rsqrt(x);
+#else
+    return 1.0 / std::sqrt(x);
+#endif
+}
 
 #define CHGPU_DEBUG_PRINTF(...) printf(__VA_ARGS__)
 
 // Decide which SD owns this point in space
 // Pass it the Center of Mass location for a DE to get its owner, also used to get contact point
-inline __device__ int3 pointSDTriplet(int64_t sphCenter_X,
-                                      int64_t sphCenter_Y,
-                                      int64_t sphCenter_Z,
-                                      ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ int3 pointSDTriplet(int64_t sphCenter_X,
+                                               int64_t sphCenter_Y,
+                                               int64_t sphCenter_Z,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
     // Note that this offset allows us to have moving walls and the like very easily
 
     int64_t sphCenter_X_modified = -gran_params->BD_frame_X + sphCenter_X;
@@ -61,20 +119,20 @@ inline __device__ int3 pointSDTriplet(int64_t sphCenter_X,
 
 // Decide which SD owns this point in space
 // Short form overload for regular ints
-inline __device__ int3 pointSDTriplet(int sphCenter_X,
-                                      int sphCenter_Y,
-                                      int sphCenter_Z,
-                                      ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ int3 pointSDTriplet(int sphCenter_X,
+                                               int sphCenter_Y,
+                                               int sphCenter_Z,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
     // call the 64-bit overload
     return pointSDTriplet((int64_t)sphCenter_X, (int64_t)sphCenter_Y, (int64_t)sphCenter_Z, gran_params);
 }
 
 // Decide which SD owns this point in space
 // overload for doubles (used in triangle code)
-inline __device__ int3 pointSDTriplet(double sphCenter_X,
-                                      double sphCenter_Y,
-                                      double sphCenter_Z,
-                                      ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ int3 pointSDTriplet(double sphCenter_X,
+                                               double sphCenter_Y,
+                                               double sphCenter_Z,
+                                               ChSystemGpu_impl::GranParamsPtr gran_params) {
     // call the 64-bit overload
     return pointSDTriplet((int64_t)sphCenter_X, (int64_t)sphCenter_Y, (int64_t)sphCenter_Z, gran_params);
 }
@@ -103,10 +161,10 @@ inline __host__ __device__ int3 SDIDTriplet(unsigned int SD_ID, ChSystemGpu_impl
 }
 
 // Convert triplet to single int SD ID
-inline __device__ unsigned int SDTripletID(const int i,
-                                           const int j,
-                                           const int k,
-                                           ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ unsigned int SDTripletID(const int i,
+                                                    const int j,
+                                                    const int k,
+                                                    ChSystemGpu_impl::GranParamsPtr gran_params) {
     // if we're outside the BD in any direction, this is an invalid SD
     if (i < 0 || i >= gran_params->nSDs_X) {
         return NULL_CHGPU_ID;
@@ -121,20 +179,20 @@ inline __device__ unsigned int SDTripletID(const int i,
 }
 
 // Convert triplet to single int SD ID
-inline __device__ unsigned int SDTripletID(const int3& trip, ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ unsigned int SDTripletID(const int3& trip, ChSystemGpu_impl::GranParamsPtr gran_params) {
     return SDTripletID(trip.x, trip.y, trip.z, gran_params);
 }
 
 // Convert triplet to single int SD ID
-inline __device__ unsigned int SDTripletID(const int trip[3], ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ unsigned int SDTripletID(const int trip[3], ChSystemGpu_impl::GranParamsPtr gran_params) {
     return SDTripletID(trip[0], trip[1], trip[2], gran_params);
 }
 
 // get an index for the current contact pair
-inline __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                             ChSystemGpu_impl::GranParamsPtr gran_params,
-                                             unsigned int body_A,
-                                             unsigned int body_B) {
+inline __host__ __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                      ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                      unsigned int body_A,
+                                                      unsigned int body_B) {
 
     // TODO this should be size_t everywhere
     size_t body_A_offset = (size_t)MAX_SPHERES_TOUCHED_BY_SPHERE * body_A;
@@ -156,7 +214,7 @@ inline __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr
             // claim this slot for ourselves, atomically
             // if the CAS returns NULL_CHGPU_ID, it means that the spot was free and we claimed it
             unsigned int body_B_returned =
-                atomicCAS(sphere_data->contact_partners_map + contact_index, NULL_CHGPU_ID, body_B);
+                chgpuAtomicCAS(sphere_data->contact_partners_map + contact_index, NULL_CHGPU_ID, body_B);
             // did we get the spot? if so, claim it
             if (NULL_CHGPU_ID == body_B_returned || body_B == body_B_returned) {
                 // make sure this contact is marked active
@@ -173,7 +231,7 @@ inline __device__ size_t findContactPairInfo(ChSystemGpu_impl::GranSphereDataPtr
 }
 
 
-inline __device__ bool checkLocalPointInSD(const int3& point, ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ bool checkLocalPointInSD(const int3& point, ChSystemGpu_impl::GranParamsPtr gran_params) {
     // TODO verify that this is correct
     // TODO optimize me
     bool ret = (point.x >= 0) && (point.y >= 0) && (point.z >= 0);
@@ -183,10 +241,10 @@ inline __device__ bool checkLocalPointInSD(const int3& point, ChSystemGpu_impl::
 }
 
 // in integer, check whether a pair of spheres is in contact
-inline __device__ bool checkSpheresContacting_int(const int3& sphereA_pos,
-                                                  const int3& sphereB_pos,
-                                                  unsigned int thisSD,
-                                                  ChSystemGpu_impl::GranParamsPtr gran_params) {
+inline __host__ __device__ bool checkSpheresContacting_int(const int3& sphereA_pos,
+                                                           const int3& sphereB_pos,
+                                                           unsigned int thisSD,
+                                                           ChSystemGpu_impl::GranParamsPtr gran_params) {
     // Compute penetration to check for collision, we can use ints provided the diameter is small enough
     int64_t penetration_int = 0;
 
@@ -216,16 +274,16 @@ inline __device__ bool checkSpheresContacting_int(const int3& sphereA_pos,
 }
 
 // NOTE: expects force_accum to be normal force only
-inline __device__ float3 computeRollingAngAcc(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                              ChSystemGpu_impl::GranParamsPtr gran_params,
-                                              float rolling_coeff,
-                                              float spinning_coeff,
-                                              const float3& normal_force,
-                                              const float3& my_omega,
-                                              const float3& their_omega,
-                                              // TODO check to make sure r_contact is what is passed everywhere
-                                              // vec from my center to center of contact
-                                              const float3& r_contact) {
+inline __host__ __device__ float3 computeRollingAngAcc(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                       ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                       float rolling_coeff,
+                                                       float spinning_coeff,
+                                                       const float3& normal_force,
+                                                       const float3& my_omega,
+                                                       const float3& their_omega,
+                                                       // TODO check to make sure r_contact is what is passed everywhere
+                                                       // vec from my center to center of contact
+                                                       const float3& r_contact) {
     float3 delta_Ang_Acc = {0., 0., 0.};
 
     if (gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS &&
@@ -267,21 +325,21 @@ inline __device__ float3 computeRollingAngAcc(ChSystemGpu_impl::GranSphereDataPt
 
 // Compute single-step friction displacement
 // set delta_t for the displacement
-inline __device__ void computeSingleStepDisplacement(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                     const float3& rel_vel,
-                                                     float3& delta_t) {
+inline __host__ __device__ void computeSingleStepDisplacement(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                              const float3& rel_vel,
+                                                              float3& delta_t) {
     delta_t = rel_vel * gran_params->stepSize_SU;
     float ut = Length(delta_t);
 }    
 
 // Compute multi-step friction displacement
 // set delta_t for the displacement
-inline __device__ void computeMultiStepDisplacement(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                    ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                                    const size_t& contact_id,
-                                                    const float3& vrel_t,
-                                                    const float3& contact_normal,
-                                                    float3& delta_t) {
+inline __host__ __device__ void computeMultiStepDisplacement(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                             ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                             const size_t& contact_id,
+                                                             const float3& vrel_t,
+                                                             const float3& contact_normal,
+                                                             float3& delta_t) {
     
     // get the tangential displacement so far
     delta_t = sphere_data->contact_history_map[contact_id];
@@ -298,21 +356,21 @@ inline __device__ void computeMultiStepDisplacement(ChSystemGpu_impl::GranParams
 
 
 
-inline __device__ void updateMultiStepDisplacement(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                                   const size_t& contact_index,
-                                                   const float3& vrel_t,
-                                                   const float3& contact_normal,
-                                                   const float k_t,
-                                                   const float gamma_t,
-                                                   const float m_eff,
-                                                   const float force_model_multiplier,
-                                                   const float3& tangent_force) {
+inline __host__ __device__ void updateMultiStepDisplacement(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                            const size_t& contact_index,
+                                                            const float3& vrel_t,
+                                                            const float3& contact_normal,
+                                                            const float k_t,
+                                                            const float gamma_t,
+                                                            const float m_eff,
+                                                            const float force_model_multiplier,
+                                                            const float3& tangent_force) {
     // Reverse engineer the delta_t from the clamped force and update the map
     sphere_data->contact_history_map[contact_index] =
         ((tangent_force / force_model_multiplier) + gamma_t * m_eff * vrel_t) / -k_t;
 }
 
-inline __device__ void updateMultiStepDisplacement_matBased(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+inline __host__ __device__ void updateMultiStepDisplacement_matBased(ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                     const size_t& contact_index,
                                                     const float3& vrel_t,
                                                     const float kt,
@@ -324,17 +382,17 @@ inline __device__ void updateMultiStepDisplacement_matBased(ChSystemGpu_impl::Gr
 
 // compute friction forces for a contact
 // returns tangent force including hertz factor, clamped and all
-inline __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                               ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                               size_t contact_index,
-                                               float static_friction_coeff,
-                                               float k_t,
-                                               float gamma_t,
-                                               float force_model_multiplier,
-                                               float m_eff,
-                                               const float3& normal_force,
-                                               const float3& vrel_t,
-                                               const float3& contact_normal) {
+inline __host__ __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                        ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                        size_t contact_index,
+                                                        float static_friction_coeff,
+                                                        float k_t,
+                                                        float gamma_t,
+                                                        float force_model_multiplier,
+                                                        float m_eff,
+                                                        const float3& normal_force,
+                                                        const float3& vrel_t,
+                                                        const float3& contact_normal) {
     float3 delta_t = {0.f, 0.f, 0.f};
 
     if (gran_params->friction_mode == CHGPU_FRICTION_MODE::SINGLE_STEP) {
@@ -371,18 +429,18 @@ inline __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr g
 /// compute material based friction forces for a contact
 /// tangential displacement is hisotry based
 /// returns tangent force including hertz factor, clamped and all
-inline __device__ float3 computeFrictionForces_matBased(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                        ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                                        size_t contact_index,
-                                                        const float& static_friction_coeff,
-                                                        const float& E_eff,
-                                                        const float& G_eff,
-                                                        const float& sqrt_Rd,
-                                                        const float& beta,
-                                                        const float3& normal_force,
-                                                        const float3& vrel_t,
-                                                        const float3& contact_normal,
-                                                        const float m_eff) {
+inline __host__ __device__ float3 computeFrictionForces_matBased(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                 ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                                 size_t contact_index,
+                                                                 const float& static_friction_coeff,
+                                                                 const float& E_eff,
+                                                                 const float& G_eff,
+                                                                 const float& sqrt_Rd,
+                                                                 const float& beta,
+                                                                 const float3& normal_force,
+                                                                 const float3& vrel_t,
+                                                                 const float3& contact_normal,
+                                                                 const float m_eff) {
     float3 delta_t = {0.f, 0.f, 0.f};
 
     computeMultiStepDisplacement(gran_params, sphere_data, contact_index, vrel_t, contact_normal, delta_t);
@@ -428,18 +486,18 @@ inline __device__ float3 computeFrictionForces_matBased(ChSystemGpu_impl::GranPa
 
 
 // overload for if the body ids are given rather than contact id
-inline __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr gran_params,
-                                               ChSystemGpu_impl::GranSphereDataPtr sphere_data,
-                                               unsigned int body_A_index,
-                                               unsigned int body_B_index,
-                                               float static_friction_coeff,
-                                               float k_t,
-                                               float gamma_t,
-                                               float force_model_multiplier,
-                                               float m_eff,
-                                               const float3& normal_force,
-                                               const float3& rel_vel,
-                                               const float3& contact_normal) {
+inline __host__ __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                        ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                        unsigned int body_A_index,
+                                                        unsigned int body_B_index,
+                                                        float static_friction_coeff,
+                                                        float k_t,
+                                                        float gamma_t,
+                                                        float force_model_multiplier,
+                                                        float m_eff,
+                                                        const float3& normal_force,
+                                                        const float3& rel_vel,
+                                                        const float3& contact_normal) {
     size_t contact_id = 0;
 
     // if multistep, compute contact id, otherwise we don't care anyways
@@ -453,7 +511,7 @@ inline __device__ float3 computeFrictionForces(ChSystemGpu_impl::GranParamsPtr g
 }
 
 // overload for if the body ids are given rather than contact id (for sphere-wall contact)
-inline __device__ float3 computeFrictionForces_matBased(ChSystemGpu_impl::GranParamsPtr gran_params,
+inline __host__ __device__ float3 computeFrictionForces_matBased(ChSystemGpu_impl::GranParamsPtr gran_params,
                                                ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                unsigned int body_A_index,
                                                unsigned int body_B_index,
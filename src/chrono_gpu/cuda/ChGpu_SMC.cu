@@ -15,6 +15,7 @@
 #include <cmath>
 #include <numeric>
 #include <fstream>
+#include <algorithm>
 
 #include "chrono_gpu/cuda/ChGpu_SMC.cuh"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
@@ -26,6 +27,14 @@ __host__ float ChSystemGpu_impl::computeArray3SquaredSum(std::vector<float, cuda
                                                          std::vector<float, cudallocator<float>>& arrY,
                                                          std::vector<float, cudallocator<float>>& arrZ,
                                                          size_t nSpheres) {
+    if (backend == CHGPU_BACKEND::CPU) {
+        double sum = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(+ : sum)
+        for (int i = 0; i < (int)nSpheres; i++)
+            sum += arrX[i] * arrX[i] + arrY[i] * arrY[i] + arrZ[i] * arrZ[i];
+        return (float)sum;
+    }
+
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
     elementalArray3Squared<float><<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer, arrX.data(),
@@ -49,6 +58,14 @@ __host__ double ChSystemGpu_impl::GetMaxParticleZ(bool getMax) {
     if (nSpheres == 0)
         CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
 
+    if (backend == CHGPU_BACKEND::CPU) {
+        float* posZ = sphere_data->sphere_stats_buffer;
+#pragma omp parallel for num_threads(num_threads)
+        for (int i = 0; i < (int)nSpheres; i++)
+            f_elementalZLocalToGlobal(i, posZ, sphere_data, nSpheres, gran_params);
+        return getMax ? *std::max_element(posZ, posZ + nSpheres) : *std::min_element(posZ, posZ + nSpheres);
+    }
+
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
     elementalZLocalToGlobal<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer, sphere_data, nSpheres,
@@ -80,6 +97,17 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveZ(float ZValue) {
     if (nSpheres == 0)
         CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
 
+    if (backend == CHGPU_BACKEND::CPU) {
+        unsigned int* YorN = sphere_data->sphere_stats_buffer_int;
+        unsigned int count = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(+ : count)
+        for (int i = 0; i < (int)nSpheres; i++) {
+            f_elementalZAboveValue(i, YorN, sphere_data, nSpheres, gran_params, ZValue);
+            count += YorN[i];
+        }
+        return count;
+    }
+
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
     elementalZAboveValue<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer_int, sphere_data, nSpheres,
@@ -103,6 +131,17 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
     if (nSpheres == 0)
         CHGPU_ERROR("ERROR! 0 particle in system! Please call this method after Initialize().\n");
 
+    if (backend == CHGPU_BACKEND::CPU) {
+        unsigned int* YorN = sphere_data->sphere_stats_buffer_int;
+        unsigned int count = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(+ : count)
+        for (int i = 0; i < (int)nSpheres; i++) {
+            f_elementalXAboveValue(i, YorN, sphere_data, nSpheres, gran_params, XValue);
+            count += YorN[i];
+        }
+        return count;
+    }
+
     const unsigned int threadsPerBlock = 1024;
     unsigned int nBlocks = (nSpheres + threadsPerBlock - 1) / threadsPerBlock;
     elementalXAboveValue<<<nBlocks, threadsPerBlock>>>(sphere_data->sphere_stats_buffer_int, sphere_data, nSpheres,
@@ -123,6 +162,13 @@ __host__ unsigned int ChSystemGpu_impl::GetNumParticleAboveX(float XValue) {
 
 // Reset broadphase data structures
 void ChSystemGpu_impl::resetBroadphaseInformation() {
+    if (backend == CHGPU_BACKEND::CPU) {
+        std::fill(SD_NumSpheresTouching.begin(), SD_NumSpheresTouching.end(), 0);
+        std::fill(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.end(), 0);
+        std::fill(spheres_in_SD_composite.begin(), spheres_in_SD_composite.end(), NULL_CHGPU_ID);
+        return;
+    }
+
     // Set all the offsets to zero
     gpuErrchk(cudaMemset(SD_NumSpheresTouching.data(), 0, SD_NumSpheresTouching.size() * sizeof(unsigned int)));
     gpuErrchk(cudaMemset(SD_SphereCompositeOffsets.data(), 0, SD_SphereCompositeOffsets.size() * sizeof(unsigned int)));
@@ -134,6 +180,29 @@ void ChSystemGpu_impl::resetBroadphaseInformation() {
 
 // Reset sphere acceleration data structures
 void ChSystemGpu_impl::resetSphereAccelerations() {
+    if (backend == CHGPU_BACKEND::CPU) {
+        bool friction = gran_params->friction_mode != CHGPU_FRICTION_MODE::FRICTIONLESS;
+        if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
+            std::copy(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, sphere_acc_X_old.begin());
+            std::copy(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, sphere_acc_Y_old.begin());
+            std::copy(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, sphere_acc_Z_old.begin());
+            if (friction) {
+                std::copy(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, sphere_ang_acc_X_old.begin());
+                std::copy(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, sphere_ang_acc_Y_old.begin());
+                std::copy(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, sphere_ang_acc_Z_old.begin());
+            }
+        }
+        std::fill(sphere_acc_X.begin(), sphere_acc_X.begin() + nSpheres, 0.f);
+        std::fill(sphere_acc_Y.begin(), sphere_acc_Y.begin() + nSpheres, 0.f);
+        std::fill(sphere_acc_Z.begin(), sphere_acc_Z.begin() + nSpheres, 0.f);
+        if (friction) {
+            std::fill(sphere_ang_acc_X.begin(), sphere_ang_acc_X.begin() + nSpheres, 0.f);
+            std::fill(sphere_ang_acc_Y.begin(), sphere_ang_acc_Y.begin() + nSpheres, 0.f);
+            std::fill(sphere_ang_acc_Z.begin(), sphere_ang_acc_Z.begin() + nSpheres, 0.f);
+        }
+        return;
+    }
+
     // cache past acceleration data
     if (time_integrator == CHGPU_TIME_INTEGRATOR::CHUNG) {
         gpuErrchk(cudaMemcpy(sphere_acc_X_old.data(), sphere_acc_X.data(), nSpheres * sizeof(float),
@@ -180,6 +249,16 @@ __global__ void compute_absv(const unsigned int nSpheres,
 }
 
 __host__ float ChSystemGpu_impl::get_max_vel() const {
+    if (backend == CHGPU_BACKEND::CPU) {
+        float max_vel = 0;
+#pragma omp parallel for num_threads(num_threads) reduction(max : max_vel)
+        for (int i = 0; i < (int)nSpheres; i++) {
+            float v[3] = {pos_X_dt[i], pos_Y_dt[i], pos_Z_dt[i]};
+            max_vel = std::max(max_vel, std::sqrt(v[0] * v[0] + v[1] * v[1] + v[2] * v[2]));
+        }
+        return max_vel;
+    }
+
     float* d_absv;
     float* d_max_vel;
     float h_max_vel;
@@ -384,14 +463,21 @@ __host__ void ChSystemGpu_impl::setupSphereDataStructures() {
         }
 
         packSphereDataPointers();
-        // Figure our the number of blocks that need to be launched to cover the box
-        unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
-        initializeLocalPositions<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
-            sphere_data, sphere_global_pos_X.data(), sphere_global_pos_Y.data(), sphere_global_pos_Z.data(), nSpheres,
-            gran_params);
+        if (backend == CHGPU_BACKEND::CPU) {
+#pragma omp parallel for num_threads(num_threads)
+            for (int i = 0; i < (int)nSpheres; i++)
+                f_initializeLocalPositions(i, sphere_data, sphere_global_pos_X.data(), sphere_global_pos_Y.data(),
+                                           sphere_global_pos_Z.data(), nSpheres, gran_params);
+        } else {
+            // Figure our the number of blocks that need to be launched to cover the box
+            unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
+            initializeLocalPositions<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(
+                sphere_data, sphere_global_pos_X.data(), sphere_global_pos_Y.data(), sphere_global_pos_Z.data(),
+                nSpheres, gran_params);
 
-        gpuErrchk(cudaDeviceSynchronize());
-        gpuErrchk(cudaPeekAtLastError());
+            gpuErrchk(cudaDeviceSynchronize());
+            gpuErrchk(cudaPeekAtLastError());
+        }
     }
 
     TRACK_VECTOR_RESIZE(sphere_acc_X, nSpheres, "sphere_acc_X", 0);
@@ -552,6 +638,11 @@ __host__ void ChSystemGpu_impl::setupSphereDataStructures() {
 /// </summary>
 /// <returns></returns>
 __host__ void ChSystemGpu_impl::runSphereBroadphase() {
+    if (backend == CHGPU_BACKEND::CPU) {
+        runSphereBroadphase_cpu();
+        return;
+    }
+
     METRICS_PRINTF("Resetting broadphase info!\n");
 
     // reset the number of spheres per SD, the offsets in the big composite array, and the big fat composite array
@@ -638,6 +729,13 @@ __host__ void ChSystemGpu_impl::updateBCPositions() {
 
         packSphereDataPointers();
 
+        if (backend == CHGPU_BACKEND::CPU) {
+#pragma omp parallel for num_threads(num_threads)
+            for (int i = 0; i < (int)nSpheres; i++)
+                f_applyBDFrameChange(i, offset_delta, sphere_data, nSpheres, gran_params);
+            return;
+        }
+
         applyBDFrameChange<<<nBlocks, CUDA_THREADS_PER_BLOCK>>>(offset_delta, sphere_data, nSpheres, gran_params);
 
         gpuErrchk(cudaPeekAtLastError());
@@ -646,6 +744,9 @@ __host__ void ChSystemGpu_impl::updateBCPositions() {
 }
 
 __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
+    if (backend == CHGPU_BACKEND::CPU)
+        return AdvanceSimulation_cpu(duration);
+
     // Figure our the number of blocks that need to be launched to cover the box
     unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
     // Settling simulation loop.
@@ -724,5 +825,149 @@ __host__ double ChSystemGpu_impl::AdvanceSimulation(float duration) {
 
     return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
 }
+
+// -----------------------------------------------------------------------------
+// CPU backend
+//
+// The host functions below run the same per-sphere and per-SD device functions as the CUDA kernels, in OpenMP loops.
+// One loop iteration over subdomains plays the role of one thread block; the per-SD arrays that the kernels keep in
+// shared memory are allocated on the stack of the iteration.
+// -----------------------------------------------------------------------------
+
+__host__ void ChSystemGpu_impl::runSphereBroadphase_cpu() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+    resetBroadphaseInformation();
+
+    // Count the spheres touching each SD
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)nSpheres; i++) {
+        unsigned int SDsTouched[MAX_SDs_TOUCHED_BY_SPHERE] = {NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID, NULL_CHGPU_ID,
+                                                              NULL_CHGPU_ID, NULL_CHGPU_ID};
+        int3 ownerSD = SDIDTriplet(sphere_data->sphere_owner_SDs[i], gran_params);
+        figureOutTouchedSD(sphere_data->sphere_local_pos_X[i], sphere_data->sphere_local_pos_Y[i],
+                           sphere_data->sphere_local_pos_Z[i], ownerSD, SDsTouched, gran_params);
+        for (unsigned int k = 0; k < MAX_SDs_TOUCHED_BY_SPHERE; k++) {
+            if (SDsTouched[k] != NULL_CHGPU_ID)
+                chgpuAtomicAdd(sphere_data->SD_NumSpheresTouching + SDsTouched[k], 1u);
+        }
+    }
+
+    // Exclusive prefix scan to get the offsets in the composite array
+    unsigned int num_entries = 0;
+    for (unsigned int sd = 0; sd < nSDs; sd++) {
+        SD_SphereCompositeOffsets[sd] = num_entries;
+        num_entries += SD_NumSpheresTouching[sd];
+    }
+    spheres_in_SD_composite.resize(num_entries, NULL_CHGPU_ID);
+    sphere_data->spheres_in_SD_composite = spheres_in_SD_composite.data();
+
+    // Populate the composite array. This is done serially so that the spheres of each SD are listed in increasing
+    // order of their IDs, which keeps the results independent of the number of threads.
+    std::copy(SD_SphereCompositeOffsets.begin(), SD_SphereCompositeOffsets.begin() + nSDs,
+              SD_SphereCompositeOffsets_ScratchPad.begin());
+    for (unsigned int i = 0; i < nSpheres; i++)
+        f_populateSpheresInEachSD(i, sphere_data, nSpheres, gran_params);
+}
+
+__host__ void ChSystemGpu_impl::computeSphereForces_cpu(bool mat_based_frictionless) {
+    unsigned int nBCs = (unsigned int)BC_params_list_SU.size();
+    bool frictionless = gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS;
+
+    // Sphere-sphere forces (frictionless case) or contact detection (frictional case), one SD at a time
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int sd = 0; sd < (int)nSDs; sd++) {
+        unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[sd];
+        if (spheresTouchingThisSD == 0)
+            continue;
+        if (spheresTouchingThisSD > MAX_COUNT_OF_SPHERES_PER_SD) {
+            ABORTABORTABORT("TOO MANY SPHERES! SD %u has %u spheres\n", sd, spheresTouchingThisSD);
+        }
+
+        unsigned int sphIDs[MAX_COUNT_OF_SPHERES_PER_SD];
+        int3 sphere_pos[MAX_COUNT_OF_SPHERES_PER_SD];
+        float3 sphere_vel[MAX_COUNT_OF_SPHERES_PER_SD];
+        not_stupid_bool sphere_fixed[MAX_COUNT_OF_SPHERES_PER_SD];
+        for (unsigned int bodyA = 0; bodyA < spheresTouchingThisSD; bodyA++) {
+            loadSphereInSD(bodyA, sd, sphere_data, gran_params, sphIDs, sphere_pos, frictionless ? sphere_vel : nullptr,
+                           sphere_fixed);
+        }
+
+        for (unsigned int bodyA = 0; bodyA < spheresTouchingThisSD; bodyA++) {
+            if (!frictionless) {
+                f_determineContactPairs(bodyA, sd, spheresTouchingThisSD, sphIDs, sphere_pos, sphere_fixed,
+                                        sphere_data, gran_params);
+            } else if (mat_based_frictionless) {
+                f_computeSphereForces_frictionless_matBased(bodyA, sd, spheresTouchingThisSD, sphIDs, sphere_pos,
+                                                            sphere_vel, sphere_fixed, sphere_data, gran_params,
+                                                            BC_type_list.data(), BC_params_list_SU.data(), nBCs);
+            } else {
+                f_computeSphereForces_frictionless(bodyA, sd, spheresTouchingThisSD, sphIDs, sphere_pos, sphere_vel,
+                                                   sphere_fixed, sphere_data, gran_params, BC_type_list.data(),
+                                                   BC_params_list_SU.data(), nBCs);
+            }
+        }
+    }
+
+    if (frictionless)
+        return;
+
+    // Frictional contact forces, one sphere at a time
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)nSpheres; i++) {
+        if (gran_params->use_mat_based) {
+            f_computeSphereContactForces_matBased(i, sphere_data, gran_params, BC_type_list.data(),
+                                                  BC_params_list_SU.data(), nBCs, nSpheres);
+        } else {
+            f_computeSphereContactForces(i, sphere_data, gran_params, BC_type_list.data(), BC_params_list_SU.data(),
+                                         nBCs, nSpheres);
+        }
+    }
+}
+
+__host__ void ChSystemGpu_impl::integrateSpheres_cpu() {
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)nSpheres; i++)
+        f_integrateSpheres(i, stepSize_SU, sphere_data, nSpheres, gran_params);
+
+    if (gran_params->friction_mode == CHGPU_FRICTION_MODE::FRICTIONLESS)
+        return;
+
+    unsigned int fricMapSize = nSpheres * MAX_SPHERES_TOUCHED_BY_SPHERE;
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)fricMapSize; i++)
+        f_updateFrictionData(i, fricMapSize, sphere_data, gran_params);
+
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)nSpheres; i++)
+        f_updateAngVels(i, stepSize_SU, sphere_data, nSpheres, gran_params);
+}
+
+__host__ double ChSystemGpu_impl::AdvanceSimulation_cpu(float duration) {
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+    float time_elapsed_SU = 0;  // time elapsed in this advance call
+
+    packSphereDataPointers();
+
+    for (unsigned int n = 0; n < nsteps; n++) {
+        updateBCPositions();
+        runSphereBroadphase_cpu();
+        resetSphereAccelerations();
+        resetBCForces();
+
+        // as in the CUDA path, the frictionless sphere-sphere contact always uses the material-based model
+        computeSphereForces_cpu(true);
+        integrateSpheres_cpu();
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+        time_elapsed_SU += stepSize_SU;
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
 }  // namespace gpu
 }  // namespace chrono
@@ -17,6 +17,7 @@
 #include "chrono_gpu/physics/ChSystemGpuMesh_impl.h"
 #include "chrono_gpu/utils/ChGpuUtilities.h"
 #include <math_constants.h>
+#include <algorithm>
 
 namespace chrono {
 namespace gpu {
@@ -155,6 +156,247 @@ __host__ void ChSystemGpuMesh_impl::runTriangleBroadphase() {
     gpuErrchk(cudaDeviceSynchronize());
 }
 
+/// Load the triangle with index local_ID among the triangles touching a given SD into the per-SD arrays used by the
+/// sphere-mesh interaction kernels. Node positions are expressed in the global frame, in simulation units.
+inline __host__ __device__ void loadTriangleInSD(unsigned int local_ID,
+                                                 unsigned int thisSD,
+                                                 unsigned int numSDTriangles,
+                                                 ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                                 const unsigned int* SD_trianglesInEachSD_composite,
+                                                 const unsigned int* SD_TrianglesCompositeOffsets,
+                                                 ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                 ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                                 unsigned int* triangleIDs,
+                                                 double3* node1,
+                                                 double3* node2,
+                                                 double3* node3) {
+    size_t SD_composite_offset = SD_TrianglesCompositeOffsets[thisSD];
+    if (SD_composite_offset == NULL_CHGPU_ID) {
+        ABORTABORTABORT("Invalid composite offset %lu for SD %u, touching %u triangles\n", NULL_CHGPU_ID, thisSD,
+                        numSDTriangles);
+    }
+    size_t offset_in_composite_Array = SD_composite_offset + local_ID;
+
+    unsigned int globalID = SD_trianglesInEachSD_composite[offset_in_composite_Array];
+    triangleIDs[local_ID] = globalID;
+
+    // Read node positions from global memory into shared memory
+    // NOTE implicit cast from float to double here
+    unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
+    node1[local_ID] = apply_frame_transform<double, float3, double3>(
+        d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
+        mesh_params->fam_frame_narrow[fam].rot_mat);
+
+    node2[local_ID] = apply_frame_transform<double, float3, double3>(
+        d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
+        mesh_params->fam_frame_narrow[fam].rot_mat);
+
+    node3[local_ID] = apply_frame_transform<double, float3, double3>(
+        d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
+        mesh_params->fam_frame_narrow[fam].rot_mat);
+
+    convert_pos_UU2SU<double3>(node1[local_ID], gran_params);
+    convert_pos_UU2SU<double3>(node2[local_ID], gran_params);
+    convert_pos_UU2SU<double3>(node3[local_ID], gran_params);
+}
+
+/// Compute the interaction between the sphere with index sphereIDLocal among the spheres touching a given SD and the
+/// triangles touching that SD (also used by the CPU backend)
+inline __host__ __device__ void f_interactionGranMat_TriangleSoup_matBased(
+    unsigned int sphereIDLocal,
+    unsigned int thisSD,
+    unsigned int numSDTriangles,
+    const unsigned int* triangleIDs,
+    const double3* node1,
+    const double3* node2,
+    const double3* node3,
+    ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+    ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+    ChSystemGpu_impl::GranParamsPtr gran_params,
+    ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+    unsigned int triangleFamilyHistmapOffset) {
+    // We need int64_ts to index into composite array
+    size_t offset_in_composite_Array = sphere_data->SD_SphereCompositeOffsets[thisSD] + sphereIDLocal;
+    unsigned int sphereIDGlobal = sphere_data->spheres_in_SD_composite[offset_in_composite_Array];
+
+    int3 sphere_pos_local =
+        make_int3(sphere_data->sphere_local_pos_X[sphereIDGlobal], sphere_data->sphere_local_pos_Y[sphereIDGlobal],
+                  sphere_data->sphere_local_pos_Z[sphereIDGlobal]);
+
+    unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[sphereIDGlobal];
+    // if this SD doesn't own that sphere, add an offset to account
+    if (sphere_owner_SD != thisSD) {
+        sphere_pos_local = sphere_pos_local + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
+    }
+
+    float3 omega = {0.f, 0.f, 0.f};
+    if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        omega = make_float3(sphere_data->sphere_Omega_X[sphereIDGlobal], sphere_data->sphere_Omega_Y[sphereIDGlobal],
+                            sphere_data->sphere_Omega_Z[sphereIDGlobal]);
+    }
+    float3 sphere_vel = make_float3(sphere_data->pos_X_dt[sphereIDGlobal], sphere_data->pos_Y_dt[sphereIDGlobal],
+                                    sphere_data->pos_Z_dt[sphereIDGlobal]);
+
+    float3 sphere_force = {0.f, 0.f, 0.f};
+    float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+
+    // loop over each triangle in the SD and compute the force this sphere (thread) exerts on it
+    for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
+        /// we have a valid sphere and a valid triganle; check if in contact
+        float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
+        float depth;    // Negative in overlap
+        float3 pt1_float;
+
+        // Transform LRF to GRF
+        const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+        bool valid_contact = false;
+
+        // vector from center of mesh body to contact point, assume this can be held in a float
+        float3 fromCenter;
+
+        {
+            double3 pt1;  // Contact point on triangle
+            // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
+            double3 sphCntr = int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sphere_pos_local, gran_params));
+            valid_contact = face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID],
+                                           sphCntr, gran_params->sphereRadius_SU, normal, depth, pt1);
+
+            valid_contact = valid_contact &&
+                            SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
+            pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
+
+            double3 meshCenter_double =
+                make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
+                             mesh_params->fam_frame_narrow[fam].pos[2]);
+            convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
+
+            double3 fromCenter_double = pt1 - meshCenter_double;
+
+            fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
+        }
+
+        // If there is a collision, add an impulse to the sphere
+        if (valid_contact) {
+            // TODO contact models
+            // Use the CD information to compute the force on the grElement
+            // normal points from triangle to sphere
+            float3 delta = -depth * normal;
+
+            // effective radius is just sphere radius -- assume meshes are locally flat (a safe assumption?)
+            // float hertz_force_factor = sqrt(abs(depth) / gran_params->sphereRadius_SU);
+
+            // helper variables
+            float sqrt_Rd = sqrt(abs(depth) * gran_params->sphereRadius_SU);
+            float Sn = 2. * mesh_params->E_eff_s2m_SU * sqrt_Rd;
+
+            float loge = (mesh_params->COR_s2m_SU < EPSILON) ? log(EPSILON) : log(mesh_params->COR_s2m_SU);
+            float beta = loge / sqrt(loge * loge + CUDART_PI_F * CUDART_PI_F);
+
+            // effective mass = mass_mesh * mass_sphere / (m_mesh + mass_sphere)
+            float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
+            const float sphere_mass_SU = gran_params->sphere_mass_SU;
+            float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
+
+            // stiffness and damping coefficient
+            float kn = (2.0 / 3.0) * Sn;
+            float gn = 2 * sqrt(5.0 / 6.0) * beta * sqrt(Sn * m_eff);
+            // relative velocity = v_sphere - v_mesh
+            float3 v_rel = sphere_vel - d_triangleSoup->vel[fam];
+
+            // assumes pos is the center of mass of the mesh
+            float3 meshCenter =
+                make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
+                            mesh_params->fam_frame_broad[fam].pos[2]);
+            convert_pos_UU2SU<float3>(meshCenter, gran_params);
+
+            // NOTE depth is negative and normal points from triangle to sphere center
+            float3 r = pt1_float + normal * (depth / 2) - meshCenter;
+
+            // Add angular velocity contribution from mesh
+            v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
+
+            // add tangential components if they exist
+            if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+                // Vector from the center of sphere to center of contact volume
+                float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                v_rel = v_rel + Cross(omega, r_A);
+            }
+
+            // normal component of relative velocity
+            float projection = Dot(v_rel, normal);
+
+            // tangential component of relative velocity
+            float3 vrel_t = v_rel - projection * normal;
+
+            // normal force magnitude
+            float forceN_mag = -kn * depth + gn * projection;
+
+            float3 force_accum = forceN_mag * normal;
+
+            // Compute force updates for adhesion term, opposite the spring term
+            // NOTE ratio is wrt the weight of a sphere of mass 1
+            // NOTE the cancelation of two negatives
+            force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+            // tangential component
+            if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+                // radius pointing from the contact point to the center of particle
+                float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                float3 roll_ang_acc = computeRollingAngAcc(
+                    sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU, mesh_params->spinning_coeff_s2m_SU,
+                    force_accum, omega, d_triangleSoup->omega[fam], Rc);
+
+                sphere_AngAcc = sphere_AngAcc + roll_ang_acc;
+
+                unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
+
+                // compute tangent force
+                float3 tangent_force = computeFrictionForces_matBased(
+                    gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                    mesh_params->static_friction_coeff_s2m, mesh_params->E_eff_s2m_SU, mesh_params->G_eff_s2m_SU,
+                    sqrt_Rd, beta, force_accum, vrel_t, normal, m_eff);
+
+                ////float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT /
+                ////                   (gran_params->TIME_UNIT * gran_params->TIME_UNIT);
+
+                ////float velocity_unit = gran_params->LENGTH_UNIT / gran_params->TIME_UNIT;
+
+                force_accum = force_accum + tangent_force;
+                sphere_AngAcc =
+                    sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
+            }
+
+            // Use the CD information to compute the force and torque on the family of this triangle
+            sphere_force = sphere_force + force_accum;
+
+            // Force on the mesh is opposite the force on the sphere
+            float3 force_total = -1.f * force_accum;
+
+            float3 torque = Cross(fromCenter, force_total);
+            // TODO we could be much smarter about reducing this atomic write
+            unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
+
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
+        }
+    }  // end of per-triangle loop
+    // write back sphere forces
+    chgpuAtomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
+    chgpuAtomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
+    chgpuAtomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
+
+    if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        // write back torques for later
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+    }
+}
+
 __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
                                                          ChSystemGpu_impl::GranSphereDataPtr sphere_data,
                                                          const unsigned int* SD_trianglesInEachSD_composite,
@@ -165,13 +407,6 @@ __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::T
                                                          unsigned int triangleFamilyHistmapOffset) {
     __shared__ unsigned int triangleIDs[MAX_TRIANGLE_COUNT_PER_SD];  //!< global ID of the triangles touching this SD
 
-    __shared__ int3 sphere_pos_local[MAX_COUNT_OF_SPHERES_PER_SD];  //!< local coordinate of the sphere
-
-    __shared__ float3 sphere_vel[MAX_COUNT_OF_SPHERES_PER_SD];
-
-    // TODO figure out how we can do this better with no friction
-    __shared__ float3 omega[MAX_COUNT_OF_SPHERES_PER_SD];
-
     __shared__ double3 node1[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 1st node of the triangle
     __shared__ double3 node2[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 2nd node of the triangle
     __shared__ double3 node3[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 3rd node of the triangle
@@ -190,238 +425,213 @@ __global__ void interactionGranMat_TriangleSoup_matBased(ChSystemGpuMesh_impl::T
     // Getting here means that there are both triangles and DEs in this SD.
     unsigned int numSDTriangles = SD_numTrianglesTouching[thisSD];
     unsigned int sphereIDLocal = threadIdx.x;
-    unsigned int sphereIDGlobal = NULL_CHGPU_ID;
 
-    // Bring in data from global into shmem. Only a subset of threads get to do this.
-    // Note that we're not using shared memory very heavily, so our bandwidth is pretty low
-    if (sphereIDLocal < spheresTouchingThisSD) {
-        size_t SD_composite_offset = sphere_data->SD_SphereCompositeOffsets[thisSD];
+    // Populate the shared memory with mesh triangle data
+    unsigned int tripsToCoverTriangles = (numSDTriangles + blockDim.x - 1) / blockDim.x;
+    unsigned int local_ID = threadIdx.x;
+    for (unsigned int triangTrip = 0; triangTrip < tripsToCoverTriangles; triangTrip++) {
+        if (local_ID < numSDTriangles) {
+            loadTriangleInSD(local_ID, thisSD, numSDTriangles, d_triangleSoup, SD_trianglesInEachSD_composite,
+                             SD_TrianglesCompositeOffsets, gran_params, mesh_params, triangleIDs, node1, node2, node3);
+        }
+        local_ID += blockDim.x;
+    }
 
-        // TODO standardize this
-        size_t offset_in_composite_Array = SD_composite_offset + sphereIDLocal;
-        sphereIDGlobal = sphere_data->spheres_in_SD_composite[offset_in_composite_Array];
+    __syncthreads();  // this call ensures data is in its place in shared memory
 
-        sphere_pos_local[sphereIDLocal] =
-            make_int3(sphere_data->sphere_local_pos_X[sphereIDGlobal], sphere_data->sphere_local_pos_Y[sphereIDGlobal],
-                      sphere_data->sphere_local_pos_Z[sphereIDGlobal]);
+    // each thread is a sphere, computing the forces exerted on it by the triangles in this SD
+    if (sphereIDLocal < spheresTouchingThisSD) {
+        f_interactionGranMat_TriangleSoup_matBased(sphereIDLocal, thisSD, numSDTriangles, triangleIDs, node1, node2,
+                                                   node3, d_triangleSoup, sphere_data, gran_params, mesh_params,
+                                                   triangleFamilyHistmapOffset);
+    }
+}  // end kernel
 
-        unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[sphereIDGlobal];
-        // if this SD doesn't own that sphere, add an offset to account
-        if (sphere_owner_SD != thisSD) {
-            sphere_pos_local[sphereIDLocal] =
-                sphere_pos_local[sphereIDLocal] + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
-        }
+/// Compute the interaction between the sphere with index sphereIDLocal among the spheres touching a given SD and the
+/// triangles touching that SD (also used by the CPU backend)
+inline __host__ __device__ void f_interactionGranMat_TriangleSoup(unsigned int sphereIDLocal,
+                                                                  unsigned int thisSD,
+                                                                  unsigned int numSDTriangles,
+                                                                  const unsigned int* triangleIDs,
+                                                                  const double3* node1,
+                                                                  const double3* node2,
+                                                                  const double3* node3,
+                                                                  ChSystemGpuMesh_impl::TriangleSoupPtr d_triangleSoup,
+                                                                  ChSystemGpu_impl::GranSphereDataPtr sphere_data,
+                                                                  ChSystemGpu_impl::GranParamsPtr gran_params,
+                                                                  ChSystemGpuMesh_impl::MeshParamsPtr mesh_params,
+                                                                  unsigned int triangleFamilyHistmapOffset) {
+    // We need int64_ts to index into composite array
+    size_t offset_in_composite_Array = sphere_data->SD_SphereCompositeOffsets[thisSD] + sphereIDLocal;
+    unsigned int sphereIDGlobal = sphere_data->spheres_in_SD_composite[offset_in_composite_Array];
+
+    int3 sphere_pos_local =
+        make_int3(sphere_data->sphere_local_pos_X[sphereIDGlobal], sphere_data->sphere_local_pos_Y[sphereIDGlobal],
+                  sphere_data->sphere_local_pos_Z[sphereIDGlobal]);
+
+    unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[sphereIDGlobal];
+    // if this SD doesn't own that sphere, add an offset to account
+    if (sphere_owner_SD != thisSD) {
+        sphere_pos_local = sphere_pos_local + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
+    }
 
-        if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            omega[sphereIDLocal] =
-                make_float3(sphere_data->sphere_Omega_X[sphereIDGlobal], sphere_data->sphere_Omega_Y[sphereIDGlobal],
+    float3 omega = {0.f, 0.f, 0.f};
+    if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        omega = make_float3(sphere_data->sphere_Omega_X[sphereIDGlobal], sphere_data->sphere_Omega_Y[sphereIDGlobal],
                             sphere_data->sphere_Omega_Z[sphereIDGlobal]);
-        }
-        sphere_vel[sphereIDLocal] =
-            make_float3(sphere_data->pos_X_dt[sphereIDGlobal], sphere_data->pos_Y_dt[sphereIDGlobal],
-                        sphere_data->pos_Z_dt[sphereIDGlobal]);
     }
-    // Populate the shared memory with mesh triangle data
-    unsigned int tripsToCoverTriangles = (numSDTriangles + blockDim.x - 1) / blockDim.x;
-    unsigned int local_ID = threadIdx.x;
-    for (unsigned int triangTrip = 0; triangTrip < tripsToCoverTriangles; triangTrip++) {
-        if (local_ID < numSDTriangles) {
-            size_t SD_composite_offset = SD_TrianglesCompositeOffsets[thisSD];
-            if (SD_composite_offset == NULL_CHGPU_ID) {
-                ABORTABORTABORT("Invalid composite offset %lu for SD %u, touching %u triangles\n", NULL_CHGPU_ID,
-                                thisSD, numSDTriangles);
-            }
-            size_t offset_in_composite_Array = SD_composite_offset + local_ID;
+    float3 sphere_vel = make_float3(sphere_data->pos_X_dt[sphereIDGlobal], sphere_data->pos_Y_dt[sphereIDGlobal],
+                                    sphere_data->pos_Z_dt[sphereIDGlobal]);
+
+    float3 sphere_force = {0.f, 0.f, 0.f};
+    float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+
+    // loop over each triangle in the SD and compute the force this sphere (thread) exerts on it
+    for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
+        /// we have a valid sphere and a valid triganle; check if in contact
+        float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
+        float depth;    // Negative in overlap
+        float3 pt1_float;
 
-            unsigned int globalID = SD_trianglesInEachSD_composite[offset_in_composite_Array];
-            triangleIDs[local_ID] = globalID;
+        // Transform LRF to GRF
+        const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+        bool valid_contact = false;
 
-            // Read node positions from global memory into shared memory
-            // NOTE implicit cast from float to double here
-            unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
-            node1[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
+        // vector from center of mesh body to contact point, assume this can be held in a float
+        float3 fromCenter;
 
-            node2[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
+        {
+            double3 pt1;  // Contact point on triangle
+            // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
+            double3 sphCntr = int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sphere_pos_local, gran_params));
+            valid_contact = face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID],
+                                           sphCntr, gran_params->sphereRadius_SU, normal, depth, pt1);
 
-            node3[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
+            valid_contact = valid_contact &&
+                            SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
+            pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
 
-            convert_pos_UU2SU<double3>(node1[local_ID], gran_params);
-            convert_pos_UU2SU<double3>(node2[local_ID], gran_params);
-            convert_pos_UU2SU<double3>(node3[local_ID], gran_params);
+            double3 meshCenter_double =
+                make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
+                             mesh_params->fam_frame_narrow[fam].pos[2]);
+            convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
+
+            double3 fromCenter_double = pt1 - meshCenter_double;
+
+            fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
         }
-        local_ID += blockDim.x;
-    }
 
-    __syncthreads();  // this call ensures data is in its place in shared memory
+        // If there is a collision, add an impulse to the sphere
+        if (valid_contact) {
+            // TODO contact models
+            // Use the CD information to compute the force on the grElement
+            float3 delta = -depth * normal;
 
-    float3 sphere_force = {0.f, 0.f, 0.f};
-    float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+            // effective radius is just sphere radius -- assume meshes are locally flat (a safe assumption?)
+            float hertz_force_factor = sqrt(abs(depth) / gran_params->sphereRadius_SU);
 
-    if (sphereIDLocal < spheresTouchingThisSD) {
-        // loop over each triangle in the SD and compute the force this sphere (thread) exerts on it
-        for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
-            /// we have a valid sphere and a valid triganle; check if in contact
-            float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
-            float depth;    // Negative in overlap
-            float3 pt1_float;
-
-            // Transform LRF to GRF
-            const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
-            bool valid_contact = false;
-
-            // vector from center of mesh body to contact point, assume this can be held in a float
-            float3 fromCenter;
-
-            {
-                double3 pt1;  // Contact point on triangle
-                // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
-                double3 sphCntr =
-                    int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sphere_pos_local[sphereIDLocal], gran_params));
-                valid_contact = face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID],
-                                               sphCntr, gran_params->sphereRadius_SU, normal, depth, pt1);
-
-                valid_contact = valid_contact &&
-                                SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
-                pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
-
-                double3 meshCenter_double =
-                    make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
-                                 mesh_params->fam_frame_narrow[fam].pos[2]);
-                convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
-
-                double3 fromCenter_double = pt1 - meshCenter_double;
-
-                fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
+            float3 force_accum = hertz_force_factor * mesh_params->K_n_s2m_SU * delta;
+
+            // Compute force updates for adhesion term, opposite the spring term
+            // NOTE ratio is wrt the weight of a sphere of mass 1
+            // NOTE the cancelation of two negatives
+            force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
+
+            // Velocity difference, it's better to do a coalesced access here than a fragmented access
+            // inside
+            float3 v_rel = sphere_vel - d_triangleSoup->vel[fam];
+
+            // TODO assumes pos is the center of mass of the mesh
+            // TODO can this be float?
+            float3 meshCenter =
+                make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
+                            mesh_params->fam_frame_broad[fam].pos[2]);
+            convert_pos_UU2SU<float3>(meshCenter, gran_params);
+
+            // NOTE depth is negative and normal points from triangle to sphere center
+            float3 r = pt1_float + normal * (depth / 2) - meshCenter;
+
+            // Add angular velocity contribution from mesh
+            v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
+
+            // add tangential components if they exist
+            if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+                // Vector from the center of sphere to center of contact volume
+                float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                v_rel = v_rel + Cross(omega, r_A);
             }
 
-            // If there is a collision, add an impulse to the sphere
-            if (valid_contact) {
-                // TODO contact models
-                // Use the CD information to compute the force on the grElement
-                // normal points from triangle to sphere
-                float3 delta = -depth * normal;
-
-                // effective radius is just sphere radius -- assume meshes are locally flat (a safe assumption?)
-                // float hertz_force_factor = sqrt(abs(depth) / gran_params->sphereRadius_SU);
-
-                // helper variables
-                float sqrt_Rd = sqrt(abs(depth) * gran_params->sphereRadius_SU);
-                float Sn = 2. * mesh_params->E_eff_s2m_SU * sqrt_Rd;
-
-                float loge = (mesh_params->COR_s2m_SU < EPSILON) ? log(EPSILON) : log(mesh_params->COR_s2m_SU);
-                float beta = loge / sqrt(loge * loge + CUDART_PI_F * CUDART_PI_F);
-
-                // effective mass = mass_mesh * mass_sphere / (m_mesh + mass_sphere)
-                float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
-                const float sphere_mass_SU = gran_params->sphere_mass_SU;
-                float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
-
-                // stiffness and damping coefficient
-                float kn = (2.0 / 3.0) * Sn;
-                float gn = 2 * sqrt(5.0 / 6.0) * beta * sqrt(Sn * m_eff);
-                // relative velocity = v_sphere - v_mesh
-                float3 v_rel = sphere_vel[sphereIDLocal] - d_triangleSoup->vel[fam];
-
-                // assumes pos is the center of mass of the mesh
-                float3 meshCenter =
-                    make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
-                                mesh_params->fam_frame_broad[fam].pos[2]);
-                convert_pos_UU2SU<float3>(meshCenter, gran_params);
-
-                // NOTE depth is negative and normal points from triangle to sphere center
-                float3 r = pt1_float + normal * (depth / 2) - meshCenter;
-
-                // Add angular velocity contribution from mesh
-                v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
-
-                // add tangential components if they exist
-                if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-                    // Vector from the center of sphere to center of contact volume
-                    float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
-                    v_rel = v_rel + Cross(omega[sphereIDLocal], r_A);
-                }
-
-                // normal component of relative velocity
-                float projection = Dot(v_rel, normal);
-
-                // tangential component of relative velocity
-                float3 vrel_t = v_rel - projection * normal;
-
-                // normal force magnitude
-                float forceN_mag = -kn * depth + gn * projection;
-
-                float3 force_accum = forceN_mag * normal;
-
-                // Compute force updates for adhesion term, opposite the spring term
-                // NOTE ratio is wrt the weight of a sphere of mass 1
-                // NOTE the cancelation of two negatives
-                force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
-
-                // tangential component
-                if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-                    // radius pointing from the contact point to the center of particle
-                    float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
-                    float3 roll_ang_acc = computeRollingAngAcc(
-                        sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU, mesh_params->spinning_coeff_s2m_SU,
-                        force_accum, omega[sphereIDLocal], d_triangleSoup->omega[fam], Rc);
-
-                    sphere_AngAcc = sphere_AngAcc + roll_ang_acc;
-
-                    unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
-
-                    // compute tangent force
-                    float3 tangent_force = computeFrictionForces_matBased(
-                        gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
-                        mesh_params->static_friction_coeff_s2m, mesh_params->E_eff_s2m_SU, mesh_params->G_eff_s2m_SU,
-                        sqrt_Rd, beta, force_accum, vrel_t, normal, m_eff);
-
-                    ////float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT /
-                    ////                   (gran_params->TIME_UNIT * gran_params->TIME_UNIT);
-
-                    ////float velocity_unit = gran_params->LENGTH_UNIT / gran_params->TIME_UNIT;
-
-                    force_accum = force_accum + tangent_force;
-                    sphere_AngAcc =
-                        sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
-                }
-
-                // Use the CD information to compute the force and torque on the family of this triangle
-                sphere_force = sphere_force + force_accum;
-
-                // Force on the mesh is opposite the force on the sphere
-                float3 force_total = -1.f * force_accum;
-
-                float3 torque = Cross(fromCenter, force_total);
-                // TODO we could be much smarter about reducing this atomic write
-                unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
-
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
+            // Force accumulator on sphere for this sphere-triangle collision
+            // Compute force updates for normal spring term
+
+            // Compute force updates for damping term
+            // NOTE assumes sphere mass of 1
+            float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
+            const float sphere_mass_SU = gran_params->sphere_mass_SU;
+            float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
+            float3 vrel_n = Dot(v_rel, normal) * normal;
+            v_rel = v_rel - vrel_n;  // v_rel is now tangential relative velocity
+
+            // Add normal damping term
+            force_accum = force_accum - hertz_force_factor * mesh_params->Gamma_n_s2m_SU * m_eff * vrel_n;
+
+            if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+                // radius pointing from the contact point to the center of particle
+                float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
+                float3 roll_ang_acc = computeRollingAngAcc(
+                    sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU, mesh_params->spinning_coeff_s2m_SU,
+                    force_accum, omega, d_triangleSoup->omega[fam], Rc);
+
+                sphere_AngAcc = sphere_AngAcc + roll_ang_acc;
+
+                unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
+
+                // compute tangent force
+                float3 tangent_force = computeFrictionForces(
+                    gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
+                    mesh_params->static_friction_coeff_s2m, mesh_params->K_t_s2m_SU, mesh_params->Gamma_t_s2m_SU,
+                    hertz_force_factor, m_eff, force_accum, v_rel, normal);
+
+                ////float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT /
+                ////                   (gran_params->TIME_UNIT * gran_params->TIME_UNIT);
+
+                ////float velocity_unit = gran_params->LENGTH_UNIT / gran_params->TIME_UNIT;
+
+                force_accum = force_accum + tangent_force;
+                sphere_AngAcc =
+                    sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
             }
-        }  // end of per-triangle loop
-        // write back sphere forces
-        atomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
-
-        if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            // write back torques for later
-            atomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
-            atomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
-            atomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+
+            // Use the CD information to compute the force and torque on the family of this triangle
+            sphere_force = sphere_force + force_accum;
+
+            // Force on the mesh is opposite the force on the sphere
+            float3 force_total = -1.f * force_accum;
+
+            float3 torque = Cross(fromCenter, force_total);
+            // TODO we could be much smarter about reducing this atomic write
+            unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
+
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
+            chgpuAtomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
         }
-    }  // end sphere id check
-}  // end kernel
+    }  // end of per-triangle loop
+    // write back sphere forces
+    chgpuAtomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
+    chgpuAtomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
+    chgpuAtomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
+
+    if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
+        // write back torques for later
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
+        chgpuAtomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
+    }
+}
 
 /// <summary>
 /// Kernel accounts for the interaction between the granular material and the triangles making up the triangle soup
@@ -444,13 +654,6 @@ __global__ void interactionGranMat_TriangleSoup(ChSystemGpuMesh_impl::TriangleSo
                                                 unsigned int triangleFamilyHistmapOffset) {
     __shared__ unsigned int triangleIDs[MAX_TRIANGLE_COUNT_PER_SD];  //!< global ID of the triangles touching this SD
 
-    __shared__ int3 sphere_pos_local[MAX_COUNT_OF_SPHERES_PER_SD];  //!< local coordinate of the sphere
-
-    __shared__ float3 sphere_vel[MAX_COUNT_OF_SPHERES_PER_SD];
-
-    // TODO figure out how we can do this better with no friction
-    __shared__ float3 omega[MAX_COUNT_OF_SPHERES_PER_SD];
-
     __shared__ double3 node1[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 1st node of the triangle
     __shared__ double3 node2[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 2nd node of the triangle
     __shared__ double3 node3[MAX_TRIANGLE_COUNT_PER_SD];  //!< Coordinates of the 3rd node of the triangle
@@ -469,229 +672,32 @@ __global__ void interactionGranMat_TriangleSoup(ChSystemGpuMesh_impl::TriangleSo
     // Getting here means that there are both triangles and DEs in this SD.
     unsigned int numSDTriangles = SD_numTrianglesTouching[thisSD];
     unsigned int sphereIDLocal = threadIdx.x;
-    unsigned int sphereIDGlobal = NULL_CHGPU_ID;
-
-    // Bring in data from global into shmem. Only a subset of threads get to do this.
-    // Note that we're not using shared memory very heavily, so our bandwidth is pretty low
-    if (sphereIDLocal < spheresTouchingThisSD) {
-        size_t SD_composite_offset = sphere_data->SD_SphereCompositeOffsets[thisSD];
 
-        // TODO standardize this
-        size_t offset_in_composite_Array = SD_composite_offset + sphereIDLocal;
-        sphereIDGlobal = sphere_data->spheres_in_SD_composite[offset_in_composite_Array];
-
-        sphere_pos_local[sphereIDLocal] =
-            make_int3(sphere_data->sphere_local_pos_X[sphereIDGlobal], sphere_data->sphere_local_pos_Y[sphereIDGlobal],
-                      sphere_data->sphere_local_pos_Z[sphereIDGlobal]);
-
-        unsigned int sphere_owner_SD = sphere_data->sphere_owner_SDs[sphereIDGlobal];
-        // if this SD doesn't own that sphere, add an offset to account
-        if (sphere_owner_SD != thisSD) {
-            sphere_pos_local[sphereIDLocal] =
-                sphere_pos_local[sphereIDLocal] + getOffsetFromSDs(thisSD, sphere_owner_SD, gran_params);
-        }
-
-        if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            omega[sphereIDLocal] =
-                make_float3(sphere_data->sphere_Omega_X[sphereIDGlobal], sphere_data->sphere_Omega_Y[sphereIDGlobal],
-                            sphere_data->sphere_Omega_Z[sphereIDGlobal]);
-        }
-        sphere_vel[sphereIDLocal] =
-            make_float3(sphere_data->pos_X_dt[sphereIDGlobal], sphere_data->pos_Y_dt[sphereIDGlobal],
-                        sphere_data->pos_Z_dt[sphereIDGlobal]);
-    }
     // Populate the shared memory with mesh triangle data
     unsigned int tripsToCoverTriangles = (numSDTriangles + blockDim.x - 1) / blockDim.x;
     unsigned int local_ID = threadIdx.x;
     for (unsigned int triangTrip = 0; triangTrip < tripsToCoverTriangles; triangTrip++) {
         if (local_ID < numSDTriangles) {
-            size_t SD_composite_offset = SD_TrianglesCompositeOffsets[thisSD];
-            if (SD_composite_offset == NULL_CHGPU_ID) {
-                ABORTABORTABORT("Invalid composite offset %lu for SD %u, touching %u triangles\n", NULL_CHGPU_ID,
-                                thisSD, numSDTriangles);
-            }
-            size_t offset_in_composite_Array = SD_composite_offset + local_ID;
-
-            unsigned int globalID = SD_trianglesInEachSD_composite[offset_in_composite_Array];
-            triangleIDs[local_ID] = globalID;
-
-            // Read node positions from global memory into shared memory
-            // NOTE implicit cast from float to double here
-            unsigned int fam = d_triangleSoup->triangleFamily_ID[globalID];
-            node1[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node1[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
-
-            node2[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node2[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
-
-            node3[local_ID] = apply_frame_transform<double, float3, double3>(
-                d_triangleSoup->node3[globalID], mesh_params->fam_frame_narrow[fam].pos,
-                mesh_params->fam_frame_narrow[fam].rot_mat);
-
-            convert_pos_UU2SU<double3>(node1[local_ID], gran_params);
-            convert_pos_UU2SU<double3>(node2[local_ID], gran_params);
-            convert_pos_UU2SU<double3>(node3[local_ID], gran_params);
+            loadTriangleInSD(local_ID, thisSD, numSDTriangles, d_triangleSoup, SD_trianglesInEachSD_composite,
+                             SD_TrianglesCompositeOffsets, gran_params, mesh_params, triangleIDs, node1, node2, node3);
         }
         local_ID += blockDim.x;
     }
 
     __syncthreads();  // this call ensures data is in its place in shared memory
 
-    float3 sphere_force = {0.f, 0.f, 0.f};
-    float3 sphere_AngAcc = {0.f, 0.f, 0.f};
+    // each thread is a sphere, computing the forces exerted on it by the triangles in this SD
     if (sphereIDLocal < spheresTouchingThisSD) {
-        // loop over each triangle in the SD and compute the force this sphere (thread) exerts on it
-        for (unsigned int triangleLocalID = 0; triangleLocalID < numSDTriangles; triangleLocalID++) {
-            /// we have a valid sphere and a valid triganle; check if in contact
-            float3 normal;  // Unit normal from pt2 to pt1 (triangle contact point to sphere contact point)
-            float depth;    // Negative in overlap
-            float3 pt1_float;
-
-            // Transform LRF to GRF
-            const unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
-            bool valid_contact = false;
-
-            // vector from center of mesh body to contact point, assume this can be held in a float
-            float3 fromCenter;
-
-            {
-                double3 pt1;  // Contact point on triangle
-                // NOTE sphere_pos_local is relative to THIS SD, not its owner SD
-                double3 sphCntr =
-                    int64_t3_to_double3(convertPosLocalToGlobal(thisSD, sphere_pos_local[sphereIDLocal], gran_params));
-                valid_contact = face_sphere_cd(node1[triangleLocalID], node2[triangleLocalID], node3[triangleLocalID],
-                                               sphCntr, gran_params->sphereRadius_SU, normal, depth, pt1);
-
-                valid_contact = valid_contact &&
-                                SDTripletID(pointSDTriplet(pt1.x, pt1.y, pt1.z, gran_params), gran_params) == thisSD;
-                pt1_float = make_float3(pt1.x, pt1.y, pt1.z);
-
-                double3 meshCenter_double =
-                    make_double3(mesh_params->fam_frame_narrow[fam].pos[0], mesh_params->fam_frame_narrow[fam].pos[1],
-                                 mesh_params->fam_frame_narrow[fam].pos[2]);
-                convert_pos_UU2SU<double3>(meshCenter_double, gran_params);
-
-                double3 fromCenter_double = pt1 - meshCenter_double;
-
-                fromCenter = make_float3(fromCenter_double.x, fromCenter_double.y, fromCenter_double.z);
-            }
-
-            // If there is a collision, add an impulse to the sphere
-            if (valid_contact) {
-                // TODO contact models
-                // Use the CD information to compute the force on the grElement
-                float3 delta = -depth * normal;
-
-                // effective radius is just sphere radius -- assume meshes are locally flat (a safe assumption?)
-                float hertz_force_factor = sqrt(abs(depth) / gran_params->sphereRadius_SU);
-
-                float3 force_accum = hertz_force_factor * mesh_params->K_n_s2m_SU * delta;
-
-                // Compute force updates for adhesion term, opposite the spring term
-                // NOTE ratio is wrt the weight of a sphere of mass 1
-                // NOTE the cancelation of two negatives
-                force_accum = force_accum + gran_params->sphere_mass_SU * mesh_params->adhesionAcc_s2m * delta / depth;
-
-                // Velocity difference, it's better to do a coalesced access here than a fragmented access
-                // inside
-                float3 v_rel = sphere_vel[sphereIDLocal] - d_triangleSoup->vel[fam];
-
-                // TODO assumes pos is the center of mass of the mesh
-                // TODO can this be float?
-                float3 meshCenter =
-                    make_float3(mesh_params->fam_frame_broad[fam].pos[0], mesh_params->fam_frame_broad[fam].pos[1],
-                                mesh_params->fam_frame_broad[fam].pos[2]);
-                convert_pos_UU2SU<float3>(meshCenter, gran_params);
-
-                // NOTE depth is negative and normal points from triangle to sphere center
-                float3 r = pt1_float + normal * (depth / 2) - meshCenter;
-
-                // Add angular velocity contribution from mesh
-                v_rel = v_rel - Cross(d_triangleSoup->omega[fam], r);
-
-                // add tangential components if they exist
-                if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-                    // Vector from the center of sphere to center of contact volume
-                    float3 r_A = -(gran_params->sphereRadius_SU + depth / 2.f) * normal;
-                    v_rel = v_rel + Cross(omega[sphereIDLocal], r_A);
-                }
-
-                // Force accumulator on sphere for this sphere-triangle collision
-                // Compute force updates for normal spring term
-
-                // Compute force updates for damping term
-                // NOTE assumes sphere mass of 1
-                float fam_mass_SU = d_triangleSoup->familyMass_SU[fam];
-                const float sphere_mass_SU = gran_params->sphere_mass_SU;
-                float m_eff = sphere_mass_SU * fam_mass_SU / (sphere_mass_SU + fam_mass_SU);
-                float3 vrel_n = Dot(v_rel, normal) * normal;
-                v_rel = v_rel - vrel_n;  // v_rel is now tangential relative velocity
-
-                // Add normal damping term
-                force_accum = force_accum - hertz_force_factor * mesh_params->Gamma_n_s2m_SU * m_eff * vrel_n;
-
-                if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-                    // radius pointing from the contact point to the center of particle
-                    float3 Rc = (gran_params->sphereRadius_SU + depth / 2.f) * normal;
-                    float3 roll_ang_acc = computeRollingAngAcc(
-                        sphere_data, gran_params, mesh_params->rolling_coeff_s2m_SU, mesh_params->spinning_coeff_s2m_SU,
-                        force_accum, omega[sphereIDLocal], d_triangleSoup->omega[fam], Rc);
-
-                    sphere_AngAcc = sphere_AngAcc + roll_ang_acc;
-
-                    unsigned int BC_histmap_label = triangleFamilyHistmapOffset + fam;
-
-                    // compute tangent force
-                    float3 tangent_force = computeFrictionForces(
-                        gran_params, sphere_data, sphereIDGlobal, BC_histmap_label,
-                        mesh_params->static_friction_coeff_s2m, mesh_params->K_t_s2m_SU, mesh_params->Gamma_t_s2m_SU,
-                        hertz_force_factor, m_eff, force_accum, v_rel, normal);
-
-                    ////float force_unit = gran_params->MASS_UNIT * gran_params->LENGTH_UNIT /
-                    ////                   (gran_params->TIME_UNIT * gran_params->TIME_UNIT);
-
-                    ////float velocity_unit = gran_params->LENGTH_UNIT / gran_params->TIME_UNIT;
-
-                    force_accum = force_accum + tangent_force;
-                    sphere_AngAcc =
-                        sphere_AngAcc + Cross(-1.f * normal, tangent_force) / gran_params->sphereInertia_by_r;
-                }
-
-                // Use the CD information to compute the force and torque on the family of this triangle
-                sphere_force = sphere_force + force_accum;
-
-                // Force on the mesh is opposite the force on the sphere
-                float3 force_total = -1.f * force_accum;
-
-                float3 torque = Cross(fromCenter, force_total);
-                // TODO we could be much smarter about reducing this atomic write
-                unsigned int fam = d_triangleSoup->triangleFamily_ID[triangleIDs[triangleLocalID]];
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 0, force_total.x);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 1, force_total.y);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 2, force_total.z);
-
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 3, torque.x);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 4, torque.y);
-                atomicAdd(d_triangleSoup->generalizedForcesPerFamily + fam * 6 + 5, torque.z);
-            }
-        }  // end of per-triangle loop
-        // write back sphere forces
-        atomicAdd(sphere_data->sphere_acc_X + sphereIDGlobal, sphere_force.x / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Y + sphereIDGlobal, sphere_force.y / gran_params->sphere_mass_SU);
-        atomicAdd(sphere_data->sphere_acc_Z + sphereIDGlobal, sphere_force.z / gran_params->sphere_mass_SU);
-
-        if (gran_params->friction_mode != chrono::gpu::CHGPU_FRICTION_MODE::FRICTIONLESS) {
-            // write back torques for later
-            atomicAdd(sphere_data->sphere_ang_acc_X + sphereIDGlobal, sphere_AngAcc.x);
-            atomicAdd(sphere_data->sphere_ang_acc_Y + sphereIDGlobal, sphere_AngAcc.y);
-            atomicAdd(sphere_data->sphere_ang_acc_Z + sphereIDGlobal, sphere_AngAcc.z);
-        }
-    }  // end sphere id check
+        f_interactionGranMat_TriangleSoup(sphereIDLocal, thisSD, numSDTriangles, triangleIDs, node1, node2, node3,
+                                          d_triangleSoup, sphere_data, gran_params, mesh_params,
+                                          triangleFamilyHistmapOffset);
+    }
 }  // end kernel
 
 __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
+    if (backend == CHGPU_BACKEND::CPU)
+        return AdvanceSimulation_cpu(duration);
+
     // Figure our the number of blocks that need to be launched to cover the box
     unsigned int nBlocks = (nSpheres + CUDA_THREADS_PER_BLOCK - 1) / CUDA_THREADS_PER_BLOCK;
 
@@ -813,5 +819,140 @@ __host__ double ChSystemGpuMesh_impl::AdvanceSimulation(float duration) {
 
     return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
 }
+
+// -----------------------------------------------------------------------------
+// CPU backend
+// -----------------------------------------------------------------------------
+
+__host__ void ChSystemGpuMesh_impl::runTriangleBroadphase_cpu() {
+    METRICS_PRINTF("Resetting broadphase info!\n");
+
+    unsigned int numTriangles = meshSoup->nTrianglesInSoup;
+
+    // Count the SDs touched by each triangle
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)numTriangles; i++)
+        Triangle_NumSDsTouching[i] = triangle_countTouchedSDs(i, meshSoup, gran_params, tri_params);
+
+    // Exclusive prefix scan to get the offsets in the list of SDs touched by each triangle
+    unsigned int numOfTriangleTouchingSD_instances = 0;
+    for (unsigned int i = 0; i < numTriangles; i++) {
+        Triangle_SDsCompositeOffsets[i] = numOfTriangleTouchingSD_instances;
+        numOfTriangleTouchingSD_instances += Triangle_NumSDsTouching[i];
+    }
+
+    // List the SDs touched by each triangle, triangle by triangle
+    SDsTouchedByEachTriangle_composite.assign(numOfTriangleTouchingSD_instances, NULL_CHGPU_ID);
+#pragma omp parallel for num_threads(num_threads)
+    for (int i = 0; i < (int)numTriangles; i++) {
+        triangle_figureOutTouchedSDs(i, meshSoup,
+                                     SDsTouchedByEachTriangle_composite.data() + Triangle_SDsCompositeOffsets[i],
+                                     gran_params, tri_params);
+    }
+
+    // Count the triangles touching each SD and check that no SD has over the max amount of triangles
+    std::fill(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.end(), 0);
+    for (unsigned int i = 0; i < numOfTriangleTouchingSD_instances; i++) {
+        unsigned int SD = SDsTouchedByEachTriangle_composite[i];
+        if (SD != NULL_CHGPU_ID)
+            SD_numTrianglesTouching[SD]++;
+    }
+    unsigned int maxTriCount = *std::max_element(SD_numTrianglesTouching.begin(), SD_numTrianglesTouching.end());
+    if (maxTriCount > MAX_TRIANGLE_COUNT_PER_SD)
+        CHGPU_ERROR("ERROR! %u triangles are found in one of the SDs! The max allowance is %u.\n", maxTriCount,
+                    MAX_TRIANGLE_COUNT_PER_SD);
+
+    // Offsets in the composite array of triangles touching each SD
+    unsigned int num_entries = 0;
+    for (unsigned int SD = 0; SD < nSDs; SD++) {
+        SD_TrianglesCompositeOffsets[SD] = num_entries;
+        num_entries += SD_numTrianglesTouching[SD];
+    }
+
+    // Flip the list of SDs touched by each triangle into the list of triangles touching each SD. Triangles are visited
+    // in increasing order of their IDs, which gives the same ordering as the key-value sort of the CUDA path.
+    SD_trianglesInEachSD_composite.resize(num_entries);
+    std::vector<unsigned int> SD_cursor(SD_TrianglesCompositeOffsets.begin(), SD_TrianglesCompositeOffsets.end());
+    for (unsigned int i = 0; i < numTriangles; i++) {
+        for (unsigned int k = 0; k < Triangle_NumSDsTouching[i]; k++) {
+            unsigned int SD = SDsTouchedByEachTriangle_composite[Triangle_SDsCompositeOffsets[i] + k];
+            if (SD != NULL_CHGPU_ID)
+                SD_trianglesInEachSD_composite[SD_cursor[SD]++] = i;
+        }
+    }
+}
+
+__host__ void ChSystemGpuMesh_impl::interactionGranMat_TriangleSoup_cpu() {
+    // triangle labels come after BC labels numerically
+    unsigned int triangleFamilyHistmapOffset = gran_params->nSpheres + 1 + (unsigned int)BC_params_list_SU.size() + 1;
+
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int sd = 0; sd < (int)nSDs; sd++) {
+        unsigned int numSDTriangles = SD_numTrianglesTouching[sd];
+        unsigned int spheresTouchingThisSD = sphere_data->SD_NumSpheresTouching[sd];
+        if (numSDTriangles == 0 || spheresTouchingThisSD == 0)
+            continue;
+
+        unsigned int triangleIDs[MAX_TRIANGLE_COUNT_PER_SD];
+        double3 node1[MAX_TRIANGLE_COUNT_PER_SD];
+        double3 node2[MAX_TRIANGLE_COUNT_PER_SD];
+        double3 node3[MAX_TRIANGLE_COUNT_PER_SD];
+        for (unsigned int local_ID = 0; local_ID < numSDTriangles; local_ID++) {
+            loadTriangleInSD(local_ID, sd, numSDTriangles, meshSoup, SD_trianglesInEachSD_composite.data(),
+                             SD_TrianglesCompositeOffsets.data(), gran_params, tri_params, triangleIDs, node1, node2,
+                             node3);
+        }
+
+        for (unsigned int sphereIDLocal = 0; sphereIDLocal < spheresTouchingThisSD; sphereIDLocal++) {
+            if (tri_params->use_mat_based) {
+                f_interactionGranMat_TriangleSoup_matBased(sphereIDLocal, sd, numSDTriangles, triangleIDs, node1,
+                                                           node2, node3, meshSoup, sphere_data, gran_params,
+                                                           tri_params, triangleFamilyHistmapOffset);
+            } else {
+                f_interactionGranMat_TriangleSoup(sphereIDLocal, sd, numSDTriangles, triangleIDs, node1, node2, node3,
+                                                  meshSoup, sphere_data, gran_params, tri_params,
+                                                  triangleFamilyHistmapOffset);
+            }
+        }
+    }
+}
+
+__host__ double ChSystemGpuMesh_impl::AdvanceSimulation_cpu(float duration) {
+    float duration_SU = (float)(duration / TIME_SU2UU);
+    unsigned int nsteps = (unsigned int)std::round(duration_SU / stepSize_SU);
+
+    packSphereDataPointers();
+
+    METRICS_PRINTF("advancing by %f at timestep %f, %u timesteps at approx user timestep %f\n", duration_SU,
+                   stepSize_SU, nsteps, duration / nsteps);
+
+    bool mesh_active = meshSoup->nTrianglesInSoup != 0 && mesh_collision_enabled;
+
+    float time_elapsed_SU = 0.f;  // time elapsed in this call (SU)
+    for (; time_elapsed_SU < stepSize_SU * nsteps; time_elapsed_SU += stepSize_SU) {
+        updateBCPositions();
+        runSphereBroadphase_cpu();
+
+        resetSphereAccelerations();
+        resetBCForces();
+        if (mesh_active) {
+            std::fill(meshSoup->generalizedForcesPerFamily,
+                      meshSoup->generalizedForcesPerFamily + 6 * meshSoup->numTriangleFamilies, 0.f);
+            runTriangleBroadphase_cpu();
+        }
+
+        computeSphereForces_cpu(gran_params->use_mat_based);
+
+        if (meshSoup->numTriangleFamilies != 0 && mesh_collision_enabled)
+            interactionGranMat_TriangleSoup_cpu();
+
+        integrateSpheres_cpu();
+
+        elapsedSimTime += (float)(stepSize_SU * TIME_SU2UU);  // Advance current time
+    }
+
+    return time_elapsed_SU * TIME_SU2UU;  // return elapsed UU time
+}
+
 }  // namespace gpu
 }  // namespace chrono
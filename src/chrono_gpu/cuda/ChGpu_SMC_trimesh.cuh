@@ -39,7 +39,7 @@ static const int SAFETY_PARAM = 1000;
 /// LRF: local reference frame
 /// GRF: global reference frame
 template <class IN_T, class IN_T3, class OUT_T3 = IN_T3>
-__device__ OUT_T3 apply_frame_transform(const IN_T3& point, const IN_T* pos, const IN_T* rot_mat) {
+__host__ __device__ OUT_T3 apply_frame_transform(const IN_T3& point, const IN_T* pos, const IN_T* rot_mat) {
     OUT_T3 result;
 
     // Apply rotation matrix to point
@@ -57,19 +57,19 @@ __device__ OUT_T3 apply_frame_transform(const IN_T3& point, const IN_T* pos, con
 
 /// Convert position vector from user units to scaled units.
 template <class T3>
-__device__ void convert_pos_UU2SU(T3& pos, ChSystemGpu_impl::GranParamsPtr gran_params) {
+__host__ __device__ void convert_pos_UU2SU(T3& pos, ChSystemGpu_impl::GranParamsPtr gran_params) {
     pos.x /= gran_params->LENGTH_UNIT;
     pos.y /= gran_params->LENGTH_UNIT;
     pos.z /= gran_params->LENGTH_UNIT;
 }
 
 /// Takes in a triangle ID and figures out an SD AABB for broadphase use
-__inline__ __device__ void triangle_figureOutSDBox(const float3& vA,
-                                                   const float3& vB,
-                                                   const float3& vC,
-                                                   int* L,
-                                                   int* U,
-                                                   ChSystemGpu_impl::GranParamsPtr gran_params) {
+__inline__ __host__ __device__ void triangle_figureOutSDBox(const float3& vA,
+                                                            const float3& vB,
+                                                            const float3& vC,
+                                                            int* L,
+                                                            int* U,
+                                                            ChSystemGpu_impl::GranParamsPtr gran_params) {
     int64_t min_pt_x = MIN(vA.x, MIN(vB.x, vC.x));
     int64_t min_pt_y = MIN(vA.y, MIN(vB.y, vC.y));
     int64_t min_pt_z = MIN(vA.z, MIN(vB.z, vC.z));
@@ -101,10 +101,11 @@ __inline__ __device__ void triangle_figureOutSDBox(const float3& vA,
 /// Takes in a triangle's position in UU and finds out how many SDs it touches.
 /// Triangle broadphase is done in float by applying the frame transform
 /// and then converting the GRF position to SU
-inline __device__ unsigned int triangle_countTouchedSDs(unsigned int triangleID,
-                                                        const ChSystemGpuMesh_impl::TriangleSoupPtr triangleSoup,
-                                                        ChSystemGpu_impl::GranParamsPtr gran_params,
-                                                        ChSystemGpuMesh_impl::MeshParamsPtr tri_params) {
+inline __host__ __device__ unsigned int triangle_countTouchedSDs(
+    unsigned int triangleID,
+    const ChSystemGpuMesh_impl::TriangleSoupPtr triangleSoup,
+    ChSystemGpu_impl::GranParamsPtr gran_params,
+    ChSystemGpuMesh_impl::MeshParamsPtr tri_params) {
     float3 vA, vB, vC;
 
     // Transform LRF to GRF
@@ -192,11 +193,11 @@ inline __device__ unsigned int triangle_countTouchedSDs(unsigned int triangleID,
 /// Takes in a triangle's position in UU and finds out what SDs it touches.
 /// Triangle broadphase is done in float by applying the frame transform
 /// and then converting the GRF position to SU
-inline __device__ void triangle_figureOutTouchedSDs(unsigned int triangleID,
-                                                    const ChSystemGpuMesh_impl::TriangleSoupPtr triangleSoup,
-                                                    unsigned int* touchedSDs,
-                                                    const ChSystemGpu_impl::GranParamsPtr& gran_params,
-                                                    const ChSystemGpuMesh_impl::MeshParamsPtr& tri_params) {
+inline __host__ __device__ void triangle_figureOutTouchedSDs(unsigned int triangleID,
+                                                             const ChSystemGpuMesh_impl::TriangleSoupPtr triangleSoup,
+                                                             unsigned int* touchedSDs,
+                                                             const ChSystemGpu_impl::GranParamsPtr& gran_params,
+                                                             const ChSystemGpuMesh_impl::MeshParamsPtr& tri_params) {
     float3 vA, vB, vC;
 
     // Transform LRF to GRF
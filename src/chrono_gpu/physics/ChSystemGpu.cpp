@@ -319,6 +319,14 @@ void ChSystemGpu::SetVerbosity(CHGPU_VERBOSITY level) {
     m_sys->verbosity = level;
 }
 
+void ChSystemGpu::SetBackend(CHGPU_BACKEND backend) {
+    m_sys->backend = backend;
+}
+
+void ChSystemGpu::SetNumThreads(int num_threads) {
+    m_sys->num_threads = num_threads;
+}
+
 void ChSystemGpuMesh::SetMeshVerbosity(CHGPU_MESH_VERBOSITY level) {
     mesh_verbosity = level;
 }
@@ -559,12 +567,11 @@ void ChSystemGpuMesh::SetMeshes() {
     pMeshSoup->nTrianglesInSoup = nTriangles;
     if (nTriangles != 0) {
         // Allocate all of the requisite pointers
-        gpuErrchk(
-            cudaMallocManaged(&pMeshSoup->triangleFamily_ID, nTriangles * sizeof(unsigned int), cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->triangleFamily_ID, nTriangles * sizeof(unsigned int)));
 
-        gpuErrchk(cudaMallocManaged(&pMeshSoup->node1, nTriangles * sizeof(float3), cudaMemAttachGlobal));
-        gpuErrchk(cudaMallocManaged(&pMeshSoup->node2, nTriangles * sizeof(float3), cudaMemAttachGlobal));
-        gpuErrchk(cudaMallocManaged(&pMeshSoup->node3, nTriangles * sizeof(float3), cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->node1, nTriangles * sizeof(float3)));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->node2, nTriangles * sizeof(float3)));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->node3, nTriangles * sizeof(float3)));
     }
 
     MESH_INFO_PRINTF("Done allocating nodes for %d triangles\n", nTriangles);
@@ -609,28 +616,24 @@ void ChSystemGpuMesh::SetMeshes() {
     pMeshSoup->numTriangleFamilies = family;
 
     if (pMeshSoup->nTrianglesInSoup != 0) {
-        gpuErrchk(cudaMallocManaged(&pMeshSoup->familyMass_SU, family * sizeof(float), cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->familyMass_SU, family * sizeof(float)));
 
         for (unsigned int i = 0; i < family; i++) {
             // NOTE The SU conversion is done in initialize after the scaling is determined
             pMeshSoup->familyMass_SU[i] = m_mesh_masses[i];
         }
 
-        gpuErrchk(cudaMallocManaged(&pMeshSoup->generalizedForcesPerFamily,
-                                    6 * pMeshSoup->numTriangleFamilies * sizeof(float), cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->generalizedForcesPerFamily,
+                                     6 * pMeshSoup->numTriangleFamilies * sizeof(float)));
         // Allocate memory for the float and double frames
-        gpuErrchk(cudaMallocManaged(&sys_trimesh->getTriParams()->fam_frame_broad,
-                                    pMeshSoup->numTriangleFamilies * sizeof(ChSystemGpuMesh_impl::MeshFrame<float>),
-                                    cudaMemAttachGlobal));
-        gpuErrchk(cudaMallocManaged(&sys_trimesh->getTriParams()->fam_frame_narrow,
-                                    pMeshSoup->numTriangleFamilies * sizeof(ChSystemGpuMesh_impl::MeshFrame<double>),
-                                    cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&sys_trimesh->getTriParams()->fam_frame_broad,
+                                     pMeshSoup->numTriangleFamilies * sizeof(ChSystemGpuMesh_impl::MeshFrame<float>)));
+        gpuErrchk(chgpuMallocManaged(&sys_trimesh->getTriParams()->fam_frame_narrow,
+                                     pMeshSoup->numTriangleFamilies * sizeof(ChSystemGpuMesh_impl::MeshFrame<double>)));
 
         // Allocate memory for linear and angular velocity
-        gpuErrchk(
-            cudaMallocManaged(&pMeshSoup->vel, pMeshSoup->numTriangleFamilies * sizeof(float3), cudaMemAttachGlobal));
-        gpuErrchk(
-            cudaMallocManaged(&pMeshSoup->omega, pMeshSoup->numTriangleFamilies * sizeof(float3), cudaMemAttachGlobal));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->vel, pMeshSoup->numTriangleFamilies * sizeof(float3)));
+        gpuErrchk(chgpuMallocManaged(&pMeshSoup->omega, pMeshSoup->numTriangleFamilies * sizeof(float3)));
 
         for (unsigned int i = 0; i < family; i++) {
             pMeshSoup->vel[i] = make_float3(0, 0, 0);
@@ -182,6 +182,14 @@ class CH_GPU_API ChSystemGpu {
     /// Set simualtion verbosity level.
     void SetVerbosity(CHGPU_VERBOSITY level);
 
+    /// Set the execution backend (default: CHGPU_BACKEND::CUDA).
+    /// With CHGPU_BACKEND::CPU, the solver runs with OpenMP on the host and does not require a CUDA device.
+    /// Must be called before Initialize().
+    void SetBackend(CHGPU_BACKEND backend);
+
+    /// Set the number of OpenMP threads used by the CPU backend (default: number of available processors).
+    void SetNumThreads(int num_threads);
+
     /// Create an axis-aligned sphere boundary condition.
     size_t CreateBCSphere(const ChVector3f& center, float radius, bool outward_normal, bool track_forces, float mass);
 
@@ -43,10 +43,10 @@ ChSystemGpuMesh_impl::ChSystemGpuMesh_impl(float sphere_rad, float density, floa
       spinning_coeff_s2m_UU(0),
       adhesion_s2m_over_gravity(0) {
     // Allocate triangle collision parameters
-    gpuErrchk(cudaMallocManaged(&tri_params, sizeof(MeshParams), cudaMemAttachGlobal));
+    gpuErrchk(chgpuMallocManaged(&tri_params, sizeof(MeshParams)));
 
     // Allocate the device soup storage
-    gpuErrchk(cudaMallocManaged(&meshSoup, sizeof(TriangleSoup), cudaMemAttachGlobal));
+    gpuErrchk(chgpuMallocManaged(&meshSoup, sizeof(TriangleSoup)));
     // start with no triangles
     meshSoup->nTrianglesInSoup = 0;
     meshSoup->numTriangleFamilies = 0;
@@ -161,21 +161,21 @@ void ChSystemGpuMesh_impl::ApplyFrameTransform(float3& p, float* pos, float* rot
 }
 
 void ChSystemGpuMesh_impl::cleanupTriMesh() {
-    cudaFree(meshSoup->triangleFamily_ID);
-    cudaFree(meshSoup->familyMass_SU);
+    chgpuFree(meshSoup->triangleFamily_ID);
+    chgpuFree(meshSoup->familyMass_SU);
 
-    cudaFree(meshSoup->node1);
-    cudaFree(meshSoup->node2);
-    cudaFree(meshSoup->node3);
+    chgpuFree(meshSoup->node1);
+    chgpuFree(meshSoup->node2);
+    chgpuFree(meshSoup->node3);
 
-    cudaFree(meshSoup->vel);
-    cudaFree(meshSoup->omega);
+    chgpuFree(meshSoup->vel);
+    chgpuFree(meshSoup->omega);
 
-    cudaFree(meshSoup->generalizedForcesPerFamily);
-    cudaFree(tri_params->fam_frame_broad);
-    cudaFree(tri_params->fam_frame_narrow);
-    cudaFree(meshSoup);
-    cudaFree(tri_params);
+    chgpuFree(meshSoup->generalizedForcesPerFamily);
+    chgpuFree(tri_params->fam_frame_broad);
+    chgpuFree(tri_params->fam_frame_narrow);
+    chgpuFree(meshSoup);
+    chgpuFree(tri_params);
 }
 
 void ChSystemGpuMesh_impl::ApplyMeshMotion(unsigned int mesh_id,
@@ -142,6 +142,12 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// Broadphase CD for triangles
     void runTriangleBroadphase();
 
+    /// Broadphase CD for triangles with the CPU backend
+    void runTriangleBroadphase_cpu();
+
+    /// Compute sphere-triangle forces with the CPU backend
+    void interactionGranMat_TriangleSoup_cpu();
+
     virtual double get_max_K() const override;
 
     template <typename T>
@@ -153,6 +159,9 @@ class ChSystemGpuMesh_impl : public ChSystemGpu_impl {
     /// Requires initialize() to have been called.
     virtual double AdvanceSimulation(float duration) override;
 
+    /// Advance simulation by duration in user units with the CPU backend, return actual duration elapsed
+    double AdvanceSimulation_cpu(float duration);
+
     /// Set of simulation parameters related to triangle data
     MeshParams* tri_params;
 
@@ -21,6 +21,7 @@
 
 #include "chrono/utils/ChUtilsGenerators.h"
 #include "chrono/core/ChVector3.h"
+#include "chrono/utils/ChOpenMP.h"
 
 #include "chrono_gpu/physics/ChSystemGpu_impl.h"
 #include "chrono_gpu/physics/ChGpuBoundaryConditions.h"
@@ -52,6 +53,8 @@ ChSystemGpu_impl::ChSystemGpu_impl(float sphere_rad, float density, float3 boxDi
       nSpheres(0),
       elapsedSimTime(0.f),
       verbosity(CHGPU_VERBOSITY::INFO),
+      backend(CHGPU_BACKEND::CUDA),
+      num_threads(ChOMP::GetNumProcs()),
       use_min_length_unit(true),
       defragment_on_start(true),
       file_write_mode(CHGPU_OUTPUT_MODE::CSV),
@@ -79,8 +82,8 @@ ChSystemGpu_impl::ChSystemGpu_impl(float sphere_rad, float density, float3 boxDi
       rolling_coeff_s2w_UU(0.0),
       spinning_coeff_s2s_UU(0.0),
       spinning_coeff_s2w_UU(0.0) {
-    gpuErrchk(cudaMallocManaged(&gran_params, sizeof(GranParams), cudaMemAttachGlobal));
-    gpuErrchk(cudaMallocManaged(&sphere_data, sizeof(SphereData), cudaMemAttachGlobal));
+    gpuErrchk(chgpuMallocManaged(&gran_params, sizeof(GranParams)));
+    gpuErrchk(chgpuMallocManaged(&sphere_data, sizeof(SphereData)));
     psi_T = PSI_T_DEFAULT;
     psi_L = PSI_L_DEFAULT;
     psi_R = PSI_R_DEFAULT;
@@ -135,7 +138,7 @@ void ChSystemGpu_impl::CreateWallBCs() {
 }
 
 ChSystemGpu_impl::~ChSystemGpu_impl() {
-    gpuErrchk(cudaFree(gran_params));
+    gpuErrchk(chgpuFree(gran_params));
 }
 
 size_t ChSystemGpu_impl::EstimateMemUsage() const {
@@ -1237,11 +1240,13 @@ void ChSystemGpu_impl::initializeSpheres() {
     runSphereBroadphase();
     INFO_PRINTF("Initial broadphase finished!\n");
 
-    int dev_ID;
-    gpuErrchk(cudaGetDevice(&dev_ID));
-    // these two will be mostly read by everyone
-    gpuErrchk(cudaMemAdvise(gran_params, sizeof(*gran_params), cudaMemAdviseSetReadMostly, dev_ID));
-    gpuErrchk(cudaMemAdvise(sphere_data, sizeof(*sphere_data), cudaMemAdviseSetReadMostly, dev_ID));
+    if (backend == CHGPU_BACKEND::CUDA && chgpuDeviceAvailable()) {
+        int dev_ID;
+        gpuErrchk(cudaGetDevice(&dev_ID));
+        // these two will be mostly read by everyone
+        gpuErrchk(cudaMemAdvise(gran_params, sizeof(*gran_params), cudaMemAdviseSetReadMostly, dev_ID));
+        gpuErrchk(cudaMemAdvise(sphere_data, sizeof(*sphere_data), cudaMemAdviseSetReadMostly, dev_ID));
+    }
 
     INFO_PRINTF("z grav term with timestep %f is %f\n", stepSize_SU,
                 stepSize_SU * stepSize_SU * gran_params->gravAcc_Z_SU);
@@ -55,10 +55,10 @@ class ChSolverStateData {
     float crntSimTime_SU;   // DN: needs to be brought here from GranParams
   public:
     ChSolverStateData() {
-        cudaMallocManaged(&pMaxNumberSpheresInAnySD, sizeof(unsigned int));
+        chgpuMallocManaged(&pMaxNumberSpheresInAnySD, sizeof(unsigned int));
         largestMaxNumberSpheresInAnySD_thusFar = 0;
     }
-    ~ChSolverStateData() { cudaFree(pMaxNumberSpheresInAnySD); }
+    ~ChSolverStateData() { chgpuFree(pMaxNumberSpheresInAnySD); }
     inline unsigned int* pMM_maxNumberSpheresInAnySD() {
         return pMaxNumberSpheresInAnySD;  ///< returns pointer to managed memory
     }
@@ -434,6 +434,19 @@ class ChSystemGpu_impl {
     /// Run the first sphere broadphase pass to get things started
     void runSphereBroadphase();
 
+    /// Sphere broadphase for the CPU backend
+    void runSphereBroadphase_cpu();
+
+    /// Compute sphere-sphere and sphere-BC forces with the CPU backend.
+    /// The frictionless material-based contact model is used if mat_based_frictionless is true.
+    void computeSphereForces_cpu(bool mat_based_frictionless);
+
+    /// Integrate the sphere states and update the friction history with the CPU backend
+    void integrateSpheres_cpu();
+
+    /// Advance simulation by duration in user units with the CPU backend, return actual duration elapsed
+    double AdvanceSimulation_cpu(float duration);
+
     /// Wrap the device helper function
     int3 getSDTripletFromID(unsigned int SD_ID) const;
 
@@ -549,6 +562,12 @@ class ChSystemGpu_impl {
     /// Allows the code to be very verbose for debugging
     CHGPU_VERBOSITY verbosity;
 
+    /// Execution backend (CUDA kernels or OpenMP loops on the host)
+    CHGPU_BACKEND backend;
+
+    /// Number of OpenMP threads used by the CPU backend
+    int num_threads;
+
     /// If dividing the longest box dimension into INT_MAX pieces gives better resolution than the deformation-based
     /// scaling, do that.
     bool use_min_length_unit;
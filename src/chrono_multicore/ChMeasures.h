@@ -40,6 +40,9 @@ class collision_measures {
         number_of_contacts_possible = 0;
         number_of_bins_active = 0;
         number_of_bin_intersections = 0;
+        number_of_contacts_reused = 0;
+        number_of_shapes_rebinned = 0;
+        number_of_shapes_coarse = 0;
 
         rigid_min_bounding_point = real3(0);
         rigid_max_bounding_point = real3(0);
@@ -61,6 +64,9 @@ class collision_measures {
     uint number_of_bins_active;        ///< Number of active bins (containing 1+ AABBs)
     uint number_of_bin_intersections;  ///< Number of AABB bin intersections
     uint number_of_contacts_possible;  ///< Number of contacts possible from broadphase
+    uint number_of_contacts_reused;    ///< Number of possible contacts reused from previous step (coherent broadphase)
+    uint number_of_shapes_rebinned;    ///< Number of shapes re-binned (coherent broadphase)
+    uint number_of_shapes_coarse;      ///< Number of shapes processed in the coarse grid (two-level broadphase)
 
     real3 rigid_min_bounding_point;
     real3 rigid_max_bounding_point;
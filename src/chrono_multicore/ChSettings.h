@@ -43,6 +43,10 @@ class collision_settings {
           bin_size(real3(1, 1, 1)),
           grid_density(5),
           broadphase_grid(ChBroadphase::GridType::FIXED_RESOLUTION),
+          broadphase_coherent(false),
+          broadphase_coherent_margin(real(0.1)),
+          broadphase_two_level(false),
+          broadphase_two_level_ratio(4),
           narrowphase_algorithm(ChNarrowphase::Algorithm::HYBRID) {}
 
     /// For stability of NSC contact, the envelope should be set to 5-10% of the smallest collision shape size (too
@@ -79,6 +83,22 @@ class collision_settings {
     /// `broadphase_grid` type is set to FIXED_DENSITY.
     real grid_density;
 
+    /// Flag controlling the temporally coherent broadphase (default: false).
+    /// If enabled, the broadphase grid, bin assignments, and candidate pairs from the previous step are reused as long
+    /// as all collision shapes remain inside the grid; only shapes whose AABB exits its enlarged AABB are re-processed.
+    bool broadphase_coherent;
+
+    /// Enlargement of the shape AABBs used in the coherent broadphase, as a fraction of the shape AABB size.
+    real broadphase_coherent_margin;
+
+    /// Flag controlling the two-level broadphase (default: false).
+    /// If enabled, shapes spanning more than `broadphase_two_level_ratio` bins of the broadphase grid in any direction
+    /// are processed in a separate, coarse grid. Not used with the coherent broadphase.
+    bool broadphase_two_level;
+
+    /// Size (in number of broadphase grid bins) above which a shape is processed in the coarse grid.
+    real broadphase_two_level_ratio;
+
     /// Algorithm for narrowphase collision detection phase.
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
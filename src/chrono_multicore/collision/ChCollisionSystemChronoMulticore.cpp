@@ -74,6 +74,10 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
     broadphase.grid_density = settings.grid_density;
+    broadphase.coherent = settings.broadphase_coherent;
+    broadphase.coherent_margin = settings.broadphase_coherent_margin;
+    broadphase.two_level = settings.broadphase_two_level;
+    broadphase.two_level_ratio = settings.broadphase_two_level_ratio;
     narrowphase.algorithm = settings.narrowphase_algorithm;
 }
 
@@ -89,6 +93,9 @@ void ChCollisionSystemChronoMulticore::PostProcess() {
     measures.number_of_bins_active = cd_data->num_active_bins;
     measures.number_of_bin_intersections = cd_data->num_bin_aabb_intersections;
     measures.number_of_contacts_possible = cd_data->num_possible_collisions;
+    measures.number_of_contacts_reused = cd_data->num_reused_collisions;
+    measures.number_of_shapes_rebinned = cd_data->num_rebinned_shapes;
+    measures.number_of_shapes_coarse = (uint)cd_data->coarse_shapes.size();
 
     measures.rigid_min_bounding_point = cd_data->rigid_min_bounding_point;
     measures.rigid_max_bounding_point = cd_data->rigid_max_bounding_point;
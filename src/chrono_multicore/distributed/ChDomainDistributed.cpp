@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "chrono_multicore/distributed/ChDomainDistributed.h"
+
+namespace chrono {
+
+ChDomainDistributed::ChDomainDistributed(int num_ranks, int rank)
+    : m_num_ranks(num_ranks), m_rank(rank), m_axis(0), m_lo(0), m_hi(0), m_ghost_width(0), m_initialized(false) {}
+
+void ChDomainDistributed::SetSplitAxis(int axis) {
+    if (axis < 0 || axis > 2)
+        throw std::invalid_argument("ChDomainDistributed: split axis must be 0, 1, or 2.");
+    m_axis = axis;
+}
+
+void ChDomainDistributed::SetSimDomain(const ChVector3d& lo, const ChVector3d& hi) {
+    m_lo = lo[m_axis];
+    m_hi = hi[m_axis];
+}
+
+void ChDomainDistributed::Initialize() {
+    if (m_hi <= m_lo)
+        throw std::runtime_error("ChDomainDistributed: invalid simulation domain.");
+
+    double width = (m_hi - m_lo) / m_num_ranks;
+    if (m_num_ranks > 1 && m_ghost_width >= width)
+        throw std::runtime_error("ChDomainDistributed: ghost layer wider than a sub-domain.");
+
+    m_bnds.resize(m_num_ranks - 1);
+    for (int i = 0; i < m_num_ranks - 1; i++)
+        m_bnds[i] = m_lo + (i + 1) * width;
+
+    m_initialized = true;
+}
+
+int ChDomainDistributed::GetOwner(const ChVector3d& pos) const {
+    // Index of the first interior boundary strictly larger than the point coordinate
+    return (int)(std::upper_bound(m_bnds.begin(), m_bnds.end(), pos[m_axis]) - m_bnds.begin());
+}
+
+double ChDomainDistributed::GetSubDomainLo(int rank) const {
+    return rank == 0 ? -std::numeric_limits<double>::infinity() : m_bnds[rank - 1];
+}
+
+double ChDomainDistributed::GetSubDomainHi(int rank) const {
+    return rank == m_num_ranks - 1 ? +std::numeric_limits<double>::infinity() : m_bnds[rank];
+}
+
+bool ChDomainDistributed::InSubDomain(int rank, const ChVector3d& pos) const {
+    double x = pos[m_axis];
+    return x >= GetSubDomainLo(rank) && x < GetSubDomainHi(rank);
+}
+
+bool ChDomainDistributed::InExtendedSubDomain(int rank, const ChVector3d& pos) const {
+    double x = pos[m_axis];
+    return x >= GetSubDomainLo(rank) - m_ghost_width && x < GetSubDomainHi(rank) + m_ghost_width;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Spatial decomposition of the simulation domain for distributed-memory
+// Chrono::Multicore simulations.
+//
+// =============================================================================
+
+#pragma once
+
+#include <vector>
+
+#include "chrono/core/ChVector3.h"
+
+#include "chrono_multicore/ChApiMulticore.h"
+
+namespace chrono {
+
+/// @addtogroup multicore_physics
+/// @{
+
+/// Decomposition of the simulation domain into slabs along one coordinate axis, one slab per MPI rank.
+/// Rank r owns all bodies with center in [lo_r, hi_r) along the split axis. The first and last slabs extend to
+/// infinity so that every point in space has exactly one owner. Each sub-domain is extended on both sides by a ghost
+/// layer; bodies owned by a neighbor rank which lie in this extended sub-domain are replicated as ghost bodies.
+class CH_MULTICORE_API ChDomainDistributed {
+  public:
+    ChDomainDistributed(int num_ranks, int rank);
+
+    /// Set the coordinate axis along which the domain is split (0: X, 1: Y, 2: Z; default: 0).
+    void SetSplitAxis(int axis);
+
+    /// Set the extent of the simulation domain along the split axis.
+    /// The domain is split into slabs of equal width between these bounds.
+    void SetSimDomain(const ChVector3d& lo, const ChVector3d& hi);
+
+    /// Set the width of the ghost layer.
+    /// This must be at least the diameter of the largest body, plus the maximum distance traveled by a body over one
+    /// step, and smaller than the slab width.
+    void SetGhostLayer(double width) { m_ghost_width = width; }
+
+    /// Compute the sub-domain boundaries.
+    /// Must be called after SetSimDomain and SetGhostLayer and before adding any bodies to the system.
+    void Initialize();
+
+    /// Return true if the domain was initialized.
+    bool IsInitialized() const { return m_initialized; }
+
+    int GetNumRanks() const { return m_num_ranks; }
+    int GetRank() const { return m_rank; }
+    int GetSplitAxis() const { return m_axis; }
+    double GetGhostLayer() const { return m_ghost_width; }
+
+    /// Return the rank owning the specified point.
+    int GetOwner(const ChVector3d& pos) const;
+
+    /// Return true if the specified point is in the sub-domain of the given rank.
+    bool InSubDomain(int rank, const ChVector3d& pos) const;
+
+    /// Return true if the specified point is in the sub-domain of the given rank, extended by the ghost layer.
+    bool InExtendedSubDomain(int rank, const ChVector3d& pos) const;
+
+    /// Get the lower bound of the sub-domain of the given rank along the split axis.
+    double GetSubDomainLo(int rank) const;
+
+    /// Get the upper bound of the sub-domain of the given rank along the split axis.
+    double GetSubDomainHi(int rank) const;
+
+  private:
+    int m_num_ranks;             ///< number of MPI ranks (sub-domains)
+    int m_rank;                  ///< rank of this process
+    int m_axis;                  ///< split axis
+    double m_lo;                 ///< lower bound of the simulation domain along the split axis
+    double m_hi;                 ///< upper bound of the simulation domain along the split axis
+    double m_ghost_width;        ///< width of the ghost layer
+    std::vector<double> m_bnds;  ///< interior sub-domain boundaries (num_ranks - 1)
+    bool m_initialized;
+};
+
+/// @} multicore_physics
+
+}  // end namespace chrono
@@ -0,0 +1,446 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "chrono/collision/ChCollisionShapeBox.h"
+#include "chrono/collision/ChCollisionShapeSphere.h"
+
+#include "chrono_multicore/distributed/ChSystemMulticoreDistributed.h"
+
+namespace chrono {
+
+// Layout of a body description (shape, inertia, collision family, and contact material)
+static const int DESC_SHAPE = 0;     // shape type (0: sphere, 1: box)
+static const int DESC_DIMS = 1;      // sphere radius or box lengths (3)
+static const int DESC_MASS = 4;      // mass
+static const int DESC_INERTIA = 5;   // moments and products of inertia (6)
+static const int DESC_FAMILY = 11;   // collision family group and mask (2)
+static const int DESC_MAT = 13;      // contact material properties (14)
+static const int DESC_SIZE = 27;
+
+// Layout of a body record exchanged between ranks
+static const int REC_GID = 0;    // global identifier
+static const int REC_OWNED = 1;  // 1 if the receiver becomes the body owner, 0 for a ghost body
+static const int REC_STATE = 2;  // position (3), orientation (4), linear velocity (3), local angular velocity (3)
+static const int REC_DESC = 15;  // body description
+static const int REC_SIZE = REC_DESC + DESC_SIZE;
+
+// Size of a body state collected with GatherBodies (global identifier and state)
+static const int GATHER_SIZE = 14;
+
+static int CommRank(MPI_Comm comm) {
+    int rank;
+    MPI_Comm_rank(comm, &rank);
+    return rank;
+}
+
+static int CommSize(MPI_Comm comm) {
+    int size;
+    MPI_Comm_size(comm, &size);
+    return size;
+}
+
+ChSystemMulticoreDistributed::ChSystemMulticoreDistributed(MPI_Comm comm)
+    : ChSystemMulticoreSMC(),
+      m_comm(comm),
+      m_rank(CommRank(comm)),
+      m_num_ranks(CommSize(comm)),
+      m_domain(m_num_ranks, m_rank),
+      m_num_gids(0) {}
+
+ChSystemMulticoreDistributed* ChSystemMulticoreDistributed::Clone() const {
+    throw std::runtime_error("ChSystemMulticoreDistributed: a distributed system cannot be cloned.");
+}
+
+// -----------------------------------------------------------------------------
+
+ChSystemMulticoreDistributed::Description ChSystemMulticoreDistributed::GetDescription(std::shared_ptr<ChBody> body) {
+    auto model = body->GetCollisionModel();
+    if (!model || model->GetNumShapes() != 1)
+        throw std::runtime_error("ChSystemMulticoreDistributed: a body must have exactly one collision shape.");
+
+    const auto& shape = model->GetShapeInstance(0).first;
+    const auto& frame = model->GetShapeInstance(0).second;
+    if (frame.GetPos() != VNULL || frame.GetRot() != QUNIT)
+        throw std::runtime_error("ChSystemMulticoreDistributed: collision shape must be at the body reference frame.");
+
+    auto mat = std::dynamic_pointer_cast<ChContactMaterialSMC>(shape->GetMaterial());
+    if (!mat)
+        throw std::runtime_error("ChSystemMulticoreDistributed: collision shape must have an SMC contact material.");
+
+    Description desc(DESC_SIZE, 0.0);
+
+    switch (shape->GetType()) {
+        case ChCollisionShape::Type::SPHERE:
+            desc[DESC_SHAPE] = 0;
+            desc[DESC_DIMS + 0] = std::static_pointer_cast<ChCollisionShapeSphere>(shape)->GetRadius();
+            break;
+        case ChCollisionShape::Type::BOX: {
+            auto lengths = std::static_pointer_cast<ChCollisionShapeBox>(shape)->GetLengths();
+            desc[DESC_SHAPE] = 1;
+            desc[DESC_DIMS + 0] = lengths.x();
+            desc[DESC_DIMS + 1] = lengths.y();
+            desc[DESC_DIMS + 2] = lengths.z();
+            break;
+        }
+        default:
+            throw std::runtime_error("ChSystemMulticoreDistributed: only sphere and box collision shapes supported.");
+    }
+
+    auto inertia_xx = body->GetInertiaXX();
+    auto inertia_xy = body->GetInertiaXY();
+    desc[DESC_MASS] = body->GetMass();
+    desc[DESC_INERTIA + 0] = inertia_xx.x();
+    desc[DESC_INERTIA + 1] = inertia_xx.y();
+    desc[DESC_INERTIA + 2] = inertia_xx.z();
+    desc[DESC_INERTIA + 3] = inertia_xy.x();
+    desc[DESC_INERTIA + 4] = inertia_xy.y();
+    desc[DESC_INERTIA + 5] = inertia_xy.z();
+
+    desc[DESC_FAMILY + 0] = model->GetFamilyGroup();
+    desc[DESC_FAMILY + 1] = model->GetFamilyMask();
+
+    desc[DESC_MAT + 0] = mat->GetStaticFriction();
+    desc[DESC_MAT + 1] = mat->GetSlidingFriction();
+    desc[DESC_MAT + 2] = mat->GetRollingFriction();
+    desc[DESC_MAT + 3] = mat->GetSpinningFriction();
+    desc[DESC_MAT + 4] = mat->GetRestitution();
+    desc[DESC_MAT + 5] = mat->GetYoungModulus();
+    desc[DESC_MAT + 6] = mat->GetPoissonRatio();
+    desc[DESC_MAT + 7] = mat->GetAdhesion();
+    desc[DESC_MAT + 8] = mat->GetAdhesionMultDMT();
+    desc[DESC_MAT + 9] = mat->GetAdhesionSPerko();
+    desc[DESC_MAT + 10] = mat->GetKn();
+    desc[DESC_MAT + 11] = mat->GetKt();
+    desc[DESC_MAT + 12] = mat->GetGn();
+    desc[DESC_MAT + 13] = mat->GetGt();
+
+    return desc;
+}
+
+void ChSystemMulticoreDistributed::AddBody(std::shared_ptr<ChBody> body) {
+    if (!m_domain.IsInitialized())
+        throw std::runtime_error("ChSystemMulticoreDistributed::AddBody: domain decomposition not initialized.");
+
+    // Global identifiers are consumed on all ranks, so that they are consistent even for discarded bodies
+    unsigned int gid = m_num_gids++;
+
+    if (body->IsFixed()) {
+        AddBodyLocal(body, gid, BodyStatus::GLOBAL, Description());
+        return;
+    }
+
+    const auto& pos = body->GetPos();
+    if (!m_domain.InExtendedSubDomain(m_rank, pos))
+        return;
+
+    auto status = m_domain.InSubDomain(m_rank, pos) ? BodyStatus::OWNED : BodyStatus::GHOST;
+    AddBodyLocal(body, gid, status, GetDescription(body));
+}
+
+void ChSystemMulticoreDistributed::AddBodyLocal(std::shared_ptr<ChBody> body,
+                                                unsigned int gid,
+                                                BodyStatus status,
+                                                const Description& desc) {
+    ChSystemMulticoreSMC::AddBody(body);
+
+    m_gid.push_back(gid);
+    m_status.push_back(status);
+    m_desc.push_back(desc);
+    m_gid_to_slot[gid] = body->GetIndex();
+}
+
+std::shared_ptr<ChBody> ChSystemMulticoreDistributed::CreateBody(const Description& desc,
+                                                                 unsigned int gid,
+                                                                 BodyStatus status) {
+    // Reuse a free slot with identical description, if one is available
+    auto free = m_free_slots.find(desc);
+    if (free != m_free_slots.end() && !free->second.empty()) {
+        int index = free->second.back();
+        free->second.pop_back();
+
+        auto& body = GetBodies()[index];
+        body->SetFixed(false);
+        m_gid[index] = gid;
+        m_status[index] = status;
+        m_gid_to_slot[gid] = index;
+        return body;
+    }
+
+    // Materials are shared among all received bodies with identical properties
+    Description mat_props(desc.begin() + DESC_MAT, desc.end());
+    auto& mat = m_materials[mat_props];
+    if (!mat) {
+        mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        mat->SetStaticFriction((float)mat_props[0]);
+        mat->SetSlidingFriction((float)mat_props[1]);
+        mat->SetRollingFriction((float)mat_props[2]);
+        mat->SetSpinningFriction((float)mat_props[3]);
+        mat->SetRestitution((float)mat_props[4]);
+        mat->SetYoungModulus((float)mat_props[5]);
+        mat->SetPoissonRatio((float)mat_props[6]);
+        mat->SetAdhesion((float)mat_props[7]);
+        mat->SetAdhesionMultDMT((float)mat_props[8]);
+        mat->SetAdhesionSPerko((float)mat_props[9]);
+        mat->SetKn((float)mat_props[10]);
+        mat->SetKt((float)mat_props[11]);
+        mat->SetGn((float)mat_props[12]);
+        mat->SetGt((float)mat_props[13]);
+    }
+
+    std::shared_ptr<ChCollisionShape> shape;
+    if (desc[DESC_SHAPE] == 0)
+        shape = chrono_types::make_shared<ChCollisionShapeSphere>(mat, desc[DESC_DIMS]);
+    else
+        shape = chrono_types::make_shared<ChCollisionShapeBox>(mat, desc[DESC_DIMS + 0], desc[DESC_DIMS + 1],
+                                                               desc[DESC_DIMS + 2]);
+
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetMass(desc[DESC_MASS]);
+    body->SetInertiaXX(ChVector3d(desc[DESC_INERTIA + 0], desc[DESC_INERTIA + 1], desc[DESC_INERTIA + 2]));
+    body->SetInertiaXY(ChVector3d(desc[DESC_INERTIA + 3], desc[DESC_INERTIA + 4], desc[DESC_INERTIA + 5]));
+    body->AddCollisionShape(shape);
+    body->GetCollisionModel()->SetFamilyGroup((short int)desc[DESC_FAMILY + 0]);
+    body->GetCollisionModel()->SetFamilyMask((short int)desc[DESC_FAMILY + 1]);
+    body->EnableCollision(true);
+
+    AddBodyLocal(body, gid, status, desc);
+
+    return body;
+}
+
+void ChSystemMulticoreDistributed::FreeSlot(int index) {
+    // Collision models cannot be removed from the multicore collision system. Instead, the body is fixed, excluded
+    // from collision detection (see UpdateRigidBodies), and kept for reuse by a body with the same description.
+    auto& body = GetBodies()[index];
+    body->SetFixed(true);
+    body->SetPosDt(VNULL);
+    body->SetAngVelLocal(VNULL);
+
+    m_gid_to_slot.erase(m_gid[index]);
+    m_status[index] = BodyStatus::FREE;
+    m_free_slots[m_desc[index]].push_back(index);
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemMulticoreDistributed::UpdateRigidBodies() {
+    ChSystemMulticoreSMC::UpdateRigidBodies();
+
+    custom_vector<char>& active = data_manager->host_data.active_rigid;
+    custom_vector<char>& collide = data_manager->host_data.collide_rigid;
+
+    for (size_t i = 0; i < m_status.size(); i++) {
+        if (m_status[i] == BodyStatus::FREE) {
+            active[i] = false;
+            collide[i] = false;
+        }
+    }
+}
+
+bool ChSystemMulticoreDistributed::AdvanceDynamics() {
+    if (data_manager->settings.solver.tangential_displ_mode != ChSystemSMC::TangentialDisplacementModel::OneStep)
+        throw std::runtime_error("ChSystemMulticoreDistributed: only the OneStep tangential displacement model supported.");
+
+    bool result = ChSystemMulticoreSMC::AdvanceDynamics();
+
+    Exchange();
+
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChSystemMulticoreDistributed::PackBody(int index, bool owned, std::vector<double>& buffer) const {
+    const auto& body = GetBodies()[index];
+    const auto& pos = body->GetPos();
+    const auto& rot = body->GetRot();
+    const auto& pos_dt = body->GetPosDt();
+    auto ang_vel = body->GetAngVelLocal();
+
+    buffer.push_back(m_gid[index]);
+    buffer.push_back(owned ? 1 : 0);
+    buffer.insert(buffer.end(), {pos.x(), pos.y(), pos.z()});
+    buffer.insert(buffer.end(), {rot.e0(), rot.e1(), rot.e2(), rot.e3()});
+    buffer.insert(buffer.end(), {pos_dt.x(), pos_dt.y(), pos_dt.z()});
+    buffer.insert(buffer.end(), {ang_vel.x(), ang_vel.y(), ang_vel.z()});
+    buffer.insert(buffer.end(), m_desc[index].begin(), m_desc[index].end());
+}
+
+void ChSystemMulticoreDistributed::UnpackBody(const double* record, std::vector<char>& refreshed) {
+    auto gid = (unsigned int)record[REC_GID];
+    auto status = record[REC_OWNED] != 0 ? BodyStatus::OWNED : BodyStatus::GHOST;
+
+    std::shared_ptr<ChBody> body;
+    auto slot = m_gid_to_slot.find(gid);
+    if (slot != m_gid_to_slot.end()) {
+        body = GetBodies()[slot->second];
+        m_status[slot->second] = status;
+    } else {
+        Description desc(record + REC_DESC, record + REC_SIZE);
+        body = CreateBody(desc, gid, status);
+    }
+
+    const double* state = record + REC_STATE;
+    body->SetPos(ChVector3d(state[0], state[1], state[2]));
+    body->SetRot(ChQuaternion<>(state[3], state[4], state[5], state[6]));
+    body->SetPosDt(ChVector3d(state[7], state[8], state[9]));
+    body->SetAngVelLocal(ChVector3d(state[10], state[11], state[12]));
+
+    unsigned int index = body->GetIndex();
+    if (index >= refreshed.size())
+        refreshed.resize(index + 1, false);
+    refreshed[index] = true;
+}
+
+// Exchange body records with the lower and upper neighbors. Records are sent to 'dest' and received from 'source'.
+static void SendRecv(const std::vector<double>& send,
+                     int dest,
+                     std::vector<double>& recv,
+                     int source,
+                     MPI_Comm comm) {
+    int num_send = (int)send.size();
+    int num_recv = 0;
+    MPI_Sendrecv(&num_send, 1, MPI_INT, dest, 0, &num_recv, 1, MPI_INT, source, 0, comm, MPI_STATUS_IGNORE);
+    recv.resize(num_recv);
+    MPI_Sendrecv(send.data(), num_send, MPI_DOUBLE, dest, 1, recv.data(), num_recv, MPI_DOUBLE, source, 1, comm,
+                 MPI_STATUS_IGNORE);
+}
+
+void ChSystemMulticoreDistributed::Exchange() {
+    m_timer_exchange.reset();
+    m_timer_exchange.start();
+
+    int rank_lo = m_rank > 0 ? m_rank - 1 : MPI_PROC_NULL;
+    int rank_hi = m_rank < m_num_ranks - 1 ? m_rank + 1 : MPI_PROC_NULL;
+
+    std::vector<double> send_lo;
+    std::vector<double> send_hi;
+
+    // Ghost bodies not refreshed by their owner during this exchange have left the extended sub-domain
+    std::vector<char> refreshed(m_status.size(), false);
+
+    // Send owned bodies to the neighbors whose extended sub-domain contains them. Owned bodies which left the
+    // sub-domain are sent to their new owner and either kept as ghosts or discarded.
+    int num_slots = (int)m_status.size();
+    for (int i = 0; i < num_slots; i++) {
+        if (m_status[i] != BodyStatus::OWNED)
+            continue;
+
+        const auto& pos = GetBodies()[i]->GetPos();
+        int owner = m_domain.GetOwner(pos);
+        if (std::abs(owner - m_rank) > 1)
+            throw std::runtime_error("ChSystemMulticoreDistributed: body moved across more than one sub-domain.");
+
+        if (rank_lo != MPI_PROC_NULL && m_domain.InExtendedSubDomain(rank_lo, pos))
+            PackBody(i, owner == rank_lo, send_lo);
+        if (rank_hi != MPI_PROC_NULL && m_domain.InExtendedSubDomain(rank_hi, pos))
+            PackBody(i, owner == rank_hi, send_hi);
+
+        if (owner != m_rank) {
+            if (m_domain.InExtendedSubDomain(m_rank, pos)) {
+                m_status[i] = BodyStatus::GHOST;
+                refreshed[i] = true;
+            } else {
+                FreeSlot(i);
+            }
+        }
+    }
+
+    std::vector<double> recv_lo;
+    std::vector<double> recv_hi;
+    SendRecv(send_hi, rank_hi, recv_lo, rank_lo, m_comm);
+    SendRecv(send_lo, rank_lo, recv_hi, rank_hi, m_comm);
+
+    for (size_t k = 0; k < recv_lo.size(); k += REC_SIZE)
+        UnpackBody(&recv_lo[k], refreshed);
+    for (size_t k = 0; k < recv_hi.size(); k += REC_SIZE)
+        UnpackBody(&recv_hi[k], refreshed);
+
+    for (int i = 0; i < num_slots; i++) {
+        if (m_status[i] == BodyStatus::GHOST && !refreshed[i])
+            FreeSlot(i);
+    }
+
+    m_timer_exchange.stop();
+}
+
+// -----------------------------------------------------------------------------
+
+unsigned int ChSystemMulticoreDistributed::GetNumBodiesOwned() const {
+    return (unsigned int)std::count(m_status.begin(), m_status.end(), BodyStatus::OWNED);
+}
+
+unsigned int ChSystemMulticoreDistributed::GetNumBodiesGhost() const {
+    return (unsigned int)std::count(m_status.begin(), m_status.end(), BodyStatus::GHOST);
+}
+
+unsigned int ChSystemMulticoreDistributed::GetNumBodiesDistributed() {
+    unsigned int num_owned = GetNumBodiesOwned();
+    unsigned int num_total = 0;
+    MPI_Allreduce(&num_owned, &num_total, 1, MPI_UNSIGNED, MPI_SUM, m_comm);
+    return num_total;
+}
+
+void ChSystemMulticoreDistributed::GatherBodies(std::vector<ChDistributedBodyState>& states) {
+    states.clear();
+
+    std::vector<double> local;
+    for (size_t i = 0; i < m_status.size(); i++) {
+        if (m_status[i] != BodyStatus::OWNED)
+            continue;
+        const auto& body = GetBodies()[i];
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        const auto& pos_dt = body->GetPosDt();
+        auto ang_vel = body->GetAngVelLocal();
+        local.insert(local.end(), {(double)m_gid[i], pos.x(), pos.y(), pos.z(), rot.e0(), rot.e1(), rot.e2(),
+                                   rot.e3(), pos_dt.x(), pos_dt.y(), pos_dt.z(), ang_vel.x(), ang_vel.y(),
+                                   ang_vel.z()});
+    }
+
+    int num_local = (int)local.size();
+    std::vector<int> counts(m_num_ranks, 0);
+    MPI_Gather(&num_local, 1, MPI_INT, counts.data(), 1, MPI_INT, 0, m_comm);
+
+    std::vector<int> displs(m_num_ranks, 0);
+    for (int r = 1; r < m_num_ranks; r++)
+        displs[r] = displs[r - 1] + counts[r - 1];
+
+    std::vector<double> all;
+    if (m_rank == 0)
+        all.resize(displs[m_num_ranks - 1] + counts[m_num_ranks - 1]);
+    MPI_Gatherv(local.data(), num_local, MPI_DOUBLE, all.data(), counts.data(), displs.data(), MPI_DOUBLE, 0, m_comm);
+
+    if (m_rank != 0)
+        return;
+
+    states.resize(all.size() / GATHER_SIZE);
+    for (size_t k = 0; k < states.size(); k++) {
+        const double* s = &all[k * GATHER_SIZE];
+        states[k].gid = (unsigned int)s[0];
+        states[k].pos = ChVector3d(s[1], s[2], s[3]);
+        states[k].rot = ChQuaternion<>(s[4], s[5], s[6], s[7]);
+        states[k].pos_dt = ChVector3d(s[8], s[9], s[10]);
+        states[k].ang_vel_local = ChVector3d(s[11], s[12], s[13]);
+    }
+
+    std::sort(states.begin(), states.end(),
+              [](const ChDistributedBodyState& a, const ChDistributedBodyState& b) { return a.gid < b.gid; });
+}
+
+}  // end namespace chrono
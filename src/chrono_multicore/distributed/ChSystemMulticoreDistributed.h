@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Distributed-memory (MPI) Chrono::Multicore system using the SMC method.
+//
+// The simulation domain is split into slabs (see ChDomainDistributed), one per
+// MPI rank. Each rank integrates the bodies it owns plus copies (ghosts) of the
+// bodies owned by its neighbors that lie within the ghost layer. After each
+// step, owned bodies that left the sub-domain migrate to their new owner and the
+// ghost copies are refreshed.
+//
+// =============================================================================
+
+#pragma once
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include <mpi.h>
+
+#include "chrono/core/ChTimer.h"
+#include "chrono/physics/ChContactMaterialSMC.h"
+
+#include "chrono_multicore/physics/ChSystemMulticore.h"
+#include "chrono_multicore/distributed/ChDomainDistributed.h"
+
+namespace chrono {
+
+/// @addtogroup multicore_physics
+/// @{
+
+/// State of a body, as collected from all ranks with ChSystemMulticoreDistributed::GatherBodies.
+struct ChDistributedBodyState {
+    unsigned int gid;          ///< global body identifier
+    ChVector3d pos;            ///< body position
+    ChQuaternion<> rot;        ///< body orientation
+    ChVector3d pos_dt;         ///< body linear velocity
+    ChVector3d ang_vel_local;  ///< body angular velocity (local frame)
+};
+
+/// Distributed-memory Chrono::Multicore system using the SMC method.
+/// All ranks must create the same model, adding bodies in the same order; every body is assigned a global identifier
+/// in the order in which it is added. Fixed bodies (e.g., containers) are replicated on all ranks. Any other body is
+/// only retained by the ranks whose extended sub-domain contains it and must have a single collision shape (sphere or
+/// box) with an SMC contact material, placed at the body reference frame.
+///
+/// Limitations:
+/// - only the one-step tangential displacement model is supported (contact history is not exchanged);
+/// - bodies cannot be connected by joints;
+/// - a body cannot move more than one sub-domain over a single step.
+class CH_MULTICORE_API ChSystemMulticoreDistributed : public ChSystemMulticoreSMC {
+  public:
+    /// Status of a body on this rank.
+    enum class BodyStatus {
+        GLOBAL,  ///< fixed body, present on all ranks
+        OWNED,   ///< body owned (integrated) by this rank
+        GHOST,   ///< copy of a body owned by a neighbor rank
+        FREE     ///< unused body slot, available for reuse
+    };
+
+    ChSystemMulticoreDistributed(MPI_Comm comm = MPI_COMM_WORLD);
+
+    /// A distributed system cannot be copied: its body slots and global identifiers are tied to the state of the
+    /// other ranks in the communicator.
+    ChSystemMulticoreDistributed(const ChSystemMulticoreDistributed& other) = delete;
+    ChSystemMulticoreDistributed& operator=(const ChSystemMulticoreDistributed& other) = delete;
+
+    /// Cloning is not supported for a distributed system; this function always throws.
+    virtual ChSystemMulticoreDistributed* Clone() const override;
+
+    /// Access the domain decomposition.
+    /// The domain must be initialized before adding any bodies to the system.
+    ChDomainDistributed& GetDomain() { return m_domain; }
+
+    MPI_Comm GetCommunicator() const { return m_comm; }
+    int GetRank() const { return m_rank; }
+    int GetNumRanks() const { return m_num_ranks; }
+
+    /// Add the specified body to the system.
+    /// This function must be called on all ranks, in the same order. A non-fixed body is discarded if it does not
+    /// lie in the extended sub-domain of this rank.
+    virtual void AddBody(std::shared_ptr<ChBody> body) override;
+
+    /// Advance the state of all owned and ghost bodies, then migrate bodies and refresh ghosts.
+    virtual bool AdvanceDynamics() override;
+
+    virtual void UpdateRigidBodies() override;
+
+    /// Get the status of the specified body on this rank.
+    BodyStatus GetBodyStatus(std::shared_ptr<ChBody> body) const { return m_status[body->GetIndex()]; }
+
+    /// Get the global identifier of the specified body.
+    unsigned int GetBodyGlobalID(std::shared_ptr<ChBody> body) const { return m_gid[body->GetIndex()]; }
+
+    /// Get the number of bodies owned by this rank.
+    unsigned int GetNumBodiesOwned() const;
+
+    /// Get the number of ghost bodies on this rank.
+    unsigned int GetNumBodiesGhost() const;
+
+    /// Get the total number of (non-fixed) bodies over all ranks.
+    /// This is a collective operation.
+    unsigned int GetNumBodiesDistributed();
+
+    /// Collect the states of all non-fixed bodies on rank 0, sorted by global identifier.
+    /// This is a collective operation; the output vector is left empty on all other ranks.
+    void GatherBodies(std::vector<ChDistributedBodyState>& states);
+
+    /// Get the time spent in body migration and ghost exchange over the last step.
+    double GetTimerExchange() const { return m_timer_exchange.GetTimeSeconds(); }
+
+  private:
+    typedef std::vector<double> Description;
+
+    /// Extract the shape, inertia, and material description of the specified body.
+    static Description GetDescription(std::shared_ptr<ChBody> body);
+
+    /// Add a body to the underlying multicore system, in a new body slot.
+    void AddBodyLocal(std::shared_ptr<ChBody> body, unsigned int gid, BodyStatus status, const Description& desc);
+
+    /// Create a body from the given description, reusing a free slot with identical description if one is available.
+    std::shared_ptr<ChBody> CreateBody(const Description& desc, unsigned int gid, BodyStatus status);
+
+    /// Mark the body in the specified slot as unused.
+    void FreeSlot(int index);
+
+    /// Migrate owned bodies and refresh ghost bodies.
+    void Exchange();
+
+    /// Pack the state and description of the body in the specified slot.
+    void PackBody(int index, bool owned, std::vector<double>& buffer) const;
+
+    /// Unpack a body record received from a neighbor rank.
+    void UnpackBody(const double* record, std::vector<char>& refreshed);
+
+    MPI_Comm m_comm;
+    int m_rank;
+    int m_num_ranks;
+    ChDomainDistributed m_domain;
+
+    unsigned int m_num_gids;                                   ///< number of global identifiers assigned so far
+    std::vector<unsigned int> m_gid;                           ///< global identifier of each body slot
+    std::vector<BodyStatus> m_status;                          ///< status of each body slot
+    std::vector<Description> m_desc;                           ///< description of each body slot
+    std::unordered_map<unsigned int, int> m_gid_to_slot;       ///< map from global identifier to body slot
+    std::map<Description, std::vector<int>> m_free_slots;      ///< free body slots, grouped by description
+    std::map<Description, std::shared_ptr<ChContactMaterialSMC>> m_materials;  ///< materials of received bodies
+
+    ChTimer m_timer_exchange;
+};
+
+/// @} multicore_physics
+
+}  // end namespace chrono
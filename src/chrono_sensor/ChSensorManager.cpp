@@ -21,11 +21,16 @@
 #include "chrono_sensor/sensors/ChOptixSensor.h"
 #include <iomanip>
 #include <iostream>
+#include <thread>
 
 namespace chrono {
 namespace sensor {
 
-CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system) : m_verbose(false), m_optix_reflections(9) {
+CH_SENSOR_API ChSensorManager::ChSensorManager(ChSystem* chrono_system)
+    : m_verbose(false),
+      m_optix_reflections(9),
+      m_backend(RayTracingBackend::OPTIX),
+      m_num_cpu_threads(std::max(1, (int)std::thread::hardware_concurrency())) {
     // save the chrono system handle
     m_system = chrono_system;
     scene = chrono_types::make_shared<ChScene>();
@@ -49,6 +54,8 @@ CH_SENSOR_API void ChSensorManager::Update() {
     for (auto pEngine : m_engines) {
         pEngine->UpdateSensors(scene);
     }
+    if (m_cpu_engine)
+        m_cpu_engine->UpdateSensors(scene);
 
     // have the sensormanager update all of the non-optix sensor (IMU and GPS).
     // TODO: perhaps create a thread that takes care of this? Tradeoff since IMU should require some data from EVERY
@@ -70,6 +77,24 @@ CH_SENSOR_API void ChSensorManager::ReconstructScenes() {
     for (auto eng : m_engines) {
         eng->ConstructScene();
     }
+    if (m_cpu_engine)
+        m_cpu_engine->ConstructScene();
+}
+
+CH_SENSOR_API void ChSensorManager::SetRayTracingBackend(RayTracingBackend backend) {
+    if (!m_render_sensor.empty()) {
+        std::cerr << "WARNING: Ray tracing backend cannot be changed after adding sensors. Ignoring this change\n";
+        return;
+    }
+    m_backend = backend;
+}
+
+CH_SENSOR_API void ChSensorManager::SetNumCPUThreads(int num_threads) {
+    if (num_threads > 0) {
+        m_num_cpu_threads = num_threads;
+        if (m_cpu_engine)
+            m_cpu_engine->SetNumThreads(num_threads);
+    }
 }
 
 CH_SENSOR_API void ChSensorManager::SetMaxEngines(int num_groups) {
@@ -93,6 +118,15 @@ CH_SENSOR_API void ChSensorManager::AddSensor(std::shared_ptr<ChSensor> sensor)
 
     if (auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(sensor)) {
         m_render_sensor.push_back(sensor);
+
+        // with the CPU backend, a single engine traces all sensors
+        if (m_backend == RayTracingBackend::CPU) {
+            if (!m_cpu_engine)
+                m_cpu_engine = chrono_types::make_shared<ChCPUEngine>(m_system, m_num_cpu_threads, m_verbose);
+            m_cpu_engine->AssignSensor(pOptixSensor);
+            return;
+        }
+
         /******** give each render group all sensor with same update rate *************/
         bool found_group = false;
 
@@ -26,6 +26,7 @@
 
 #include "chrono_sensor/sensors/ChSensor.h"
 #include "chrono_sensor/optix/ChOptixEngine.h"
+#include "chrono_sensor/cpu/ChCPUEngine.h"
 #include "chrono_sensor/ChDynamicsManager.h"
 #include "chrono_sensor/optix/scene/ChScene.h"
 
@@ -38,6 +39,12 @@ namespace sensor {
 /// @addtogroup sensor
 /// @{
 
+/// Ray tracing backend used for rendering the optix-based sensors
+enum class RayTracingBackend {
+    OPTIX,  ///< GPU ray tracing with OptiX (default)
+    CPU     ///< multithreaded CPU ray tracing (lidar, depth camera and radar only)
+};
+
 /// class for managing sensors. This is the Sensor system class.
 
 class CH_SENSOR_API ChSensorManager {
@@ -102,6 +109,22 @@ class CH_SENSOR_API ChSensorManager {
     /// @return The max number of recursions used in ray tracing
     int GetRayRecursions() { return m_optix_reflections; }
 
+    /// Set the backend used for rendering the optix-based sensors. Must be called before any such sensor is added.
+    /// @param backend The ray tracing backend
+    void SetRayTracingBackend(RayTracingBackend backend);
+
+    /// Get the backend used for rendering the optix-based sensors
+    /// @return The ray tracing backend
+    RayTracingBackend GetRayTracingBackend() { return m_backend; }
+
+    /// Set the number of threads used by the CPU ray tracing backend (default: hardware concurrency)
+    /// @param num_threads The number of threads
+    void SetNumCPUThreads(int num_threads);
+
+    /// Get the CPU engine, if the CPU backend is used and a sensor was added
+    /// @return A shared pointer to the CPU engine (null if none was created)
+    std::shared_ptr<ChCPUEngine> GetCPUEngine() { return m_cpu_engine; }
+
     /// Set if the sensor framework should print all info
     /// @param verbose Whether the framework should print info
     void SetVerbose(bool verbose) { m_verbose = verbose; }
@@ -115,13 +138,16 @@ class CH_SENSOR_API ChSensorManager {
     std::shared_ptr<ChScene> scene;
 
   private:
-    bool m_verbose;           ///< Whether we should print messages and warnings
-    int m_optix_reflections;  ///< Maximum number of ray tracing recursions
-    int m_num_keyframes;      ///< number of keyframes to use
+    bool m_verbose;               ///< Whether we should print messages and warnings
+    int m_optix_reflections;      ///< Maximum number of ray tracing recursions
+    int m_num_keyframes;          ///< number of keyframes to use
+    RayTracingBackend m_backend;  ///< backend used for rendering the optix-based sensors
+    int m_num_cpu_threads;        ///< number of threads of the CPU backend
 
     // class variables
     ChSystem* m_system;                                     ///< Chrono system the manager is attached to
     std::vector<std::shared_ptr<ChOptixEngine>> m_engines;  ///< The optix engine(s) used for rendered sensors
+    std::shared_ptr<ChCPUEngine> m_cpu_engine;              ///< The CPU engine used with the CPU backend
     std::shared_ptr<ChDynamicsManager> m_dynamics_manager;  ///< Container for updating dynamic sensors
 
     int m_allowable_groups = 1;  ///< Default maximum number of allowable engines
@@ -0,0 +1,199 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Bounding volume hierarchy used by the CPU ray tracing backend
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChCPUBVH.h"
+
+#include <numeric>
+
+namespace chrono {
+namespace sensor {
+
+// Number of bins used when evaluating the surface area heuristic
+static const int BVH_NUM_BINS = 12;
+// Maximum depth of the tree. Must be consistent with the traversal stack size of the ray tracer.
+static const int BVH_MAX_DEPTH = 48;
+
+void ChCPUBVH::Build(const std::vector<CPUBoundingBox>& prim_boxes, int max_leaf_size) {
+    m_nodes.clear();
+    m_indices.resize(prim_boxes.size());
+    std::iota(m_indices.begin(), m_indices.end(), 0);
+
+    if (prim_boxes.empty()) {
+        m_build_cost = 0;
+        m_cost = 0;
+        return;
+    }
+
+    std::vector<ChVector3f> centers(prim_boxes.size());
+    for (size_t i = 0; i < prim_boxes.size(); i++)
+        centers[i] = prim_boxes[i].Center();
+
+    m_nodes.reserve(2 * prim_boxes.size());
+    Node root;
+    root.first = 0;
+    root.count = (int)prim_boxes.size();
+    root.axis = 0;
+    m_nodes.push_back(root);
+
+    Subdivide(0, prim_boxes, centers, std::max(1, max_leaf_size), 0);
+
+    m_build_cost = ComputeCost();
+    m_cost = m_build_cost;
+}
+
+void ChCPUBVH::Subdivide(int node_id,
+                         const std::vector<CPUBoundingBox>& prim_boxes,
+                         const std::vector<ChVector3f>& centers,
+                         int max_leaf_size,
+                         int depth) {
+    const int first = m_nodes[node_id].first;
+    const int count = m_nodes[node_id].count;
+
+    // bounds of the primitives and of their centers
+    CPUBoundingBox box;
+    CPUBoundingBox center_box;
+    for (int i = first; i < first + count; i++) {
+        box.Extend(prim_boxes[m_indices[i]]);
+        center_box.Extend(centers[m_indices[i]]);
+    }
+    m_nodes[node_id].box = box;
+
+    if (count <= max_leaf_size || depth >= BVH_MAX_DEPTH)
+        return;
+
+    // split along the axis of largest center extent
+    ChVector3f extent = center_box.bmax - center_box.bmin;
+    int axis = 0;
+    if (extent.y() > extent[axis])
+        axis = 1;
+    if (extent.z() > extent[axis])
+        axis = 2;
+    if (extent[axis] <= 0)
+        return;  // all centers coincide, keep as a leaf
+
+    // bin the primitives and evaluate the SAH for each bin boundary
+    int bin_count[BVH_NUM_BINS] = {};
+    CPUBoundingBox bin_box[BVH_NUM_BINS];
+    const float bin_scale = BVH_NUM_BINS / extent[axis];
+    auto bin_of = [&](int prim) {
+        int b = (int)((centers[prim][axis] - center_box.bmin[axis]) * bin_scale);
+        return std::min(b, BVH_NUM_BINS - 1);
+    };
+    for (int i = first; i < first + count; i++) {
+        int b = bin_of(m_indices[i]);
+        bin_count[b]++;
+        bin_box[b].Extend(prim_boxes[m_indices[i]]);
+    }
+
+    float left_area[BVH_NUM_BINS - 1];
+    int left_count[BVH_NUM_BINS - 1];
+    CPUBoundingBox acc_box;
+    int acc_count = 0;
+    for (int b = 0; b < BVH_NUM_BINS - 1; b++) {
+        acc_box.Extend(bin_box[b]);
+        acc_count += bin_count[b];
+        left_area[b] = acc_box.HalfArea();
+        left_count[b] = acc_count;
+    }
+
+    int best_split = -1;
+    float best_cost = 1e30f;
+    acc_box = CPUBoundingBox();
+    acc_count = 0;
+    for (int b = BVH_NUM_BINS - 1; b > 0; b--) {
+        acc_box.Extend(bin_box[b]);
+        acc_count += bin_count[b];
+        if (left_count[b - 1] == 0 || acc_count == 0)
+            continue;
+        float cost = left_area[b - 1] * left_count[b - 1] + acc_box.HalfArea() * acc_count;
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_split = b - 1;
+        }
+    }
+
+    int mid = first;
+    if (best_split >= 0) {
+        // do not split if a leaf is cheaper (traversal cost of one box test per node)
+        float leaf_cost = box.HalfArea() * count;
+        if (best_cost + box.HalfArea() >= leaf_cost && count <= 4 * max_leaf_size)
+            return;
+        auto it = std::partition(m_indices.begin() + first, m_indices.begin() + first + count,
+                                 [&](int prim) { return bin_of(prim) <= best_split; });
+        mid = (int)(it - m_indices.begin());
+    }
+
+    // fall back to a median split if the binning could not separate the primitives
+    if (mid == first || mid == first + count) {
+        mid = first + count / 2;
+        std::nth_element(m_indices.begin() + first, m_indices.begin() + mid, m_indices.begin() + first + count,
+                         [&](int a, int b) { return centers[a][axis] < centers[b][axis]; });
+    }
+
+    int left = (int)m_nodes.size();
+    Node child;
+    child.axis = 0;
+    child.first = first;
+    child.count = mid - first;
+    m_nodes.push_back(child);
+    child.first = mid;
+    child.count = first + count - mid;
+    m_nodes.push_back(child);
+
+    m_nodes[node_id].first = left;
+    m_nodes[node_id].count = 0;
+    m_nodes[node_id].axis = axis;
+
+    Subdivide(left, prim_boxes, centers, max_leaf_size, depth + 1);
+    Subdivide(left + 1, prim_boxes, centers, max_leaf_size, depth + 1);
+}
+
+void ChCPUBVH::Refit(const std::vector<CPUBoundingBox>& prim_boxes) {
+    // children are always stored after their parent, so a reverse sweep updates the tree bottom-up
+    for (int n = (int)m_nodes.size() - 1; n >= 0; n--) {
+        Node& node = m_nodes[n];
+        CPUBoundingBox box;
+        if (node.count > 0) {
+            for (int i = node.first; i < node.first + node.count; i++)
+                box.Extend(prim_boxes[m_indices[i]]);
+        } else {
+            box.Extend(m_nodes[node.first].box);
+            box.Extend(m_nodes[node.first + 1].box);
+        }
+        node.box = box;
+    }
+
+    m_cost = ComputeCost();
+}
+
+float ChCPUBVH::ComputeCost() const {
+    if (m_nodes.empty())
+        return 0;
+
+    float cost = 0;
+    for (const auto& node : m_nodes) {
+        float area = node.box.HalfArea();
+        cost += node.count > 0 ? area * node.count : area;
+    }
+
+    float root_area = m_nodes[0].box.HalfArea();
+    return root_area > 0 ? cost / root_area : cost;
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Bounding volume hierarchy used by the CPU ray tracing backend
+//
+// =============================================================================
+
+#ifndef CHCPUBVH_H
+#define CHCPUBVH_H
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono/core/ChVector3.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Axis-aligned bounding box used by the CPU ray tracer.
+struct CPUBoundingBox {
+    /// Default constructor creates an empty (inverted) box.
+    CPUBoundingBox() : bmin(1e30f), bmax(-1e30f) {}
+
+    /// Grow the box to include the given point.
+    void Extend(const ChVector3f& p) {
+        bmin = ChVector3f(std::min(bmin.x(), p.x()), std::min(bmin.y(), p.y()), std::min(bmin.z(), p.z()));
+        bmax = ChVector3f(std::max(bmax.x(), p.x()), std::max(bmax.y(), p.y()), std::max(bmax.z(), p.z()));
+    }
+
+    /// Grow the box to include the given box.
+    void Extend(const CPUBoundingBox& b) {
+        Extend(b.bmin);
+        Extend(b.bmax);
+    }
+
+    /// Return the center of the box.
+    ChVector3f Center() const { return (bmin + bmax) * 0.5f; }
+
+    /// Return half of the surface area of the box (zero for an empty box).
+    float HalfArea() const {
+        ChVector3f e = bmax - bmin;
+        if (e.x() < 0 || e.y() < 0 || e.z() < 0)
+            return 0;
+        return e.x() * e.y() + e.y() * e.z() + e.z() * e.x();
+    }
+
+    ChVector3f bmin;  ///< lower corner
+    ChVector3f bmax;  ///< upper corner
+};
+
+/// Bounding volume hierarchy over a set of primitive bounding boxes, built with a binned surface area heuristic (SAH).
+/// The hierarchy can be refitted in place when the primitives move, which keeps the tree topology and only updates the
+/// node bounds. The SAH cost of the tree is tracked so that the owner can decide when the quality of a refitted tree
+/// has degraded enough to warrant a full rebuild.
+class CH_SENSOR_API ChCPUBVH {
+  public:
+    /// Node of the hierarchy. The two children of an internal node are stored consecutively.
+    struct Node {
+        CPUBoundingBox box;  ///< bounds of all primitives below this node
+        int first;           ///< index of the first primitive (leaf) or of the left child (internal node)
+        int count;           ///< number of primitives in a leaf, 0 for an internal node
+        int axis;            ///< split axis of an internal node
+    };
+
+    ChCPUBVH() : m_build_cost(0), m_cost(0) {}
+
+    /// Build the hierarchy from scratch.
+    /// @param prim_boxes Bounding boxes of the primitives. Primitive i is referred to by index i.
+    /// @param max_leaf_size Maximum number of primitives in a leaf node.
+    void Build(const std::vector<CPUBoundingBox>& prim_boxes, int max_leaf_size = 4);
+
+    /// Update the node bounds for new primitive bounding boxes, keeping the tree topology.
+    /// The number of primitives must be the same as in the last call to Build.
+    void Refit(const std::vector<CPUBoundingBox>& prim_boxes);
+
+    /// Return true if the SAH cost of the refitted tree exceeds the cost of the tree at build time by the given ratio.
+    bool NeedsRebuild(float ratio) const { return m_cost > ratio * m_build_cost; }
+
+    /// Return true if the hierarchy contains no primitives.
+    bool IsEmpty() const { return m_nodes.empty(); }
+
+    /// Get the SAH cost of the current tree, relative to the area of the root node.
+    float GetCost() const { return m_cost; }
+
+    /// Get the nodes of the hierarchy. The root node is the first node.
+    const std::vector<Node>& GetNodes() const { return m_nodes; }
+
+    /// Get the primitive indices referenced by the leaf nodes.
+    const std::vector<int>& GetIndices() const { return m_indices; }
+
+  private:
+    void Subdivide(int node_id,
+                   const std::vector<CPUBoundingBox>& prim_boxes,
+                   const std::vector<ChVector3f>& centers,
+                   int max_leaf_size,
+                   int depth);
+    float ComputeCost() const;
+
+    std::vector<Node> m_nodes;   ///< tree nodes, children always stored after their parent
+    std::vector<int> m_indices;  ///< primitive indices, ordered by leaf
+    float m_build_cost;          ///< SAH cost of the tree right after the last build
+    float m_cost;                ///< SAH cost of the tree after the last refit
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,221 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChCPUEngine.h"
+
+#include <algorithm>
+#include <iostream>
+
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/sensors/ChRadarSensor.h"
+
+#include "chrono/assets/ChVisualShapeBox.h"
+#include "chrono/assets/ChVisualShapeCylinder.h"
+#include "chrono/assets/ChVisualShapeSphere.h"
+#include "chrono/assets/ChVisualShapeTriangleMesh.h"
+
+namespace chrono {
+namespace sensor {
+
+ChCPUEngine::ChCPUEngine(ChSystem* sys, int num_threads, bool verbose)
+    : m_verbose(verbose), m_system(sys), m_num_threads(std::max(1, num_threads)), m_scene_constructed(false) {}
+
+void ChCPUEngine::SetNumThreads(int num_threads) {
+    m_num_threads = std::max(1, num_threads);
+    for (auto& renderer : m_assignedRenderers)
+        renderer->m_num_threads = m_num_threads;
+}
+
+void ChCPUEngine::AssignSensor(std::shared_ptr<ChOptixSensor> sensor) {
+    if (!std::dynamic_pointer_cast<ChLidarSensor>(sensor) && !std::dynamic_pointer_cast<ChDepthCamera>(sensor) &&
+        !std::dynamic_pointer_cast<ChRadarSensor>(sensor)) {
+        throw std::runtime_error("Sensor " + sensor->GetName() +
+                                 " is not supported by the CPU engine (only lidar, depth camera and radar)");
+    }
+
+    if (std::find(m_assignedSensor.begin(), m_assignedSensor.end(), sensor) != m_assignedSensor.end()) {
+        std::cerr << "WARNING: This sensor already exists in manager. Ignoring this addition\n";
+        return;
+    }
+
+    // all filters after the render filter must be able to process data in host memory
+    for (auto f : sensor->GetFilterList()) {
+        if (!f->SupportsHostBuffers()) {
+            throw std::runtime_error("Filter " + f->Name() + " of sensor " + sensor->GetName() +
+                                     " does not support the CPU engine");
+        }
+    }
+
+    sensor->SetHostRendered(true);
+
+    m_assignedSensor.push_back(sensor);
+    m_cameraStartFrames.push_back(sensor->GetParent()->GetVisualModelFrame());
+    m_cameraStartFrames_set.push_back(false);
+
+    // create a ChFilterCPURender and push to front of filter list
+    auto cpu_filter = chrono_types::make_shared<ChFilterCPURender>();
+    cpu_filter->m_tracer = &m_tracer;
+    cpu_filter->m_num_threads = m_num_threads;
+    m_assignedRenderers.push_back(cpu_filter);
+    sensor->PushFilterFront(cpu_filter);
+    sensor->LockFilterList();
+
+    std::shared_ptr<SensorBuffer> buffer;
+    for (auto f : sensor->GetFilterList()) {
+        f->Initialize(sensor, buffer);
+    }
+}
+
+void ChCPUEngine::UpdateSensors(std::shared_ptr<ChScene> scene) {
+    if (!m_scene_constructed) {
+        ConstructScene();
+    }
+    std::vector<int> to_be_updated;
+
+    // check if any of the sensors would be collecting data right now, if so, pack a tmp start keyframe
+    for (int i = 0; i < (int)m_assignedSensor.size(); i++) {
+        auto sensor = m_assignedSensor[i];
+        if (m_system->GetChTime() > sensor->GetNumLaunches() / sensor->GetUpdateRate() - 1e-7 &&
+            !m_cameraStartFrames_set[i]) {
+            m_cameraStartFrames[i] = sensor->GetParent()->GetVisualModelFrame();
+            m_cameraStartFrames_set[i] = true;
+        }
+    }
+
+    // check which sensors need to be updated this step
+    for (int i = 0; i < (int)m_assignedSensor.size(); i++) {
+        auto sensor = m_assignedSensor[i];
+        if (m_system->GetChTime() >
+            sensor->GetNumLaunches() / sensor->GetUpdateRate() + sensor->GetCollectionWindow() - 1e-7) {
+            to_be_updated.push_back(i);
+        }
+    }
+
+    if (to_be_updated.empty())
+        return;
+
+    UpdateCameraTransforms(to_be_updated, scene);
+
+    // refit the acceleration structures once for all sensors updated this step
+    m_tracer.Update(scene->GetOriginOffset(), m_num_threads);
+
+    float t = (float)m_system->GetChTime();
+    for (auto i : to_be_updated) {
+        auto sensor = m_assignedSensor[i];
+        sensor->IncrementNumLaunches();
+        m_assignedRenderers[i]->m_time_stamp = t;
+        m_assignedRenderers[i]->m_scene_epsilon = scene->GetSceneEpsilon();
+
+        // rendering and post-processing are done synchronously, so the data is available without lag
+        for (auto& f : sensor->GetFilterList()) {
+            f->Apply();
+        }
+    }
+}
+
+void ChCPUEngine::ConstructScene() {
+    m_tracer.Clear();
+
+    // iterate through all bodies in Chrono and add an instance for each visual shape
+    for (auto body : m_system->GetBodies()) {
+        if (!body->GetVisualModel())
+            continue;
+        for (auto& shape_instance : body->GetVisualModel()->GetShapeInstances()) {
+            const auto& shape = shape_instance.first;
+            const auto& shape_frame = shape_instance.second;
+
+            if (!shape->IsVisible()) {
+                continue;
+            } else if (auto box_shape = std::dynamic_pointer_cast<ChVisualShapeBox>(shape)) {
+                m_tracer.AddBox(body, shape_frame, box_shape->GetLengths());
+            } else if (auto sphere_shape = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape)) {
+                m_tracer.AddSphere(body, shape_frame, sphere_shape->GetRadius());
+            } else if (auto cylinder_shape = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
+                m_tracer.AddCylinder(body, shape_frame, cylinder_shape->GetRadius(), cylinder_shape->GetHeight());
+            } else if (auto trimesh_shape = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape)) {
+                m_tracer.AddMesh(body, shape_frame, trimesh_shape->GetMesh(), trimesh_shape->GetScale(),
+                                 trimesh_shape->IsMutable());
+            }
+        }
+    }
+
+    // Assumption made here that other physics items don't have a transform -> not always true!!!
+    for (auto item : m_system->GetOtherPhysicsItems()) {
+        if (!item->GetVisualModel())
+            continue;
+        auto dummy_body = chrono_types::make_shared<ChBody>();
+        for (auto& shape_instance : item->GetVisualModel()->GetShapeInstances()) {
+            const auto& shape = shape_instance.first;
+            const auto& shape_frame = shape_instance.second;
+
+            if (!shape->IsVisible()) {
+                continue;
+            } else if (auto box_shape = std::dynamic_pointer_cast<ChVisualShapeBox>(shape)) {
+                m_tracer.AddBox(dummy_body, shape_frame, box_shape->GetLengths());
+            } else if (auto sphere_shape = std::dynamic_pointer_cast<ChVisualShapeSphere>(shape)) {
+                m_tracer.AddSphere(dummy_body, shape_frame, sphere_shape->GetRadius());
+            } else if (auto cylinder_shape = std::dynamic_pointer_cast<ChVisualShapeCylinder>(shape)) {
+                m_tracer.AddCylinder(dummy_body, shape_frame, cylinder_shape->GetRadius(),
+                                     cylinder_shape->GetHeight());
+            } else if (auto trimesh_shape = std::dynamic_pointer_cast<ChVisualShapeTriangleMesh>(shape)) {
+                m_tracer.AddMesh(dummy_body, shape_frame, trimesh_shape->GetMesh(), trimesh_shape->GetScale(),
+                                 trimesh_shape->IsMutable());
+            }
+        }
+    }
+
+    if (m_verbose)
+        std::cout << "CPU engine scene constructed with " << m_tracer.GetNumInstances() << " shapes\n";
+
+    m_scene_constructed = true;
+}
+
+void ChCPUEngine::UpdateCameraTransforms(std::vector<int>& to_be_updated, std::shared_ptr<ChScene> scene) {
+    // go through the sensors to be updated and see if we need to move the scene origin
+    for (auto id : to_be_updated) {
+        ChFrame<double> global_loc_0 = m_cameraStartFrames[id] * m_assignedSensor[id]->GetOffsetPose();
+        scene->UpdateOriginOffset(global_loc_0.GetPos());
+    }
+
+    for (auto id : to_be_updated) {
+        auto sensor = m_assignedSensor[id];
+        auto renderer = m_assignedRenderers[id];
+
+        // update radar velocity
+        if (auto radar = std::dynamic_pointer_cast<ChRadarSensor>(sensor)) {
+            auto r = radar->GetOffsetPose().GetPos();
+            auto ang_vel = radar->GetAngularVelocity() % r;
+            renderer->m_radar_velocity =
+                radar->GetOffsetPose().TransformDirectionLocalToParent(ang_vel) + radar->GetTranslationalVelocity();
+        }
+
+        ChFrame<double> f_offset = sensor->GetOffsetPose();
+        ChFrame<double> f_body_0 = m_cameraStartFrames[id];
+        m_cameraStartFrames_set[id] = false;  // reset this camera frame so that we know it should be packed again
+        ChFrame<double> f_body_1 = sensor->GetParent()->GetVisualModelFrame();
+        ChFrame<double> global_loc_0 = f_body_0 * f_offset;
+        ChFrame<double> global_loc_1 = f_body_1 * f_offset;
+
+        renderer->m_pos0 = global_loc_0.GetPos() - scene->GetOriginOffset();
+        renderer->m_rot0 = global_loc_0.GetRot();
+        renderer->m_pos1 = global_loc_1.GetPos() - scene->GetOriginOffset();
+        renderer->m_rot1 = global_loc_1.GetRot();
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// CPU rendering engine for lidar, depth camera and radar sensors. Sensors are
+// traced and their filter graphs processed synchronously on the calling
+// thread, using a pool of worker threads for the ray tracing.
+//
+// =============================================================================
+
+#ifndef CHCPUENGINE_H
+#define CHCPUENGINE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/optix/scene/ChScene.h"
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// CPU engine that is responsible for managing the render-based sensors when no GPU ray tracing is available.
+/// Supports ChLidarSensor, ChDepthCamera and ChRadarSensor. All filters of a sensor handled by this engine must
+/// support host buffers (see ChFilter::SupportsHostBuffers).
+class CH_SENSOR_API ChCPUEngine {
+  public:
+    /// Class constructor
+    /// @param sys Pointer to the ChSystem that defines the simulation
+    /// @param num_threads Number of threads used for ray tracing
+    /// @param verbose Sets verbose level for the engine
+    ChCPUEngine(ChSystem* sys, int num_threads, bool verbose = false);
+
+    /// Add a sensor for this engine to manage and update
+    /// @param sensor A shared pointer to a lidar, depth camera or radar sensor
+    void AssignSensor(std::shared_ptr<ChOptixSensor> sensor);
+
+    /// Updates the sensors if they need to be updated based on simulation time and last update time. Rendering and
+    /// filter processing complete before this function returns.
+    /// @param scene The scene that should be rendered with.
+    void UpdateSensors(std::shared_ptr<ChScene> scene);
+
+    /// Construct the scene from scratch, translating all visual shapes from Chrono into the ray tracer.
+    void ConstructScene();
+
+    /// Query the number of sensors for which this engine is responsible.
+    /// @return The number of sensors managed by this engine
+    int GetNumSensor() { return (int)m_assignedSensor.size(); }
+
+    /// Gives the user access to the list of sensors being managed by this engine.
+    /// @return the vector of Chrono sensors
+    std::vector<std::shared_ptr<ChOptixSensor>> GetSensor() { return m_assignedSensor; }
+
+    /// Set the number of threads used for ray tracing.
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of threads used for ray tracing.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Access the ray tracer holding the scene of this engine.
+    const ChCPURayTracer& GetRayTracer() const { return m_tracer; }
+
+  private:
+    void UpdateCameraTransforms(std::vector<int>& to_be_updated, std::shared_ptr<ChScene> scene);
+
+    bool m_verbose;            ///< whether the engine should print errors and warnings
+    ChSystem* m_system;        ///< the chrono system that defines the scene
+    int m_num_threads;         ///< number of threads used for ray tracing
+    bool m_scene_constructed;  ///< the scene has been translated into the ray tracer
+    ChCPURayTracer m_tracer;   ///< acceleration structures of the scene
+
+    std::vector<std::shared_ptr<ChOptixSensor>> m_assignedSensor;         ///< list of sensors this engine manages
+    std::vector<std::shared_ptr<ChFilterCPURender>> m_assignedRenderers;  ///< render filter of each sensor
+    std::vector<ChFrame<double>> m_cameraStartFrames;  ///< sensor body frames at the start of the collection window
+    std::vector<bool> m_cameraStartFrames_set;         ///< whether the start frame has been packed
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -0,0 +1,510 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Two-level ray tracer for the CPU backend. Primitive shapes are intersected
+// analytically in their local frame, using the same unit shapes as the OptiX
+// intersection programs (unit box, unit sphere, unit cylinder along Z).
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+
+#include <cmath>
+
+namespace chrono {
+namespace sensor {
+
+// Traversal stack size, must be larger than the maximum depth of a ChCPUBVH
+static const int TRAVERSAL_STACK_SIZE = 64;
+
+// Slab test of a ray against an axis-aligned box, limited to the interval [tmin, tmax]
+static inline bool HitBox(const CPUBoundingBox& box,
+                          const ChVector3f& orig,
+                          const ChVector3f& inv_dir,
+                          float tmin,
+                          float tmax) {
+    for (int k = 0; k < 3; k++) {
+        float t0 = (box.bmin[k] - orig[k]) * inv_dir[k];
+        float t1 = (box.bmax[k] - orig[k]) * inv_dir[k];
+        if (t0 > t1)
+            std::swap(t0, t1);
+        tmin = t0 > tmin ? t0 : tmin;
+        tmax = t1 < tmax ? t1 : tmax;
+        if (tmin > tmax)
+            return false;
+    }
+    return true;
+}
+
+static inline ChVector3f Reciprocal(const ChVector3f& v) {
+    return ChVector3f(1.f / v.x(), 1.f / v.y(), 1.f / v.z());
+}
+
+// Traverse a hierarchy with a packet of rays. A node is visited if any ray of the packet intersects its bounds within
+// the current [tmin, tmax] interval of that ray. The leaf callback may shorten the tmax values.
+template <class LeafFunc>
+static void TraversePacket(const ChCPUBVH& bvh,
+                           int size,
+                           const ChVector3f* orig,
+                           const ChVector3f* inv_dir,
+                           const float* tmin,
+                           const float* tmax,
+                           LeafFunc&& leaf) {
+    const auto& nodes = bvh.GetNodes();
+    int stack[TRAVERSAL_STACK_SIZE];
+    int sp = 0;
+    stack[sp++] = 0;
+
+    while (sp > 0) {
+        const ChCPUBVH::Node& node = nodes[stack[--sp]];
+
+        bool active = false;
+        for (int r = 0; r < size && !active; r++)
+            active = HitBox(node.box, orig[r], inv_dir[r], tmin[r], tmax[r]);
+        if (!active)
+            continue;
+
+        if (node.count > 0) {
+            leaf(node.first, node.count);
+            continue;
+        }
+
+        // visit first the child on the side from which the packet comes
+        if (inv_dir[0][node.axis] < 0) {
+            stack[sp++] = node.first;
+            stack[sp++] = node.first + 1;
+        } else {
+            stack[sp++] = node.first + 1;
+            stack[sp++] = node.first;
+        }
+    }
+}
+
+// Intersection with the unit box [-0.5, 0.5]^3
+static inline bool IntersectUnitBox(const ChVector3f& o,
+                                    const ChVector3f& inv_d,
+                                    float tmin,
+                                    float tmax,
+                                    float& t,
+                                    ChVector3f& n) {
+    float t_near = -1e30f;
+    float t_far = 1e30f;
+    int axis_near = 0;
+    int axis_far = 0;
+    for (int k = 0; k < 3; k++) {
+        float t0 = (-0.5f - o[k]) * inv_d[k];
+        float t1 = (0.5f - o[k]) * inv_d[k];
+        if (std::min(t0, t1) > t_near) {
+            t_near = std::min(t0, t1);
+            axis_near = k;
+        }
+        if (std::max(t0, t1) < t_far) {
+            t_far = std::max(t0, t1);
+            axis_far = k;
+        }
+    }
+    if (t_near > t_far)
+        return false;
+
+    int axis;
+    if (t_near > tmin && t_near < tmax) {
+        t = t_near;
+        axis = axis_near;
+    } else if (t_far > tmin && t_far < tmax) {
+        t = t_far;
+        axis = axis_far;
+    } else {
+        return false;
+    }
+    n = ChVector3f(0, 0, 0);
+    n[axis] = o[axis] + t / inv_d[axis] > 0 ? 1.f : -1.f;
+    return true;
+}
+
+// Intersection with the unit sphere centered at the origin
+static inline bool IntersectUnitSphere(const ChVector3f& o,
+                                       const ChVector3f& d,
+                                       float tmin,
+                                       float tmax,
+                                       float& t,
+                                       ChVector3f& n) {
+    float a = d ^ d;
+    float b = 2 * (d ^ o);
+    float c = (o ^ o) - 1;
+    float det = b * b - 4 * a * c;
+    if (det <= 0)
+        return false;
+
+    det = std::sqrt(det);
+    float t_near = (-b - det) / (2 * a);
+    float t_far = (-b + det) / (2 * a);
+    if (t_near > tmin && t_near < tmax)
+        t = t_near;
+    else if (t_far > tmin && t_far < tmax)
+        t = t_far;
+    else
+        return false;
+    n = o + d * t;
+    return true;
+}
+
+// Intersection with the unit cylinder of radius 1 along the Z axis, with z in [-0.5, 0.5]
+static inline bool IntersectUnitCylinder(const ChVector3f& o,
+                                         const ChVector3f& d,
+                                         float tmin,
+                                         float tmax,
+                                         float& t,
+                                         ChVector3f& n) {
+    bool found = false;
+
+    // end caps
+    for (float zc : {0.5f, -0.5f}) {
+        float tc = (zc - o.z()) / d.z();
+        if (tc > tmin && tc < tmax) {
+            float px = o.x() + d.x() * tc;
+            float py = o.y() + d.y() * tc;
+            if (px * px + py * py < 1) {
+                t = tmax = tc;
+                n = ChVector3f(0, 0, zc > 0 ? 1.f : -1.f);
+                found = true;
+            }
+        }
+    }
+
+    // lateral surface
+    float a = d.x() * d.x() + d.y() * d.y();
+    float b = 2 * (d.x() * o.x() + d.y() * o.y());
+    float c = o.x() * o.x() + o.y() * o.y() - 1;
+    float det = b * b - 4 * a * c;
+    if (a > 0 && det > 0) {
+        det = std::sqrt(det);
+        for (float ts : {(-b - det) / (2 * a), (-b + det) / (2 * a)}) {
+            float pz = o.z() + d.z() * ts;
+            if (ts > tmin && ts < tmax && pz > -0.5f && pz < 0.5f) {
+                t = tmax = ts;
+                n = ChVector3f(o.x() + d.x() * ts, o.y() + d.y() * ts, 0);
+                found = true;
+                break;
+            }
+        }
+    }
+
+    return found;
+}
+
+// Double-sided ray-triangle intersection (Moller-Trumbore)
+static inline bool IntersectTriangle(const ChVector3f& o,
+                                     const ChVector3f& d,
+                                     const ChVector3f& v0,
+                                     const ChVector3f& v1,
+                                     const ChVector3f& v2,
+                                     float tmin,
+                                     float tmax,
+                                     float& t) {
+    ChVector3f e1 = v1 - v0;
+    ChVector3f e2 = v2 - v0;
+    ChVector3f p = d % e2;
+    float det = e1 ^ p;
+    if (std::abs(det) < 1e-12f)
+        return false;
+    float inv_det = 1.f / det;
+    ChVector3f s = o - v0;
+    float u = (s ^ p) * inv_det;
+    if (u < 0 || u > 1)
+        return false;
+    ChVector3f q = s % e1;
+    float v = (d ^ q) * inv_det;
+    if (v < 0 || u + v > 1)
+        return false;
+    float tt = (e2 ^ q) * inv_det;
+    if (tt <= tmin || tt >= tmax)
+        return false;
+    t = tt;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+ChCPURayTracer::ChCPURayTracer() : m_tlas_dirty(true), m_num_rebuilds(0), m_rebuild_ratio(1.5f) {}
+
+void ChCPURayTracer::Clear() {
+    m_instances.clear();
+    m_meshes.clear();
+    m_mesh_map.clear();
+    m_instance_boxes.clear();
+    m_tlas = ChCPUBVH();
+    m_tlas_dirty = true;
+    m_num_rebuilds = 0;
+}
+
+void ChCPURayTracer::AddBox(std::shared_ptr<ChBody> body, const ChFrame<>& asset_frame, const ChVector3d& lengths) {
+    AddInstance(ShapeType::BOX, body, asset_frame, lengths, -1);
+}
+
+void ChCPURayTracer::AddSphere(std::shared_ptr<ChBody> body, const ChFrame<>& asset_frame, double radius) {
+    AddInstance(ShapeType::SPHERE, body, asset_frame, ChVector3d(radius), -1);
+}
+
+void ChCPURayTracer::AddCylinder(std::shared_ptr<ChBody> body,
+                                 const ChFrame<>& asset_frame,
+                                 double radius,
+                                 double height) {
+    AddInstance(ShapeType::CYLINDER, body, asset_frame, ChVector3d(radius, radius, height), -1);
+}
+
+void ChCPURayTracer::AddMesh(std::shared_ptr<ChBody> body,
+                             const ChFrame<>& asset_frame,
+                             std::shared_ptr<ChTriangleMeshConnected> mesh,
+                             const ChVector3d& scale,
+                             bool deformable) {
+    int mesh_id;
+    auto it = m_mesh_map.find(mesh.get());
+    if (it != m_mesh_map.end()) {
+        mesh_id = it->second;
+        m_meshes[mesh_id].deformable |= deformable;
+    } else {
+        mesh_id = (int)m_meshes.size();
+        m_meshes.emplace_back();
+        m_meshes[mesh_id].trimesh = mesh;
+        m_meshes[mesh_id].deformable = deformable;
+        LoadMesh(m_meshes[mesh_id]);
+        m_mesh_map[mesh.get()] = mesh_id;
+    }
+    AddInstance(ShapeType::MESH, body, asset_frame, scale, mesh_id);
+}
+
+void ChCPURayTracer::AddInstance(ShapeType type,
+                                 std::shared_ptr<ChBody> body,
+                                 const ChFrame<>& asset_frame,
+                                 const ChVector3d& scale,
+                                 int mesh) {
+    Instance inst;
+    inst.type = type;
+    inst.body = body;
+    inst.asset_frame = asset_frame;
+    inst.scale = scale;
+    inst.mesh = mesh;
+    m_instances.push_back(inst);
+    m_tlas_dirty = true;
+}
+
+void ChCPURayTracer::LoadMesh(Mesh& mesh) {
+    const auto& vertices = mesh.trimesh->GetCoordsVertices();
+    const auto& triangles = mesh.trimesh->GetIndicesVertexes();
+
+    mesh.vertices.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        mesh.vertices[i] = ChVector3f(vertices[i]);
+    mesh.triangles = triangles;
+
+    mesh.tri_boxes.resize(triangles.size());
+    for (size_t i = 0; i < triangles.size(); i++) {
+        CPUBoundingBox box;
+        for (int k = 0; k < 3; k++)
+            box.Extend(mesh.vertices[triangles[i][k]]);
+        mesh.tri_boxes[i] = box;
+    }
+
+    mesh.bvh.Build(mesh.tri_boxes, 4);
+}
+
+CPUBoundingBox ChCPURayTracer::GetLocalBox(const Instance& inst) const {
+    CPUBoundingBox box;
+    switch (inst.type) {
+        case ShapeType::BOX:
+            box.bmin = ChVector3f(-0.5f);
+            box.bmax = ChVector3f(0.5f);
+            break;
+        case ShapeType::SPHERE:
+            box.bmin = ChVector3f(-1.f);
+            box.bmax = ChVector3f(1.f);
+            break;
+        case ShapeType::CYLINDER:
+            box.bmin = ChVector3f(-1.f, -1.f, -0.5f);
+            box.bmax = ChVector3f(1.f, 1.f, 0.5f);
+            break;
+        case ShapeType::MESH:
+            if (!m_meshes[inst.mesh].bvh.IsEmpty())
+                box = m_meshes[inst.mesh].bvh.GetNodes()[0].box;
+            break;
+    }
+    return box;
+}
+
+void ChCPURayTracer::Update(const ChVector3d& origin, int num_threads) {
+    // refresh deformable meshes, rebuilding their hierarchy only if the topology changed or the quality degraded
+    int num_meshes = (int)m_meshes.size();
+#pragma omp parallel for num_threads(num_threads) schedule(dynamic)
+    for (int m = 0; m < num_meshes; m++) {
+        Mesh& mesh = m_meshes[m];
+        if (!mesh.deformable)
+            continue;
+
+        const auto& vertices = mesh.trimesh->GetCoordsVertices();
+        const auto& triangles = mesh.trimesh->GetIndicesVertexes();
+        if (vertices.size() != mesh.vertices.size() || triangles.size() != mesh.triangles.size()) {
+            LoadMesh(mesh);
+            continue;
+        }
+
+        for (size_t i = 0; i < vertices.size(); i++)
+            mesh.vertices[i] = ChVector3f(vertices[i]);
+        for (size_t i = 0; i < triangles.size(); i++) {
+            CPUBoundingBox box;
+            for (int k = 0; k < 3; k++)
+                box.Extend(mesh.vertices[mesh.triangles[i][k]]);
+            mesh.tri_boxes[i] = box;
+        }
+        mesh.bvh.Refit(mesh.tri_boxes);
+        if (mesh.bvh.NeedsRebuild(m_rebuild_ratio))
+            mesh.bvh.Build(mesh.tri_boxes, 4);
+    }
+
+    // update instance poses, velocities, and world bounds
+    int num_instances = (int)m_instances.size();
+    m_instance_boxes.resize(num_instances);
+#pragma omp parallel for num_threads(num_threads) if (num_instances > 256)
+    for (int i = 0; i < num_instances; i++) {
+        Instance& inst = m_instances[i];
+        ChFrame<> frame = inst.body->GetFrameRefToAbs() * inst.asset_frame;
+        const ChQuaternion<>& q = frame.GetRot();
+
+        inst.pos = ChVector3f(frame.GetPos() - origin);
+        inst.axis[0] = ChVector3f(q.GetAxisX());
+        inst.axis[1] = ChVector3f(q.GetAxisY());
+        inst.axis[2] = ChVector3f(q.GetAxisZ());
+        inst.inv_scale =
+            ChVector3f(1.f / (float)inst.scale.x(), 1.f / (float)inst.scale.y(), 1.f / (float)inst.scale.z());
+        inst.lin_vel = ChVector3f(inst.body->GetPosDt());
+        inst.ang_vel = ChVector3f(inst.body->GetAngVelParent());
+
+        CPUBoundingBox local = GetLocalBox(inst);
+        CPUBoundingBox world;
+        if (local.HalfArea() > 0 || local.bmin.x() <= local.bmax.x()) {
+            for (int c = 0; c < 8; c++) {
+                ChVector3f p((c & 1) ? local.bmax.x() : local.bmin.x(), (c & 2) ? local.bmax.y() : local.bmin.y(),
+                             (c & 4) ? local.bmax.z() : local.bmin.z());
+                world.Extend(inst.pos + inst.axis[0] * (p.x() * (float)inst.scale.x()) +
+                             inst.axis[1] * (p.y() * (float)inst.scale.y()) +
+                             inst.axis[2] * (p.z() * (float)inst.scale.z()));
+            }
+        }
+        m_instance_boxes[i] = world;
+    }
+
+    // refit the top-level hierarchy and rebuild it only when needed
+    if (m_tlas_dirty) {
+        m_tlas.Build(m_instance_boxes, 2);
+        m_tlas_dirty = false;
+        m_num_rebuilds++;
+    } else {
+        m_tlas.Refit(m_instance_boxes);
+        if (m_tlas.NeedsRebuild(m_rebuild_ratio)) {
+            m_tlas.Build(m_instance_boxes, 2);
+            m_num_rebuilds++;
+        }
+    }
+}
+
+void ChCPURayTracer::Intersect(CPURayPacket& packet) const {
+    for (int r = 0; r < packet.size; r++)
+        packet.hit[r] = -1;
+    if (m_tlas_dirty || m_tlas.IsEmpty())
+        return;
+
+    ChVector3f inv_dir[CPURayPacket::MAX_SIZE];
+    for (int r = 0; r < packet.size; r++)
+        inv_dir[r] = Reciprocal(packet.direction[r]);
+
+    const auto& indices = m_tlas.GetIndices();
+    TraversePacket(m_tlas, packet.size, packet.origin, inv_dir, packet.tmin, packet.tmax, [&](int first, int count) {
+        for (int i = first; i < first + count; i++)
+            IntersectInstance(indices[i], packet);
+    });
+}
+
+void ChCPURayTracer::IntersectInstance(int id, CPURayPacket& packet) const {
+    const Instance& inst = m_instances[id];
+
+    // rays in the local (unscaled) frame of the instance; the ray parameter is unchanged by the transformation
+    ChVector3f orig[CPURayPacket::MAX_SIZE];
+    ChVector3f dir[CPURayPacket::MAX_SIZE];
+    ChVector3f inv_dir[CPURayPacket::MAX_SIZE];
+    for (int r = 0; r < packet.size; r++) {
+        ChVector3f o = packet.origin[r] - inst.pos;
+        const ChVector3f& d = packet.direction[r];
+        orig[r] = ChVector3f(o ^ inst.axis[0], o ^ inst.axis[1], o ^ inst.axis[2]) * inst.inv_scale;
+        dir[r] = ChVector3f(d ^ inst.axis[0], d ^ inst.axis[1], d ^ inst.axis[2]) * inst.inv_scale;
+        inv_dir[r] = Reciprocal(dir[r]);
+    }
+
+    // record a hit with the given local normal
+    auto report = [&](int r, float t, const ChVector3f& n) {
+        ChVector3f ns = n * inst.inv_scale;
+        ChVector3f nw = inst.axis[0] * ns.x() + inst.axis[1] * ns.y() + inst.axis[2] * ns.z();
+        packet.tmax[r] = t;
+        packet.hit[r] = id;
+        packet.normal[r] = nw.GetNormalized();
+    };
+
+    float t;
+    ChVector3f n;
+    switch (inst.type) {
+        case ShapeType::BOX:
+            for (int r = 0; r < packet.size; r++) {
+                if (IntersectUnitBox(orig[r], inv_dir[r], packet.tmin[r], packet.tmax[r], t, n))
+                    report(r, t, n);
+            }
+            break;
+        case ShapeType::SPHERE:
+            for (int r = 0; r < packet.size; r++) {
+                if (IntersectUnitSphere(orig[r], dir[r], packet.tmin[r], packet.tmax[r], t, n))
+                    report(r, t, n);
+            }
+            break;
+        case ShapeType::CYLINDER:
+            for (int r = 0; r < packet.size; r++) {
+                if (IntersectUnitCylinder(orig[r], dir[r], packet.tmin[r], packet.tmax[r], t, n))
+                    report(r, t, n);
+            }
+            break;
+        case ShapeType::MESH: {
+            const Mesh& mesh = m_meshes[inst.mesh];
+            if (mesh.bvh.IsEmpty())
+                break;
+            const auto& indices = mesh.bvh.GetIndices();
+            TraversePacket(mesh.bvh, packet.size, orig, inv_dir, packet.tmin, packet.tmax, [&](int first, int count) {
+                for (int i = first; i < first + count; i++) {
+                    const ChVector3i& tri = mesh.triangles[indices[i]];
+                    const ChVector3f& v0 = mesh.vertices[tri[0]];
+                    const ChVector3f& v1 = mesh.vertices[tri[1]];
+                    const ChVector3f& v2 = mesh.vertices[tri[2]];
+                    for (int r = 0; r < packet.size; r++) {
+                        if (IntersectTriangle(orig[r], dir[r], v0, v1, v2, packet.tmin[r], packet.tmax[r], t))
+                            report(r, t, (v1 - v0) % (v2 - v0));
+                    }
+                }
+            });
+            break;
+        }
+    }
+}
+
+ChVector3f ChCPURayTracer::GetPointVelocity(int instance, const ChVector3f& point) const {
+    const Instance& inst = m_instances[instance];
+    return inst.lin_vel + inst.ang_vel % (point - inst.pos);
+}
+
+}  // namespace sensor
+}  // namespace chrono
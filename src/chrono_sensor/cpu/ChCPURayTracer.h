@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Two-level ray tracer for the CPU backend. Each visual shape is an instance
+// of a primitive (box, sphere, cylinder) or of a triangle mesh with its own
+// BVH. A top-level BVH over the instance bounds is refitted as bodies move.
+//
+// =============================================================================
+
+#ifndef CHCPURAYTRACER_H
+#define CHCPURAYTRACER_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono_sensor/ChApiSensor.h"
+#include "chrono_sensor/cpu/ChCPUBVH.h"
+
+#include "chrono/core/ChFrame.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+#include "chrono/physics/ChBody.h"
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Packet of coherent rays that are traced together through the acceleration structures.
+/// All positions are expressed relative to the origin of the ray tracer (see ChCPURayTracer::Update).
+struct CPURayPacket {
+    static const int MAX_SIZE = 16;  ///< maximum number of rays in a packet
+
+    int size = 0;                    ///< number of rays in the packet
+    ChVector3f origin[MAX_SIZE];     ///< ray origins
+    ChVector3f direction[MAX_SIZE];  ///< ray directions (unit length)
+    float tmin[MAX_SIZE];            ///< minimum hit distance
+    float tmax[MAX_SIZE];            ///< maximum hit distance; on return, the distance to the closest hit
+    int hit[MAX_SIZE];               ///< on return, index of the instance hit by the ray (-1 if no hit)
+    ChVector3f normal[MAX_SIZE];     ///< on return, unit world normal at the closest hit
+};
+
+/// CPU ray tracer for the visual shapes of a Chrono system.
+/// Shapes are added as instances attached to a body. Each call to Update recomputes the instance poses from the
+/// current body states, refreshes deformable meshes, and refits the acceleration structures. A hierarchy is only
+/// rebuilt when the refitted tree quality degrades beyond a given ratio.
+class CH_SENSOR_API ChCPURayTracer {
+  public:
+    ChCPURayTracer();
+
+    /// Remove all instances.
+    void Clear();
+
+    /// Add a box with the given side lengths, centered at the asset frame.
+    void AddBox(std::shared_ptr<ChBody> body, const ChFrame<>& asset_frame, const ChVector3d& lengths);
+
+    /// Add a sphere with the given radius, centered at the asset frame.
+    void AddSphere(std::shared_ptr<ChBody> body, const ChFrame<>& asset_frame, double radius);
+
+    /// Add a cylinder with the given radius and height, centered at the asset frame and aligned with its Z axis.
+    void AddCylinder(std::shared_ptr<ChBody> body, const ChFrame<>& asset_frame, double radius, double height);
+
+    /// Add a triangle mesh, scaled and expressed in the asset frame.
+    /// Instances of the same rigid mesh share a single mesh hierarchy. The vertices of a deformable mesh are re-read
+    /// at each update.
+    void AddMesh(std::shared_ptr<ChBody> body,
+                 const ChFrame<>& asset_frame,
+                 std::shared_ptr<ChTriangleMeshConnected> mesh,
+                 const ChVector3d& scale,
+                 bool deformable);
+
+    /// Update instance poses and velocities from the current body states and refit (or rebuild) the hierarchies.
+    /// @param origin Position subtracted from all world positions, so that tracing is done in single precision close
+    /// to the sensors.
+    /// @param num_threads Number of threads used for updating the instances and meshes.
+    void Update(const ChVector3d& origin, int num_threads = 1);
+
+    /// Find the closest hit for each ray in the packet.
+    void Intersect(CPURayPacket& packet) const;
+
+    /// Return the velocity (in the world frame) of the given point of an instance. The point is expressed relative to
+    /// the ray tracer origin.
+    ChVector3f GetPointVelocity(int instance, const ChVector3f& point) const;
+
+    /// Get the number of instances.
+    int GetNumInstances() const { return (int)m_instances.size(); }
+
+    /// Get the number of full rebuilds of the top-level hierarchy since the last call to Clear.
+    unsigned int GetNumRebuilds() const { return m_num_rebuilds; }
+
+    /// Set the ratio between the current and the initial SAH cost of a refitted hierarchy above which the hierarchy is
+    /// rebuilt (default: 1.5).
+    void SetRebuildRatio(float ratio) { m_rebuild_ratio = ratio; }
+
+  private:
+    enum class ShapeType { BOX, SPHERE, CYLINDER, MESH };
+
+    /// Triangle mesh with its own hierarchy, in mesh coordinates.
+    struct Mesh {
+        std::shared_ptr<ChTriangleMeshConnected> trimesh;
+        bool deformable;
+        std::vector<ChVector3f> vertices;
+        std::vector<ChVector3i> triangles;
+        std::vector<CPUBoundingBox> tri_boxes;
+        ChCPUBVH bvh;
+    };
+
+    /// Shape instance attached to a body.
+    struct Instance {
+        ShapeType type;
+        std::shared_ptr<ChBody> body;
+        ChFrame<> asset_frame;
+        ChVector3d scale;
+        int mesh;  ///< index of the mesh (MESH instances only)
+
+        // state at the last update, relative to the ray tracer origin
+        ChVector3f pos;        ///< position of the instance frame
+        ChVector3f axis[3];    ///< unit axes of the instance frame
+        ChVector3f inv_scale;  ///< inverse of the instance scaling
+        ChVector3f lin_vel;    ///< linear velocity of the body
+        ChVector3f ang_vel;    ///< angular velocity of the body, in the world frame
+    };
+
+    void AddInstance(ShapeType type,
+                     std::shared_ptr<ChBody> body,
+                     const ChFrame<>& asset_frame,
+                     const ChVector3d& scale,
+                     int mesh);
+    void LoadMesh(Mesh& mesh);
+    CPUBoundingBox GetLocalBox(const Instance& inst) const;
+    void IntersectInstance(int id, CPURayPacket& packet) const;
+
+    std::vector<Instance> m_instances;
+    std::vector<Mesh> m_meshes;
+    std::unordered_map<const ChTriangleMeshConnected*, int> m_mesh_map;  ///< mesh index of each added trimesh
+
+    std::vector<CPUBoundingBox> m_instance_boxes;  ///< world bounds of the instances
+    ChCPUBVH m_tlas;                               ///< top-level hierarchy over the instances
+    bool m_tlas_dirty;                             ///< the instance set changed since the last build
+    unsigned int m_num_rebuilds;                   ///< number of top-level rebuilds
+    float m_rebuild_ratio;                         ///< SAH cost ratio triggering a rebuild
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
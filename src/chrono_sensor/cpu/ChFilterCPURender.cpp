@@ -0,0 +1,355 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Ray generation and shading follow the OptiX programs of the lidar, depth
+// camera and radar pipelines (see optix/shaders).
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/ChFilterCPURender.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono_sensor/sensors/ChDepthCamera.h"
+#include "chrono_sensor/sensors/ChLidarSensor.h"
+#include "chrono_sensor/sensors/ChRadarSensor.h"
+#include "chrono_sensor/sensors/ChSensor.h"
+#include "chrono_sensor/sensors/ChSensorBuffer.h"
+#include "chrono_sensor/utils/CudaMallocHelper.h"
+
+#include "chrono/utils/ChConstants.h"
+
+namespace chrono {
+namespace sensor {
+
+// Side of the square pixel tiles traced as one packet
+static const int TILE_SIZE = 4;
+static_assert(TILE_SIZE * TILE_SIZE <= CPURayPacket::MAX_SIZE, "pixel tile does not fit in a ray packet");
+
+ChFilterCPURender::ChFilterCPURender()
+    : ChFilter("CPURenderer"),
+      m_tracer(nullptr),
+      m_num_threads(1),
+      m_scene_epsilon(1e-3f),
+      m_time_stamp(0) {}
+
+CH_SENSOR_API void ChFilterCPURender::Apply() {
+    auto pOptixSensor = m_optixSensor.lock();
+    m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = m_time_stamp;
+
+    if (!m_tracer)
+        throw std::runtime_error("The CPU render filter has no scene to trace");
+
+    if (std::dynamic_pointer_cast<ChLidarSensor>(pOptixSensor)) {
+        RenderLidar();
+    } else if (std::dynamic_pointer_cast<ChDepthCamera>(pOptixSensor)) {
+        RenderDepthCamera();
+    } else if (std::dynamic_pointer_cast<ChRadarSensor>(pOptixSensor)) {
+        RenderRadar();
+    }
+}
+
+CH_SENSOR_API void ChFilterCPURender::Initialize(std::shared_ptr<ChSensor> pSensor,
+                                                 std::shared_ptr<SensorBuffer>& bufferInOut) {
+    if (bufferInOut) {
+        throw std::runtime_error("The CPU render filter must be the first filter in the list");
+    }
+    auto pOptixSensor = std::dynamic_pointer_cast<ChOptixSensor>(pSensor);
+    if (!pOptixSensor) {
+        InvalidFilterGraphSensorTypeMismatch(pSensor);
+    }
+    m_optixSensor = pOptixSensor;
+    unsigned int size = pOptixSensor->GetWidth() * pOptixSensor->GetHeight();
+
+    if (std::dynamic_pointer_cast<ChDepthCamera>(pSensor)) {
+        auto bufferOut = chrono_types::make_shared<SensorDeviceDepthBuffer>();
+        DeviceDepthBufferPtr b(hostMallocHelper<PixelDepth>(size), hostFreeHelper<PixelDepth>);
+        bufferOut->Buffer = std::move(b);
+        m_bufferOut = bufferOut;
+    } else if (std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
+        auto bufferOut = chrono_types::make_shared<SensorDeviceDIBuffer>();
+        DeviceDIBufferPtr b(hostMallocHelper<PixelDI>(size), hostFreeHelper<PixelDI>);
+        bufferOut->Buffer = std::move(b);
+        m_bufferOut = bufferOut;
+    } else if (std::dynamic_pointer_cast<ChRadarSensor>(pSensor)) {
+        auto bufferOut = chrono_types::make_shared<SensorDeviceRadarBuffer>();
+        DeviceRadarBufferPtr b(hostMallocHelper<RadarReturn>(size), hostFreeHelper<RadarReturn>);
+        bufferOut->Buffer = std::move(b);
+        m_bufferOut = bufferOut;
+    } else {
+        throw std::runtime_error("This type of sensor not supported yet by CPU render filter");
+    }
+    m_bufferOut->Width = pOptixSensor->GetWidth();
+    m_bufferOut->Height = pOptixSensor->GetHeight();
+    m_bufferOut->LaunchedCount = pOptixSensor->GetNumLaunches();
+    m_bufferOut->TimeStamp = m_time_stamp;
+
+    // gives our output buffer to the next filter in the graph
+    bufferInOut = m_bufferOut;
+}
+
+template <class RayGen, class Shade>
+void ChFilterCPURender::TraceImage(RayGen&& gen, Shade&& shade) {
+    const int w = (int)m_bufferOut->Width;
+    const int h = (int)m_bufferOut->Height;
+    const int tiles_x = (w + TILE_SIZE - 1) / TILE_SIZE;
+    const int tiles_y = (h + TILE_SIZE - 1) / TILE_SIZE;
+
+#pragma omp parallel for num_threads(m_num_threads) schedule(dynamic)
+    for (int tile = 0; tile < tiles_x * tiles_y; tile++) {
+        const int x0 = (tile % tiles_x) * TILE_SIZE;
+        const int y0 = (tile / tiles_x) * TILE_SIZE;
+        const int x1 = std::min(x0 + TILE_SIZE, w);
+        const int y1 = std::min(y0 + TILE_SIZE, h);
+
+        CPURayPacket packet;
+        for (int iy = y0; iy < y1; iy++) {
+            for (int ix = x0; ix < x1; ix++) {
+                int k = packet.size++;
+                gen(ix, iy, packet.origin[k], packet.direction[k], packet.tmin[k], packet.tmax[k]);
+            }
+        }
+
+        m_tracer->Intersect(packet);
+
+        int k = 0;
+        for (int iy = y0; iy < y1; iy++) {
+            for (int ix = x0; ix < x1; ix++, k++) {
+                shade(ix, iy, packet, k);
+            }
+        }
+    }
+}
+
+void ChFilterCPURender::GetPose(float t_frac,
+                                ChVector3f& pos,
+                                ChVector3f& forward,
+                                ChVector3f& left,
+                                ChVector3f& up) const {
+    pos = m_pos0 + (m_pos1 - m_pos0) * t_frac;
+    ChQuaternion<float> rot = m_rot0 * (1 - t_frac) + m_rot1 * t_frac;
+    rot.Normalize();
+    forward = rot.GetAxisX();
+    left = rot.GetAxisY();
+    up = rot.GetAxisZ();
+}
+
+void ChFilterCPURender::RenderLidar() {
+    auto lidar = std::static_pointer_cast<ChLidarSensor>(m_optixSensor.lock());
+    auto bufferOut = std::static_pointer_cast<SensorDeviceDIBuffer>(m_bufferOut);
+    PixelDI* frame_buffer = bufferOut->Buffer.get();
+    const int w = (int)bufferOut->Width;
+
+    const float hfov = lidar->GetHFOV();
+    const float max_vert_angle = lidar->GetMaxVertAngle();
+    const float min_vert_angle = lidar->GetMinVertAngle();
+    const float clip_near = lidar->GetClipNear();
+    const float max_distance = lidar->GetMaxDistance();
+    const bool elliptical = lidar->GetBeamShape() == LidarBeamShape::ELLIPTICAL;
+    const float horiz_div_angle = lidar->GetHorizDivAngle();
+    const float vert_div_angle = lidar->GetVertDivAngle();
+
+    // a single ray per beam is the special case of one sample per beam, with no local offset
+    const int d = (int)lidar->GetSampleRadius() * 2 - 1;
+    const int global_w = (int)bufferOut->Width / d;
+    const int global_h = (int)bufferOut->Height / d;
+
+    auto gen = [&](int ix, int iy, ChVector3f& origin, ChVector3f& dir, float& tmin, float& tmax) {
+        const int beam_x = ix / d;
+        const int beam_y = iy / d;
+        float beam_phi = (beam_y / (float)(std::max(1, global_h - 1))) * (max_vert_angle - min_vert_angle) +
+                         min_vert_angle;
+        float beam_theta = (beam_x / (float)(std::max(1, global_w - 1))) * hfov - hfov / 2.f;
+
+        // relative theta and phi for local ray in beam
+        float local_ray_theta = 0;
+        float local_ray_phi = 0;
+        if (d > 1) {
+            float frac_x = ((ix % d) + .5f) / d * 2.f - 1.f;
+            float frac_y = ((iy % d) + .5f) / d * 2.f - 1.f;
+            if (elliptical) {
+                local_ray_theta = frac_x * horiz_div_angle / 2.f;
+                local_ray_phi = frac_y * vert_div_angle / 2.f;
+            } else {
+                float angle = std::atan2(frac_y, frac_x);
+                float ring = std::max(std::abs(frac_x), std::abs(frac_y));
+                float axis_x = vert_div_angle / 2.f * ring;
+                float axis_y = horiz_div_angle / 2.f * ring;
+                float radius = 0;
+                if (axis_x != 0 || axis_y != 0) {
+                    radius = (axis_x * axis_y) / std::sqrt(axis_x * axis_x * std::sin(angle) * std::sin(angle) +
+                                                           axis_y * axis_y * std::cos(angle) * std::cos(angle));
+                }
+                local_ray_theta = radius * std::sin(angle);
+                local_ray_phi = radius * std::cos(angle);
+            }
+        }
+
+        const float theta = beam_theta + local_ray_theta;
+        const float phi = beam_phi + local_ray_phi;
+
+        ChVector3f forward, left, up;
+        GetPose(beam_x / (float)global_w, origin, forward, left, up);
+        dir = forward * (std::cos(phi) * std::cos(theta)) + left * (std::cos(phi) * std::sin(theta)) +
+              up * std::sin(phi);
+        dir.Normalize();
+        tmin = clip_near;
+        tmax = 1.5f * max_distance;
+    };
+
+    auto shade = [&](int ix, int iy, const CPURayPacket& packet, int k) {
+        PixelDI& pixel = frame_buffer[iy * w + ix];
+        if (packet.hit[k] < 0) {
+            pixel.range = 0;
+            pixel.intensity = 0;
+        } else {
+            pixel.range = packet.tmax[k];
+            pixel.intensity = std::abs(packet.normal[k].Dot(-packet.direction[k]));
+        }
+    };
+
+    TraceImage(gen, shade);
+    bufferOut->Beam_return_count = 0;
+}
+
+void ChFilterCPURender::RenderDepthCamera() {
+    auto camera = std::static_pointer_cast<ChDepthCamera>(m_optixSensor.lock());
+    auto bufferOut = std::static_pointer_cast<SensorDeviceDepthBuffer>(m_bufferOut);
+    PixelDepth* frame_buffer = bufferOut->Buffer.get();
+    const int w = (int)bufferOut->Width;
+    const int h = (int)bufferOut->Height;
+
+    const float hfov = camera->GetHFOV();
+    const float max_depth = camera->GetMaxDepth();
+    const CameraLensModelType lens_model = camera->GetLensModelType();
+    const LensParams lens = camera->GetLensParameters();
+    const float h_factor = hfov / (float)CH_PI * 2.f;
+
+    // without time jitter, all rays leave from the pose at the start of the collection window
+    ChVector3f pos, forward, left, up;
+    GetPose(0.f, pos, forward, left, up);
+
+    auto gen = [&](int ix, int iy, ChVector3f& origin, ChVector3f& dir, float& tmin, float& tmax) {
+        float dx = (ix + .5f) / w * 2.f - 1.f;
+        float dy = (iy + .5f) / h * 2.f - 1.f;
+        dy *= (float)h / (float)w;  // correct for the aspect ratio
+
+        if (lens_model == FOV_LENS && (dx > 1e-5 || std::abs(dy) > 1e-5)) {
+            float focal = 1.f / std::tan(hfov / 2.f);
+            float nx = dx / focal;
+            float ny = dy / focal;
+            float rd = std::sqrt(nx * nx + ny * ny);
+            float ru = std::tan(rd * hfov) / (2 * std::tan(hfov / 2.f));
+            dx = nx * (ru / rd) * focal;
+            dy = ny * (ru / rd) * focal;
+        } else if (lens_model == RADIAL) {
+            float focal = 1.f / std::tan(hfov / 2.f);
+            float recip_focal = std::tan(hfov / 2.f);
+            float nx = dx * recip_focal;
+            float ny = dy * recip_focal;
+            double rd2 = nx * nx + ny * ny;
+            double rd4 = rd2 * rd2;
+            double rd6 = rd4 * rd2;
+            double rd8 = rd4 * rd4;
+            double rd10 = rd6 * rd4;
+            double rd12 = rd6 * rd6;
+            double rd14 = rd8 * rd6;
+            double rd16 = rd8 * rd8;
+            double rd18 = rd10 * rd8;
+            float ratio = (float)(1.0 + lens.a0 * rd2 + lens.a1 * rd4 + lens.a2 * rd6 + lens.a3 * rd8 +
+                                  lens.a4 * rd10 + lens.a5 * rd12 + lens.a6 * rd14 + lens.a7 * rd16 + lens.a8 * rd18);
+            dx = nx * ratio * focal;
+            dy = ny * ratio * focal;
+        }
+
+        origin = pos;
+        dir = forward - left * (dx * h_factor) + up * (dy * h_factor);
+        dir.Normalize();
+        tmin = m_scene_epsilon;
+        tmax = 1e16f;
+    };
+
+    auto shade = [&](int ix, int iy, const CPURayPacket& packet, int k) {
+        frame_buffer[iy * w + ix].depth = packet.hit[k] < 0 ? max_depth : std::min(max_depth, packet.tmax[k]);
+    };
+
+    TraceImage(gen, shade);
+}
+
+void ChFilterCPURender::RenderRadar() {
+    auto radar = std::static_pointer_cast<ChRadarSensor>(m_optixSensor.lock());
+    auto bufferOut = std::static_pointer_cast<SensorDeviceRadarBuffer>(m_bufferOut);
+    RadarReturn* frame_buffer = bufferOut->Buffer.get();
+    const int w = (int)bufferOut->Width;
+    const int h = (int)bufferOut->Height;
+
+    const float hfov = radar->GetHFOV();
+    const float vfov = radar->GetVFOV();
+    const float clip_near = radar->GetClipNear();
+    const float max_distance = radar->GetMaxDistance();
+
+    auto gen = [&](int ix, int iy, ChVector3f& origin, ChVector3f& dir, float& tmin, float& tmax) {
+        float dx = (ix + .5f) / w * 2.f - 1.f;
+        float dy = (iy + .5f) / h * 2.f - 1.f;
+        float theta = dx * hfov / 2.f;
+        float phi = -vfov / 2.f + (dy * .5f + .5f) * vfov;
+
+        ChVector3f forward, left, up;
+        GetPose(ix / (float)w, origin, forward, left, up);
+        dir = forward * (std::cos(phi) * std::cos(theta)) + left * (std::cos(phi) * std::sin(theta)) +
+              up * std::sin(phi);
+        dir.Normalize();
+        tmin = clip_near;
+        tmax = 1.5f * max_distance;
+    };
+
+    auto shade = [&](int ix, int iy, const CPURayPacket& packet, int k) {
+        RadarReturn& ret = frame_buffer[iy * w + ix];
+        ret.azimuth = (ix / (float)w) * hfov - hfov / 2.f;
+        ret.elevation = (iy / (float)h) * vfov - vfov / 2.f;
+
+        if (packet.hit[k] < 0) {
+            ret.range = 0;
+            ret.doppler_velocity[0] = 0;
+            ret.doppler_velocity[1] = 0;
+            ret.doppler_velocity[2] = 0;
+            ret.amplitude = 0;
+            ret.objectId = 0;
+            return;
+        }
+
+        const ChVector3f hit_point = packet.origin[k] + packet.direction[k] * packet.tmax[k];
+        ChVector3f vel = m_tracer->GetPointVelocity(packet.hit[k], hit_point);
+
+        // removing stationary object ray hits
+        ChVector3f vel_global = vel.IsNull() ? ChVector3f(0, 0, 0) : vel - m_radar_velocity;
+
+        ChVector3f forward, left, up, pos;
+        GetPose(ix / (float)w, pos, forward, left, up);
+
+        ret.range = packet.tmax[k];
+        ret.doppler_velocity[0] = forward.Dot(vel_global);
+        ret.doppler_velocity[1] = left.Dot(vel_global);
+        ret.doppler_velocity[2] = up.Dot(vel_global);
+        ret.amplitude = std::abs(packet.normal[k].Dot(-packet.direction[k]));
+        ret.objectId = (float)packet.hit[k];
+    };
+
+    TraceImage(gen, shade);
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Filter that generates the raw data of a sensor rendered with the CPU ray
+// tracing backend
+//
+// =============================================================================
+
+#ifndef CHFILTERCPURENDER_H
+#define CHFILTERCPURENDER_H
+
+#include <memory>
+
+#include "chrono_sensor/filters/ChFilter.h"
+#include "chrono_sensor/sensors/ChOptixSensor.h"
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+
+namespace chrono {
+namespace sensor {
+
+// forward declaration
+class ChSensor;
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// A filter that generates data for a ChOptixSensor by tracing rays on the CPU. This is the CPU counterpart of
+/// ChFilterOptixRender and produces the same buffers (depth/intensity for lidar, depth for depth cameras, returns for
+/// radar), in host memory. Rays are traced in 4x4 tiles, each traced as one packet.
+class CH_SENSOR_API ChFilterCPURender : public ChFilter {
+  public:
+    /// Class constructor
+    ChFilterCPURender();
+
+    /// Apply function. Generates data for the sensor.
+    virtual void Apply();
+
+    /// Initializes the output buffer of the sensor.
+    /// @param pSensor A pointer to the sensor.
+    /// @param bufferInOut A pointer to the process buffer
+    virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
+
+    /// The render filter produces host buffers.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
+  private:
+    /// Trace one ray per pixel of the output buffer.
+    /// @param gen Ray generation function, gen(ix, iy, origin, direction, tmin, tmax)
+    /// @param shade Shading function, shade(ix, iy, origin, direction, t, instance, normal)
+    template <class RayGen, class Shade>
+    void TraceImage(RayGen&& gen, Shade&& shade);
+
+    /// Interpolated sensor pose within the collection window.
+    void GetPose(float t_frac, ChVector3f& pos, ChVector3f& forward, ChVector3f& left, ChVector3f& up) const;
+
+    void RenderLidar();
+    void RenderDepthCamera();
+    void RenderRadar();
+
+    std::shared_ptr<SensorBuffer> m_bufferOut;
+    std::weak_ptr<ChOptixSensor> m_optixSensor;  ///< for holding a weak reference to parent sensor
+
+    // Special handles that will be set by ChCPUEngine
+    const ChCPURayTracer* m_tracer;  ///< scene shared by all sensors of the engine
+    int m_num_threads;               ///< number of threads used for tracing
+    ChVector3f m_pos0;               ///< sensor position at the start of the collection window
+    ChQuaternion<float> m_rot0;      ///< sensor orientation at the start of the collection window
+    ChVector3f m_pos1;               ///< sensor position at the end of the collection window
+    ChQuaternion<float> m_rot1;      ///< sensor orientation at the end of the collection window
+    ChVector3f m_radar_velocity;     ///< absolute velocity of a radar sensor
+    float m_scene_epsilon;           ///< minimum hit distance for camera rays
+    float m_time_stamp;              ///< time stamp for when the data (render) was launched
+
+    friend class ChCPUEngine;  ///< ChCPUEngine is allowed to set and use the private members
+};
+
+/// @} sensor_cpu
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
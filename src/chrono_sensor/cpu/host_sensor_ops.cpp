@@ -0,0 +1,329 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Host implementations of the sensor post-processing kernels. These follow the
+// CUDA kernels one-to-one, with one loop iteration per kernel thread.
+//
+// =============================================================================
+
+#include "chrono_sensor/cpu/host_sensor_ops.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace chrono {
+namespace sensor {
+
+// Intensity of sample (i,j) of a beam, accumulated over the samples of the same beam with a similar range (within the
+// 10 cm kernel width used by the CUDA reduction kernels)
+static float beam_local_intensity(const float* bufIn, int w, int d, int out_hIndex, int out_vIndex, int i, int j) {
+    const float kernel_radius = .05f;
+
+    int in_index = (d * out_vIndex + i) * d * w + (d * out_hIndex + j);
+    float local_range = bufIn[2 * in_index];
+    float local_intensity = bufIn[2 * in_index + 1];
+
+    for (int k = 0; k < d; k++) {
+        for (int l = 0; l < d; l++) {
+            int inner_in_index = (d * out_vIndex + k) * d * w + (d * out_hIndex + l);
+            float range = bufIn[2 * inner_in_index];
+            float intensity = bufIn[2 * inner_in_index + 1];
+
+            if (inner_in_index != in_index && std::abs(range - local_range) < kernel_radius) {
+                float weight = (kernel_radius - std::abs(range - local_range)) / kernel_radius;
+                local_intensity += weight * intensity;
+            }
+        }
+    }
+
+    return local_intensity / (d * d);  // calculating portion of beam here
+}
+
+void host_lidar_mean_reduce(void* bufIn, void* bufOut, int width, int height, int radius) {
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+    float* in = (float*)bufIn;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_hIndex = out_index % w;
+        int out_vIndex = out_index / w;
+
+        out[2 * out_index] = 0;
+        out[2 * out_index + 1] = 0;
+
+        float sum_range = 0.f;
+        float sum_intensity = 0.f;
+        int n_contributing = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_vIndex + i) * d * w + (d * out_hIndex + j);
+                sum_intensity += in[2 * in_index + 1];
+                if (in[2 * in_index + 1] > 1e-6) {
+                    sum_range += in[2 * in_index];
+                    n_contributing++;
+                }
+            }
+        }
+        if (n_contributing > 0) {
+            out[2 * out_index] = sum_range / n_contributing;
+            out[2 * out_index + 1] = sum_intensity / (d * d);
+        }
+    }
+}
+
+void host_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height, int radius) {
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+    float* in = (float*)bufIn;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_hIndex = out_index % w;
+        int out_vIndex = out_index / w;
+
+        float strongest = 0;
+        float intensity_at_strongest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_vIndex + i) * d * w + (d * out_hIndex + j);
+                float local_intensity = beam_local_intensity(in, w, d, out_hIndex, out_vIndex, i, j);
+                if (local_intensity > intensity_at_strongest) {
+                    intensity_at_strongest = local_intensity;
+                    strongest = in[2 * in_index];
+                }
+            }
+        }
+        out[2 * out_index] = strongest;
+        out[2 * out_index + 1] = intensity_at_strongest;
+    }
+}
+
+void host_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, int radius) {
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+    float* in = (float*)bufIn;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_hIndex = out_index % w;
+        int out_vIndex = out_index / w;
+
+        float shortest = 1e10;
+        float intensity_at_shortest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_vIndex + i) * d * w + (d * out_hIndex + j);
+                float local_range = in[2 * in_index];
+                float ray_intensity = in[2 * in_index + 1];
+                if (shortest > local_range && ray_intensity > 0) {
+                    intensity_at_shortest = beam_local_intensity(in, w, d, out_hIndex, out_vIndex, i, j);
+                    shortest = local_range;
+                }
+            }
+        }
+        out[2 * out_index] = shortest;
+        out[2 * out_index + 1] = intensity_at_shortest;
+    }
+}
+
+void host_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius) {
+    int d = radius * 2 - 1;
+    int w = width / d;
+    int h = height / d;
+    float* in = (float*)bufIn;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int out_index = 0; out_index < w * h; out_index++) {
+        int out_hIndex = out_index % w;
+        int out_vIndex = out_index / w;
+
+        float shortest = 1e10;  // very very far
+        float intensity_at_shortest = 0;
+        float strongest = 0;
+        float intensity_at_strongest = 0;
+        for (int i = 0; i < d; i++) {
+            for (int j = 0; j < d; j++) {
+                int in_index = (d * out_vIndex + i) * d * w + (d * out_hIndex + j);
+                float local_range = in[2 * in_index];
+                float ray_intensity = in[2 * in_index + 1];
+                float local_intensity = beam_local_intensity(in, w, d, out_hIndex, out_vIndex, i, j);
+                if (shortest > local_range && ray_intensity > 0) {
+                    intensity_at_shortest = local_intensity;
+                    shortest = local_range;
+                }
+                if (local_intensity > intensity_at_strongest) {
+                    intensity_at_strongest = local_intensity;
+                    strongest = local_range;
+                }
+            }
+        }
+        out[4 * out_index] = strongest;
+        out[4 * out_index + 1] = intensity_at_strongest;
+        out[4 * out_index + 2] = shortest;
+        out[4 * out_index + 3] = intensity_at_shortest;
+    }
+}
+
+void host_pointcloud_from_depth(void* bufDI,
+                                void* bufOut,
+                                int width,
+                                int height,
+                                float hfov,
+                                float max_v_angle,
+                                float min_v_angle) {
+    float* in = (float*)bufDI;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int index = 0; index < width * height; index++) {
+        int hIndex = index % width;
+        int vIndex = index / width;
+
+        float vAngle = (vIndex / (float)(std::max(1, height - 1))) * (max_v_angle - min_v_angle) + min_v_angle;
+        float hAngle = (hIndex / (float)(std::max(1, width - 1))) * hfov - hfov / 2.f;
+
+        float range = in[2 * index];
+        float proj_xy = range * std::cos(vAngle);
+        out[4 * index] = proj_xy * std::cos(hAngle);
+        out[4 * index + 1] = proj_xy * std::sin(hAngle);
+        out[4 * index + 2] = range * std::sin(vAngle);
+        out[4 * index + 3] = in[2 * index + 1];
+    }
+}
+
+void host_pointcloud_from_depth_dual_return(void* bufDI,
+                                            void* bufOut,
+                                            int width,
+                                            int height,
+                                            float hfov,
+                                            float max_v_angle,
+                                            float min_v_angle) {
+    float* in = (float*)bufDI;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int index = 0; index < width * height; index++) {
+        int hIndex = index % width;
+        int vIndex = index / width;
+
+        float vAngle = (vIndex / (float)(std::max(1, height - 1))) * (max_v_angle - min_v_angle) + min_v_angle;
+        float hAngle = (hIndex / (float)(std::max(1, width - 1))) * hfov - hfov / 2.f;
+
+        // strongest return followed by the shortest return
+        for (int k = 0; k < 2; k++) {
+            float range = in[4 * index + 2 * k];
+            float proj_xy = range * std::cos(vAngle);
+            out[8 * index + 4 * k] = proj_xy * std::cos(hAngle);
+            out[8 * index + 4 * k + 1] = proj_xy * std::sin(hAngle);
+            out[8 * index + 4 * k + 2] = range * std::sin(vAngle);
+            out[8 * index + 4 * k + 3] = in[4 * index + 2 * k + 1];
+        }
+    }
+}
+
+void host_lidar_noise_normal(float* bufPtr,
+                             int width,
+                             int height,
+                             float stdev_range,
+                             float stdev_v_angle,
+                             float stdev_h_angle,
+                             float stdev_intensity,
+                             std::mt19937& rng) {
+    std::normal_distribution<float> normal(0.f, 1.f);
+
+    // sequential, so that a single generator can be used
+    for (int index = 0; index < width * height; index++) {
+        float i = bufPtr[index * 4 + 3];
+        if (i <= 1e-6)
+            continue;
+
+        float x = bufPtr[index * 4];
+        float y = bufPtr[index * 4 + 1];
+        float z = bufPtr[index * 4 + 2];
+
+        // convert to spherical coordinates
+        float range = std::sqrt(x * x + y * y + z * z);
+        if (range <= 1e-6)
+            continue;
+        float phi = std::asin(z / (range + 1e-6f));
+        float theta = std::acos(x / ((range + 1e-6f) * std::cos(phi)));
+        if (y < 0)
+            theta = -theta;
+
+        // apply noise
+        range += normal(rng) * stdev_range;
+        theta += normal(rng) * stdev_h_angle;
+        phi += normal(rng) * stdev_v_angle;
+        i += normal(rng) * stdev_intensity;
+
+        // convert back to XYZ
+        bufPtr[index * 4] = std::cos(theta) * std::cos(phi) * range;
+        bufPtr[index * 4 + 1] = std::sin(theta) * std::cos(phi) * range;
+        bufPtr[index * 4 + 2] = std::sin(phi) * range;
+        bufPtr[index * 4 + 3] = i > 0 ? i : 0;
+    }
+}
+
+void host_radar_pointcloud_from_angles(void* bufIn, void* bufOut, int width, int height) {
+    float* in = (float*)bufIn;
+    float* out = (float*)bufOut;
+
+#pragma omp parallel for
+    for (int index = 0; index < width * height; index++) {
+        float range = in[8 * index];
+        float azimuth = in[8 * index + 1];
+        float elevation = in[8 * index + 2];
+        float proj_xy = range * std::cos(elevation);
+        out[8 * index] = proj_xy * std::cos(azimuth);
+        out[8 * index + 1] = proj_xy * std::sin(azimuth);
+        out[8 * index + 2] = range * std::sin(elevation);
+        for (int k = 3; k < 8; k++)
+            out[8 * index + k] = in[8 * index + k];
+    }
+}
+
+void host_depth_to_uchar4(void* bufIn, void* bufOut, int w, int h) {
+    float* in = (float*)bufIn;
+    unsigned char* out = (unsigned char*)bufOut;
+    if (w * h == 0)
+        return;
+
+    auto result = std::minmax_element(in, in + w * h);
+    float d_min = *result.first;
+    float d_max = *result.second;
+    float scale = d_max > d_min ? 1.f / (d_max - d_min) : 0.f;  // uniform depth maps to black
+
+#pragma omp parallel for
+    for (int idx = 0; idx < w * h; idx++) {
+        float normalized_depth = std::min(std::max((in[idx] - d_min) * scale, 0.f), 1.f);
+        unsigned char intensity = (unsigned char)(normalized_depth * 255.f);
+
+        // gray scale colormap
+        out[idx * 4 + 0] = intensity;
+        out[idx * 4 + 1] = intensity;
+        out[idx * 4 + 2] = intensity;
+        out[idx * 4 + 3] = (unsigned char)255;
+    }
+}
+
+}  // namespace sensor
+}  // namespace chrono
@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Host implementations of the sensor post-processing kernels, used by filters
+// when the sensor data is rendered by the CPU ray tracing backend
+//
+// =============================================================================
+
+#ifndef HOST_SENSOR_OPS_H
+#define HOST_SENSOR_OPS_H
+
+#include <random>
+
+namespace chrono {
+namespace sensor {
+
+/// @addtogroup sensor_cpu
+/// @{
+
+/// Host version of cuda_lidar_mean_reduce.
+/// @param bufIn Input host pointer to raw lidar data.
+/// @param bufOut Output host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+void host_lidar_mean_reduce(void* bufIn, void* bufOut, int width, int height, int radius);
+
+/// Host version of cuda_lidar_strong_reduce.
+/// @param bufIn Input host pointer to raw lidar data.
+/// @param bufOut Output host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+void host_lidar_strong_reduce(void* bufIn, void* bufOut, int width, int height, int radius);
+
+/// Host version of cuda_lidar_first_reduce.
+/// @param bufIn Input host pointer to raw lidar data.
+/// @param bufOut Output host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+void host_lidar_first_reduce(void* bufIn, void* bufOut, int width, int height, int radius);
+
+/// Host version of cuda_lidar_dual_reduce.
+/// @param bufIn Input host pointer to raw lidar data.
+/// @param bufOut Output host pointer for processed lidar data.
+/// @param width Width of the input data.
+/// @param height Height of the input data.
+/// @param radius Radius in samples of the beam to be reduced.
+void host_lidar_dual_reduce(void* bufIn, void* bufOut, int width, int height, int radius);
+
+/// Host version of cuda_pointcloud_from_depth.
+/// @param bufDI Host pointer to depth/intensity data.
+/// @param bufOut Host pointer to the output point cloud.
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param hfov Horizontal field of view of the lidar.
+/// @param max_v_angle Maximum vertical angle of the lidar.
+/// @param min_v_angle Minimum vertical angle of the lidar.
+void host_pointcloud_from_depth(void* bufDI,
+                                void* bufOut,
+                                int width,
+                                int height,
+                                float hfov,
+                                float max_v_angle,
+                                float min_v_angle);
+
+/// Host version of cuda_pointcloud_from_depth_dual_return.
+/// @param bufDI Host pointer to dual return depth/intensity data.
+/// @param bufOut Host pointer to the output point cloud.
+/// @param width Width of the data.
+/// @param height Height of the data.
+/// @param hfov Horizontal field of view of the lidar.
+/// @param max_v_angle Maximum vertical angle of the lidar.
+/// @param min_v_angle Minimum vertical angle of the lidar.
+void host_pointcloud_from_depth_dual_return(void* bufDI,
+                                            void* bufOut,
+                                            int width,
+                                            int height,
+                                            float hfov,
+                                            float max_v_angle,
+                                            float min_v_angle);
+
+/// Host version of cuda_lidar_noise_normal.
+/// @param bufPtr Host pointer to the point cloud (XYZI).
+/// @param width Width of lidar data buffer.
+/// @param height Height of lidar data buffer.
+/// @param stdev_range Standard deviation for lidar range.
+/// @param stdev_v_angle Standard deviation of noise for vertical angle measurement.
+/// @param stdev_h_angle Standard deviation of noise for horizontal angle measurement.
+/// @param stdev_intensity Standard deviation of noise for intensity.
+/// @param rng The random number generator
+void host_lidar_noise_normal(float* bufPtr,
+                             int width,
+                             int height,
+                             float stdev_range,
+                             float stdev_v_angle,
+                             float stdev_h_angle,
+                             float stdev_intensity,
+                             std::mt19937& rng);
+
+/// Host version of cuda_radar_pointcloud_from_angles.
+/// @param bufIn Host pointer to the radar returns.
+/// @param bufOut Host pointer to the output point cloud.
+/// @param width Width of the data.
+/// @param height Height of the data.
+void host_radar_pointcloud_from_angles(void* bufIn, void* bufOut, int width, int height);
+
+/// Host version of cuda_depth_to_uchar4. The depth is normalized by the range of values in the buffer.
+/// @param bufIn Host pointer to the depth image.
+/// @param bufOut Host pointer to the output RGBA8 image.
+/// @param w The image width.
+/// @param h The image height.
+void host_depth_to_uchar4(void* bufIn, void* bufOut, int w, int h);
+
+/// @}
+
+}  // namespace sensor
+}  // namespace chrono
+
+#endif
@@ -51,6 +51,9 @@ class CH_SENSOR_API ChFilter {
     /// augmentation does not happen in place.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut) = 0;
 
+    /// Return true if the filter can process buffers in host memory, as produced by the CPU ray tracing backend.
+    virtual bool SupportsHostBuffers() const { return false; }
+
     /// Accesses the name of the filter. Name not used for any critical processes. Optional use for clarity.
     /// A string reference to the filter's name.
     std::string& Name() { return m_name; }
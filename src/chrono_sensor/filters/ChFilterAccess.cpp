@@ -23,6 +23,23 @@
 namespace chrono {
 namespace sensor {
 
+// Allocate a lag buffer, in pinned memory when the incoming data is on the device or in regular host memory when the
+// sensor is rendered on the CPU
+template <class T>
+static std::shared_ptr<T[]> AllocateLagBuffer(unsigned int size, bool host_input) {
+    if (host_input)
+        return std::shared_ptr<T[]>(hostMallocHelper<T>(size), hostFreeHelper<T>);
+    return std::shared_ptr<T[]>(cudaHostMallocHelper<T>(size), cudaHostFreeHelper<T>);
+}
+
+// Copy the incoming data into a lag buffer
+static void CopyToLagBuffer(void* dst, const void* src, size_t size, bool host_input, CUstream& stream) {
+    if (host_input)
+        memcpy(dst, src, size);
+    else
+        cudaMemcpyAsync(dst, src, size, cudaMemcpyDeviceToHost, stream);
+}
+
 template <>
 CH_SENSOR_API void ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>::Apply() {
     // create a new buffer to push to the lag buffer list
@@ -32,9 +49,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>::Apply()
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostR8Buffer>();
-        std::shared_ptr<char[]> b(cudaHostMallocHelper<char>(m_bufferIn->Width * m_bufferIn->Height),
-                                  cudaHostFreeHelper<char>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<char>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -42,8 +57,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>::Apply()
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(), m_bufferIn->Width * m_bufferIn->Height,
-                    cudaMemcpyDeviceToHost, m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height, m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -57,7 +72,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostR8Buffer, UserR8BufferPtr>::Apply()
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -70,9 +86,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRGBA8Buffer, UserRGBA8BufferPtr>::Ap
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostRGBA8Buffer>();
-        std::shared_ptr<PixelRGBA8[]> b(cudaHostMallocHelper<PixelRGBA8>(m_bufferIn->Width * m_bufferIn->Height),
-                                        cudaHostFreeHelper<PixelRGBA8>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<PixelRGBA8>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -80,8 +94,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRGBA8Buffer, UserRGBA8BufferPtr>::Ap
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelRGBA8), cudaMemcpyDeviceToHost, m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelRGBA8), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -95,7 +109,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRGBA8Buffer, UserRGBA8BufferPtr>::Ap
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -108,9 +123,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostSemanticBuffer, UserSemanticBufferPt
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostSemanticBuffer>();
-        std::shared_ptr<PixelSemantic[]> b(cudaHostMallocHelper<PixelSemantic>(m_bufferIn->Width * m_bufferIn->Height),
-                                           cudaHostFreeHelper<PixelSemantic>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<PixelSemantic>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -118,9 +131,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostSemanticBuffer, UserSemanticBufferPt
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelSemantic), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelSemantic), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -134,7 +146,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostSemanticBuffer, UserSemanticBufferPt
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -147,9 +160,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDepthBuffer, UserDepthBufferPtr>::Ap
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostDepthBuffer>();
-        std::shared_ptr<PixelDepth[]> b(cudaHostMallocHelper<PixelDepth>(m_bufferIn->Width * m_bufferIn->Height),
-                                        cudaHostFreeHelper<PixelDepth>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<PixelDepth>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -157,8 +168,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDepthBuffer, UserDepthBufferPtr>::Ap
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDepth), cudaMemcpyDeviceToHost, m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDepth), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -172,7 +183,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDepthBuffer, UserDepthBufferPtr>::Ap
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -185,9 +197,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-        std::shared_ptr<PixelXYZI[]> b(cudaHostMallocHelper<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height),
-                                       cudaHostFreeHelper<PixelXYZI>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<PixelXYZI>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Beam_return_count;
@@ -195,8 +205,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelXYZI), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -210,7 +220,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostXYZIBuffer, UserXYZIBufferPtr>::Appl
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -223,9 +234,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostDIBuffer>();
-        std::shared_ptr<PixelDI[]> b(cudaHostMallocHelper<PixelDI>(m_bufferIn->Width * m_bufferIn->Height),
-                                     cudaHostFreeHelper<PixelDI>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<PixelDI>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -233,8 +242,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), cudaMemcpyDeviceToHost, m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(PixelDI), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -248,7 +257,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostDIBuffer, UserDIBufferPtr>::Apply()
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -261,9 +271,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarBuffer, UserRadarBufferPtr>::Ap
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostRadarBuffer>();
-        std::shared_ptr<RadarReturn[]> b(cudaHostMallocHelper<RadarReturn>(m_bufferIn->Width * m_bufferIn->Height),
-                                         cudaHostFreeHelper<RadarReturn>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<RadarReturn>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Width;
@@ -271,9 +279,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarBuffer, UserRadarBufferPtr>::Ap
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(RadarReturn), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(RadarReturn), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -287,7 +294,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarBuffer, UserRadarBufferPtr>::Ap
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
@@ -300,10 +308,7 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarXYZBuffer, UserRadarXYZBufferPt
         m_empty_lag_buffers.pop();
     } else {
         tmp_buffer = chrono_types::make_shared<SensorHostRadarXYZBuffer>();
-        std::shared_ptr<RadarXYZReturn[]> b(
-            cudaHostMallocHelper<RadarXYZReturn>(m_bufferIn->Width * m_bufferIn->Height),
-            cudaHostFreeHelper<RadarXYZReturn>);
-        tmp_buffer->Buffer = std::move(b);
+        tmp_buffer->Buffer = AllocateLagBuffer<RadarXYZReturn>(m_bufferIn->Width * m_bufferIn->Height, m_host_input);
     }
 
     tmp_buffer->Width = m_bufferIn->Beam_return_count;
@@ -311,9 +316,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarXYZBuffer, UserRadarXYZBufferPt
     tmp_buffer->LaunchedCount = m_bufferIn->LaunchedCount;
     tmp_buffer->TimeStamp = m_bufferIn->TimeStamp;
 
-    cudaMemcpyAsync(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
-                    m_bufferIn->Width * m_bufferIn->Height * sizeof(RadarXYZReturn), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
+    CopyToLagBuffer(tmp_buffer->Buffer.get(), m_bufferIn->Buffer.get(),
+                    m_bufferIn->Width * m_bufferIn->Height * sizeof(RadarXYZReturn), m_host_input, m_cuda_stream);
 
     {  // lock in this scope before pushing to lag buffer queue
         std::lock_guard<std::mutex> lck(m_mutexBufferAccess);
@@ -327,7 +331,8 @@ CH_SENSOR_API void ChFilterAccess<SensorHostRadarXYZBuffer, UserRadarXYZBufferPt
             m_lag_buffers.pop();
         }
         // synchronize the cuda stream since we moved data to the host
-        cudaStreamSynchronize(m_cuda_stream);
+        if (!m_host_input)
+            cudaStreamSynchronize(m_cuda_stream);
     }
 }
 
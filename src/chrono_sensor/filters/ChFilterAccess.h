@@ -53,6 +53,9 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     /// ready based on the time.
     virtual void Apply();
 
+    /// The access filter can copy from both device and host buffers.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
     /// Initializes all data needed by the filter access apply function.
     /// @param pSensor A pointer to the sensor.
     /// @param bufferInOut the incoming process buffer
@@ -71,6 +74,7 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
 
         if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
             m_cuda_stream = pOpx->GetCudaStream();
+            m_host_input = pOpx->IsHostRendered();
         }
 
         m_sensor = pSensor;  // save handle to the parent sensor (weak ptr to not cause loop dependency)
@@ -123,6 +127,7 @@ class CH_SENSOR_API ChFilterAccess : public ChFilter {
     std::weak_ptr<ChSensor> m_sensor;        ///< pointer to the sensor to which this filter is attached
     std::shared_ptr<BufferType> m_bufferIn;  ///< shared pointer to the buffer coming in
     CUstream m_cuda_stream;                  ///< reference to the cuda stream for device-side buffers
+    bool m_host_input = false;               ///< incoming buffer is in host memory (CPU rendered sensor)
 
     std::queue<std::shared_ptr<BufferType>>
         m_lag_buffers;  ///< buffers that are time stamped and held until past their lag time
@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterImageOps.h"
 #include "chrono_sensor/sensors/ChCameraSensor.h"
 #include "chrono_sensor/cuda/image_ops.cuh"
+#include "chrono_sensor/cpu/host_sensor_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 namespace chrono {
@@ -66,7 +67,7 @@ CH_SENSOR_API void ChFilterDepthToRGBA8::Initialize(std::shared_ptr<ChSensor> pS
 
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
-
+        m_host = pOpx->IsHostRendered();
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
@@ -74,8 +75,9 @@ CH_SENSOR_API void ChFilterDepthToRGBA8::Initialize(std::shared_ptr<ChSensor> pS
     m_buffer_in = std::dynamic_pointer_cast<SensorDeviceDepthBuffer>(bufferInOut);
     if (m_buffer_in) {
         m_buffer_out = chrono_types::make_shared<SensorDeviceRGBA8Buffer>();
-        DeviceRGBA8BufferPtr b(cudaMallocHelper<PixelRGBA8>(m_buffer_in->Width * m_buffer_in->Height),
-                               cudaFreeHelper<PixelRGBA8>);
+        unsigned int size = m_buffer_in->Width * m_buffer_in->Height;
+        DeviceRGBA8BufferPtr b(m_host ? hostMallocHelper<PixelRGBA8>(size) : cudaMallocHelper<PixelRGBA8>(size),
+                               m_host ? hostFreeHelper<PixelRGBA8> : cudaFreeHelper<PixelRGBA8>);
         m_buffer_out->Buffer = std::move(b);
         m_buffer_out->Width = m_buffer_in->Width;
         m_buffer_out->Height = m_buffer_in->Height;
@@ -88,8 +90,12 @@ CH_SENSOR_API void ChFilterDepthToRGBA8::Initialize(std::shared_ptr<ChSensor> pS
 }
 
 CH_SENSOR_API void ChFilterDepthToRGBA8::Apply() {
-    cuda_depth_to_uchar4(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), m_buffer_out->Width,
-                               m_buffer_out->Height, m_cuda_stream);
+    if (m_host)
+        host_depth_to_uchar4(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), m_buffer_out->Width,
+                             m_buffer_out->Height);
+    else
+        cuda_depth_to_uchar4(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), m_buffer_out->Width,
+                             m_buffer_out->Height, m_cuda_stream);
 
     m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
     m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
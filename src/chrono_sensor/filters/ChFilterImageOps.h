@@ -61,10 +61,14 @@ class CH_SENSOR_API ChFilterDepthToRGBA8 : public ChFilter {
 
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// The conversion can also be performed on the host for depth cameras rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     std::shared_ptr<SensorDeviceDepthBuffer> m_buffer_in;   ///<
     std::shared_ptr<SensorDeviceRGBA8Buffer> m_buffer_out;  ///<
     CUstream m_cuda_stream;
+    bool m_host = false;  ///< data is in host memory (CPU rendered depth camera)
 };
 
 /// A filter that, when applied to a sensor, resizes the image to the specified dimensions.
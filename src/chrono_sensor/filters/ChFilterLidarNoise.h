@@ -22,6 +22,7 @@
 #include <cuda.h>
 #include <curand.h>
 #include <curand_kernel.h>
+#include <random>
 
 namespace chrono {
 namespace sensor {
@@ -52,12 +53,17 @@ class CH_SENSOR_API ChFilterLidarNoiseXYZI : public ChFilter {
     /// @param bufferInOut A buffer that is passed into the filter.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// Noise can also be applied on the host for lidars rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     float m_stdev_range;      ///< Standard deviation of the normal distribution applied to the distance measurement
     float m_stdev_v_angle;    ///< Standard deviation of the normal distribution applied to the vertical angle
     float m_stdev_h_angle;    ///< Standard deviation of the normal distribution applied to the horizontal angle
     float m_stdev_intensity;  ///< Standard deviation of the normal distribution applied to the intensity measurement
     std::shared_ptr<curandState_t> m_rng;                   ///< cuda random number generator
+    std::mt19937 m_host_rng;                                ///< random number generator for host buffers
+    bool m_host = false;                                    ///< data is in host memory (CPU rendered lidar)
     std::shared_ptr<SensorDeviceXYZIBuffer> m_bufferInOut;  ///< buffer for applying noise to point cloud
     CUstream m_cuda_stream;                                 ///< reference to the cuda stream
 };
@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterLidarReduce.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/cuda/lidar_reduce.cuh"
+#include "chrono_sensor/cpu/host_sensor_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 namespace chrono {
@@ -35,16 +36,20 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 
     if (auto pOpx = std::dynamic_pointer_cast<ChLidarSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_host = pOpx->IsHostRendered();
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
+    auto malloc_helper = m_host ? hostMallocHelper<PixelDI> : cudaMallocHelper<PixelDI>;
+    auto free_helper = m_host ? hostFreeHelper<PixelDI> : cudaFreeHelper<PixelDI>;
+
     switch (m_ret) {
         case LidarReturnMode::DUAL_RETURN: {
             m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height * 2 /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
+            DeviceDIBufferPtr b(malloc_helper(m_buffer_in->Width * m_buffer_in->Height * 2 /
+                                              ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
+                                free_helper);
             m_buffer_out->Buffer = std::move(b);
             m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
             m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
@@ -54,9 +59,9 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 
         default: {  // all other returns are single, regardless of type
             m_buffer_out = chrono_types::make_shared<SensorDeviceDIBuffer>();
-            DeviceDIBufferPtr b(cudaMallocHelper<PixelDI>(m_buffer_in->Width * m_buffer_in->Height /
-                                                          ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
-                                cudaFreeHelper<PixelDI>);
+            DeviceDIBufferPtr b(malloc_helper(m_buffer_in->Width * m_buffer_in->Height /
+                                              ((m_reduce_radius * 2 - 1) * (m_reduce_radius * 2 - 1))),
+                                free_helper);
             m_buffer_out->Buffer = std::move(b);
             m_buffer_out->Width = m_buffer_in->Width / (m_reduce_radius * 2 - 1);
             m_buffer_out->Height = m_buffer_in->Height / (m_reduce_radius * 2 - 1);
@@ -67,6 +72,30 @@ CH_SENSOR_API void ChFilterLidarReduce::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterLidarReduce::Apply() {
+    if (m_host) {
+        void* buf_in = m_buffer_in->Buffer.get();
+        void* buf_out = m_buffer_out->Buffer.get();
+        int w = (int)m_buffer_in->Width;
+        int h = (int)m_buffer_in->Height;
+        switch (m_ret) {
+            case LidarReturnMode::DUAL_RETURN:
+                host_lidar_dual_reduce(buf_in, buf_out, w, h, m_reduce_radius);
+                break;
+            case LidarReturnMode::STRONGEST_RETURN:
+                host_lidar_strong_reduce(buf_in, buf_out, w, h, m_reduce_radius);
+                break;
+            case LidarReturnMode::FIRST_RETURN:
+                host_lidar_first_reduce(buf_in, buf_out, w, h, m_reduce_radius);
+                break;
+            default:  // LidarReturnMode::MEAN_RETURN:
+                host_lidar_mean_reduce(buf_in, buf_out, w, h, m_reduce_radius);
+                break;
+        }
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
     switch (m_ret) {
         case LidarReturnMode::DUAL_RETURN:
             cuda_lidar_dual_reduce(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
@@ -46,12 +46,16 @@ class CH_SENSOR_API ChFilterLidarReduce : public ChFilter {
     /// @param bufferInOut A buffer that is passed into the filter.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// The reduction can also be performed on the host for lidars rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;   ///< for holding the input buffer
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_out;  ///< for holding the output buffer
     LidarReturnMode m_ret;                               ///< for holding the return mode
     int m_reduce_radius;                                 ///< for holding the sample radius
     CUstream m_cuda_stream;                              ///< reference to the cuda stream
+    bool m_host = false;                                 ///< data is in host memory (CPU rendered lidar)
 };
 
 /// @}
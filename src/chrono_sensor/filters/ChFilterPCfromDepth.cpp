@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterPCfromDepth.h"
 #include "chrono_sensor/sensors/ChLidarSensor.h"
 #include "chrono_sensor/cuda/pointcloud.cuh"
+#include "chrono_sensor/cpu/host_sensor_ops.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 
 // #include <cuda_runtime_api.h>
@@ -37,15 +38,16 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
         m_min_vert_angle = pLidar->GetMinVertAngle();
         m_max_vert_angle = pLidar->GetMaxVertAngle();
         m_cuda_stream = pLidar->GetCudaStream();
+        m_host = pLidar->IsHostRendered();
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
     // allocate output buffer
     m_buffer_out = chrono_types::make_shared<SensorDeviceXYZIBuffer>();
-    DeviceXYZIBufferPtr b(
-        cudaMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaFreeHelper<PixelXYZI>);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+    DeviceXYZIBufferPtr b(m_host ? hostMallocHelper<PixelXYZI>(size) : cudaMallocHelper<PixelXYZI>(size),
+                          m_host ? hostFreeHelper<PixelXYZI> : cudaFreeHelper<PixelXYZI>);
     m_buffer_out->Buffer = std::move(b);
     m_buffer_out->Width = m_buffer_in->Width;
     m_buffer_out->Height = m_buffer_in->Height;
@@ -54,6 +56,32 @@ CH_SENSOR_API void ChFilterPCfromDepth::Initialize(std::shared_ptr<ChSensor> pSe
 }
 
 CH_SENSOR_API void ChFilterPCfromDepth::Apply() {
+    if (m_host) {
+        if (m_buffer_in->Dual_return) {
+            host_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
+                                                   (int)m_buffer_in->Width, (int)m_buffer_in->Height, m_hFOV,
+                                                   m_max_vert_angle, m_min_vert_angle);
+        } else {
+            host_pointcloud_from_depth(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
+                                       (int)m_buffer_in->Height, m_hFOV, m_max_vert_angle, m_min_vert_angle);
+        }
+
+        // compact the returns in place, no staging copies needed on the host
+        PixelXYZI* buf = m_buffer_out->Buffer.get();
+        unsigned int size = m_buffer_out->Width * m_buffer_out->Height * (m_buffer_out->Dual_return + 1);
+        m_buffer_out->Beam_return_count = 0;
+        for (unsigned int i = 0; i < size; i++) {
+            if (buf[i].intensity > 0) {
+                buf[m_buffer_out->Beam_return_count] = buf[i];
+                m_buffer_out->Beam_return_count++;
+            }
+        }
+
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
     // carry out the conversion from depth to point cloud
     if (m_buffer_in->Dual_return) {
         cuda_pointcloud_from_depth_dual_return(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
@@ -44,11 +44,15 @@ class CH_SENSOR_API ChFilterPCfromDepth : public ChFilter {
     /// @param bufferInOut A buffer that is passed into the filter.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// The conversion can also be performed on the host for lidars rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     float m_hFOV;                                          ///< field of view of the parent lidar
     float m_min_vert_angle;                                ///< mimimum vertical angle of parent lidar
     float m_max_vert_angle;                                ///< maximum vetical angle of parent lidar
     CUstream m_cuda_stream;                                ///< reference to the cuda stream
+    bool m_host = false;                                   ///< data is in host memory (CPU rendered lidar)
     std::shared_ptr<SensorDeviceDIBuffer> m_buffer_in;     ///< holder of the input buffer
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_out;  ///< holder of the output buffer
 };
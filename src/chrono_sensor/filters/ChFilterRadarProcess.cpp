@@ -17,6 +17,7 @@
 #include "chrono_sensor/filters/ChFilterRadarProcess.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 #include "chrono_sensor/cuda/radarprocess.cuh"
+#include "chrono_sensor/cpu/host_sensor_ops.h"
 #include "chrono_sensor/utils/Dbscan.h"
 #include <random>
 
@@ -37,6 +38,7 @@ CH_SENSOR_API void ChFilterRadarProcess::Initialize(std::shared_ptr<ChSensor> pS
     // The sensor must be a radar
     if (auto pRadar = std::dynamic_pointer_cast<ChRadarSensor>(pSensor)) {
         m_cuda_stream = pRadar->GetCudaStream();
+        m_host = pRadar->IsHostRendered();
         m_hFOV = pRadar->GetHFOV();
         m_vFOV = pRadar->GetVFOV();
     } else {
@@ -44,8 +46,10 @@ CH_SENSOR_API void ChFilterRadarProcess::Initialize(std::shared_ptr<ChSensor> pS
     }
     m_radar = std::dynamic_pointer_cast<ChRadarSensor>(pSensor);
     m_buffer_out = chrono_types::make_shared<SensorDeviceRadarXYZBuffer>();
-    std::shared_ptr<RadarXYZReturn[]> b(cudaHostMallocHelper<RadarXYZReturn>(m_buffer_in->Width * m_buffer_in->Height),
-                                        cudaHostFreeHelper<RadarXYZReturn>);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height;
+    std::shared_ptr<RadarXYZReturn[]> b(
+        m_host ? hostMallocHelper<RadarXYZReturn>(size) : cudaHostMallocHelper<RadarXYZReturn>(size),
+        m_host ? hostFreeHelper<RadarXYZReturn> : cudaHostFreeHelper<RadarXYZReturn>);
     m_buffer_out->Buffer = std::move(b);
     m_buffer_out->Width = bufferInOut->Width;
     m_buffer_out->Height = bufferInOut->Height;
@@ -53,16 +57,23 @@ CH_SENSOR_API void ChFilterRadarProcess::Initialize(std::shared_ptr<ChSensor> pS
 }
 
 CH_SENSOR_API void ChFilterRadarProcess::Apply() {
-    // converts azimuth and elevation to XYZ Coordinates in device
-    cuda_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
-                                      (int)m_buffer_in->Height, m_hFOV, m_vFOV, m_cuda_stream);
-
-    // Transfer pointcloud to host
     auto buf = std::vector<RadarXYZReturn>(m_buffer_out->Width * m_buffer_out->Height);
-    cudaMemcpyAsync(buf.data(), m_buffer_out->Buffer.get(),
-                    m_buffer_out->Width * m_buffer_out->Height * sizeof(RadarXYZReturn), cudaMemcpyDeviceToHost,
-                    m_cuda_stream);
-    cudaStreamSynchronize(m_cuda_stream);
+    if (m_host) {
+        // converts azimuth and elevation to XYZ Coordinates directly on the host
+        host_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), buf.data(), (int)m_buffer_in->Width,
+                                          (int)m_buffer_in->Height);
+    } else {
+        // converts azimuth and elevation to XYZ Coordinates in device
+        cuda_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
+                                          (int)m_buffer_in->Width, (int)m_buffer_in->Height, m_hFOV, m_vFOV,
+                                          m_cuda_stream);
+
+        // Transfer pointcloud to host
+        cudaMemcpyAsync(buf.data(), m_buffer_out->Buffer.get(),
+                        m_buffer_out->Width * m_buffer_out->Height * sizeof(RadarXYZReturn), cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
+        cudaStreamSynchronize(m_cuda_stream);
+    }
 
     // sort returns to bins by objectId
     auto bins = std::vector<std::vector<RadarXYZReturn>>();
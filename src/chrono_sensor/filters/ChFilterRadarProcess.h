@@ -48,11 +48,15 @@ class CH_SENSOR_API ChFilterRadarProcess : public ChFilter {
     /// @param bufferInOut A buffer that is passed into the filter
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// The processing can also be performed on the host for radars rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     std::shared_ptr<ChRadarSensor> m_radar;                  /// radar this filter is attached
     std::shared_ptr<SensorDeviceRadarBuffer> m_buffer_in;    /// holder of the input buffer
     std::shared_ptr<SensorHostRadarXYZBuffer> m_buffer_out;  /// holder of the output buffer
     CUstream m_cuda_stream;                                  /// reference to the cuda stream
+    bool m_host = false;                                     /// data is in host memory (CPU rendered radar)
     float m_hFOV;                                            /// horizontal field of view of the radar
     float m_vFOV;                                            /// mimimum vertical angle of the radar
     #if PROFILE
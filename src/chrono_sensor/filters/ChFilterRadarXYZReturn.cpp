@@ -1,6 +1,7 @@
 #include "chrono_sensor/filters/ChFilterRadarXYZReturn.h"
 #include "chrono_sensor/utils/CudaMallocHelper.h"
 #include "chrono_sensor/cuda/radarprocess.cuh"
+#include "chrono_sensor/cpu/host_sensor_ops.h"
 #include "chrono_sensor/utils/Dbscan.h"
 #include <random>
 
@@ -23,6 +24,7 @@ CH_SENSOR_API void ChFilterRadarXYZReturn::Initialize(std::shared_ptr<ChSensor>
     // grab radar parameters
     if (auto pRadar = std::dynamic_pointer_cast<ChRadarSensor>(pSensor)) {
         m_cuda_stream = pRadar->GetCudaStream();
+        m_host = pRadar->IsHostRendered();
         m_hFOV = pRadar->GetHFOV();
         m_vFOV = pRadar->GetVFOV();
     } else {
@@ -33,8 +35,10 @@ CH_SENSOR_API void ChFilterRadarXYZReturn::Initialize(std::shared_ptr<ChSensor>
 
     // create output buffer
     m_buffer_out = chrono_types::make_shared<SensorDeviceRadarXYZBuffer>();
-    std::shared_ptr<RadarXYZReturn[]> b(cudaHostMallocHelper<RadarXYZReturn>(m_buffer_in->Width * m_buffer_in->Height),
-                                        cudaHostFreeHelper<RadarXYZReturn>);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height;
+    std::shared_ptr<RadarXYZReturn[]> b(
+        m_host ? hostMallocHelper<RadarXYZReturn>(size) : cudaHostMallocHelper<RadarXYZReturn>(size),
+        m_host ? hostFreeHelper<RadarXYZReturn> : cudaHostFreeHelper<RadarXYZReturn>);
     m_buffer_out->Buffer = std::move(b);
     m_buffer_out->Width = bufferInOut->Width;
     m_buffer_out->Height = bufferInOut->Height;
@@ -42,6 +46,25 @@ CH_SENSOR_API void ChFilterRadarXYZReturn::Initialize(std::shared_ptr<ChSensor>
 }
 
 CH_SENSOR_API void ChFilterRadarXYZReturn::Apply() {
+    if (m_host) {
+        host_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(),
+                                          (int)m_buffer_in->Width, (int)m_buffer_in->Height);
+
+        // filter out no returns, compacting in place
+        RadarXYZReturn* buf = m_buffer_out->Buffer.get();
+        m_buffer_out->Beam_return_count = 0;
+        for (unsigned int i = 0; i < m_buffer_out->Width * m_buffer_out->Height; i++) {
+            if (buf[i].amplitude > 0) {
+                buf[m_buffer_out->Beam_return_count] = buf[i];
+                m_buffer_out->Beam_return_count += 1;
+            }
+        }
+
+        m_buffer_out->LaunchedCount = m_buffer_in->LaunchedCount;
+        m_buffer_out->TimeStamp = m_buffer_in->TimeStamp;
+        return;
+    }
+
     // converts azimuth and elevation to XYZ Coordinates in device
     cuda_radar_pointcloud_from_angles(m_buffer_in->Buffer.get(), m_buffer_out->Buffer.get(), (int)m_buffer_in->Width,
                                       (int)m_buffer_in->Height, m_hFOV, m_vFOV, m_cuda_stream);
@@ -34,11 +34,15 @@ class CH_SENSOR_API ChFilterRadarXYZReturn : public ChFilter {
 
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// The conversion can also be performed on the host for radars rendered on the CPU.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     std::shared_ptr<ChRadarSensor> m_radar;
     std::shared_ptr<SensorDeviceRadarBuffer> m_buffer_in;
     std::shared_ptr<SensorDeviceRadarXYZBuffer> m_buffer_out;
     CUstream m_cuda_stream;
+    bool m_host = false;
     float m_hFOV;
     float m_vFOV;
     float m_min_vert_angle;
@@ -36,14 +36,18 @@ CH_SENSOR_API ChFilterSavePtCloud::ChFilterSavePtCloud(std::string data_path, st
 CH_SENSOR_API ChFilterSavePtCloud::~ChFilterSavePtCloud() {}
 
 CH_SENSOR_API void ChFilterSavePtCloud::Apply() {
-    cudaMemcpyAsync(m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(),
-                    sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1),
-                    cudaMemcpyDeviceToHost, m_cuda_stream);
+    size_t size = sizeof(PixelXYZI) * m_host_buffer->Width * m_host_buffer->Height * (m_host_buffer->Dual_return + 1);
+    if (m_host)
+        memcpy(m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(), size);
+    else
+        cudaMemcpyAsync(m_host_buffer->Buffer.get(), m_buffer_in->Buffer.get(), size, cudaMemcpyDeviceToHost,
+                        m_cuda_stream);
 
     std::string filename = m_path + "frame_" + std::to_string(m_frame_number) + ".csv";
     m_frame_number++;
     utils::ChWriterCSV csv_writer(",");
-    cudaStreamSynchronize(m_cuda_stream);
+    if (!m_host)
+        cudaStreamSynchronize(m_cuda_stream);
     std::cout << "Beam count: " << m_buffer_in->Beam_return_count << std::endl;
     for (unsigned int i = 0; i < m_buffer_in->Beam_return_count; i++) {
         csv_writer << m_host_buffer->Buffer[i].x << m_host_buffer->Buffer[i].y << m_host_buffer->Buffer[i].z
@@ -63,14 +67,15 @@ CH_SENSOR_API void ChFilterSavePtCloud::Initialize(std::shared_ptr<ChSensor> pSe
 
     if (auto pOpx = std::dynamic_pointer_cast<ChOptixSensor>(pSensor)) {
         m_cuda_stream = pOpx->GetCudaStream();
+        m_host = pOpx->IsHostRendered();
     } else {
         InvalidFilterGraphSensorTypeMismatch(pSensor);
     }
 
     m_host_buffer = chrono_types::make_shared<SensorHostXYZIBuffer>();
-    std::shared_ptr<PixelXYZI[]> b(
-        cudaHostMallocHelper<PixelXYZI>(m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1)),
-        cudaHostFreeHelper<PixelXYZI>);
+    unsigned int size = m_buffer_in->Width * m_buffer_in->Height * (m_buffer_in->Dual_return + 1);
+    std::shared_ptr<PixelXYZI[]> b(m_host ? hostMallocHelper<PixelXYZI>(size) : cudaHostMallocHelper<PixelXYZI>(size),
+                                   m_host ? hostFreeHelper<PixelXYZI> : cudaHostFreeHelper<PixelXYZI>);
     m_host_buffer->Buffer = std::move(b);
     m_host_buffer->Width = m_buffer_in->Width;
     m_host_buffer->Height = m_buffer_in->Height;
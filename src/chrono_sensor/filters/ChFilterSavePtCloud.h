@@ -50,12 +50,16 @@ class CH_SENSOR_API ChFilterSavePtCloud : public ChFilter {
     /// @param bufferInOut A buffer that is passed into the filter.
     virtual void Initialize(std::shared_ptr<ChSensor> pSensor, std::shared_ptr<SensorBuffer>& bufferInOut);
 
+    /// Point clouds rendered on the CPU are saved directly from host memory.
+    virtual bool SupportsHostBuffers() const override { return true; }
+
   private:
     std::string m_path;                                   ///< path to saved data
     unsigned int m_frame_number = 0;                      ///< frame counter for saving sequential frames
     std::shared_ptr<SensorDeviceXYZIBuffer> m_buffer_in;  ///< input buffer for point cloud
     std::shared_ptr<SensorHostXYZIBuffer> m_host_buffer;  ///< input buffer for point cloud
     CUstream m_cuda_stream;
+    bool m_host = false;  ///< input buffer is in host memory (CPU rendered lidar)
 };
 
 /// @}
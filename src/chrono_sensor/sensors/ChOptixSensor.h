@@ -56,6 +56,13 @@ class CH_SENSOR_API ChOptixSensor : public ChSensor {
     unsigned int GetHeight() { return m_height; }
     CUstream GetCudaStream() { return m_cuda_stream; }
 
+    /// Return true if the sensor data is rendered by the CPU ray tracing backend, in which case the buffers passed
+    /// through the filter graph are in host memory.
+    bool IsHostRendered() const { return m_host_rendered; }
+
+    /// Mark the sensor as rendered by the CPU ray tracing backend. Set by the engine before filters are initialized.
+    void SetHostRendered(bool host_rendered) { m_host_rendered = host_rendered; }
+
   protected:
     PipelineType m_pipeline_type;  ///< the type of pipeline for rendering
 
@@ -63,6 +70,7 @@ class CH_SENSOR_API ChOptixSensor : public ChSensor {
     unsigned int m_width;    ///< to hold reference to the width for rendering
     unsigned int m_height;   ///< to hold reference to the height for rendering
     CUstream m_cuda_stream;  ///< cuda stream for this buffer when applicable
+    bool m_host_rendered;    ///< data is rendered on the CPU and kept in host memory
 };
 
 /// @} sensor_sensors
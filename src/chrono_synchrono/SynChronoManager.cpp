@@ -53,7 +53,9 @@ SynChronoManager::SynChronoManager(int node_id, int num_nodes, std::shared_ptr<S
       m_time_update(0),
       m_time_msg_gather(0),
       m_time_communication(0),
-      m_time_msg_process(0) {
+      m_time_msg_process(0),
+      m_num_msgs_received(0),
+      m_total_num_msgs_received(0) {
     if (communicator)
         SetCommunicator(communicator);
 
@@ -188,6 +190,7 @@ void SynChronoManager::Synchronize(double time) {
     // Call update for each underlying agent
     m_timer_update.start();
     UpdateAgents();
+    UpdateInterest();
     m_timer_update.stop();
 
     // Gather messages from each node and add those to the communicator
@@ -202,6 +205,8 @@ void SynChronoManager::Synchronize(double time) {
     m_communicator->Synchronize();
     m_timer_communication.stop();
 
+    m_volume = m_communicator->GetMessageVolume();
+
     // Process any received data
     // Will most likely contain state or general purpose messages
     // Distribute the organized messages
@@ -216,6 +221,13 @@ void SynChronoManager::Synchronize(double time) {
     m_time_communication += m_timer_communication();
     m_time_msg_process += m_timer_msg_process();
 
+    // Accumulate message volume
+    m_total_volume.buffers_sent += m_volume.buffers_sent;
+    m_total_volume.buffers_received += m_volume.buffers_received;
+    m_total_volume.bytes_sent += m_volume.bytes_sent;
+    m_total_volume.bytes_received += m_volume.bytes_received;
+    m_total_num_msgs_received += m_num_msgs_received;
+
     // Reset
     m_communicator->Reset();     // Reset the communicator
     m_messages.clear();          // clean the message map
@@ -241,6 +253,13 @@ void SynChronoManager::PrintStepStatistics(std::ostream& os) const {
     os << "   Msg. generation: " << 1e3 * m_timer_msg_gather() << "  [" << m_time_msg_gather << "]" << std::endl;
     os << "   Communication:   " << 1e3 * m_timer_communication() << "  [" << m_time_communication << "]" << std::endl;
     os << "   Msg. processing: " << 1e3 * m_timer_msg_process() << "  [" << m_time_msg_process << "]" << std::endl;
+    os << " Message volume (kB [kB]):" << std::endl;
+    os << "   Sent:            " << 1e-3 * m_volume.bytes_sent << " in " << m_volume.buffers_sent << " buffers  ["
+       << 1e-3 * m_total_volume.bytes_sent << " in " << m_total_volume.buffers_sent << "]" << std::endl;
+    os << "   Received:        " << 1e-3 * m_volume.bytes_received << " in " << m_volume.buffers_received
+       << " buffers  [" << 1e-3 * m_total_volume.bytes_received << " in " << m_total_volume.buffers_received << "]"
+       << std::endl;
+    os << "   Msgs. received:  " << m_num_msgs_received << "  [" << m_total_num_msgs_received << "]" << std::endl;
 }
 
 // --------------------------------------------------------------------------------------------------------------
@@ -265,9 +284,22 @@ SynMessageList SynChronoManager::GatherDescriptionMessages() {
     return messages;
 }
 
+void SynChronoManager::UpdateInterest() {
+    std::vector<SynInterestRecord> records;
+
+    for (auto& agent_pair : m_agents) {
+        ChVector3d location;
+        if (agent_pair.second->GetLocation(location))
+            records.push_back({{location.x(), location.y(), location.z()}, agent_pair.second->GetInterestRadius()});
+    }
+
+    m_communicator->SetInterestRecords(records);
+}
+
 void SynChronoManager::ProcessReceivedMessages() {
     // get the message buffer from the underlying communicator
     SynMessageList messages = m_communicator->GetMessages();
+    m_num_msgs_received = messages.size();
 
     for (auto& message : messages) {
         if (message->GetMessageType() == SynFlatBuffers::Type_Simulation_State) {
@@ -86,9 +86,12 @@ class SYN_API SynChronoManager {
     /// @brief Should the simulation still be running?
     bool IsOk() { return m_is_ok; }
 
-    /// @brief Print timing information (over last step and cumulative)
+    /// @brief Print timing and message volume information (over last step and cumulative)
     void PrintStepStatistics(std::ostream& os) const;
 
+    /// @brief Get the volume of the data exchanged with other nodes during the last synchronization
+    const SynMessageVolume& GetMessageVolume() const { return m_volume; }
+
   private:
     // These methods are only available to derived classes.
     // This decision was made to ensure agents are responsible for message generation,
@@ -119,6 +122,11 @@ class SYN_API SynChronoManager {
     ///
     void ProcessReceivedMessages();
 
+    ///@brief Pass the location and region of interest of each agent on this node to the communicator.
+    /// Communicators supporting interest management use this to only exchange messages with nearby nodes.
+    ///
+    void UpdateInterest();
+
     ///@brief This method passes out each received message to it's intended agent
     ///
 
@@ -156,6 +164,11 @@ class SYN_API SynChronoManager {
     double m_time_communication;  ///< cummulative time for communication
     double m_time_msg_process;    ///< cumulative time for processing received messages
 
+    SynMessageVolume m_volume;         ///< data exchanged during the last synchronization
+    SynMessageVolume m_total_volume;   ///< cumulative data exchanged
+    size_t m_num_msgs_received;        ///< number of messages received during the last synchronization
+    size_t m_total_num_msgs_received;  ///< cumulative number of messages received
+
     int m_num_managed_agents = 0;                                    ///< Number of agents managed by this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_agents;          ///< Agents in the SynChrono world on this node
     std::map<AgentKey, std::shared_ptr<SynAgent>> m_zombies;         ///< Agents in the SynChrono world not on this node
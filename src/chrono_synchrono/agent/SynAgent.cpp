@@ -22,10 +22,13 @@
 
 #include "chrono_synchrono/agent/SynAgent.h"
 
+#include <limits>
+
 namespace chrono {
 namespace synchrono {
 
-SynAgent::SynAgent(AgentKey agent_key) : m_agent_key(agent_key) {}
+SynAgent::SynAgent(AgentKey agent_key)
+    : m_agent_key(agent_key), m_interest_radius(std::numeric_limits<double>::infinity()) {}
 
 SynAgent::~SynAgent() {}
 
@@ -93,6 +93,28 @@ class SYN_API SynAgent {
 
     // -------------------------------------------------------------------------
 
+    ///@brief Get the current location of this agent, used for interest management.
+    /// Agents without a spatial location (e.g. terrain or environment agents) return false and are distributed
+    /// together with the located agents on their node.
+    ///
+    ///@param location the location of the agent
+    ///@return whether the agent has a location
+    virtual bool GetLocation(ChVector3d& location) { return false; }
+
+    ///@brief Set the radius of the region of interest around this agent.
+    /// The node of this agent only receives messages from nodes with at least one agent inside this region (or from
+    /// nodes without any located agent). Defaults to infinity, i.e. messages from all nodes are received. Zombies of
+    /// agents outside the region keep the last state received from them.
+    ///
+    ///@param radius the radius of the region of interest
+    void SetInterestRadius(double radius) { m_interest_radius = radius; }
+
+    ///@brief Get the radius of the region of interest around this agent
+    ///
+    double GetInterestRadius() const { return m_interest_radius; }
+
+    // -------------------------------------------------------------------------
+
     int GetID() { return m_agent_key.GetAgentID(); }
 
     AgentKey GetKey() { return m_agent_key; }
@@ -101,6 +123,8 @@ class SYN_API SynAgent {
   protected:
     AgentKey m_agent_key;
 
+    double m_interest_radius;  ///< radius of the region of interest around this agent
+
     std::function<void(std::shared_ptr<SynMessage>)> m_process_message_callback;
 };
 
@@ -86,6 +86,14 @@ void SynCopterAgent::Update() {
     m_state->SetState(time, chassis_pose, props_poses);
 }
 
+bool SynCopterAgent::GetLocation(ChVector3d& location) {
+    if (!m_copter)
+        return false;
+
+    location = m_copter->GetChassis()->GetPos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynCopterAgent::SetKey(AgentKey agent_key) {
@@ -79,6 +79,13 @@ class SYN_API SynTrackedVehicleAgent : public SynAgent {
     ///@param messages a referenced vector containing messages to be distributed from this rank
     virtual void GatherDescriptionMessages(SynMessageList& messages) override { messages.push_back(m_description); }
 
+    ///@brief Get the current location of this agent, used for interest management
+    /// The location of the vehicle chassis is used. Zombie agents have no location.
+    ///
+    ///@param location the location of the agent
+    ///@return whether the agent has a location
+    virtual bool GetLocation(ChVector3d& location) override;
+
     // ------------------------------------------------------------------------
 
     ///@brief Set the zombie visualization files from a JSON specification file
@@ -115,6 +115,14 @@ void SynWheeledVehicleAgent::Update() {
     m_state->SetState(time, chassis, wheels);
 }
 
+bool SynWheeledVehicleAgent::GetLocation(ChVector3d& location) {
+    if (!m_vehicle)
+        return false;
+
+    location = m_vehicle->GetPos();
+    return true;
+}
+
 // ------------------------------------------------------------------------
 
 void SynWheeledVehicleAgent::SetZombieVisualizationFilesFromJSON(const std::string& filename) {
@@ -27,7 +27,7 @@
 namespace chrono {
 namespace synchrono {
 
-SynCommunicator::SynCommunicator() : m_initialized(false) {}
+SynCommunicator::SynCommunicator() : m_initialized(false), m_broadcast(false) {}
 
 SynCommunicator::~SynCommunicator() {}
 
@@ -50,6 +50,9 @@ void SynCommunicator::AddQuitMessage() {
     // Source and destination are meaningless in this case
     auto message = chrono_types::make_shared<SynSimulationMessage>(AgentKey(), AgentKey(), true);
     m_flatbuffers_manager.AddMessage(message);
+
+    // Every node must be told, regardless of interest
+    m_broadcast = true;
 }
 
 void SynCommunicator::AddIncomingMessages(SynMessageList& messages) {
@@ -28,6 +28,7 @@
 #include "chrono_synchrono/SynApi.h"
 #include "chrono_synchrono/flatbuffer/SynFlatBuffersManager.h"
 #include "chrono_synchrono/flatbuffer/message/SynMessage.h"
+#include "chrono_synchrono/communication/SynInterestManager.h"
 
 #include <vector>
 #include <functional>
@@ -38,6 +39,14 @@ namespace synchrono {
 /// @addtogroup synchrono_communication
 /// @{
 
+/// Volume of the data exchanged with other nodes during a synchronization
+struct SynMessageVolume {
+    unsigned int buffers_sent = 0;      ///< number of message buffers sent to other nodes
+    unsigned int buffers_received = 0;  ///< number of message buffers received from other nodes
+    size_t bytes_sent = 0;              ///< number of bytes sent to other nodes
+    size_t bytes_received = 0;          ///< number of bytes received from other nodes
+};
+
 /// Base class communicator used to establish and facilitate communication between nodes
 class SYN_API SynCommunicator {
   public:
@@ -99,10 +108,25 @@ class SYN_API SynCommunicator {
     ///@return SynMessageList the received messages
     virtual SynMessageList& GetMessages() { return m_incoming_messages; }
 
+    ///@brief Set the spatial summary of the agents on this node, used for interest management.
+    /// Communicators supporting interest management only exchange messages between nodes with agents inside each
+    /// other's region of interest (see SynInterestManager). Others ignore the summary and exchange with all nodes.
+    ///
+    ///@param records the location and radius of interest of each located agent on this node
+    void SetInterestRecords(const std::vector<SynInterestRecord>& records) { m_interest_records = records; }
+
+    ///@brief Get the volume of the data exchanged during the last synchronization
+    ///
+    const SynMessageVolume& GetMessageVolume() const { return m_message_volume; }
+
     // -----------------------------------------------------------------------------------------------
 
   protected:
     bool m_initialized;  ///< whether the communicator has been initialized
+    bool m_broadcast;    ///< outgoing messages must reach all nodes (e.g. quit messages)
+
+    std::vector<SynInterestRecord> m_interest_records;  ///< spatial summary of the agents on this node
+    SynMessageVolume m_message_volume;                  ///< data exchanged during the last synchronization
 
     SynMessageList m_incoming_messages;           ///< Incoming messages
     SynFlatBuffersManager m_flatbuffers_manager;  ///< flatbuffer manager for this rank
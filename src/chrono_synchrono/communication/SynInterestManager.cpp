@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Spatial interest management for SynChrono
+//
+// =============================================================================
+
+#include "chrono_synchrono/communication/SynInterestManager.h"
+
+#include <cmath>
+
+namespace chrono {
+namespace synchrono {
+
+SynInterestManager::SynInterestManager() : m_num_nodes(0), m_full_exchange(true) {}
+
+void SynInterestManager::Update(const std::vector<std::vector<SynInterestRecord>>& records,
+                                const std::vector<bool>& broadcast) {
+    m_num_nodes = (int)records.size();
+    m_interest.assign(m_num_nodes * m_num_nodes, 0);
+    m_full_exchange = true;
+
+    for (int receiver = 0; receiver < m_num_nodes; receiver++) {
+        const auto& observers = records[receiver];
+
+        for (int sender = 0; sender < m_num_nodes; sender++) {
+            if (sender == receiver)
+                continue;
+
+            const auto& targets = records[sender];
+
+            // Nodes without located agents, or explicitly broadcasting, take part in every exchange
+            bool interested = observers.empty() || targets.empty() ||
+                              (sender < (int)broadcast.size() && broadcast[sender]);
+            for (auto o = observers.begin(); !interested && o != observers.end(); ++o)
+                for (auto t = targets.begin(); !interested && t != targets.end(); ++t)
+                    interested = IsInRange(*o, *t);
+
+            m_interest[receiver * m_num_nodes + sender] = interested;
+            m_full_exchange = m_full_exchange && interested;
+        }
+    }
+}
+
+std::vector<int> SynInterestManager::GetDestinations(int node) const {
+    std::vector<int> destinations;
+    for (int receiver = 0; receiver < m_num_nodes; receiver++)
+        if (receiver != node && IsInterested(receiver, node))
+            destinations.push_back(receiver);
+
+    return destinations;
+}
+
+std::vector<int> SynInterestManager::GetSources(int node) const {
+    std::vector<int> sources;
+    for (int sender = 0; sender < m_num_nodes; sender++)
+        if (sender != node && IsInterested(node, sender))
+            sources.push_back(sender);
+
+    return sources;
+}
+
+bool SynInterestManager::IsInRange(const SynInterestRecord& observer, const SynInterestRecord& target) {
+    if (std::isinf(observer.radius))
+        return true;
+
+    double dx = target.pos[0] - observer.pos[0];
+    double dy = target.pos[1] - observer.pos[1];
+    double dz = target.pos[2] - observer.pos[2];
+
+    return dx * dx + dy * dy + dz * dz <= observer.radius * observer.radius;
+}
+
+}  // namespace synchrono
+}  // namespace chrono
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Spatial interest management for SynChrono. Each node summarizes its agents
+// as a list of locations together with a region of interest (a sphere) around
+// each of them. From the summaries of all nodes, every node can determine,
+// without further communication, which nodes need its state messages and from
+// which nodes it will receive state messages.
+//
+// Interest is resolved at node granularity:
+//  - node j receives the messages of node i if any agent of node j has node i
+//    inside its region of interest, i.e. if some located agent of node i is
+//    within the radius of interest of some located agent of node j
+//  - agents without a location (e.g. SynSCMTerrainAgent) travel with the
+//    located agents of their node and do not restrict what their node receives
+//  - a node without any located agent sends to and receives from every node
+//
+// =============================================================================
+
+#ifndef SYN_INTEREST_MANAGER_H
+#define SYN_INTEREST_MANAGER_H
+
+#include <vector>
+
+#include "chrono_synchrono/SynApi.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_communication
+/// @{
+
+/// Spatial summary of a single agent, exchanged between nodes for interest management.
+/// Plain-old-data so that it can be sent as a raw byte array.
+struct SynInterestRecord {
+    double pos[3];  ///< location of the agent
+    double radius;  ///< radius of the region of interest around the agent (infinity to receive everything)
+};
+
+/// Helper class which determines, from the spatial summaries of all nodes, which nodes exchange messages
+class SYN_API SynInterestManager {
+  public:
+    ///@brief Default constructor
+    ///
+    SynInterestManager();
+
+    ///@brief Compute the interest relations between all nodes
+    ///
+    ///@param records the spatial summaries of the agents of each node, indexed by node id
+    ///@param broadcast whether a node must send its messages to all other nodes regardless of interest (optional)
+    void Update(const std::vector<std::vector<SynInterestRecord>>& records,
+                const std::vector<bool>& broadcast = std::vector<bool>());
+
+    ///@brief Whether the receiving node needs the messages of the sending node
+    ///
+    bool IsInterested(int receiver, int sender) const { return m_interest[receiver * m_num_nodes + sender]; }
+
+    ///@brief Get the nodes which need the messages of the given node (the node itself excluded)
+    ///
+    std::vector<int> GetDestinations(int node) const;
+
+    ///@brief Get the nodes whose messages are needed by the given node (the node itself excluded)
+    ///
+    std::vector<int> GetSources(int node) const;
+
+    ///@brief Whether every node needs the messages of every other node, i.e. the exchange is all-to-all
+    ///
+    bool IsFullExchange() const { return m_full_exchange; }
+
+    ///@brief Get the number of nodes of the last update
+    ///
+    int GetNumNodes() const { return m_num_nodes; }
+
+    ///@brief Whether an agent with the given region of interest is interested in another agent's location
+    ///
+    static bool IsInRange(const SynInterestRecord& observer, const SynInterestRecord& target);
+
+  private:
+    int m_num_nodes;               ///< number of nodes of the last update
+    bool m_full_exchange;          ///< all nodes need the messages of all other nodes
+    std::vector<char> m_interest;  ///< interest matrix, row-major (receiver, sender)
+};
+
+/// @} synchrono_communication
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
@@ -38,6 +38,10 @@ SynMPICommunicator::SynMPICommunicator(int argc, char* argv[]) {
 
     m_msg_lengths = new int[m_num_ranks];
     m_msg_displs = new int[m_num_ranks];
+
+    m_headers.resize(3 * m_num_ranks);
+    m_record_lengths.resize(m_num_ranks);
+    m_record_displs.resize(m_num_ranks);
 }
 
 SynMPICommunicator::~SynMPICommunicator() {
@@ -51,42 +55,106 @@ void SynMPICommunicator::Synchronize() {
     m_flatbuffers_manager.Finish();
 
     int msg_length = m_flatbuffers_manager.GetSize();
+    int record_length = (int)(m_interest_records.size() * sizeof(SynInterestRecord));
 
-    // Get the length of message from each agent
-    MPI_Allgather(&msg_length, 1, MPI_INT,    // Sending pointer, length, type
-                  m_msg_lengths, 1, MPI_INT,  // Receiving pointer, length, type
-                  MPI_COMM_WORLD);            // Receiving rank and world
+    // Get the length of message, the size of the spatial summary and the broadcast flag from each rank
+    int header[3] = {msg_length, record_length, m_broadcast ? 1 : 0};
+    MPI_Allgather(header, 3, MPI_INT,             // Sending pointer, length, type
+                  m_headers.data(), 3, MPI_INT,  // Receiving pointer, length, type
+                  MPI_COMM_WORLD);               // Receiving rank and world
 
     m_total_length = 0;
+    int total_record_length = 0;
 
     // In C++17 this could just be an exclusive scan from std::
     // Didn't use std::partial_sum since we want m_total_length computed
     // m_msg_displs is needed by MPI_Gatherv
+    std::vector<bool> broadcast(m_num_ranks);
     for (int i = 0; i < m_num_ranks; i++) {
+        m_msg_lengths[i] = m_headers[3 * i + 0];
         m_msg_displs[i] = m_total_length;
         m_total_length += m_msg_lengths[i];
+
+        m_record_lengths[i] = m_headers[3 * i + 1];
+        m_record_displs[i] = total_record_length;
+        total_record_length += m_record_lengths[i];
+
+        broadcast[i] = m_headers[3 * i + 2] != 0;
     }
 
-    // if (m_rank == 0)
-    //     std::cout << m_rank << " message length: " << m_total_length << std::endl;
+    // Gather the spatial summaries, only needed if at least one rank has located agents
+    std::vector<std::vector<SynInterestRecord>> records(m_num_ranks);
+    if (total_record_length > 0) {
+        m_all_records.resize(total_record_length);
+
+        MPI_Allgatherv(m_interest_records.data(), record_length, MPI_BYTE,  // Sending pointer, length, type
+                       m_all_records.data(), m_record_lengths.data(), m_record_displs.data(),
+                       MPI_BYTE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+
+        for (int i = 0; i < m_num_ranks; i++) {
+            auto first = reinterpret_cast<const SynInterestRecord*>(m_all_records.data() + m_record_displs[i]);
+            records[i].assign(first, first + m_record_lengths[i] / sizeof(SynInterestRecord));
+        }
+    }
+
+    // Every rank has the same summaries, so every rank agrees on who sends to whom
+    m_interest.Update(records, broadcast);
+
+    m_all_data.resize(m_total_length);
+    m_message_volume = SynMessageVolume();
+
+    if (m_interest.IsFullExchange()) {
+        MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
+                       m_all_data.data(), m_msg_lengths, m_msg_displs,
+                       MPI_BYTE,  // Receiving pointer, lengths, displacements, type
+                       MPI_COMM_WORLD);
+
+        m_sources.clear();
+        for (int i = 0; i < m_num_ranks; i++)
+            if (i != m_rank)
+                m_sources.push_back(i);
 
-    m_all_data.reserve(m_total_length);
+        m_message_volume.buffers_sent = m_num_ranks - 1;
+    } else {
+        // Neighborhood exchange: lengths are already known, so receives can be posted directly
+        m_sources = m_interest.GetSources(m_rank);
+        auto destinations = m_interest.GetDestinations(m_rank);
 
-    MPI_Allgatherv(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE,  // Sending pointer, length, type
-                   m_all_data.data(), m_msg_lengths, m_msg_displs,
-                   MPI_BYTE,  // Receiving pointer, lengths, displacements, type
-                   MPI_COMM_WORLD);
+        std::vector<MPI_Request> requests;
+        requests.reserve(m_sources.size() + destinations.size());
 
+        for (int source : m_sources) {
+            requests.emplace_back();
+            MPI_Irecv(m_all_data.data() + m_msg_displs[source], m_msg_lengths[source], MPI_BYTE, source, 0,
+                      MPI_COMM_WORLD, &requests.back());
+        }
+
+        for (int destination : destinations) {
+            requests.emplace_back();
+            MPI_Isend(m_flatbuffers_manager.GetBufferPointer(), msg_length, MPI_BYTE, destination, 0, MPI_COMM_WORLD,
+                      &requests.back());
+        }
+
+        MPI_Waitall((int)requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+        m_message_volume.buffers_sent = (unsigned int)destinations.size();
+    }
+
+    m_message_volume.bytes_sent = (size_t)msg_length * m_message_volume.buffers_sent;
+    m_message_volume.buffers_received = (unsigned int)m_sources.size();
+    for (int source : m_sources)
+        m_message_volume.bytes_received += m_msg_lengths[source];
+
+    m_broadcast = false;
     m_flatbuffers_manager.Reset();
 }
 
 SynMessageList& SynMPICommunicator::GetMessages() {
-    for (int i = 0; i < m_num_ranks; i++) {
-        if (i != m_rank) {
-            std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
-                                                             m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
-            m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
-        }
+    for (int i : m_sources) {
+        std::vector<uint8_t> data = std::vector<uint8_t>(m_all_data.data() + m_msg_displs[i],
+                                                         m_all_data.data() + m_msg_displs[i] + m_msg_lengths[i]);
+        m_flatbuffers_manager.ProcessBuffer(data, m_incoming_messages);
     }
 
     return m_incoming_messages;
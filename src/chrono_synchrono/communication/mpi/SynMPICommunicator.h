@@ -57,7 +57,11 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     /// As in, depending on the derived class implementation, this method could use synchronous
     /// or asynchronous method calls to implement a communication interface.
     ///
-    /// Synchronize will serialize the underlying message buffer if it hasn't yet
+    /// Synchronize will serialize the underlying message buffer if it hasn't yet.
+    ///
+    /// The message lengths and the spatial summaries of all ranks are gathered first. If every rank is interested in
+    /// every other rank, the message buffers are exchanged all-to-all. Otherwise each rank only sends its buffer to
+    /// the ranks interested in it, using point-to-point messages (see SynInterestManager).
     ///
     virtual void Synchronize() override;
 
@@ -83,6 +87,10 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
     ///
     virtual unsigned int GetNumRanks() const { return m_num_ranks; }
 
+    ///@brief Get the interest relations between ranks computed during the last synchronization
+    ///
+    const SynInterestManager& GetInterestManager() const { return m_interest; }
+
     // -----------------------------------------------------------------------------------------------
 
   private:
@@ -96,6 +104,14 @@ class SYN_API SynMPICommunicator : public SynCommunicator {
 
     std::vector<uint8_t> m_rank_data;
     std::vector<uint8_t> m_all_data;
+
+    std::vector<int> m_headers;          ///< message length, summary size and broadcast flag of each rank
+    std::vector<int> m_record_lengths;   ///< size in bytes of the spatial summary of each rank
+    std::vector<int> m_record_displs;    ///< offsets of the spatial summaries in m_all_records
+    std::vector<uint8_t> m_all_records;  ///< spatial summaries of all ranks
+
+    SynInterestManager m_interest;  ///< interest relations between ranks
+    std::vector<int> m_sources;     ///< ranks whose messages were received during the last synchronization
 };
 
 /// @} synchrono_communication
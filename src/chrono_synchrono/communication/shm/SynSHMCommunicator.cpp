@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Communicator for nodes running as separate processes on the same machine.
+// Message buffers are exchanged through ring buffers in a shared memory
+// segment and received messages are decoded in place.
+//
+// =============================================================================
+
+#include "chrono_synchrono/communication/shm/SynSHMCommunicator.h"
+
+#include <cstring>
+
+#include "chrono/core/ChTypes.h"
+
+namespace chrono {
+namespace synchrono {
+
+// Spatial summaries start with an 8-byte header holding the broadcast flag, followed by the interest records
+static const size_t kSummaryHeader = sizeof(uint64_t);
+
+SynSHMCommunicator::SynSHMCommunicator(int node_id,
+                                       int num_nodes,
+                                       const std::string& name,
+                                       size_t capacity,
+                                       uint64_t key,
+                                       double timeout)
+    : m_node_id(node_id), m_num_nodes(num_nodes) {
+    m_transport =
+        chrono_types::make_unique<utils::ChSharedMemoryTransport>(name, node_id, num_nodes, capacity, timeout, key);
+}
+
+SynSHMCommunicator::~SynSHMCommunicator() {
+    ReleaseSources();
+}
+
+void SynSHMCommunicator::Synchronize() {
+    // Buffers from the previous synchronization must be released before the senders can reuse their space
+    ReleaseSources();
+
+    m_flatbuffers_manager.Finish();
+
+    // Send the broadcast flag and the spatial summary to all other nodes
+    size_t record_length = m_interest_records.size() * sizeof(SynInterestRecord);
+    m_summary.assign(kSummaryHeader + record_length, 0);
+    m_summary[0] = m_broadcast ? 1 : 0;
+    if (record_length > 0)
+        std::memcpy(m_summary.data() + kSummaryHeader, m_interest_records.data(), record_length);
+
+    for (int node = 0; node < m_num_nodes; node++)
+        if (node != m_node_id)
+            m_transport->Send(node, m_summary.data(), m_summary.size());
+
+    // Collect the summaries of all nodes
+    std::vector<std::vector<SynInterestRecord>> records(m_num_nodes);
+    std::vector<bool> broadcast(m_num_nodes, false);
+    records[m_node_id] = m_interest_records;
+    broadcast[m_node_id] = m_broadcast;
+
+    for (int node = 0; node < m_num_nodes; node++) {
+        if (node == m_node_id)
+            continue;
+        size_t size;
+        auto summary = static_cast<const uint8_t*>(m_transport->Peek(node, size));
+        broadcast[node] = summary[0] != 0;
+        auto first = reinterpret_cast<const SynInterestRecord*>(summary + kSummaryHeader);
+        records[node].assign(first, first + (size - kSummaryHeader) / sizeof(SynInterestRecord));
+        m_transport->Release(node);
+    }
+
+    // Every node has the same summaries, so every node agrees on who sends to whom
+    m_interest.Update(records, broadcast);
+
+    auto destinations = m_interest.GetDestinations(m_node_id);
+    m_sources = m_interest.GetSources(m_node_id);
+
+    size_t msg_length = m_flatbuffers_manager.GetSize();
+    for (int destination : destinations)
+        m_transport->Send(destination, m_flatbuffers_manager.GetBufferPointer(), msg_length);
+
+    // Wait for the message buffers of the sources, but leave them in the shared segment until processed
+    m_message_volume = SynMessageVolume();
+    m_buffers.resize(m_sources.size());
+    for (size_t i = 0; i < m_sources.size(); i++) {
+        size_t size;
+        m_buffers[i] = static_cast<const uint8_t*>(m_transport->Peek(m_sources[i], size));
+        m_message_volume.bytes_received += size;
+    }
+
+    m_message_volume.buffers_sent = (unsigned int)destinations.size();
+    m_message_volume.buffers_received = (unsigned int)m_sources.size();
+    m_message_volume.bytes_sent = msg_length * destinations.size();
+
+    m_broadcast = false;
+    m_flatbuffers_manager.Reset();
+}
+
+void SynSHMCommunicator::Barrier() {
+    m_transport->Barrier();
+}
+
+SynMessageList& SynSHMCommunicator::GetMessages() {
+    for (auto buffer : m_buffers)
+        m_flatbuffers_manager.ProcessBuffer(buffer, m_incoming_messages);
+    ReleaseSources();
+
+    return m_incoming_messages;
+}
+
+void SynSHMCommunicator::ReleaseSources() {
+    for (size_t i = 0; i < m_buffers.size(); i++)
+        m_transport->Release(m_sources[i]);
+    m_buffers.clear();
+}
+
+}  // namespace synchrono
+}  // namespace chrono
@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Communicator for nodes running as separate processes on the same machine.
+// Message buffers are exchanged through ring buffers in a shared memory
+// segment and received messages are decoded in place.
+//
+// =============================================================================
+
+#ifndef SYN_SHM_COMMUNICATOR_H
+#define SYN_SHM_COMMUNICATOR_H
+
+#include <memory>
+#include <string>
+
+#include "chrono/utils/ChSharedMemory.h"
+
+#include "chrono_synchrono/communication/SynCommunicator.h"
+
+namespace chrono {
+namespace synchrono {
+
+/// @addtogroup synchrono_communication
+/// @{
+
+/// Derived communicator used to establish and facilitate communication between nodes running on a single machine.
+/// Uses a shared memory segment (see utils::ChSharedMemoryTransport) instead of a network protocol. The processes can
+/// be started in any way (e.g. from a script, or with mpirun), as long as each is given a distinct node index and all
+/// use the same segment name.
+///
+/// Received message buffers are not copied out of the shared segment: they are decoded in place by GetMessages and
+/// released right after. The capacity of the ring buffers must be large enough for the largest message buffer of a
+/// node, plus its spatial summary.
+class SYN_API SynSHMCommunicator : public SynCommunicator {
+  public:
+    ///@brief Create the communicator and attach to the shared memory segment.
+    /// Blocks until all nodes have attached to the segment.
+    ///
+    ///@param node_id index of this node, in [0, num_nodes)
+    ///@param num_nodes number of nodes in the simulation
+    ///@param name name of the shared memory segment, unique among the simulations running on the machine
+    ///@param capacity capacity (bytes) of the ring buffer of each pair of nodes
+    ///@param key key identifying the current run, identical on all nodes (e.g. the process ID of node 0), such that
+    /// no node attaches to a stale segment with the same name left over by a previous run
+    ///@param timeout maximum time (s) to wait for the other nodes, at construction and in Barrier
+    SynSHMCommunicator(int node_id,
+                       int num_nodes,
+                       const std::string& name = "synchrono",
+                       size_t capacity = 1 << 22,
+                       uint64_t key = 0,
+                       double timeout = 60);
+
+    ///@brief Destructor
+    ///
+    virtual ~SynSHMCommunicator();
+
+    ///@brief This method is responsible for continuous synchronization steps
+    ///
+    /// Synchronize will serialize the underlying message buffer if it hasn't yet.
+    ///
+    /// The spatial summaries of all nodes are exchanged first. Each node then writes its message buffer only to the
+    /// nodes interested in it (see SynInterestManager) and waits for the buffers of the nodes it is interested in.
+    ///
+    virtual void Synchronize() override;
+
+    ///@brief Block until all nodes have called Barrier.
+    /// Throws a std::runtime_error if not all nodes arrive within the timeout specified at construction.
+    ///
+    virtual void Barrier() override;
+
+    // -----------------------------------------------------------------------------------------------
+
+    ///@brief Get the messages received by the communicator.
+    /// The message buffers received during the last synchronization are decoded in place and then released.
+    ///
+    ///@return SynMessageList the received messages
+    virtual SynMessageList& GetMessages() override;
+
+    ///@brief Get the index of this node
+    ///
+    int GetNodeID() const { return m_node_id; }
+
+    ///@brief Get the number of nodes in the simulation
+    ///
+    int GetNumNodes() const { return m_num_nodes; }
+
+    ///@brief Get the interest relations between nodes computed during the last synchronization
+    ///
+    const SynInterestManager& GetInterestManager() const { return m_interest; }
+
+    // -----------------------------------------------------------------------------------------------
+
+  private:
+    /// Release the message buffers received during the last synchronization, if not already processed.
+    void ReleaseSources();
+
+    int m_node_id;
+    int m_num_nodes;
+
+    std::unique_ptr<utils::ChSharedMemoryTransport> m_transport;  ///< shared memory transport between nodes
+
+    std::vector<uint8_t> m_summary;  ///< outgoing broadcast flag and spatial summary
+
+    SynInterestManager m_interest;          ///< interest relations between nodes
+    std::vector<int> m_sources;             ///< nodes whose message buffers were received in the last synchronization
+    std::vector<const uint8_t*> m_buffers;  ///< received message buffers, still in the shared segment
+};
+
+/// @} synchrono_communication
+
+}  // namespace synchrono
+}  // namespace chrono
+
+#endif
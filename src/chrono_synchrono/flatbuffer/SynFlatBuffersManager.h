@@ -53,6 +53,12 @@ class SYN_API SynFlatBuffersManager {
     ///@param messages reference to message list to store the parsed messages
     void ProcessBuffer(std::vector<uint8_t>& data, SynMessageList& messages);
 
+    ///@brief Process a size prefixed SynFlatBuffers::Buffer message in place, without copying it
+    ///
+    ///@param data pointer to the start of the size prefixed buffer
+    ///@param messages reference to message list to store the parsed messages
+    void ProcessBuffer(const uint8_t* data, SynMessageList& messages);
+
     ///@brief Adds a SynMessage to the flatbuffer message buffer. Will call MessageFromState automatically
     ///
     ///@param message the SynMessage to add
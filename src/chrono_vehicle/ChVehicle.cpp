@@ -23,6 +23,7 @@
 
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChTrace.h"
 
 #include "chrono_vehicle/ChWorldFrame.h"
 #include "chrono_vehicle/ChVehicle.h"
@@ -30,6 +31,7 @@
 #include "chrono_vehicle/ChVehicleVisualSystem.h"
 
 #include "chrono_vehicle/output/ChVehicleOutputASCII.h"
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
 #ifdef CHRONO_HAS_HDF5
     #include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
 #endif
@@ -134,6 +136,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
             m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
 #endif
             break;
+        case ChVehicleOutput::BINARY:
+            m_output_db = new ChVehicleOutputBinary(out_dir + "/" + out_name + ".bin");
+            break;
     }
 }
 
@@ -153,6 +158,9 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type, std::ostream& out_stream,
             //// TODO
 #endif
             break;
+        case ChVehicleOutput::BINARY:
+            m_output_db = new ChVehicleOutputBinary(out_stream);
+            break;
     }
 }
 
@@ -175,6 +183,8 @@ void ChVehicle::InitializePowertrain(std::shared_ptr<ChPowertrainAssembly> power
 // -----------------------------------------------------------------------------
 
 void ChVehicle::Advance(double step) {
+    CH_TRACE("VehicleAdvance");
+
     // Ensure the vehicle mass includes the mass of subsystems that may have been initialized after the vehicle
     if (!m_initialized) {
         InitializeInertiaProperties();
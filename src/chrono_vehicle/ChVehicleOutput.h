@@ -46,7 +46,8 @@ class CH_VEHICLE_API ChVehicleOutput {
     enum Type {
         ASCII,  ///< ASCII text
         JSON,   ///< JSON
-        HDF5    ///< HDF-5
+        HDF5,   ///< HDF-5
+        BINARY  ///< columnar binary, written asynchronously
     };
 
     ChVehicleOutput() {}
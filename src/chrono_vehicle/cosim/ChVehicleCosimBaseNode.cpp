@@ -19,6 +19,7 @@
 //
 // =============================================================================
 
+#include <chrono>
 #include <iomanip>
 
 #include "chrono_vehicle/cosim/ChVehicleCosimBaseNode.h"
@@ -83,6 +84,10 @@ ChVehicleCosimBaseNode::ChVehicleCosimBaseNode(const std::string& name)
     : m_name(name),
       m_step_size(1e-4),
       m_cum_sim_time(0),
+      m_lagged_coupling(false),
+      m_nonblocking(true),
+      m_cum_comm_time(0),
+      m_shm_capacity(0),
       m_verbose(true),
       m_renderRT(false),
       m_renderRT_step(0.01),
@@ -100,6 +105,11 @@ ChVehicleCosimBaseNode::ChVehicleCosimBaseNode(const std::string& name)
     MPI_Comm_rank(MPI_COMM_WORLD, &m_rank);
 }
 
+ChVehicleCosimBaseNode::~ChVehicleCosimBaseNode() {
+    // Complete any data exchange still in flight (e.g., the last coupling forces with lagged coupling)
+    WaitPendingRequests();
+}
+
 void ChVehicleCosimBaseNode::Initialize() {
     int size;
     MPI_Comm_size(MPI_COMM_WORLD, &size);
@@ -184,9 +194,45 @@ void ChVehicleCosimBaseNode::Initialize() {
         }
     }
 
+    // Either all or none of the nodes must exchange coupling data through shared memory
+    int shm = m_shm_name.empty() ? 0 : 1;
+    int shm_all = 0;
+    MPI_Allreduce(&shm, &shm_all, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    if (shm_all != 0 && shm_all != size) {
+        if (m_rank == 0)
+            cerr << "Error: shared memory enabled on " << shm_all << " out of " << size << " nodes." << endl;
+        err = true;
+    }
+
     if (err) {
         MPI_Abort(MPI_COMM_WORLD, 1);
     }
+
+    // Attach to the shared memory segment (created by the MBS node).
+    // The key broadcast by the MBS node identifies this run, so that no node attaches to a stale segment with the same
+    // name left over by a previous co-simulation.
+    if (shm) {
+        uint64_t key = 0;
+        if (m_rank == MBS_NODE_RANK)
+            key = (uint64_t)std::chrono::system_clock::now().time_since_epoch().count();
+        MPI_Bcast(&key, 1, MPI_UINT64_T, MBS_NODE_RANK, MPI_COMM_WORLD);
+
+        try {
+            m_shm = chrono_types::make_unique<utils::ChSharedMemoryTransport>(m_shm_name, m_rank, size, m_shm_capacity,
+                                                                              60.0, key);
+        } catch (const std::exception& e) {
+            cerr << "Error on rank " << m_rank << ": " << e.what() << endl;
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+
+        if (m_verbose && m_rank == 0)
+            cout << "Coupling data exchanged through shared memory segment '" << m_shm_name << "'" << endl;
+    }
+}
+
+void ChVehicleCosimBaseNode::EnableSharedMemory(const std::string& name, size_t capacity) {
+    m_shm_name = name;
+    m_shm_capacity = capacity;
 }
 
 void ChVehicleCosimBaseNode::SetOutDir(const std::string& dir_name, const std::string& suffix) {
@@ -543,6 +589,73 @@ void ChVehicleCosimBaseNode::RecvGeometry(ChVehicleGeometry& geom, int source) c
     }
 }
 
+void ChVehicleCosimBaseNode::WaitPendingRequests() {
+    if (m_requests.empty() && m_shm_recvs.empty())
+        return;
+
+    double prev_time = m_timer_comm.GetTimeSeconds();
+    m_timer_comm.start();
+    MPI_Waitall((int)m_requests.size(), m_requests.data(), MPI_STATUSES_IGNORE);
+    for (const auto& recv : m_shm_recvs)
+        m_shm->Recv(recv.source, recv.data, recv.size);
+    m_timer_comm.stop();
+    m_cum_comm_time += m_timer_comm.GetTimeSeconds() - prev_time;
+
+    m_requests.clear();
+    m_shm_recvs.clear();
+}
+
+void ChVehicleCosimBaseNode::SendData(const void* data, int count, MPI_Datatype type, int dest, int tag, bool post) {
+    post = post && m_nonblocking;
+    if (m_shm) {
+        // Messages between two nodes are received in the order they were sent, so no tag is needed
+        int type_size;
+        MPI_Type_size(type, &type_size);
+        m_shm->Send(dest, data, (size_t)count * type_size);
+    } else if (post) {
+        MPI_Request request;
+        MPI_Isend(data, count, type, dest, tag, MPI_COMM_WORLD, &request);
+        m_requests.push_back(request);
+    } else {
+        MPI_Send(data, count, type, dest, tag, MPI_COMM_WORLD);
+    }
+}
+
+void ChVehicleCosimBaseNode::RecvData(void* data, int count, MPI_Datatype type, int source, int tag, bool post) {
+    post = post && m_nonblocking;
+    if (m_shm) {
+        int type_size;
+        MPI_Type_size(type, &type_size);
+        if (post)
+            m_shm_recvs.push_back({data, (size_t)count * type_size, source});
+        else
+            m_shm->Recv(source, data, (size_t)count * type_size);
+    } else if (post) {
+        MPI_Request request;
+        MPI_Irecv(data, count, type, source, tag, MPI_COMM_WORLD, &request);
+        m_requests.push_back(request);
+    } else {
+        MPI_Status status;
+        MPI_Recv(data, count, type, source, tag, MPI_COMM_WORLD, &status);
+    }
+}
+
+int ChVehicleCosimBaseNode::ProbeData(MPI_Datatype type, int source, int tag) {
+    int count;
+    if (m_shm) {
+        int type_size;
+        MPI_Type_size(type, &type_size);
+        size_t size;
+        m_shm->Peek(source, size);
+        count = (int)(size / type_size);
+    } else {
+        MPI_Status status;
+        MPI_Probe(source, tag, MPI_COMM_WORLD, &status);
+        MPI_Get_count(&status, type, &count);
+    }
+    return count;
+}
+
 void ChVehicleCosimBaseNode::ProgressBar(unsigned int x, unsigned int n, unsigned int w) {
     if ((x != n) && (x % (n / 100 + 1) != 0))
         return;
@@ -22,6 +22,7 @@
 #include <fstream>
 #include <string>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <mpi.h>
@@ -29,6 +30,7 @@
 #include "chrono/core/ChTimer.h"
 #include "chrono/core/ChVector3.h"
 #include "chrono/core/ChQuaternion.h"
+#include "chrono/utils/ChSharedMemory.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChVehicleGeometry.h"
@@ -122,7 +124,7 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
         MESH   ///< exchange state and force for a mesh (flexible tire mesh)
     };
 
-    virtual ~ChVehicleCosimBaseNode() {}
+    virtual ~ChVehicleCosimBaseNode();
 
     /// Return the node type.
     virtual NodeType GetNodeType() const = 0;
@@ -173,6 +175,37 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     /// Get the cumulative simulation execution time on this node.
     double GetTotalExecutionTime() const { return m_cum_sim_time; }
 
+    /// Get the time spent waiting for inter-node communication during the current step on this node.
+    double GetStepCommunicationTime() const { return m_timer_comm.GetTimeSeconds(); }
+
+    /// Get the cumulative time spent waiting for inter-node communication on this node.
+    double GetTotalCommunicationTime() const { return m_cum_comm_time; }
+
+    /// Enable/disable one-step lagged coupling (default: false).
+    /// If enabled, an MBS node does not wait for the terrain forces corresponding to the current synchronization
+    /// point. Instead, it applies the forces received at the previous synchronization point and starts advancing its
+    /// state while the current data exchange completes in the background. This overlaps the MBS integration with the
+    /// tire and terrain computation and communication, at the cost of a one-step delay in the coupling forces.
+    /// This setting is ignored by TIRE and TERRAIN nodes.
+    void EnableLaggedCoupling(bool val) { m_lagged_coupling = val; }
+
+    /// Enable/disable non-blocking data exchange during synchronization (default: true).
+    /// If disabled, all coupling messages are exchanged with blocking MPI calls, in the same order. Results are
+    /// identical; the blocking exchange is provided as a reference for testing and debugging. If used, this function
+    /// must be called, with the same value, on all nodes.
+    void EnableNonblockingExchange(bool val) { m_nonblocking = val; }
+
+    /// Enable exchanging the co-simulation coupling data through shared memory (default: disabled).
+    /// If enabled, the per-step data exchanges between the MBS, TIRE, and TERRAIN nodes go through ring buffers in a
+    /// named shared memory segment instead of MPI messages. All ranks must then run on the same machine and this
+    /// function must be called, with the same arguments, on all nodes before Initialize. MPI is still used to launch
+    /// the nodes, during initialization, and for any communication internal to the terrain nodes.
+    /// The segment name must be unique among the co-simulations running concurrently on the machine; a segment left
+    /// over by a co-simulation which did not terminate cleanly is replaced. The capacity
+    /// (in bytes) of the ring buffer between any two nodes must be large enough to hold the data sent during one
+    /// synchronization (e.g., mesh vertex states and contact forces for a flexible tire).
+    void EnableSharedMemory(const std::string& name, size_t capacity = 1 << 22);
+
     /// Initialize this node.
     /// This function allows the node to initialize itself and, optionally, perform an initial data exchange with any
     /// other node. A derived class implementation should first call this base class function.
@@ -242,6 +275,26 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     /// Utility function to receive and unpack a struct with geometry information.
     void RecvGeometry(ChVehicleGeometry& geom, int source) const;
 
+    /// Utility function to complete all pending non-blocking MPI requests of this node.
+    /// The time spent waiting is accumulated in the communication timer.
+    void WaitPendingRequests();
+
+    /// Utility function to send coupling data (of the specified MPI type) to another node during synchronization.
+    /// Uses the shared memory transport if enabled and MPI otherwise. If `post` is true, a non-blocking send is issued
+    /// and completed by WaitPendingRequests (with shared memory, the data is copied before this function returns).
+    /// A blocking send is used if non-blocking exchange is disabled.
+    void SendData(const void* data, int count, MPI_Datatype type, int dest, int tag, bool post = false);
+
+    /// Utility function to receive coupling data (of the specified MPI type) from another node during synchronization.
+    /// Uses the shared memory transport if enabled and MPI otherwise. If `post` is true, a non-blocking receive is
+    /// issued and completed by WaitPendingRequests, after which the data is available. A blocking receive is used if
+    /// non-blocking exchange is disabled.
+    void RecvData(void* data, int count, MPI_Datatype type, int source, int tag, bool post = false);
+
+    /// Utility function to wait for the next coupling message from another node and return its size, as the number
+    /// of elements of the specified MPI type. The message must then be received with RecvData.
+    int ProbeData(MPI_Datatype type, int source, int tag);
+
     /// Utility function to display a progress bar to the terminal.
     /// Displays an ASCII progress bar for the quantity x which must be a value between 0 and n.
     /// The width 'w' represents the number of '=' characters corresponding to 100%.
@@ -283,6 +336,24 @@ class CH_VEHICLE_API ChVehicleCosimBaseNode {
     ChTimer m_timer;        ///< timer for integration cost
     double m_cum_sim_time;  ///< cumulative integration cost
 
+    std::vector<MPI_Request> m_requests;  ///< pending non-blocking MPI requests
+    bool m_lagged_coupling;               ///< if true, use one-step lagged coupling forces (MBS node only)
+    bool m_nonblocking;                   ///< if false, posted sends and receives are completed immediately
+    ChTimer m_timer_comm;                 ///< timer for communication wait time (reset at each synchronization)
+    double m_cum_comm_time;               ///< cumulative communication wait time
+
+    /// Receive posted through the shared memory transport, completed by WaitPendingRequests.
+    struct PendingRecv {
+        void* data;   ///< receive buffer
+        size_t size;  ///< size of the expected message (bytes)
+        int source;   ///< sending node
+    };
+
+    std::string m_shm_name;                                 ///< name of the shared memory segment (empty if disabled)
+    size_t m_shm_capacity;                                  ///< capacity of each shared memory ring buffer
+    std::unique_ptr<utils::ChSharedMemoryTransport> m_shm;  ///< shared memory transport for the coupling data
+    std::vector<PendingRecv> m_shm_recvs;                   ///< pending shared memory receives
+
     bool m_verbose;  ///< verbose messages during simulation?
 
     static const double m_gacc;
@@ -223,6 +223,8 @@ void ChVehicleCosimTerrainNode::InitializeTrackData() {
 // Only the main terrain node participates in the co-simulation data exchange.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
+    m_timer_comm.reset();
+
     switch (m_interface_type) {
         case InterfaceType::BODY:
             if (m_wheeled)
@@ -243,13 +245,18 @@ void ChVehicleCosimTerrainNode::Synchronize(int step_number, double time) {
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double time) {
-    for (int i = 0; i < m_num_objects; i++) {
-        if (m_rank == TERRAIN_NODE_RANK) {
-            // Receive rigid body state data for this tire
-            MPI_Status status;
-            double state_data[13];
-            MPI_Recv(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+    if (m_rank == TERRAIN_NODE_RANK) {
+        // Complete the force messages sent at the previous synchronization (before reusing the send buffer)
+        WaitPendingRequests();
+
+        // Receive rigid body state data from all tire nodes
+        m_state_data.resize(13 * m_num_objects);
+        for (int i = 0; i < m_num_objects; i++)
+            RecvData(&m_state_data[13 * i], 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, true);
+        WaitPendingRequests();
 
+        for (int i = 0; i < m_num_objects; i++) {
+            const double* state_data = &m_state_data[13 * i];
             m_rigid_state[i].pos = ChVector3d(state_data[0], state_data[1], state_data[2]);
             m_rigid_state[i].rot = ChQuaternion<>(state_data[3], state_data[4], state_data[5], state_data[6]);
             m_rigid_state[i].lin_vel = ChVector3d(state_data[7], state_data[8], state_data[9]);
@@ -258,7 +265,9 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
             if (m_verbose)
                 cout << "[Terrain node] Recv: spindle position (" << i << ") = " << m_rigid_state[i].pos << endl;
         }
+    }
 
+    for (int i = 0; i < m_num_objects; i++) {
         // Set position, rotation, and velocities of proxy rigid body
         UpdateRigidProxy(i, m_rigid_state[i]);
 
@@ -268,46 +277,54 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledBody(int step_number, double t
         if (step_number > 0) {
             GetForceRigidProxy(i, m_rigid_contact[i]);
         }
+    }
 
-        if (m_rank == TERRAIN_NODE_RANK) {
-            // Send wheel contact force
-            double force_data[] = {m_rigid_contact[i].force.x(),  m_rigid_contact[i].force.y(),
-                                   m_rigid_contact[i].force.z(),  m_rigid_contact[i].moment.x(),
-                                   m_rigid_contact[i].moment.y(), m_rigid_contact[i].moment.z()};
-            MPI_Send(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+    if (m_rank == TERRAIN_NODE_RANK) {
+        // Send wheel contact forces (completed at the next synchronization)
+        m_force_data.resize(6 * m_num_objects);
+        for (int i = 0; i < m_num_objects; i++) {
+            double* force_data = &m_force_data[6 * i];
+            force_data[0] = m_rigid_contact[i].force.x();
+            force_data[1] = m_rigid_contact[i].force.y();
+            force_data[2] = m_rigid_contact[i].force.z();
+            force_data[3] = m_rigid_contact[i].moment.x();
+            force_data[4] = m_rigid_contact[i].moment.y();
+            force_data[5] = m_rigid_contact[i].moment.z();
+
+            SendData(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, true);
 
             if (m_verbose)
                 cout << "[Terrain node] Send: spindle force (" << i << ") = " << m_rigid_contact[i].force << endl;
         }
-    }
 
-    if (m_rank == TERRAIN_NODE_RANK && m_verbose) {
-        cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
+        if (m_verbose)
+            cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
     }
 }
 
 void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double time) {
-    std::vector<double> all_states(13 * m_num_objects);
-    std::vector<double> all_forces(6 * m_num_objects);
     int start_idx;
 
     // Receive rigid body data for all track shoes
     if (m_rank == TERRAIN_NODE_RANK) {
-        MPI_Status status;
-        MPI_Recv(all_states.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD,
-                 &status);
+        // Complete the force message sent at the previous synchronization (before reusing the send buffer)
+        WaitPendingRequests();
+
+        m_state_data.resize(13 * m_num_objects);
+        RecvData(m_state_data.data(), 13 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, true);
+        WaitPendingRequests();
 
         // Unpack rigid body data
         start_idx = 0;
         for (int i = 0; i < m_num_objects; i++) {
             m_rigid_state[i].pos =
-                ChVector3d(all_states[start_idx + 0], all_states[start_idx + 1], all_states[start_idx + 2]);
-            m_rigid_state[i].rot = ChQuaternion<>(all_states[start_idx + 3], all_states[start_idx + 4],
-                                                  all_states[start_idx + 5], all_states[start_idx + 6]);
+                ChVector3d(m_state_data[start_idx + 0], m_state_data[start_idx + 1], m_state_data[start_idx + 2]);
+            m_rigid_state[i].rot = ChQuaternion<>(m_state_data[start_idx + 3], m_state_data[start_idx + 4],
+                                                  m_state_data[start_idx + 5], m_state_data[start_idx + 6]);
             m_rigid_state[i].lin_vel =
-                ChVector3d(all_states[start_idx + 7], all_states[start_idx + 8], all_states[start_idx + 9]);
+                ChVector3d(m_state_data[start_idx + 7], m_state_data[start_idx + 8], m_state_data[start_idx + 9]);
             m_rigid_state[i].ang_vel =
-                ChVector3d(all_states[start_idx + 10], all_states[start_idx + 11], all_states[start_idx + 12]);
+                ChVector3d(m_state_data[start_idx + 10], m_state_data[start_idx + 11], m_state_data[start_idx + 12]);
             start_idx += 13;
         }
     }
@@ -323,21 +340,22 @@ void ChVehicleCosimTerrainNode::SynchronizeTrackedBody(int step_number, double t
         }
     }
 
-    // Send contact forces for all track shoes
+    // Send contact forces for all track shoes (completed at the next synchronization)
     if (m_rank == TERRAIN_NODE_RANK) {
         // Pack contact forces
+        m_force_data.resize(6 * m_num_objects);
         start_idx = 0;
         for (int i = 0; i < m_num_objects; i++) {
-            all_forces[start_idx + 0] = m_rigid_contact[i].force.x();
-            all_forces[start_idx + 1] = m_rigid_contact[i].force.y();
-            all_forces[start_idx + 2] = m_rigid_contact[i].force.z();
-            all_forces[start_idx + 3] = m_rigid_contact[i].moment.x();
-            all_forces[start_idx + 4] = m_rigid_contact[i].moment.y();
-            all_forces[start_idx + 5] = m_rigid_contact[i].moment.z();
+            m_force_data[start_idx + 0] = m_rigid_contact[i].force.x();
+            m_force_data[start_idx + 1] = m_rigid_contact[i].force.y();
+            m_force_data[start_idx + 2] = m_rigid_contact[i].force.z();
+            m_force_data[start_idx + 3] = m_rigid_contact[i].moment.x();
+            m_force_data[start_idx + 4] = m_rigid_contact[i].moment.y();
+            m_force_data[start_idx + 5] = m_rigid_contact[i].moment.z();
             start_idx += 6;
         }
 
-        MPI_Send(all_forces.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+        SendData(m_force_data.data(), 6 * m_num_objects, MPI_DOUBLE, MBS_NODE_RANK, step_number, true);
 
         if (m_verbose)
             cout << "[Terrain node] step number: " << step_number << "  num contacts: " << GetNumContacts() << endl;
@@ -350,9 +368,8 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
             auto nv = m_geometry[i].m_coll_meshes[0].m_trimesh->GetNumVertices();
 
             // Receive mesh state data
-            MPI_Status status;
             double* vert_data = new double[2 * 3 * nv];
-            MPI_Recv(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+            RecvData(vert_data, 2 * 3 * nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number);
 
             for (unsigned int iv = 0; iv < nv; iv++) {
                 unsigned int offset = 3 * iv;
@@ -384,8 +401,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
 
         if (m_rank == TERRAIN_NODE_RANK) {
             // Send vertex indices and forces.
-            MPI_Send(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number,
-                     MPI_COMM_WORLD);
+            SendData(m_mesh_contact[i].vidx.data(), m_mesh_contact[i].nv, MPI_INT, TIRE_NODE_RANK(i), step_number);
 
             double* force_data = new double[3 * m_mesh_contact[i].nv];
             for (int iv = 0; iv < m_mesh_contact[i].nv; iv++) {
@@ -393,7 +409,7 @@ void ChVehicleCosimTerrainNode::SynchronizeWheeledMesh(int step_number, double t
                 force_data[3 * iv + 1] = m_mesh_contact[i].vforce[iv].y();
                 force_data[3 * iv + 2] = m_mesh_contact[i].vforce[iv].z();
             }
-            MPI_Send(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+            SendData(force_data, 3 * m_mesh_contact[i].nv, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number);
             delete[] force_data;
 
             if (m_verbose)
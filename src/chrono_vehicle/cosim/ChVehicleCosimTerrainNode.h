@@ -191,6 +191,9 @@ class CH_VEHICLE_API ChVehicleCosimTerrainNode : public ChVehicleCosimBaseNode {
     /// Print vertex and face connectivity data for the i-th object, as received at synchronization.
     /// Invoked only when using the MESH communication interface.
     void PrintMeshUpdateData(int i);
+
+    std::vector<double> m_state_data;  ///< receive buffer for rigid states (BODY communication interface)
+    std::vector<double> m_force_data;  ///< send buffer for rigid contact forces (BODY communication interface)
 };
 
 /// @} vehicle_cosim
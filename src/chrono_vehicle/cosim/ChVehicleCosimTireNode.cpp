@@ -295,6 +295,8 @@ void ChVehicleCosimTireNode::InitializeSystem() {
 }
 
 void ChVehicleCosimTireNode::Synchronize(int step_number, double time) {
+    m_timer_comm.reset();
+
     switch (GetInterfaceType()) {
         case InterfaceType::BODY:
             SynchronizeBody(step_number, time);
@@ -306,12 +308,15 @@ void ChVehicleCosimTireNode::Synchronize(int step_number, double time) {
 }
 
 void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
-    // Act as a simple counduit between the MBS and TERRAIN nodes
-    MPI_Status status;
+    // Act as a simple counduit between the MBS and TERRAIN nodes.
+    // Outgoing messages are sent with non-blocking calls; the relay buffers are reused only after these messages
+    // (posted at the previous synchronization) are completed.
+    WaitPendingRequests();
 
     // Receive spindle state data from MBS node
-    double state_data[13];
-    MPI_Recv(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    double* state_data = m_state_data;
+    RecvData(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number, true);
+    WaitPendingRequests();
 
     BodyState spindle_state;
     spindle_state.pos = ChVector3d(state_data[0], state_data[1], state_data[2]);
@@ -323,13 +328,14 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     ApplySpindleState(spindle_state);
 
     // Send spindle state data to Terrain node
-    MPI_Send(state_data, 13, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    SendData(state_data, 13, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, true);
     if (m_verbose)
         cout << "[Tire node " << m_index << " ] Send: spindle position = " << spindle_state.pos << endl;
 
     // Receive spindle force from TERRAIN NODE and send to MBS node
-    double force_data[6];
-    MPI_Recv(force_data, 6, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    double* force_data = m_force_data;
+    RecvData(force_data, 6, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, true);
+    WaitPendingRequests();
 
     TerrainForce spindle_force;
     spindle_force.force = ChVector3d(force_data[0], force_data[1], force_data[2]);
@@ -342,15 +348,13 @@ void ChVehicleCosimTireNode::SynchronizeBody(int step_number, double time) {
     ApplySpindleForce(spindle_force);
 
     // Send spindle force to MBS node
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    SendData(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, true);
 }
 
 void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
-    MPI_Status status;
-
     // Receive spindle state data from MBS node
     double state_data[13];
-    MPI_Recv(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    RecvData(state_data, 13, MPI_DOUBLE, MBS_NODE_RANK, step_number);
 
     BodyState spindle_state;
     spindle_state.pos = ChVector3d(state_data[0], state_data[1], state_data[2]);
@@ -376,17 +380,15 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
         vert_data[3 * nvs + 3 * iv + 1] = mesh_state.vvel[iv].y();
         vert_data[3 * nvs + 3 * iv + 2] = mesh_state.vvel[iv].z();
     }
-    MPI_Send(vert_data, 2 * 3 * nvs, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    SendData(vert_data, 2 * 3 * nvs, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number);
 
     // Receive mesh forces from TERRAIN node.
-    // Note that we use MPI_Probe to figure out the number of indices and forces received.
-    int nvc = 0;
-    MPI_Probe(TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Get_count(&status, MPI_INT, &nvc);
+    // Note that we probe the incoming message to figure out the number of indices and forces received.
+    int nvc = ProbeData(MPI_INT, TERRAIN_NODE_RANK, step_number);
     int* index_data = new int[nvc];
     double* mesh_contact_data = new double[3 * nvc];
-    MPI_Recv(index_data, nvc, MPI_INT, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-    MPI_Recv(mesh_contact_data, 3 * nvc, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
+    RecvData(index_data, nvc, MPI_INT, TERRAIN_NODE_RANK, step_number);
+    RecvData(mesh_contact_data, 3 * nvc, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number);
 
     MeshContact mesh_contact;
     mesh_contact.nv = nvc;
@@ -411,7 +413,7 @@ void ChVehicleCosimTireNode::SynchronizeMesh(int step_number, double time) {
     LoadSpindleForce(spindle_force);
     double force_data[] = {spindle_force.force.x(),  spindle_force.force.y(),  spindle_force.force.z(),
                            spindle_force.moment.x(), spindle_force.moment.y(), spindle_force.moment.z()};
-    MPI_Send(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number, MPI_COMM_WORLD);
+    SendData(force_data, 6, MPI_DOUBLE, MBS_NODE_RANK, step_number);
 
     delete[] vert_data;
     delete[] index_data;
@@ -181,6 +181,9 @@ class CH_VEHICLE_API ChVehicleCosimTireNode : public ChVehicleCosimBaseNode {
     void InitializeSystem();
     void SynchronizeBody(int step_number, double time);
     void SynchronizeMesh(int step_number, double time);
+
+    double m_state_data[13];  ///< relay buffer for spindle state (BODY communication interface)
+    double m_force_data[6];   ///< relay buffer for spindle force (BODY communication interface)
 };
 
 /// @} vehicle_cosim
@@ -236,52 +236,70 @@ void ChVehicleCosimTrackedMBSNode::InitializeSystem() {
 // -----------------------------------------------------------------------------
 // Synchronization of the MBS node:
 // - extract and send track shoe states
-// - receive and apply vertex contact forces
+// - receive and apply track shoe contact forces
+// All data is exchanged in single buffers with non-blocking calls (unless disabled). With lagged coupling, the forces
+// received for the previous synchronization point are applied and the current exchange is completed at the next
+// synchronization.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimTrackedMBSNode::Synchronize(int step_number, double time) {
+    m_timer_comm.reset();
+
     unsigned int num_shoes = (unsigned int)GetNumTrackShoes();
-    std::vector<double> all_states(13 * num_shoes);
-    std::vector<double> all_forces(6 * num_shoes);
-    unsigned int start_idx;
+    m_state_data.resize(13 * num_shoes);
+    m_force_data.resize(6 * num_shoes, 0.0);
+
+    if (m_lagged_coupling) {
+        // Complete the exchange started at the previous synchronization and apply the track shoe forces
+        WaitPendingRequests();
+        ApplyTrackShoeForces();
+        SendTrackShoeStates(step_number);
+    } else {
+        SendTrackShoeStates(step_number);
+        WaitPendingRequests();
+        ApplyTrackShoeForces();
+    }
+}
 
+void ChVehicleCosimTrackedMBSNode::SendTrackShoeStates(int step_number) {
     // Pack states of all track shoe bodies
-    start_idx = 0;
+    unsigned int start_idx = 0;
     for (unsigned int i = 0; i < GetNumTracks(); i++) {
         for (unsigned int j = 0; j < GetNumTrackShoes(i); j++) {
             BodyState state = GetTrackShoeState(i, j);
-            all_states[start_idx + 0] = state.pos.x();
-            all_states[start_idx + 1] = state.pos.y();
-            all_states[start_idx + 2] = state.pos.z();
-            all_states[start_idx + 3] = state.rot.e0();
-            all_states[start_idx + 4] = state.rot.e1();
-            all_states[start_idx + 5] = state.rot.e2();
-            all_states[start_idx + 6] = state.rot.e3();
-            all_states[start_idx + 7] = state.lin_vel.x();
-            all_states[start_idx + 8] = state.lin_vel.y();
-            all_states[start_idx + 9] = state.lin_vel.z();
-            all_states[start_idx + 10] = state.ang_vel.x();
-            all_states[start_idx + 11] = state.ang_vel.y();
-            all_states[start_idx + 12] = state.ang_vel.z();
+            m_state_data[start_idx + 0] = state.pos.x();
+            m_state_data[start_idx + 1] = state.pos.y();
+            m_state_data[start_idx + 2] = state.pos.z();
+            m_state_data[start_idx + 3] = state.rot.e0();
+            m_state_data[start_idx + 4] = state.rot.e1();
+            m_state_data[start_idx + 5] = state.rot.e2();
+            m_state_data[start_idx + 6] = state.rot.e3();
+            m_state_data[start_idx + 7] = state.lin_vel.x();
+            m_state_data[start_idx + 8] = state.lin_vel.y();
+            m_state_data[start_idx + 9] = state.lin_vel.z();
+            m_state_data[start_idx + 10] = state.ang_vel.x();
+            m_state_data[start_idx + 11] = state.ang_vel.y();
+            m_state_data[start_idx + 12] = state.ang_vel.z();
             start_idx += 13;
         }
     }
 
-    // Send track shoe states to the terrain node
-    MPI_Send(all_states.data(), 13 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD);
+    // Send track shoe states to the terrain node and post receive for the track shoe forces
+    SendData(m_state_data.data(), (int)m_state_data.size(), MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, true);
+    RecvData(m_force_data.data(), (int)m_force_data.size(), MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, true);
+}
 
-    // Receive track shoe forces as applied to the center of the track shoe body.
+void ChVehicleCosimTrackedMBSNode::ApplyTrackShoeForces() {
+    // Track shoe forces are applied to the center of the track shoe body.
     // Note that we assume this is the resultant wrench at the track shoe origin (expressed in absolute frame).
-    MPI_Status status;
-    MPI_Recv(all_forces.data(), 6 * num_shoes, MPI_DOUBLE, TERRAIN_NODE_RANK, step_number, MPI_COMM_WORLD, &status);
-
-    // Apply track shoe forces on each individual track shoe body
-    start_idx = 0;
+    unsigned int start_idx = 0;
     for (unsigned int i = 0; i < GetNumTracks(); i++) {
         for (unsigned int j = 0; j < GetNumTrackShoes(i); j++) {
             TerrainForce force;
             force.point = GetTrackShoeBody(i, j)->GetPos();
-            force.force = ChVector3d(all_forces[start_idx + 0], all_forces[start_idx + 1], all_forces[start_idx + 2]);
-            force.moment = ChVector3d(all_forces[start_idx + 3], all_forces[start_idx + 4], all_forces[start_idx + 5]);
+            force.force =
+                ChVector3d(m_force_data[start_idx + 0], m_force_data[start_idx + 1], m_force_data[start_idx + 2]);
+            force.moment =
+                ChVector3d(m_force_data[start_idx + 3], m_force_data[start_idx + 4], m_force_data[start_idx + 5]);
             ApplyTrackShoeForce(i, j, force);
             start_idx += 6;
         }
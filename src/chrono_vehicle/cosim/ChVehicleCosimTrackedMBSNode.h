@@ -156,7 +156,16 @@ class CH_VEHICLE_API ChVehicleCosimTrackedMBSNode : public ChVehicleCosimBaseNod
     virtual ChSystem* GetSystemPostprocess() const override { return m_system; }
     void InitializeSystem();
 
+    /// Pack and send (non-blocking) the track shoe states and post a receive for the track shoe forces.
+    void SendTrackShoeStates(int step_number);
+
+    /// Apply the track shoe forces from the receive buffer.
+    void ApplyTrackShoeForces();
+
     bool m_fix_chassis;
+
+    std::vector<double> m_state_data;  ///< send buffer for track shoe states
+    std::vector<double> m_force_data;  ///< receive buffer for track shoe forces
 };
 
 /// @} vehicle_cosim
@@ -259,31 +259,66 @@ void ChVehicleCosimWheeledMBSNode::InitializeSystem() {
 
 // -----------------------------------------------------------------------------
 // Synchronization of the MBS node:
-// - extract and send tire mesh vertex states
-// - receive and apply vertex contact forces
+// - extract and send spindle states
+// - receive and apply spindle forces
+// All messages are exchanged with non-blocking calls (unless disabled). With lagged coupling, the spindle forces
+// received for the previous synchronization point are applied and the current exchange is completed at the next
+// synchronization.
 // -----------------------------------------------------------------------------
 void ChVehicleCosimWheeledMBSNode::Synchronize(int step_number, double time) {
-    MPI_Status status;
+    m_timer_comm.reset();
+
+    m_state_data.resize(13 * m_num_tire_nodes);
+    m_force_data.resize(6 * m_num_tire_nodes, 0.0);
+
+    if (m_lagged_coupling) {
+        // Complete the exchange started at the previous synchronization and apply the spindle forces
+        WaitPendingRequests();
+        ApplySpindleForces();
+        SendSpindleStates(step_number);
+    } else {
+        SendSpindleStates(step_number);
+        WaitPendingRequests();
+        ApplySpindleForces();
+    }
+}
 
+void ChVehicleCosimWheeledMBSNode::SendSpindleStates(int step_number) {
     for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
-        // Send wheel state to the tire node
+        // Pack wheel state and send to the tire node
         BodyState state = GetSpindleState(i);
-        double state_data[] = {
-            state.pos.x(),     state.pos.y(),     state.pos.z(),                      //
-            state.rot.e0(),    state.rot.e1(),    state.rot.e2(),    state.rot.e3(),  //
-            state.lin_vel.x(), state.lin_vel.y(), state.lin_vel.z(),                  //
-            state.ang_vel.x(), state.ang_vel.y(), state.ang_vel.z()                   //
-        };
-
-        MPI_Send(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD);
+        double* state_data = &m_state_data[13 * i];
+        state_data[0] = state.pos.x();
+        state_data[1] = state.pos.y();
+        state_data[2] = state.pos.z();
+        state_data[3] = state.rot.e0();
+        state_data[4] = state.rot.e1();
+        state_data[5] = state.rot.e2();
+        state_data[6] = state.rot.e3();
+        state_data[7] = state.lin_vel.x();
+        state_data[8] = state.lin_vel.y();
+        state_data[9] = state.lin_vel.z();
+        state_data[10] = state.ang_vel.x();
+        state_data[11] = state.ang_vel.y();
+        state_data[12] = state.ang_vel.z();
+
+        SendData(state_data, 13, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, true);
 
         if (m_verbose)
             cout << "[MBS node    ] Send: spindle position (" << i << ") = " << state.pos << endl;
+    }
+
+    // Post receives for the spindle forces (only after all states were sent, as the terrain node needs the states of
+    // all tires before returning any force)
+    for (unsigned int i = 0; i < m_num_tire_nodes; i++)
+        RecvData(&m_force_data[6 * i], 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, true);
+}
 
-        // Receive spindle force as applied to the center of the spindle/wheel.
-        // Note that we assume this is the resultant wrench at the wheel origin (expressed in absolute frame).
-        double force_data[6];
-        MPI_Recv(force_data, 6, MPI_DOUBLE, TIRE_NODE_RANK(i), step_number, MPI_COMM_WORLD, &status);
+void ChVehicleCosimWheeledMBSNode::ApplySpindleForces() {
+    // Spindle forces are applied to the center of the spindle/wheel.
+    // Note that we assume this is the resultant wrench at the wheel origin (expressed in absolute frame).
+    for (unsigned int i = 0; i < m_num_tire_nodes; i++) {
+        const double* force_data = &m_force_data[6 * i];
 
         TerrainForce spindle_force;
         spindle_force.point = GetSpindleBody(i)->GetPos();
@@ -169,7 +169,16 @@ class CH_VEHICLE_API ChVehicleCosimWheeledMBSNode : public ChVehicleCosimBaseNod
     virtual ChSystem* GetSystemPostprocess() const override { return m_system; }
     void InitializeSystem();
 
+    /// Pack and send (non-blocking) the spindle states and post receives for the spindle forces.
+    void SendSpindleStates(int step_number);
+
+    /// Apply the spindle forces from the receive buffer.
+    void ApplySpindleForces();
+
     bool m_fix_chassis;
+
+    std::vector<double> m_state_data;  ///< send buffer for spindle states
+    std::vector<double> m_force_data;  ///< receive buffer for spindle forces
 };
 
 /// @} vehicle_cosim
@@ -0,0 +1,455 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Binary vehicle output database.
+// Frame data is collected in a preallocated buffer on the simulation thread and
+// written, in a columnar binary format, by a background thread.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+
+namespace chrono {
+namespace vehicle {
+
+// Record types
+static const uint32_t kSchemaRecord = 1;
+static const uint32_t kFrameRecord = 2;
+
+// Column names of fixed-size tables
+static const std::vector<std::string> kBodyColumns = {
+    "pos_x",    "pos_y",    "pos_z",    "rot_e0",   "rot_e1",   "rot_e2",   "rot_e3",
+    "vel_x",    "vel_y",    "vel_z",    "angvel_x", "angvel_y", "angvel_z", "acc_x",
+    "acc_y",    "acc_z",    "angacc_x", "angacc_y", "angacc_z"};
+static const std::vector<std::string> kAuxRefColumns = {"ref_pos_x", "ref_pos_y", "ref_pos_z",
+                                                        "ref_vel_x", "ref_vel_y", "ref_vel_z",
+                                                        "ref_acc_x", "ref_acc_y", "ref_acc_z"};
+static const std::vector<std::string> kMarkerColumns = {"pos_x", "pos_y", "pos_z", "vel_x", "vel_y",
+                                                        "vel_z", "acc_x", "acc_y", "acc_z"};
+static const std::vector<std::string> kShaftColumns = {"pos", "vel", "acc", "torque"};
+static const std::vector<std::string> kJointColumns = {"force_x",  "force_y",  "force_z",
+                                                       "torque_x", "torque_y", "torque_z"};
+static const std::vector<std::string> kCoupleColumns = {"rel_pos", "rel_vel", "rel_acc", "reaction1", "reaction2"};
+static const std::vector<std::string> kLinSpringColumns = {"p1_x", "p1_y", "p1_z",     "p2_x", "p2_y",
+                                                           "p2_z", "length", "velocity", "force"};
+static const std::vector<std::string> kRotSpringColumns = {"angle", "velocity", "torque"};
+static const std::vector<std::string> kBodyLoadColumns = {"force_x",  "force_y",  "force_z",
+                                                          "torque_x", "torque_y", "torque_z"};
+
+// -----------------------------------------------------------------------------
+
+ChVehicleOutputBinary::ChVehicleOutputBinary(const std::string& filename)
+    : m_file_stream(filename, std::ios::binary), m_stream(m_file_stream) {
+    if (!m_file_stream.is_open())
+        throw std::runtime_error("Cannot open output file " + filename);
+    Start();
+}
+
+ChVehicleOutputBinary::ChVehicleOutputBinary(std::ostream& stream) : m_file_stream(), m_stream(stream) {
+    Start();
+}
+
+ChVehicleOutputBinary::~ChVehicleOutputBinary() {
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_writer.join();
+
+    m_stream.flush();
+    if (m_file_stream.is_open())
+        m_file_stream.close();
+}
+
+void ChVehicleOutputBinary::Start() {
+    m_table = 0;
+    m_current = nullptr;
+    m_submitted = nullptr;
+    m_pending = nullptr;
+    m_num_written = 0;
+    m_stop = false;
+
+    m_stream.write("CHVOBIN1", 8);
+
+    m_writer = std::thread(&ChVehicleOutputBinary::Process, this);
+}
+
+void ChVehicleOutputBinary::Flush() {
+    if (m_current)
+        Submit();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_pending == nullptr; });
+}
+
+int ChVehicleOutputBinary::GetNumFramesWritten() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_written;
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBinary::WriteTime(int frame, double time) {
+    if (m_current)
+        Submit();
+
+    // The writer may still be busy with the last submitted frame, but the other buffer is free (Submit waits for the
+    // frame before). Its values vector keeps the capacity of earlier frames, so a fixed layout causes no allocations.
+    m_current = (m_submitted == &m_frames[0]) ? &m_frames[1] : &m_frames[0];
+    m_current->frame = frame;
+    m_current->time = time;
+    m_current->schema.reset();
+    m_current->values.clear();
+
+    m_table = 0;
+    m_section.clear();
+}
+
+void ChVehicleOutputBinary::WriteSection(const std::string& name) {
+    m_section = name;
+}
+
+template <typename T>
+double* ChVehicleOutputBinary::AddTable(TableKind kind,
+                                        const std::vector<std::shared_ptr<T>>& elements,
+                                        unsigned int num_columns) {
+    if (!m_current)
+        throw std::runtime_error("ChVehicleOutputBinary: WriteTime must be called before writing data");
+
+    auto num_elements = (unsigned int)elements.size();
+
+    // Check the table against the layout of the previous frame (only until the first mismatch)
+    if (!m_new_schema) {
+        bool match = m_schema && m_table < m_schema->tables.size();
+        if (match) {
+            const auto& table = m_schema->tables[m_table];
+            match = table.kind == kind && table.num_elements == num_elements && table.num_columns == num_columns &&
+                    table.section == m_section;
+        }
+        if (!match) {
+            // Start a new schema, reusing the descriptions of the tables that matched so far
+            m_new_schema = std::make_shared<Schema>();
+            if (m_schema)
+                m_new_schema->tables.assign(m_schema->tables.begin(), m_schema->tables.begin() + m_table);
+        }
+    }
+
+    if (m_new_schema) {
+        Table table;
+        table.section = m_section;
+        table.kind = kind;
+        table.num_elements = num_elements;
+        table.num_columns = num_columns;
+        for (const auto& element : elements) {
+            table.ids.push_back(element->GetIdentifier());
+            table.names.push_back(element->GetName());
+        }
+        m_new_schema->tables.push_back(std::move(table));
+    }
+
+    m_table++;
+
+    auto& values = m_current->values;
+    size_t offset = values.size();
+    values.resize(offset + (size_t)num_elements * num_columns);
+    return values.data() + offset;
+}
+
+void ChVehicleOutputBinary::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    size_t n = bodies.size();
+    double* v = AddTable(BODIES, bodies, (unsigned int)kBodyColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& body = bodies[i];
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        const auto& vel = body->GetPosDt();
+        const auto& acc = body->GetPosDt2();
+        auto angvel = body->GetAngVelParent();
+        auto angacc = body->GetAngAccParent();
+        double row[] = {pos.x(),    pos.y(),    pos.z(),    rot.e0(),   rot.e1(),   rot.e2(),   rot.e3(),
+                        vel.x(),    vel.y(),    vel.z(),    angvel.x(), angvel.y(), angvel.z(), acc.x(),
+                        acc.y(),    acc.z(),    angacc.x(), angacc.y(), angacc.z()};
+        for (size_t c = 0; c < kBodyColumns.size(); c++)
+            v[c * n + i] = row[c];
+    }
+}
+
+void ChVehicleOutputBinary::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    size_t n = bodies.size();
+    size_t nb = kBodyColumns.size();
+    double* v = AddTable(AUXREF_BODIES, bodies, (unsigned int)(nb + kAuxRefColumns.size()));
+    for (size_t i = 0; i < n; i++) {
+        const auto& body = bodies[i];
+        const auto& pos = body->GetPos();
+        const auto& rot = body->GetRot();
+        const auto& vel = body->GetPosDt();
+        const auto& acc = body->GetPosDt2();
+        auto angvel = body->GetAngVelParent();
+        auto angacc = body->GetAngAccParent();
+        const auto& ref_pos = body->GetFrameRefToAbs().GetPos();
+        const auto& ref_vel = body->GetFrameRefToAbs().GetPosDt();
+        const auto& ref_acc = body->GetFrameRefToAbs().GetPosDt2();
+        double row[] = {pos.x(),     pos.y(),     pos.z(),     rot.e0(),    rot.e1(),    rot.e2(),    rot.e3(),
+                        vel.x(),     vel.y(),     vel.z(),     angvel.x(),  angvel.y(),  angvel.z(),  acc.x(),
+                        acc.y(),     acc.z(),     angacc.x(),  angacc.y(),  angacc.z(),  ref_pos.x(), ref_pos.y(),
+                        ref_pos.z(), ref_vel.x(), ref_vel.y(), ref_vel.z(), ref_acc.x(), ref_acc.y(), ref_acc.z()};
+        for (size_t c = 0; c < nb + kAuxRefColumns.size(); c++)
+            v[c * n + i] = row[c];
+    }
+}
+
+void ChVehicleOutputBinary::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    size_t n = markers.size();
+    double* v = AddTable(MARKERS, markers, (unsigned int)kMarkerColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& marker = markers[i];
+        const auto& pos = marker->GetAbsCoordsys().pos;
+        const auto& vel = marker->GetAbsCoordsysDt().pos;
+        const auto& acc = marker->GetAbsCoordsysDt2().pos;
+        double row[] = {pos.x(), pos.y(), pos.z(), vel.x(), vel.y(), vel.z(), acc.x(), acc.y(), acc.z()};
+        for (size_t c = 0; c < kMarkerColumns.size(); c++)
+            v[c * n + i] = row[c];
+    }
+}
+
+void ChVehicleOutputBinary::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    size_t n = shafts.size();
+    double* v = AddTable(SHAFTS, shafts, (unsigned int)kShaftColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& shaft = shafts[i];
+        v[0 * n + i] = shaft->GetPos();
+        v[1 * n + i] = shaft->GetPosDt();
+        v[2 * n + i] = shaft->GetPosDt2();
+        v[3 * n + i] = shaft->GetAppliedLoad();
+    }
+}
+
+void ChVehicleOutputBinary::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    size_t n = joints.size();
+    size_t nr = kJointColumns.size();
+
+    // One violation column for each constraint of the most constrained joint
+    unsigned int num_violations = 0;
+    for (const auto& joint : joints)
+        num_violations = std::max(num_violations, joint->GetNumConstraints());
+
+    double* v = AddTable(JOINTS, joints, (unsigned int)nr + num_violations);
+    for (size_t i = 0; i < n; i++) {
+        const auto& joint = joints[i];
+        auto reaction = joint->GetReaction2();
+        v[0 * n + i] = reaction.force.x();
+        v[1 * n + i] = reaction.force.y();
+        v[2 * n + i] = reaction.force.z();
+        v[3 * n + i] = reaction.torque.x();
+        v[4 * n + i] = reaction.torque.y();
+        v[5 * n + i] = reaction.torque.z();
+
+        auto C = joint->GetConstraintViolation();
+        auto nc = std::min((unsigned int)C.size(), num_violations);
+        for (unsigned int k = 0; k < nc; k++)
+            v[(nr + k) * n + i] = C(k);
+        for (unsigned int k = nc; k < num_violations; k++)
+            v[(nr + k) * n + i] = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+void ChVehicleOutputBinary::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    size_t n = couples.size();
+    double* v = AddTable(COUPLES, couples, (unsigned int)kCoupleColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& couple = couples[i];
+        v[0 * n + i] = couple->GetRelativePos();
+        v[1 * n + i] = couple->GetRelativePosDt();
+        v[2 * n + i] = couple->GetRelativePosDt2();
+        v[3 * n + i] = couple->GetReaction1();
+        v[4 * n + i] = couple->GetReaction2();
+    }
+}
+
+void ChVehicleOutputBinary::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) {
+    size_t n = springs.size();
+    double* v = AddTable(LIN_SPRINGS, springs, (unsigned int)kLinSpringColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& spring = springs[i];
+        auto p1 = spring->GetPoint1Abs();
+        auto p2 = spring->GetPoint2Abs();
+        double row[] = {p1.x(), p1.y(), p1.z(),
+                        p2.x(), p2.y(), p2.z(),
+                        spring->GetLength(), spring->GetVelocity(), spring->GetForce()};
+        for (size_t c = 0; c < kLinSpringColumns.size(); c++)
+            v[c * n + i] = row[c];
+    }
+}
+
+void ChVehicleOutputBinary::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) {
+    size_t n = springs.size();
+    double* v = AddTable(ROT_SPRINGS, springs, (unsigned int)kRotSpringColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& spring = springs[i];
+        v[0 * n + i] = spring->GetAngle();
+        v[1 * n + i] = spring->GetVelocity();
+        v[2 * n + i] = spring->GetTorque();
+    }
+}
+
+void ChVehicleOutputBinary::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    size_t n = loads.size();
+    double* v = AddTable(BODY_LOADS, loads, (unsigned int)kBodyLoadColumns.size());
+    for (size_t i = 0; i < n; i++) {
+        const auto& load = loads[i];
+        auto force = load->GetForce();
+        auto torque = load->GetTorque();
+        v[0 * n + i] = force.x();
+        v[1 * n + i] = force.y();
+        v[2 * n + i] = force.z();
+        v[3 * n + i] = torque.x();
+        v[4 * n + i] = torque.y();
+        v[5 * n + i] = torque.z();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBinary::Submit() {
+    // A frame with fewer tables than the previous one also changes the layout
+    if (!m_new_schema && (!m_schema || m_table != m_schema->tables.size())) {
+        m_new_schema = std::make_shared<Schema>();
+        if (m_schema)
+            m_new_schema->tables.assign(m_schema->tables.begin(), m_schema->tables.begin() + m_table);
+    }
+    if (m_new_schema) {
+        m_current->schema = m_new_schema;
+        m_schema = m_new_schema;
+        m_new_schema.reset();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv.wait(lock, [this]() { return m_pending == nullptr; });
+        m_pending = m_current;
+    }
+    m_cv.notify_all();
+
+    m_submitted = m_current;
+    m_current = nullptr;
+}
+
+void ChVehicleOutputBinary::Process() {
+    while (true) {
+        Frame* frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() { return m_pending != nullptr || m_stop; });
+            if (!m_pending)
+                return;
+            frame = m_pending;
+        }
+
+        // The simulation thread does not touch the pending frame until it is released below
+        if (frame->schema)
+            WriteSchema(*frame->schema);
+        WriteFrame(*frame);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending = nullptr;
+            m_num_written++;
+        }
+        m_cv.notify_all();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+namespace {
+
+template <typename T>
+void WriteValue(std::ostream& stream, T value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+void WriteString(std::ostream& stream, const std::string& str) {
+    WriteValue<uint32_t>(stream, (uint32_t)str.size());
+    stream.write(str.data(), str.size());
+}
+
+const std::vector<std::string>& GetColumns(ChVehicleOutputBinary::TableKind kind) {
+    switch (kind) {
+        case ChVehicleOutputBinary::BODIES:
+            return kBodyColumns;
+        case ChVehicleOutputBinary::MARKERS:
+            return kMarkerColumns;
+        case ChVehicleOutputBinary::SHAFTS:
+            return kShaftColumns;
+        case ChVehicleOutputBinary::JOINTS:
+            return kJointColumns;
+        case ChVehicleOutputBinary::COUPLES:
+            return kCoupleColumns;
+        case ChVehicleOutputBinary::LIN_SPRINGS:
+            return kLinSpringColumns;
+        case ChVehicleOutputBinary::ROT_SPRINGS:
+            return kRotSpringColumns;
+        case ChVehicleOutputBinary::BODY_LOADS:
+        default:
+            return kBodyLoadColumns;
+    }
+}
+
+}  // end anonymous namespace
+
+void ChVehicleOutputBinary::WriteSchema(const Schema& schema) {
+    WriteValue<uint32_t>(m_stream, kSchemaRecord);
+    WriteValue<uint32_t>(m_stream, (uint32_t)schema.tables.size());
+    for (const auto& table : schema.tables) {
+        WriteString(m_stream, table.section);
+        WriteValue<uint32_t>(m_stream, (uint32_t)table.kind);
+        WriteValue<uint32_t>(m_stream, table.num_elements);
+        WriteValue<uint32_t>(m_stream, table.num_columns);
+
+        // Column names (auxref bodies extend the body columns, joints extend theirs with constraint violations)
+        std::vector<std::string> columns;
+        if (table.kind == AUXREF_BODIES) {
+            columns = kBodyColumns;
+            columns.insert(columns.end(), kAuxRefColumns.begin(), kAuxRefColumns.end());
+        } else {
+            columns = GetColumns(table.kind);
+        }
+        for (unsigned int k = (unsigned int)columns.size(); k < table.num_columns; k++)
+            columns.push_back("violation_" + std::to_string(k - kJointColumns.size()));
+        for (const auto& column : columns)
+            WriteString(m_stream, column);
+
+        for (unsigned int i = 0; i < table.num_elements; i++) {
+            WriteValue<int32_t>(m_stream, table.ids[i]);
+            WriteString(m_stream, table.names[i]);
+        }
+    }
+}
+
+void ChVehicleOutputBinary::WriteFrame(const Frame& frame) {
+    WriteValue<uint32_t>(m_stream, kFrameRecord);
+    WriteValue<int32_t>(m_stream, frame.frame);
+    WriteValue<double>(m_stream, frame.time);
+    WriteValue<uint64_t>(m_stream, (uint64_t)frame.values.size());
+    m_stream.write(reinterpret_cast<const char*>(frame.values.data()), frame.values.size() * sizeof(double));
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
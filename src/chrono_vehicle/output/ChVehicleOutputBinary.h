@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Binary vehicle output database.
+// Frame data is collected in a preallocated buffer on the simulation thread and
+// written, in a columnar binary format, by a background thread.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BINARY_H
+#define CH_VEHICLE_OUTPUT_BINARY_H
+
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Binary vehicle output database.
+///
+/// The Write functions only copy the current values into a preallocated frame buffer; the buffer of a complete frame
+/// is handed over to a background thread which writes it to the output stream while the simulation continues with
+/// the next frame (double buffering). If the writer falls behind, the simulation thread waits for it at the next
+/// frame. A frame is complete when the next frame starts (WriteTime) or when the database is destroyed.
+///
+/// File layout (little-endian on all supported platforms, strings stored as a uint32 length followed by the
+/// characters):
+/// - header: the 8 characters "CHVOBIN1";
+/// - a sequence of records, each starting with a uint32 record type:
+///   - schema record (type 1), written before the first frame and again only if the layout of the output changes:
+///     uint32 number of tables, then for each table: section name, uint32 table kind (see TableKind), uint32 number
+///     of elements, uint32 number of columns, the column names, and the int32 identifier and name of each element;
+///   - frame record (type 2): int32 frame number, double time, uint64 number of values, then the values (double) of
+///     all tables in schema order. The values of a table are stored column by column (all elements for the first
+///     column, then all elements for the second column, etc.).
+///
+/// Joint tables have one column for each component of the reaction force and torque, plus as many constraint
+/// violation columns as the largest number of constraints of a joint in the table; unused entries are set to NaN.
+class CH_VEHICLE_API ChVehicleOutputBinary : public ChVehicleOutput {
+  public:
+    /// Kind of the elements of an output table.
+    enum TableKind {
+        BODIES = 0,
+        AUXREF_BODIES = 1,
+        MARKERS = 2,
+        SHAFTS = 3,
+        JOINTS = 4,
+        COUPLES = 5,
+        LIN_SPRINGS = 6,
+        ROT_SPRINGS = 7,
+        BODY_LOADS = 8
+    };
+
+    ChVehicleOutputBinary(const std::string& filename);
+    ChVehicleOutputBinary(std::ostream& stream);
+
+    /// Write the last frame, wait for all pending writes, and stop the writer thread.
+    ~ChVehicleOutputBinary();
+
+    /// Hand over the current frame (if any) to the writer thread and wait until all frames are written.
+    void Flush();
+
+    /// Get the number of frames written to the output stream so far.
+    int GetNumFramesWritten() const;
+
+  private:
+    /// Description of one output table (a group of elements of the same kind, in one section).
+    struct Table {
+        std::string section;
+        TableKind kind;
+        unsigned int num_elements;
+        unsigned int num_columns;
+        std::vector<int> ids;
+        std::vector<std::string> names;
+    };
+
+    /// Output layout (list of tables, in output order).
+    struct Schema {
+        std::vector<Table> tables;
+    };
+
+    /// Data of one output frame.
+    struct Frame {
+        int frame;
+        double time;
+        std::shared_ptr<Schema> schema;  ///< schema to be written before this frame (if not empty)
+        std::vector<double> values;      ///< values of all tables, in schema order
+    };
+
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkTSDA>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRSDA>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    /// Start a new table in the current frame and return a pointer to its (column-major) values.
+    /// If the table does not match the current schema, a new schema is started and the element identifiers and names
+    /// are recorded from the provided objects.
+    template <typename T>
+    double* AddTable(TableKind kind, const std::vector<std::shared_ptr<T>>& elements, unsigned int num_columns);
+
+    /// Hand over the current frame to the writer thread.
+    void Submit();
+
+    /// Start the writer thread and write the file header.
+    void Start();
+
+    /// Writer thread function.
+    void Process();
+
+    void WriteSchema(const Schema& schema);
+    void WriteFrame(const Frame& frame);
+
+    std::ofstream m_file_stream;
+    std::ostream& m_stream;
+
+    std::shared_ptr<Schema> m_schema;      ///< layout of the last submitted frame
+    std::shared_ptr<Schema> m_new_schema;  ///< layout being recorded for the current frame (if changed)
+    size_t m_table;                        ///< index of the next table in the current frame
+    std::string m_section;                 ///< current section name
+
+    Frame m_frames[2];             ///< frame buffers
+    Frame* m_current;              ///< buffer filled by the simulation thread (nullptr outside a frame)
+    Frame* m_submitted;            ///< buffer of the last frame handed over to the writer thread
+    Frame* m_pending;              ///< buffer handed over to the writer thread and not yet written (nullptr if none)
+    int m_num_written;             ///< number of frames written
+    bool m_stop;                   ///< request for the writer thread to exit
+    std::thread m_writer;          ///< background writer thread
+    mutable std::mutex m_mutex;    ///< protects m_pending, m_num_written, and m_stop
+    std::condition_variable m_cv;  ///< signals frame handover and completion
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
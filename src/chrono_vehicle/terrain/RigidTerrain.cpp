@@ -51,6 +51,8 @@ RigidTerrain::RigidTerrain(ChSystem* system)
       m_num_patches(0),
       m_use_friction_functor(false),
       m_contact_callback(nullptr),
+      m_use_grid(false),
+      m_grid_resolution(0.1),
       m_collision_family(14),
       m_initialized(false) {}
 
@@ -62,6 +64,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
       m_num_patches(0),
       m_use_friction_functor(false),
       m_contact_callback(nullptr),
+      m_use_grid(false),
+      m_grid_resolution(0.1),
       m_collision_family(14),
       m_initialized(false) {
     // Open and parse the input file
@@ -179,6 +183,13 @@ void RigidTerrain::InitializePatch(std::shared_ptr<Patch> patch) {
     // Initialize the patch
     patch->Initialize();
 
+    // Rasterize the height/normal grid of a mesh patch (if so requested)
+    if (m_use_grid) {
+        auto mesh_patch = std::dynamic_pointer_cast<MeshPatch>(patch);
+        if (mesh_patch && mesh_patch->m_sweep_radius == 0)
+            mesh_patch->BuildGrid(m_grid_resolution);
+    }
+
     // All patches are added to the same collision family and collision with other models in this family is disabled
     patch->m_body->GetCollisionModel()->SetFamily(m_collision_family);
     patch->m_body->GetCollisionModel()->DisallowCollisionsWith(m_collision_family);
@@ -272,6 +283,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChCo
             ->Length();
 
     patch->m_mesh_name = mesh_name;
+    patch->m_sweep_radius = sweep_sphere_radius;
     patch->m_type = PatchType::MESH;
 
     return patch;
@@ -423,6 +435,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChCo
     // Cache patch parameters
     patch->m_radius = ChVector3d(length, width, (hMax - hMin)).Length() / 2;
     patch->m_mesh_name = mesh_name;
+    patch->m_sweep_radius = sweep_sphere_radius;
     patch->m_type = PatchType::HEIGHT_MAP;
 
     return patch;
@@ -835,6 +848,7 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChCo
     patch->m_body->AddCollisionShape(ct_shape);
 
     patch->m_radius = ChVector3d(length, width, (height_max - height_min)).Length() / 2;
+    patch->m_sweep_radius = sweep_sphere_radius;
     patch->m_type = PatchType::MESH;
 
     return patch;
@@ -1112,7 +1126,276 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector3d& loc, double& height, Ch
     return std::abs(Cl.x()) <= m_hlength && std::abs(Cl.y()) <= m_hwidth;
 }
 
+// -----------------------------------------------------------------------------
+// Height/normal grid for mesh patches.
+// The grid is defined in the horizontal plane of the ISO frame associated with the current world frame. Grid nodes
+// are stored in square tiles, allocated only if they intersect the mesh footprint. A grid cell is marked as smooth
+// (i.e., suitable for interpolation) if all its corner nodes lie on a single mesh surface and are consistent with a
+// common tangent plane, and if all mesh vertices inside the cell lie on the bilinear interpolant of the corner heights
+// (so that mesh features smaller than a grid cell are not smoothed out).
+// -----------------------------------------------------------------------------
+
+struct RigidTerrain::MeshGrid {
+    static constexpr int TileBits = 6;
+    static constexpr int TileSize = 1 << TileBits;
+
+    /// Result of a grid query.
+    enum class Result {
+        HIT,     ///< point found by interpolation in a smooth cell
+        MISS,    ///< location outside the mesh footprint
+        UNKNOWN  ///< inconclusive query (ray casting required)
+    };
+
+    /// Status of a grid node.
+    enum class Status : unsigned char {
+        EMPTY,     ///< no mesh surface at this node
+        VALID,     ///< single mesh surface at this node
+        AMBIGUOUS  ///< multiple mesh surfaces at this node
+    };
+
+    struct Node {
+        double height = 0;              ///< surface height
+        ChVector3d normal;              ///< surface normal
+        Status status = Status::EMPTY;  ///< node status
+        bool smooth = false;            ///< smooth cell with this node as lower-left corner
+    };
+
+    MeshGrid(double resolution, double xmin, double ymin, double xmax, double ymax);
+
+    Node* GetNode(int i, int j, bool allocate);
+    const Node* GetNode(int i, int j) const;
+
+    /// Rasterize the triangle with given vertices (expressed in the ISO frame).
+    void Rasterize(const ChVector3d& a, const ChVector3d& b, const ChVector3d& c);
+
+    /// Identify smooth cells (to be called after all triangles were rasterized).
+    void MarkSmoothCells();
+
+    /// Unmark the smooth cells containing the given mesh vertex (expressed in the ISO frame) if the vertex does not lie
+    /// on the interpolated surface (to be called after MarkSmoothCells).
+    void CheckVertex(const ChVector3d& p);
+
+    /// Find the surface point below the specified location (expressed in the ISO frame).
+    Result Query(const ChVector3d& loc, double& height, ChVector3d& normal) const;
+
+    double m_res;  ///< grid resolution
+    double m_tol;  ///< height tolerance
+    double m_x0;   ///< x coordinate of grid origin
+    double m_y0;   ///< y coordinate of grid origin
+    int m_nx;      ///< number of nodes in x direction
+    int m_ny;      ///< number of nodes in y direction
+    int m_ntx;     ///< number of tiles in x direction
+
+    std::vector<std::unique_ptr<Node[]>> m_tiles;  ///< node tiles (nullptr if not allocated)
+};
+
+RigidTerrain::MeshGrid::MeshGrid(double resolution, double xmin, double ymin, double xmax, double ymax)
+    : m_res(resolution), m_tol(0.05 * resolution), m_x0(xmin), m_y0(ymin) {
+    m_nx = std::max(2, (int)std::ceil((xmax - xmin) / resolution) + 1);
+    m_ny = std::max(2, (int)std::ceil((ymax - ymin) / resolution) + 1);
+    m_ntx = (m_nx + TileSize - 1) >> TileBits;
+    int nty = (m_ny + TileSize - 1) >> TileBits;
+    m_tiles.resize(m_ntx * nty);
+}
+
+RigidTerrain::MeshGrid::Node* RigidTerrain::MeshGrid::GetNode(int i, int j, bool allocate) {
+    auto& tile = m_tiles[(i >> TileBits) + (j >> TileBits) * m_ntx];
+    if (!tile) {
+        if (!allocate)
+            return nullptr;
+        tile.reset(new Node[TileSize * TileSize]);
+    }
+    return &tile[(i & (TileSize - 1)) + (j & (TileSize - 1)) * TileSize];
+}
+
+const RigidTerrain::MeshGrid::Node* RigidTerrain::MeshGrid::GetNode(int i, int j) const {
+    const auto& tile = m_tiles[(i >> TileBits) + (j >> TileBits) * m_ntx];
+    if (!tile)
+        return nullptr;
+    return &tile[(i & (TileSize - 1)) + (j & (TileSize - 1)) * TileSize];
+}
+
+void RigidTerrain::MeshGrid::Rasterize(const ChVector3d& a, const ChVector3d& b, const ChVector3d& c) {
+    // Upward face normal; skip degenerate and vertical triangles
+    ChVector3d n = Vcross(b - a, c - a);
+    double len = n.Length();
+    if (len == 0 || std::abs(n.z()) < 1e-6 * len)
+        return;
+    n /= (n.z() > 0) ? len : -len;
+
+    double det = (b.x() - a.x()) * (c.y() - a.y()) - (c.x() - a.x()) * (b.y() - a.y());
+
+    // Range of grid nodes covered by the triangle bounding box
+    int imin = std::max(0, (int)std::ceil((std::min({a.x(), b.x(), c.x()}) - m_x0) / m_res));
+    int imax = std::min(m_nx - 1, (int)std::floor((std::max({a.x(), b.x(), c.x()}) - m_x0) / m_res));
+    int jmin = std::max(0, (int)std::ceil((std::min({a.y(), b.y(), c.y()}) - m_y0) / m_res));
+    int jmax = std::min(m_ny - 1, (int)std::floor((std::max({a.y(), b.y(), c.y()}) - m_y0) / m_res));
+
+    for (int j = jmin; j <= jmax; j++) {
+        double y = m_y0 + j * m_res;
+        for (int i = imin; i <= imax; i++) {
+            double x = m_x0 + i * m_res;
+
+            // Barycentric coordinates of the grid node
+            double la = ((b.x() - x) * (c.y() - y) - (c.x() - x) * (b.y() - y)) / det;
+            double lb = ((c.x() - x) * (a.y() - y) - (a.x() - x) * (c.y() - y)) / det;
+            double lc = 1 - la - lb;
+            if (la < -1e-9 || lb < -1e-9 || lc < -1e-9)
+                continue;
+
+            double h = la * a.z() + lb * b.z() + lc * c.z();
+            Node* node = GetNode(i, j, true);
+            switch (node->status) {
+                case Status::EMPTY:
+                    node->height = h;
+                    node->normal = n;
+                    node->status = Status::VALID;
+                    break;
+                case Status::VALID:
+                    if (std::abs(h - node->height) > m_tol)
+                        node->status = Status::AMBIGUOUS;
+                    break;
+                case Status::AMBIGUOUS:
+                    break;
+            }
+        }
+    }
+}
+
+void RigidTerrain::MeshGrid::MarkSmoothCells() {
+    // Maximum angle between normals at the corners of a smooth cell (5 degrees)
+    const double cos_tol = std::cos(5 * CH_DEG_TO_RAD);
+
+    for (int j = 0; j < m_ny - 1; j++) {
+        for (int i = 0; i < m_nx - 1; i++) {
+            Node* n00 = GetNode(i, j, false);
+            if (!n00)
+                continue;
+            const Node* corners[3] = {GetNode(i + 1, j), GetNode(i, j + 1), GetNode(i + 1, j + 1)};
+            const double dx[3] = {m_res, 0, m_res};
+            const double dy[3] = {0, m_res, m_res};
+
+            bool smooth = n00->status == Status::VALID;
+            for (int k = 0; k < 3 && smooth; k++) {
+                const Node* nk = corners[k];
+                if (!nk || nk->status != Status::VALID || Vdot(nk->normal, n00->normal) < cos_tol) {
+                    smooth = false;
+                    break;
+                }
+                // height predicted by the tangent plane at the lower-left corner
+                double h = n00->height - (n00->normal.x() * dx[k] + n00->normal.y() * dy[k]) / n00->normal.z();
+                smooth = std::abs(nk->height - h) <= m_tol;
+            }
+            n00->smooth = smooth;
+        }
+    }
+}
+
+void RigidTerrain::MeshGrid::CheckVertex(const ChVector3d& p) {
+    double u = (p.x() - m_x0) / m_res;
+    double v = (p.y() - m_y0) / m_res;
+
+    // A vertex on a grid line belongs to all adjacent cells
+    int imin = std::max(0, (int)std::ceil(u) - 1);
+    int imax = std::min(m_nx - 2, (int)std::floor(u));
+    int jmin = std::max(0, (int)std::ceil(v) - 1);
+    int jmax = std::min(m_ny - 2, (int)std::floor(v));
+
+    for (int j = jmin; j <= jmax; j++) {
+        for (int i = imin; i <= imax; i++) {
+            Node* n00 = GetNode(i, j, false);
+            if (!n00 || !n00->smooth)
+                continue;
+            const Node* n10 = GetNode(i + 1, j);
+            const Node* n01 = GetNode(i, j + 1);
+            const Node* n11 = GetNode(i + 1, j + 1);
+
+            // Bilinear interpolation of the corner heights
+            double fu = u - i;
+            double fv = v - j;
+            double height = (1 - fu) * (1 - fv) * n00->height + fu * (1 - fv) * n10->height +
+                            (1 - fu) * fv * n01->height + fu * fv * n11->height;
+            if (std::abs(p.z() - height) > m_tol)
+                n00->smooth = false;
+        }
+    }
+}
+
+RigidTerrain::MeshGrid::Result RigidTerrain::MeshGrid::Query(const ChVector3d& loc,
+                                                             double& height,
+                                                             ChVector3d& normal) const {
+    double u = (loc.x() - m_x0) / m_res;
+    double v = (loc.y() - m_y0) / m_res;
+    if (u < 0 || v < 0 || u > m_nx - 1 || v > m_ny - 1)
+        return Result::MISS;
+
+    int i = std::min((int)u, m_nx - 2);
+    int j = std::min((int)v, m_ny - 2);
+    const Node* n00 = GetNode(i, j);
+    if (!n00 || !n00->smooth)
+        return Result::UNKNOWN;
+    const Node* n10 = GetNode(i + 1, j);
+    const Node* n01 = GetNode(i, j + 1);
+    const Node* n11 = GetNode(i + 1, j + 1);
+
+    // Bilinear interpolation of height and normal
+    double fu = u - i;
+    double fv = v - j;
+    double w00 = (1 - fu) * (1 - fv);
+    double w10 = fu * (1 - fv);
+    double w01 = (1 - fu) * fv;
+    double w11 = fu * fv;
+    height = w00 * n00->height + w10 * n10->height + w01 * n01->height + w11 * n11->height;
+
+    // The ray cast from a location below the surface would not intersect it
+    if (loc.z() < height - m_tol)
+        return Result::UNKNOWN;
+
+    normal = w00 * n00->normal + w10 * n10->normal + w01 * n01->normal + w11 * n11->normal;
+    normal.Normalize();
+
+    return Result::HIT;
+}
+
+void RigidTerrain::MeshPatch::BuildGrid(double resolution) {
+    // Mesh vertices expressed in the ISO frame
+    const auto& vertices = m_trimesh->GetCoordsVertices();
+    std::vector<ChVector3d> vertices_iso(vertices.size());
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < vertices.size(); i++) {
+        vertices_iso[i] = ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(vertices[i]));
+        xmin = std::min(xmin, vertices_iso[i].x());
+        ymin = std::min(ymin, vertices_iso[i].y());
+        xmax = std::max(xmax, vertices_iso[i].x());
+        ymax = std::max(ymax, vertices_iso[i].y());
+    }
+    if (vertices.empty())
+        return;
+
+    m_grid = chrono_types::make_shared<MeshGrid>(resolution, xmin, ymin, xmax, ymax);
+    for (const auto& face : m_trimesh->GetIndicesVertexes())
+        m_grid->Rasterize(vertices_iso[face[0]], vertices_iso[face[1]], vertices_iso[face[2]]);
+    m_grid->MarkSmoothCells();
+    for (const auto& v : vertices_iso)
+        m_grid->CheckVertex(v);
+}
+
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const {
+    // Use the height/normal grid (if available) and fall back to ray casting if the grid query is inconclusive
+    if (m_grid) {
+        ChVector3d normal_iso;
+        auto result = m_grid->Query(ChWorldFrame::ToISO(loc), height, normal_iso);
+        if (result == MeshGrid::Result::HIT) {
+            normal = ChWorldFrame::FromISO(normal_iso);
+            return true;
+        }
+        if (result == MeshGrid::Result::MISS)
+            return false;
+    }
+
     ChVector3d from = loc;
     ChVector3d to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
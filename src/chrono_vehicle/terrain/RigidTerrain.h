@@ -184,6 +184,19 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// default, this option is disabled.  This function must be called before Initialize.
     void UseLocationDependentFriction(bool val) { m_use_friction_functor = val; }
 
+    /// Enable use of a precomputed height/normal grid for mesh patches (default: false).
+    /// If enabled, a grid with the specified resolution is rasterized from the triangular mesh of each mesh patch
+    /// (including patches created from a height-map or a point cloud) when the patch is initialized. Terrain queries
+    /// (GetHeight, GetNormal, GetCoefficientFriction, GetProperties) are then answered by interpolation within smooth
+    /// grid cells, with a fallback to exact ray casting near discontinuities (creases, steps, overlapping surfaces,
+    /// mesh boundaries) and for query points below the cached surface. No grid is built for mesh patches with a
+    /// non-zero sweep sphere radius: queries on such patches always use ray casting, since the grid only represents
+    /// the mesh surface itself. This function must be called before Initialize.
+    void UseMeshPatchGrid(bool val, double resolution = 0.1) {
+        m_use_grid = val;
+        m_grid_resolution = resolution;
+    }
+
     /// Get the terrain height below the specified location.
     /// This function should return the height of the closest point *below* the specified location (in the direction of
     /// the current world vertical). If a user-provided functor object of type ChTerrain::HeightFunctor is provided,
@@ -245,13 +258,19 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
     };
 
+    /// Rasterized height/normal grid for a mesh patch.
+    struct MeshGrid;
+
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
         std::shared_ptr<ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                             ///< name of associated mesh
+        double m_sweep_radius;                               ///< radius of sweep sphere of the contact mesh
+        std::shared_ptr<MeshGrid> m_grid;                    ///< height/normal grid (if enabled)
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector3d& loc, double& height, ChVector3d& normal) const override;
+        void BuildGrid(double resolution);
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
         virtual void ExportMeshWavefront(const std::string& out_dir) override;
     };
@@ -261,6 +280,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
+    bool m_use_grid;
+    double m_grid_resolution;
 
     void AddPatch(std::shared_ptr<Patch> patch,
                   const ChCoordsys<>& position,
@@ -22,6 +22,7 @@
 #include <queue>
 #include <unordered_set>
 #include <limits>
+#include <stdexcept>
 
 #ifdef _OPENMP
     #include <omp.h>
@@ -33,6 +34,7 @@
 #include "chrono/assets/ChTexture.h"
 #include "chrono/assets/ChVisualShapeBox.h"
 #include "chrono/utils/ChConvexHull.h"
+#include "chrono/utils/ChTrace.h"
 #include "chrono/utils/ChUtils.h"
 
 #include "chrono_vehicle/ChVehicleModelData.h"
@@ -140,6 +142,11 @@ void SCMTerrain::SetCosimulationMode(bool val) {
     m_loader->m_cosim_mode = val;
 }
 
+// Set the storage type for modified grid nodes.
+void SCMTerrain::SetNodeStorage(NodeStorage type) {
+    m_loader->m_grid.SetType(type);
+}
+
 // Set properties of the SCM soil model.
 void SCMTerrain::SetSoilParameters(
     double Bekker_Kphi,    // Kphi, frictional modulus in Bekker model
@@ -293,6 +300,11 @@ int SCMTerrain::GetNumErosionNodes() const {
     return m_loader->m_num_erosion_nodes;
 }
 
+// Return the total number of modified grid nodes.
+size_t SCMTerrain::GetNumModifiedNodes() const {
+    return m_loader->m_grid.GetNumNodes();
+}
+
 // Timer information
 double SCMTerrain::GetTimerMovingPatches() const {
     return 1e3 * m_loader->m_timer_moving_patches();
@@ -339,6 +351,8 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+    os << "   Number modified nodes:   " << m_loader->m_modified_nodes.size() << " (step)  "
+       << m_loader->m_grid.GetNumNodes() << " (total)" << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -354,6 +368,143 @@ SCMContactableData::SCMContactableData(double area_ratio,
       Mohr_mu(std::tan(Mohr_friction * CH_DEG_TO_RAD)),
       Janosi_shear(Janosi_shear) {}
 
+// -----------------------------------------------------------------------------
+// Storage for modified grid nodes
+// -----------------------------------------------------------------------------
+
+void SCMLoader::NodeGrid::SetType(SCMTerrain::NodeStorage type) {
+    if (type == m_type)
+        return;
+
+    // Extract existing node records
+    std::vector<std::pair<ChVector2i, NodeRecord>> records;
+    records.reserve(m_num_nodes);
+    ForEach([&records](const ChVector2i& ij, const NodeRecord& nr) { records.push_back(std::make_pair(ij, nr)); });
+
+    // Release current storage
+    m_map.clear();
+    m_outside.clear();
+    m_tiles.clear();
+    for (auto& tile : m_directory)
+        tile.reset();
+    m_num_nodes = 0;
+
+    // Switch storage type and transfer node records
+    m_type = type;
+    for (const auto& r : records)
+        Insert(r.first, r.second);
+}
+
+void SCMLoader::NodeGrid::SetBounds(int nx, int ny) {
+    m_nx = nx;
+    m_ny = ny;
+
+    // Collect existing tiles
+    std::vector<std::unique_ptr<Tile>> tiles;
+    for (auto& tile : m_directory) {
+        if (tile)
+            tiles.push_back(std::move(tile));
+    }
+    for (auto& tile : m_outside)
+        tiles.push_back(std::move(tile.second));
+    m_outside.clear();
+
+    // Resize tile directory to cover the grid range [-nx,nx] x [-ny,ny]
+    m_tile_min = TileCoords(ChVector2i(-nx, -ny));
+    ChVector2i tile_max = TileCoords(ChVector2i(nx, ny));
+    m_dir_nx = tile_max.x() - m_tile_min.x() + 1;
+    m_dir_ny = tile_max.y() - m_tile_min.y() + 1;
+    m_directory.clear();
+    m_directory.resize(m_dir_nx * m_dir_ny);
+
+    // Reassign existing tiles (tile addresses, and therefore the list of tiles, are unchanged)
+    for (auto& tile : tiles) {
+        ChVector2i tij = TileCoords(tile->origin);
+        GetTileSlot(tij) = std::move(tile);
+    }
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::GetTile(const ChVector2i& tij) const {
+    int ti = tij.x() - m_tile_min.x();
+    int tj = tij.y() - m_tile_min.y();
+    if (ti >= 0 && ti < m_dir_nx && tj >= 0 && tj < m_dir_ny)
+        return m_directory[ti + m_dir_nx * tj].get();
+
+    auto it = m_outside.find(tij);
+    return it == m_outside.end() ? nullptr : it->second.get();
+}
+
+std::unique_ptr<SCMLoader::NodeGrid::Tile>& SCMLoader::NodeGrid::GetTileSlot(const ChVector2i& tij) {
+    int ti = tij.x() - m_tile_min.x();
+    int tj = tij.y() - m_tile_min.y();
+    if (ti >= 0 && ti < m_dir_nx && tj >= 0 && tj < m_dir_ny)
+        return m_directory[ti + m_dir_nx * tj];
+
+    return m_outside[tij];
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::Find(const ChVector2i& ij) {
+    if (m_type == SCMTerrain::NodeStorage::HASH_MAP) {
+        auto it = m_map.find(ij);
+        return it == m_map.end() ? nullptr : &it->second;
+    }
+
+    Tile* tile = GetTile(TileCoords(ij));
+    if (!tile)
+        return nullptr;
+    int k = TileIndex(ij);
+    return tile->used[k] ? &tile->records[k] : nullptr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::At(const ChVector2i& ij) {
+    auto nr = Find(ij);
+    if (!nr)
+        throw std::out_of_range("SCMLoader::NodeGrid::At -- grid node not recorded");
+    return *nr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::Insert(const ChVector2i& ij, const NodeRecord& nr) {
+    if (m_type == SCMTerrain::NodeStorage::HASH_MAP) {
+        auto res = m_map.insert(std::make_pair(ij, nr));
+        if (res.second)
+            m_num_nodes++;
+        return res.first->second;
+    }
+
+    ChVector2i tij = TileCoords(ij);
+    auto& tile = GetTileSlot(tij);
+    if (!tile) {
+        tile = chrono_types::make_unique<Tile>();
+        tile->origin = ChVector2i(tij.x() * TILE_SIZE, tij.y() * TILE_SIZE);
+        m_tiles.push_back(tile.get());
+    }
+
+    int k = TileIndex(ij);
+    if (!tile->used[k]) {
+        tile->records[k] = nr;
+        tile->used.set(k);
+        m_num_nodes++;
+    }
+    return tile->records[k];
+}
+
+void SCMLoader::NodeGrid::ForEach(const std::function<void(const ChVector2i&, const NodeRecord&)>& f) const {
+    if (m_type == SCMTerrain::NodeStorage::HASH_MAP) {
+        for (const auto& r : m_map)
+            f(r.first, r.second);
+        return;
+    }
+
+    for (const auto tile : m_tiles) {
+        if (tile->used.none())
+            continue;
+        for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+            if (tile->used[k])
+                f(tile->origin + ChVector2i(k & TILE_MASK, k >> TILE_BITS), tile->records[k]);
+        }
+    }
+}
+
 // -----------------------------------------------------------------------------
 // Implementation of SCMLoader
 // -----------------------------------------------------------------------------
@@ -703,6 +854,9 @@ void SCMLoader::SetupInitial() {
         pinfo.m_body = nullptr;
         m_patches.push_back(pinfo);
     }
+
+    // Set the grid range covered by the dense directory of node tiles
+    m_grid.SetBounds(m_nx, m_ny);
 }
 
 bool SCMLoader::CheckMeshBounds(const ChVector2i& loc) const {
@@ -720,16 +874,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector3d& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2i ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.Find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -813,10 +966,9 @@ ChVector3d SCMLoader::GetInitNormal(const ChVector2i& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2i& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.Find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -1037,6 +1189,8 @@ static const std::vector<ChVector2i> neighbors4{
 
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
+    CH_TRACE("SCMInternalForces");
+
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
     std::vector<int> modified_vertices = m_external_modified_vertices;
     m_external_modified_vertices.clear();
@@ -1044,7 +1198,8 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid.At(ij);
+        nr.modified = false;
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1101,13 +1256,15 @@ void SCMLoader::ComputeInternalForces() {
 
     // Information of vertices with ray-cast hits
     struct HitRecord {
+        ChVector2i ij;               // grid node coordinates
         ChContactable* contactable;  // pointer to hit object
         ChVector3d abs_point;        // hit point, expressed in global frame
         int patch_id;                // index of associated patch id
     };
 
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2i, HitRecord, CoordHash> hits;
+    // List of vertices with ray-cast hits.
+    // The index of a hit in this list is cached in the corresponding node record (NodeRecord::hit_index).
+    std::vector<HitRecord> hits;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
@@ -1152,14 +1309,16 @@ void SCMLoader::ComputeInternalForces() {
     #pragma omp critical(SCM_ray_casting)
                 {
                     // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
+                    auto& nr = m_grid.Insert(ij, NodeRecord(z, z, GetInitNormal(ij)));
+
+                    // Add to our list of hits to process
+                    if (nr.hit_index == -1) {
+                        nr.hit_index = (int)hits.size();
+                        HitRecord record = {ij, mrayhit_result.hitModel->GetContactable(),
+                                            mrayhit_result.abs_hitPoint, -1};
+                        hits.push_back(record);
+                        m_num_ray_hits++;
                     }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
                 }
             }
         }
@@ -1171,7 +1330,7 @@ void SCMLoader::ComputeInternalForces() {
     // Map-reduce approach (to eliminate critical section)
 
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2i, HitRecord, CoordHash>> t_hits(nthreads);
+    std::vector<std::vector<HitRecord>> t_hits(nthreads);
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
@@ -1179,35 +1338,39 @@ void SCMLoader::ComputeInternalForces() {
 
         // Loop through all vertices in the patch range
         int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
-            ChVector2i ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z = GetHeight(ij);
-
-            ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
-
-            // Create ray at current grid location
-            ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector3d from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
+    #pragma omp parallel num_threads(nthreads) reduction(+ : num_ray_casts)
+        {
+            CH_TRACE("SCMRayCasting");
+    #pragma omp for nowait
+            for (int k = 0; k < p.m_range.size(); k++) {
+                int t_num = ChOMP::GetThreadNum();
+                ChVector2i ij = p.m_range[k];
+
+                // Move from (i, j) to (x, y, z) representation in the world frame
+                double x = ij.x() * m_delta;
+                double y = ij.y() * m_delta;
+                double z = GetHeight(ij);
+
+                ChVector3d vertex_abs = m_plane.TransformPointLocalToParent(ChVector3d(x, y, z));
+
+                // Create ray at current grid location
+                ChCollisionSystem::ChRayhitResult mrayhit_result;
+                ChVector3d to = vertex_abs + m_Z * m_test_offset_up;
+                ChVector3d from = to - m_Z * m_test_offset_down;
+
+                // Ray-OBB test (quick rejection)
+                if (m_moving_patch && !RayOBBtest(p, from, m_Z))
+                    continue;
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+                // Cast ray into collision system
+                GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
+                num_ray_casts++;
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                if (mrayhit_result.hit) {
+                    // Add to our list of hits to process
+                    HitRecord record = {ij, mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                    t_hits[t_num].push_back(record);
+                }
             }
         }
 
@@ -1219,14 +1382,18 @@ void SCMLoader::ComputeInternalForces() {
         for (int t_num = 0; t_num < nthreads; t_num++) {
             for (auto& h : t_hits[t_num]) {
                 // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
+                auto nr = m_grid.Find(h.ij);
+                if (!nr) {
+                    double z = GetInitHeight(h.ij);
+                    nr = &m_grid.Insert(h.ij, NodeRecord(z, z, GetInitNormal(h.ij)));
                 }
-                ////hits.insert(h);
+                // Keep only the first hit at this node (a node can be in the range of several moving patches)
+                if (nr->hit_index != -1)
+                    continue;
+                nr->hit_index = (int)hits.size();
+                hits.push_back(h);
             }
 
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
             t_hits[t_num].clear();
         }
         m_num_ray_hits = (int)hits.size();
@@ -1256,13 +1423,13 @@ void SCMLoader::ComputeInternalForces() {
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
     for (auto& h : hits) {
-        if (h.second.patch_id != -1)
+        if (h.patch_id != -1)
             continue;
 
-        ChVector2i ij = h.first;
+        ChVector2i ij = h.ij;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        h.patch_id = m_num_contact_patches++;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2d(m_delta * ij.x(), m_delta * ij.y()));
@@ -1272,24 +1439,24 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
+            ChVector2i crt_ij = todo.front();  // Current hit node is first element in queue
+            todo.pop();                        // Remove first element from queue
 
-            ChVector2i crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            int crt_patch = h.patch_id;
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2i nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr_nr = m_grid.Find(nbr_ij);
+                if (!nbr_nr || nbr_nr->hit_index == -1)
                     continue;
+                auto& nbr = hits[nbr_nr->hit_index];
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                if (nbr.patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr.patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2d(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1300,6 +1467,10 @@ void SCMLoader::ComputeInternalForces() {
         contact_patches.push_back(patch);
     }
 
+    // Reset the cached hit indices
+    for (const auto& h : hits)
+        m_grid.At(h.ij).hit_index = -1;
+
     // Calculate area and perimeter of each contact patch.
     // Calculate approximation to Beker term 1/b.
     for (auto& p : contact_patches) {
@@ -1333,14 +1504,14 @@ void SCMLoader::ComputeInternalForces() {
 
     // Process only hit nodes
     for (auto& h : hits) {
-        ChVector2d ij = h.first;
+        ChVector2i ij = h.ij;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid.At(ij);          // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector3d& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = h.contactable;
+        const ChVector3d& hit_point_abs = h.abs_point;
+        int patch_id = h.patch_id;
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
@@ -1364,7 +1535,7 @@ void SCMLoader::ComputeInternalForces() {
         }
 
         // Mark current node as modified
-        m_modified_nodes.push_back(ij);
+        MarkModified(ij, nr);
 
         // Calculate velocity at touched grid node
         ChVector3d point_local(ij.x() * m_delta, ij.y() * m_delta, nr.level);
@@ -1526,7 +1697,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                 // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);          //   get node record
+                const auto& nr = m_grid.At(ij);              //   get node record
                 if (nr.sigma <= 0)                           //   if node not touched
                     continue;                                //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;       //   accumulate displaced material
@@ -1534,10 +1705,9 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
-                        p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
+                    auto nbr_nr = m_grid.Find(nbr_ij);               //     neighbor record
+                    if (!nbr_nr || nbr_nr->sigma <= 0)               //     if neighbor not recorded or not touched
+                        p_boundary.insert(nbr_ij);                   //       set neighbor as boundary
                 }
             }
             tot_step_flow *= GetSystem()->GetStep();
@@ -1546,17 +1716,16 @@ void SCMLoader::ComputeInternalForces() {
             double diff = m_flow_factor * tot_step_flow / p_boundary.size();
 
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
-            for (const auto& ij : p_boundary) {                                  // for each node in bndry
-                m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
-                    double z = GetInitHeight(ij);                                //     undeformed height
-                    const ChVector3d& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
-                    m_modified_nodes.push_back(ij);                              //     mark as modified
-                }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
-                nr.erosion = true;                                               //   add to erosion domain
-                AddMaterialToNode(diff, nr);                                     //   add raise amount
+            for (const auto& ij : p_boundary) {                    // for each node in bndry
+                auto nr = m_grid.Find(ij);                         //   node record
+                if (!nr) {                                         //   if not yet recorded
+                    double z = GetInitHeight(ij);                  //     undeformed height
+                    const ChVector3d& n = GetInitNormal(ij);       //     terrain normal
+                    nr = &m_grid.Insert(ij, NodeRecord(z, z, n));  //     add new node record
+                }                                                  //
+                MarkModified(ij, *nr);                             //   mark as modified
+                nr->erosion = true;                                //   add to erosion domain
+                AddMaterialToNode(diff, *nr);                      //   add raise amount
             }
 
             // Accumulate boundary
@@ -1578,20 +1747,20 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2i nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
-                        double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
-                        const ChVector3d& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
-                        NodeRecord nr(z, z, n);                         //     create new record
-                        nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
-                        front.insert(nbr_ij);                           //     add neighbor to new front
-                        m_modified_nodes.push_back(nbr_ij);             //     mark as modified
-                    } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
-                        if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
-                            nr.erosion = true;                          //       include in erosion domain
-                            front.insert(nbr_ij);                       //       add neighbor to new front
-                            m_modified_nodes.push_back(nbr_ij);         //       mark as modified
+                    auto rec = m_grid.Find(nbr_ij);                             //   neighbor record
+                    if (!rec) {                                                 //   if neighbor not yet recorded
+                        double z = GetInitHeight(nbr_ij);                       //     undeformed height at neighbor
+                        const ChVector3d& n = GetInitNormal(nbr_ij);            //     terrain normal at neighbor
+                        auto& nr = m_grid.Insert(nbr_ij, NodeRecord(z, z, n));  //     add new node record
+                        nr.erosion = true;                                      //     include in erosion domain
+                        front.insert(nbr_ij);                                   //     add neighbor to new front
+                        MarkModified(nbr_ij, nr);                               //     mark as modified
+                    } else {                                                    //   if neighbor previously recorded
+                        NodeRecord& nr = *rec;                                  //     get existing record
+                        if (!nr.erosion && nr.sigma <= 0) {                     //     if neighbor not touched
+                            nr.erosion = true;                                  //       include in erosion domain
+                            front.insert(nbr_ij);                               //       add neighbor to new front
+                            MarkModified(nbr_ij, nr);                           //       mark as modified
                         }
                     }
                 }
@@ -1608,13 +1777,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid.At(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2i nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid.Find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1659,7 +1828,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid.At(ij);           // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1673,6 +1842,13 @@ void SCMLoader::ComputeInternalForces() {
     m_timer_visualization.stop();
 }
 
+void SCMLoader::MarkModified(const ChVector2i& ij, NodeRecord& nr) {
+    if (!nr.modified) {
+        nr.modified = true;
+        m_modified_nodes.push_back(ij);
+    }
+}
+
 void SCMLoader::AddMaterialToNode(double amount, NodeRecord& nr) {
     if (amount > nr.hit_level - nr.level) {                      //   if not possible to assign all mass
         nr.massremainder += amount - (nr.hit_level - nr.level);  //     material to be further propagated
@@ -1782,14 +1958,16 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2i ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        nodes.reserve(m_grid.GetNumNodes());
+        m_grid.ForEach([&nodes](const ChVector2i& ij, const NodeRecord& nr) {  //
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
+        nodes.reserve(m_modified_nodes.size());
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            auto rec = m_grid.Find(ij);
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1800,8 +1978,14 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 //       As such, some plot types may be incorrect at these nodes.
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
-        // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        // Modify existing entry in grid or insert new one
+        SCMLoader::NodeRecord nr(n.second, n.second, GetInitNormal(n.first));
+        if (auto rec = m_grid.Find(n.first)) {
+            nr.modified = rec->modified;
+            *rec = nr;
+        } else {
+            m_grid.Insert(n.first, nr);
+        }
     }
 
     // Update visualization
@@ -1810,7 +1994,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid.At(ij);              // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
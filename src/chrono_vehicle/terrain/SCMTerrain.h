@@ -22,6 +22,9 @@
 
 #include <string>
 #include <ostream>
+#include <array>
+#include <bitset>
+#include <functional>
 #include <unordered_map>
 
 #include "chrono/assets/ChVisualShapeTriangleMesh.h"
@@ -69,6 +72,12 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
         PLOT_MASSREMAINDER
     };
 
+    /// Storage type for the records of modified SCM grid nodes.
+    enum class NodeStorage {
+        HASH_MAP,    ///< hash map keyed by grid node coordinates
+        DENSE_TILES  ///< lazily allocated dense tiles of grid nodes
+    };
+
     /// Information at SCM node.
     struct NodeInfo {
         double sinkage;          ///< sinkage, along local normal direction
@@ -223,6 +232,13 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// GetContactForceNode for rigid bodies and FEA nodes, respectively.
     void SetCosimulationMode(bool val);
 
+    /// Set the storage type for the records of modified grid nodes (default: HASH_MAP).
+    /// With DENSE_TILES, node records are stored in fixed-size square tiles which are allocated the first time one of
+    /// their nodes is modified. Tiles within the terrain patch are accessed through a dense directory, so that node
+    /// lookup does not require hashing. This is more efficient for long simulations with a large number of modified
+    /// nodes (e.g., tracked vehicles), at the cost of allocating memory for all nodes of a tile.
+    void SetNodeStorage(NodeStorage type);
+
     /// Initialize the terrain system (flat).
     /// This version creates a flat array of points.
     void Initialize(double sizeX,  ///< [in] terrain dimension in the X direction
@@ -296,6 +312,8 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     int GetNumContactPatches() const;
     /// Return the number of nodes in the erosion domain at last step (bulldosing effects).
     int GetNumErosionNodes() const;
+    /// Return the total number of modified grid nodes (since the start of the simulation).
+    size_t GetNumModifiedNodes() const;
 
     /// Return time for updating moving patches at last step (ms).
     double GetTimerMovingPatches() const;
@@ -407,6 +425,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         double kshear;             // along local tangent direction
         double tau;                // along local tangent direction
         bool erosion;              // for bulldozing
+        bool modified;             // included in the list of nodes modified during the current step
+        int hit_index;             // index in list of ray hits during current step (-1 if none)
         double massremainder;      // for bulldozing
         double step_plastic_flow;  // for bulldozing
 
@@ -426,6 +446,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               kshear(0),
               tau(0),
               erosion(false),
+              modified(false),
+              hit_index(-1),
               massremainder(0),
               step_plastic_flow(0) {}
     };
@@ -437,6 +459,70 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2i& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Storage for the records of modified grid nodes, either in a hash map or in dense tiles.
+    // Tiles have TILE_SIZE x TILE_SIZE nodes and are allocated on first insertion of one of their nodes. Tiles covering
+    // the grid range [-nx,nx] x [-ny,ny] are indexed directly in a tile directory; any other tiles are kept in a hash
+    // map. Node records are never relocated, so references to records remain valid after insertions.
+    class NodeGrid {
+      public:
+        NodeGrid() : m_type(SCMTerrain::NodeStorage::HASH_MAP), m_nx(0), m_ny(0), m_num_nodes(0) { SetBounds(0, 0); }
+
+        // Set the storage type (existing records are transferred).
+        void SetType(SCMTerrain::NodeStorage type);
+
+        // Set the grid range covered by the tile directory (existing records are preserved).
+        void SetBounds(int nx, int ny);
+
+        // Return a pointer to the record of the specified node (nullptr if the node was not recorded).
+        NodeRecord* Find(const ChVector2i& ij);
+        const NodeRecord* Find(const ChVector2i& ij) const { return const_cast<NodeGrid*>(this)->Find(ij); }
+
+        // Return a reference to the record of the specified node (throws if the node was not recorded).
+        NodeRecord& At(const ChVector2i& ij);
+
+        // Insert a record for the specified node if not already present and return a reference to the node record.
+        NodeRecord& Insert(const ChVector2i& ij, const NodeRecord& nr);
+
+        // Apply the given function to all recorded nodes.
+        void ForEach(const std::function<void(const ChVector2i&, const NodeRecord&)>& f) const;
+
+        size_t GetNumNodes() const { return m_num_nodes; }
+
+      private:
+        static const int TILE_BITS = 4;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+        static const int TILE_MASK = TILE_SIZE - 1;
+
+        struct Tile {
+            ChVector2i origin;                                      // grid coordinates of first node in tile
+            std::array<NodeRecord, TILE_SIZE * TILE_SIZE> records;  // node records (row-major)
+            std::bitset<TILE_SIZE * TILE_SIZE> used;                // flags for recorded nodes
+        };
+
+        // Tile coordinates of a grid node (arithmetic shift, i.e. floor division for negative indices)
+        static ChVector2i TileCoords(const ChVector2i& ij) {
+            return ChVector2i(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+        }
+        static int TileIndex(const ChVector2i& ij) { return (ij.x() & TILE_MASK) + TILE_SIZE * (ij.y() & TILE_MASK); }
+
+        Tile* GetTile(const ChVector2i& tij) const;
+        std::unique_ptr<Tile>& GetTileSlot(const ChVector2i& tij);
+
+        SCMTerrain::NodeStorage m_type;
+        int m_nx;
+        int m_ny;
+        size_t m_num_nodes;
+
+        std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_map;  // hash map storage
+
+        ChVector2i m_tile_min;                                                       // first tile in directory
+        int m_dir_nx;                                                                // directory tiles in X
+        int m_dir_ny;                                                                // directory tiles in Y
+        std::vector<std::unique_ptr<Tile>> m_directory;                              // tiles covering grid range
+        std::unordered_map<ChVector2i, std::unique_ptr<Tile>, CoordHash> m_outside;  // tiles outside grid range
+        std::vector<Tile*> m_tiles;                                                  // all allocated tiles
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -527,6 +613,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Update vertex normal in visualization mesh
     void UpdateMeshVertexNormal(const ChVector2i ij, int iv);
 
+    // Add the specified node to the list of nodes modified during the current step (if not already present).
+    void MarkModified(const ChVector2i& ij, NodeRecord& nr);
+
     /// Get the heights of all modified grid nodes.
     /// If 'all_nodes = true', return modified nodes from the start of simulation.  Otherwise, return only the nodes
     /// modified over the last step.
@@ -546,8 +635,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     ChMatrixDynamic<> m_heights;  ///< (base) grid heights (when initializing from height-field map)
     double m_base_height;         ///< default height for vertices outside the projection of input mesh
 
-    std::unordered_map<ChVector2i, NodeRecord, CoordHash> m_grid_map;  ///< modified grid nodes (persistent)
-    std::vector<ChVector2i> m_modified_nodes;                          ///< modified grid nodes (current)
+    NodeGrid m_grid;                           ///< modified grid nodes (persistent)
+    std::vector<ChVector2i> m_modified_nodes;  ///< modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  ///< set of active moving patches
     bool m_moving_patch;                     ///< user-specified moving patches?
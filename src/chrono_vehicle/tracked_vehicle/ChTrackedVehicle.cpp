@@ -22,6 +22,8 @@
 #include "chrono_vehicle/ChSubsysDefs.h"
 #include "chrono_vehicle/tracked_vehicle/ChTrackedVehicle.h"
 
+#include "chrono/utils/ChTrace.h"
+
 #include "chrono_thirdparty/rapidjson/document.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/stringbuffer.h"
@@ -71,6 +73,8 @@ void ChTrackedVehicle::Initialize(const ChCoordsys<>& chassisPos, double chassis
 // reference frame).
 // -----------------------------------------------------------------------------
 void ChTrackedVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_TRACE("VehicleSynchronize");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
@@ -112,6 +116,8 @@ void ChTrackedVehicle::Synchronize(double time,
                                    const DriverInputs& driver_inputs,
                                    const TerrainForces& shoe_forces_left,
                                    const TerrainForces& shoe_forces_right) {
+    CH_TRACE("VehicleSynchronize");
+
     // Let the driveline combine driver inputs if needed
     double braking_left = 0;
     double braking_right = 0;
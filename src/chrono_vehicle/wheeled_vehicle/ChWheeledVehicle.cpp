@@ -18,6 +18,8 @@
 
 #include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
 
+#include "chrono/utils/ChTrace.h"
+
 #include "chrono_thirdparty/rapidjson/document.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/stringbuffer.h"
@@ -57,6 +59,8 @@ void ChWheeledVehicle::InitializeTire(std::shared_ptr<ChTire> tire,
 // to the terrain system.
 // -----------------------------------------------------------------------------
 void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_inputs) {
+    CH_TRACE("VehicleSynchronize");
+
     double powertrain_torque = m_powertrain_assembly ? m_powertrain_assembly->GetOutputTorque() : 0;
     double driveline_speed = m_driveline ? m_driveline->GetOutputDriveshaftSpeed() : 0;
 
@@ -93,8 +97,10 @@ void ChWheeledVehicle::Synchronize(double time, const DriverInputs& driver_input
     // Synchronize any associated tires
     for (auto& axle : m_axles) {
         for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
+            if (wheel->m_tire) {
+                CH_TRACE("TireSynchronize");
                 wheel->m_tire->Synchronize(time, terrain);
+            }
         }
     }
 
@@ -115,8 +121,10 @@ void ChWheeledVehicle::Advance(double step) {
     // current time.
     for (auto& axle : m_axles) {
         for (auto& wheel : axle->GetWheels()) {
-            if (wheel->m_tire)
+            if (wheel->m_tire) {
+                CH_TRACE("TireAdvance");
                 wheel->m_tire->Advance(step);
+            }
         }
         axle->Advance(step);
     }
@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono::Multicore demo program for distributed-memory (MPI) simulation.
+//
+// Granular material settles in a fixed container. The domain is split along
+// the X axis into one slab per MPI rank. Run with, e.g.:
+//    mpirun -np 4 demo_MCORE_distributed
+//
+// The states of all particles are collected on rank 0 and written to CSV files.
+//
+// The global reference frame has Z up.
+// =============================================================================
+
+#include <cstdio>
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+#include "chrono_multicore/distributed/ChSystemMulticoreDistributed.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+
+// Container half-dimensions
+ChVector3d hdim(2, 0.5, 0.5);
+
+// Particle radius and density
+double radius = 0.02;
+double rho = 2000;
+
+// Number of particle layers
+int num_layers = 8;
+
+// Simulation parameters
+double time_step = 1e-4;
+double time_end = 1;
+double out_fps = 50;
+
+// -----------------------------------------------------------------------------
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+
+    ChSystemMulticoreDistributed sys(MPI_COMM_WORLD);
+    int rank = sys.GetRank();
+
+    if (rank == 0)
+        std::cout << "Copyright (c) 2017 projectchrono.org\nChrono version: " << CHRONO_VERSION << std::endl;
+
+    // Split the domain along X; the ghost layer must accommodate the largest particle
+    sys.GetDomain().SetSplitAxis(0);
+    sys.GetDomain().SetSimDomain(-hdim, hdim);
+    sys.GetDomain().SetGhostLayer(4 * radius);
+    sys.GetDomain().Initialize();
+
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
+    sys.GetSettings()->collision.bins_per_axis = vec3(20, 5, 5);
+    sys.GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
+    sys.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::TangentialDisplacementModel::OneStep;
+    sys.SetNumThreads(1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.4f);
+
+    // Fixed container (replicated on all ranks)
+    auto bin = chrono_types::make_shared<ChBody>();
+    bin->SetFixed(true);
+    bin->EnableCollision(true);
+    utils::AddBoxContainer(bin, mat,                                      //
+                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
+                           hdim * 2, 0.2,                                 //
+                           ChVector3i(2, 2, -1));
+    sys.AddBody(bin);
+
+    // Granular material. Particles must be generated identically on all ranks, so use a grid sampler.
+    double r = 1.01 * radius;
+    utils::ChGridSampler<double> sampler(2 * r);
+    utils::ChGenerator gen(&sys);
+    auto m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->SetDefaultMaterial(mat);
+    m1->SetDefaultDensity(rho);
+    m1->SetDefaultSize(radius);
+
+    ChVector3d range(hdim.x() - r, hdim.y() - r, 0);
+    ChVector3d center(0, 0, 2 * r);
+    for (int il = 0; il < num_layers; il++) {
+        gen.CreateObjectsBox(sampler, center, range);
+        center.z() += 2 * r;
+    }
+
+    unsigned int num_particles = sys.GetNumBodiesDistributed();
+    if (rank == 0)
+        std::cout << "Number of particles: " << num_particles << std::endl;
+
+    // Output directory
+    const std::string out_dir = GetChronoOutputPath() + "DEMO_MCORE_DISTRIBUTED";
+    if (rank == 0) {
+        if (!filesystem::create_directory(filesystem::path(out_dir))) {
+            std::cout << "Error creating directory " << out_dir << std::endl;
+            MPI_Abort(MPI_COMM_WORLD, 1);
+        }
+    }
+
+    // Simulation loop
+    int out_steps = (int)std::ceil((1 / out_fps) / time_step);
+    int out_frame = 0;
+    double exchange_time = 0;
+    std::vector<ChDistributedBodyState> states;
+
+    for (int step = 0; sys.GetChTime() < time_end; step++) {
+        if (step % out_steps == 0) {
+            sys.GatherBodies(states);
+            if (rank == 0) {
+                utils::ChWriterCSV csv(",");
+                for (const auto& s : states)
+                    csv << s.gid << s.pos << s.pos_dt << std::endl;
+                csv.WriteToFile(out_dir + "/data_" + std::to_string(out_frame) + ".csv", "gid,x,y,z,vx,vy,vz\n");
+                std::cout << "t = " << sys.GetChTime() << "  particles: " << states.size() << std::endl;
+            }
+            out_frame++;
+        }
+
+        sys.DoStepDynamics(time_step);
+        exchange_time += sys.GetTimerExchange();
+    }
+
+    std::cout << "Rank " << rank << "  owned: " << sys.GetNumBodiesOwned() << "  ghosts: " << sys.GetNumBodiesGhost()
+              << "  exchange time: " << exchange_time << " s" << std::endl;
+
+    MPI_Finalize();
+    return 0;
+}
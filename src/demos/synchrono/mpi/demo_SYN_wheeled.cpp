@@ -77,6 +77,9 @@ double end_time = 1000;
 // How often SynChrono state messages are interchanged
 double heartbeat = 1e-2;  // 100[Hz]
 
+// Radius around the vehicle from which state messages are received (0: from all nodes)
+double interest_radius = 0;
+
 // Time interval between two render frames
 double render_step_size = 1.0 / 50;  // FPS = 50
 
@@ -174,6 +177,7 @@ int main(int argc, char* argv[]) {
     step_size = cli.GetAsType<double>("step_size");
     end_time = cli.GetAsType<double>("end_time");
     heartbeat = cli.GetAsType<double>("heartbeat");
+    interest_radius = cli.GetAsType<double>("interest_radius");
 
     // Change SynChronoManager settings
     syn_manager.SetHeartbeat(heartbeat);
@@ -219,6 +223,8 @@ int main(int argc, char* argv[]) {
 
     // Add vehicle as an agent and initialize SynChronoManager
     auto agent = chrono_types::make_shared<SynWheeledVehicleAgent>(&vehicle, zombie_filename);
+    if (interest_radius > 0)
+        agent->SetInterestRadius(interest_radius);
     syn_manager.AddAgent(agent);
     syn_manager.Initialize(vehicle.GetSystem());
 
@@ -305,6 +311,9 @@ int main(int argc, char* argv[]) {
     // Properly shuts down other ranks when one rank ends early
     syn_manager.QuitSimulation();
 
+    if (node_id == 0)
+        syn_manager.PrintStepStatistics(std::cout);
+
     return 0;
 }
 
@@ -321,6 +330,8 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<double>("Simulation", "s,step_size", "Step size", std::to_string(step_size));
     cli.AddOption<double>("Simulation", "e,end_time", "End time", std::to_string(end_time));
     cli.AddOption<double>("Simulation", "b,heartbeat", "Heartbeat", std::to_string(heartbeat));
+    cli.AddOption<double>("Simulation", "r,interest_radius", "Radius of interest around the vehicle (0: all nodes)",
+                          std::to_string(interest_radius));
 
     // Irrlicht options
     cli.AddOption<std::vector<int>>("Irrlicht", "i,irr", "Nodes for irrlicht usage", "-1");
@@ -74,6 +74,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& shared_memory,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -128,6 +129,7 @@ int main(int argc, char** argv) {
     double base_vel = 1.0;
     double slip = 0;
     bool use_checkpoint = false;
+    bool shared_memory = false;
     double output_fps = 100;
     double vis_output_fps = 100;
     double render_fps = 0;
@@ -144,8 +146,9 @@ int main(int argc, char** argv) {
     bool verbose = true;
     if (!GetProblemSpecs(argc, argv, rank, terrain_specfile, tire_specfile, nthreads_tire, nthreads_terrain, step_size,
                          fixed_settling_time, KE_threshold, settling_time, sim_time, act_type, base_vel, slip,
-                         total_mass, toe_angle, dbp_filter_window, use_checkpoint, output_fps, vis_output_fps,
-                         render_fps, sim_output, settling_output, vis_output, renderRT, verbose, suffix)) {
+                         total_mass, toe_angle, dbp_filter_window, use_checkpoint, shared_memory, output_fps,
+                         vis_output_fps, render_fps, sim_output, settling_output, vis_output, renderRT, verbose,
+                         suffix)) {
         MPI_Finalize();
         return 1;
     }
@@ -427,6 +430,10 @@ int main(int argc, char** argv) {
 
     }  // if TERRAIN_NODE_RANK
 
+    // Exchange coupling data through shared memory (all ranks must run on the same machine)
+    if (shared_memory)
+        node->EnableSharedMemory("chrono_cosim_wheel_rig" + suffix);
+
     // Initialize systems
     // (perform initial inter-node data exchange)
     node->Initialize();
@@ -493,6 +500,7 @@ bool GetProblemSpecs(int argc,
                      double& toe_angle,
                      double& dbp_filter_window,
                      bool& use_checkpoint,
+                     bool& shared_memory,
                      double& output_fps,
                      double& vis_output_fps,
                      double& render_fps,
@@ -529,6 +537,7 @@ bool GetProblemSpecs(int argc,
                        std::to_string(nthreads_terrain));
 
     cli.AddOption<bool>("Simulation", "use_checkpoint", "Initialize from checkpoint file");
+    cli.AddOption<bool>("Simulation", "shared_memory", "Exchange coupling data through shared memory (single machine)");
 
     cli.AddOption<bool>("Output", "quiet", "Disable verbose messages");
     cli.AddOption<bool>("Output", "no_output", "Disable generation of simulation output files");
@@ -618,6 +627,7 @@ bool GetProblemSpecs(int argc,
     render_fps = cli.GetAsType<double>("render_fps");
 
     use_checkpoint = cli.GetAsType<bool>("use_checkpoint");
+    shared_memory = cli.GetAsType<bool>("shared_memory");
 
     nthreads_tire = cli.GetAsType<int>("threads_tire");
     nthreads_terrain = cli.GetAsType<int>("threads_terrain");
@@ -63,7 +63,11 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFBeamTest {
   public:
-    ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFBeamTest(int num_elements,
+                 SolverType solver_type,
+                 int NumThreads,
+                 bool useContInt,
+                 bool useBatching = false);
 
     ~ANCFBeamTest() { delete m_system; }
 
@@ -85,7 +89,11 @@ class ANCFBeamTest {
     int m_NumThreads;
 };
 
-ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFBeamTest::ANCFBeamTest(int num_elements,
+                           SolverType solver_type,
+                           int NumThreads,
+                           bool useContInt,
+                           bool useBatching) {
     m_SolverType = solver_type;
     m_NumElements = num_elements;
     m_NumThreads = NumThreads;
@@ -185,6 +193,7 @@ ANCFBeamTest::ANCFBeamTest(int num_elements, SolverType solver_type, int NumThre
 
     // Create mesh container
     auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetElementBatching(useBatching);
     m_system->Add(mesh);
 
     // Setup visualization
@@ -457,6 +466,10 @@ int main(int argc, char* argv[]) {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt");
                     }
+                    {
+                        ANCFBeamTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_ContInt_Batched");
+                    }
                     {
                         ANCFBeamTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementBeamANCF_3333_PreInt");
@@ -62,7 +62,11 @@ enum class SolverType { MINRES, SparseLU, SparseQR, PARDISO_MKL, MUMPS };
 
 class ANCFHexaTest {
   public:
-    ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt);
+    ANCFHexaTest(int num_elements,
+                 SolverType solver_type,
+                 int NumThreads,
+                 bool useContInt,
+                 bool useBatching = false);
 
     ~ANCFHexaTest() { delete m_system; }
 
@@ -84,7 +88,11 @@ class ANCFHexaTest {
     int m_NumThreads;
 };
 
-ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThreads, bool useContInt) {
+ANCFHexaTest::ANCFHexaTest(int num_elements,
+                           SolverType solver_type,
+                           int NumThreads,
+                           bool useContInt,
+                           bool useBatching) {
     m_SolverType = solver_type;
     m_NumElements = 2 * num_elements * num_elements;
     m_NumThreads = NumThreads;
@@ -177,6 +185,7 @@ ANCFHexaTest::ANCFHexaTest(int num_elements, SolverType solver_type, int NumThre
 
     // Create mesh container
     auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetElementBatching(useBatching);
     m_system->Add(mesh);
 
     // Setup visualization
@@ -478,6 +487,10 @@ int main(int argc, char* argv[]) {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, true);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContInt");
                     }
+                    {
+                        ANCFHexaTest test(num_els(i), ls, NumThreads, true, true);
+                        test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_ContInt_Batched");
+                    }
                     {
                         ANCFHexaTest test(num_els(i), ls, NumThreads, false);
                         test.RunTimingTest(timing_stats, "ChElementHexaANCF_3843_PreInt");
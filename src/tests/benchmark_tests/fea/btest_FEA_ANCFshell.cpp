@@ -17,6 +17,10 @@
 // Note that the MKL Pardiso and Mumps solvers are set to lock the sparsity
 // pattern, but not to use the sparsity pattern learner.
 //
+// The ANCFshell*_Scaling tests report strong-scaling results (fixed mesh size,
+// increasing number of threads) for the evaluation of element forces, with
+// atomic updates of the global residual or with element coloring.
+//
 // =============================================================================
 
 #include "chrono/ChConfig.h"
@@ -58,7 +62,7 @@ class ANCFshell : public utils::ChBenchmarkTest {
     void SimulateVis();
 
   protected:
-    ANCFshell(SolverType solver_type);
+    ANCFshell(SolverType solver_type, int num_threads = 4, bool element_coloring = false);
 
     ChSystemSMC* m_system;
 };
@@ -87,11 +91,23 @@ class ANCFshell_MUMPS : public ANCFshell<N> {
     ANCFshell_MUMPS() : ANCFshell<N>(SolverType::MUMPS) {}
 };
 
+template <int N, int NT>
+class ANCFshell_Atomic : public ANCFshell<N> {
+  public:
+    ANCFshell_Atomic() : ANCFshell<N>(SolverType::MINRES, NT, false) {}
+};
+
+template <int N, int NT>
+class ANCFshell_Colored : public ANCFshell<N> {
+  public:
+    ANCFshell_Colored() : ANCFshell<N>(SolverType::MINRES, NT, true) {}
+};
+
 template <int N>
-ANCFshell<N>::ANCFshell(SolverType solver_type) {
+ANCFshell<N>::ANCFshell(SolverType solver_type, int num_threads, bool element_coloring) {
     m_system = new ChSystemSMC();
     m_system->SetGravitationalAcceleration(ChVector3d(0, -9.8, 0));
-    m_system->SetNumThreads(4);
+    m_system->SetNumThreads(num_threads);
 
     // Set solver parameters
 #ifndef CHRONO_PARDISO_MKL
@@ -167,6 +183,7 @@ ANCFshell<N>::ANCFshell(SolverType solver_type) {
 
     // Create mesh nodes and elements
     auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetElementColoring(element_coloring);
     m_system->Add(mesh);
 
     auto vis_surf = chrono_types::make_shared<ChVisualShapeFEA>(mesh);
@@ -264,6 +281,26 @@ CH_BM_SIMULATION_LOOP(ANCFshell32_MUMPS, ANCFshell_MUMPS<32>, NUM_SKIP_STEPS, NU
 CH_BM_SIMULATION_LOOP(ANCFshell64_MUMPS, ANCFshell_MUMPS<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 #endif
 
+// Strong scaling of element force evaluation (fixed mesh, increasing number of threads)
+using ANCFshell128_Atomic_1T = ANCFshell_Atomic<128, 1>;
+using ANCFshell128_Atomic_2T = ANCFshell_Atomic<128, 2>;
+using ANCFshell128_Atomic_4T = ANCFshell_Atomic<128, 4>;
+using ANCFshell128_Atomic_8T = ANCFshell_Atomic<128, 8>;
+using ANCFshell128_Colored_1T = ANCFshell_Colored<128, 1>;
+using ANCFshell128_Colored_2T = ANCFshell_Colored<128, 2>;
+using ANCFshell128_Colored_4T = ANCFshell_Colored<128, 4>;
+using ANCFshell128_Colored_8T = ANCFshell_Colored<128, 8>;
+
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Atomic_1, ANCFshell128_Atomic_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Atomic_2, ANCFshell128_Atomic_2T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Atomic_4, ANCFshell128_Atomic_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Atomic_8, ANCFshell128_Atomic_8T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Colored_1, ANCFshell128_Colored_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Colored_2, ANCFshell128_Colored_2T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Colored_4, ANCFshell128_Colored_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(ANCFshell128_Scaling_Colored_8, ANCFshell128_Colored_8T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -15,6 +15,9 @@
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
 // learner".
+// The STEP_* tests compare a direct sparse solver with the matrix-free Krylov
+// solvers (no assembly of the system matrix), using diagonal or block-Jacobi
+// preconditioning, for implicit dynamics steps.
 //
 // =============================================================================
 
@@ -24,6 +27,7 @@
 #include "chrono/core/ChMatrix.h"
 #include "chrono/physics/ChSystemSMC.h"
 #include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
 #include "chrono/fea/ChElementShellANCF_3423.h"
 #include "chrono/fea/ChMesh.h"
 
@@ -100,11 +104,17 @@ class SystemFixture : public ::benchmark::Fixture {
         st.counters["LS_Setup"] = m_system->GetTimerLSsetup() * 1e3 / num_it;
         st.counters["LS_Solve"] = m_system->GetTimerLSsolve() * 1e3 / num_it;
 
-        auto solver = std::static_pointer_cast<ChDirectSolverLS>(m_system->GetSolver());
-        st.counters["LS_Setup_assembly"] = solver->GetTimeSetup_Assembly() * 1e3 / num_it;
-        st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
-        st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
-        st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
+        if (auto solver = std::dynamic_pointer_cast<ChDirectSolverLS>(m_system->GetSolver())) {
+            st.counters["LS_Setup_assembly"] = solver->GetTimeSetup_Assembly() * 1e3 / num_it;
+            st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
+            st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
+            st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
+        }
+
+        if (auto solver = std::dynamic_pointer_cast<ChIterativeSolverLS>(m_system->GetSolver())) {
+            st.counters["LS_iterations"] = solver->GetIterations();
+            st.counters["LS_error"] = solver->GetError();
+        }
     }
 
   protected:
@@ -156,6 +166,38 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+// Implicit dynamics steps with a direct sparse solver (assembled system matrix)
+#define BM_STEP_QR(TEST_NAME, N)                                                      \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<ChSolverSparseQR>();                  \
+        solver->UseSparsityPatternLearner(true);                                      \
+        solver->LockSparsityPattern(true);                                            \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStepDynamics(1e-3);                                           \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
+// Implicit dynamics steps with a matrix-free Krylov solver (no assembly of the system matrix)
+#define BM_STEP_KRYLOV(TEST_NAME, N, SOLVER_TYPE, BLOCK_PRECOND)                      \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<SOLVER_TYPE>();                       \
+        solver->SetMaxIterations(1000);                                               \
+        solver->SetTolerance(1e-10);                                                  \
+        solver->EnableDiagonalPreconditioner(true);                                   \
+        solver->EnableBlockJacobiPreconditioner(BLOCK_PRECOND);                       \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        while (st.KeepRunning()) {                                                    \
+            m_system->DoStepDynamics(1e-3);                                           \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -193,6 +235,27 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_STEP_QR(STEP_QR_500, 500)
+BM_STEP_KRYLOV(STEP_MINRES_diag_500, 500, ChSolverMINRES, false)
+BM_STEP_KRYLOV(STEP_MINRES_block_500, 500, ChSolverMINRES, true)
+BM_STEP_KRYLOV(STEP_GMRES_block_500, 500, ChSolverGMRES, true)
+BM_STEP_QR(STEP_QR_1000, 1000)
+BM_STEP_KRYLOV(STEP_MINRES_diag_1000, 1000, ChSolverMINRES, false)
+BM_STEP_KRYLOV(STEP_MINRES_block_1000, 1000, ChSolverMINRES, true)
+BM_STEP_KRYLOV(STEP_GMRES_block_1000, 1000, ChSolverGMRES, true)
+BM_STEP_QR(STEP_QR_2000, 2000)
+BM_STEP_KRYLOV(STEP_MINRES_diag_2000, 2000, ChSolverMINRES, false)
+BM_STEP_KRYLOV(STEP_MINRES_block_2000, 2000, ChSolverMINRES, true)
+BM_STEP_KRYLOV(STEP_GMRES_block_2000, 2000, ChSolverGMRES, true)
+BM_STEP_QR(STEP_QR_4000, 4000)
+BM_STEP_KRYLOV(STEP_MINRES_diag_4000, 4000, ChSolverMINRES, false)
+BM_STEP_KRYLOV(STEP_MINRES_block_4000, 4000, ChSolverMINRES, true)
+BM_STEP_KRYLOV(STEP_GMRES_block_4000, 4000, ChSolverGMRES, true)
+BM_STEP_QR(STEP_QR_8000, 8000)
+BM_STEP_KRYLOV(STEP_MINRES_diag_8000, 8000, ChSolverMINRES, false)
+BM_STEP_KRYLOV(STEP_MINRES_block_8000, 8000, ChSolverMINRES, true)
+BM_STEP_KRYLOV(STEP_GMRES_block_8000, 8000, ChSolverGMRES, true)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
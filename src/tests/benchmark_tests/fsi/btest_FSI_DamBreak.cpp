@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono::FSI benchmark program for the CPU (OpenMP) version of the explicit
+// WCSPH solver (USE_FSI_CPU). A dam break problem is simulated with a varying
+// number of threads to measure the scaling of the SPH solver with core count.
+//
+// The global reference frame has Z up.
+// =============================================================================
+
+// Run benchmark tests for a number of threads between MIN and MAX (inclusive)
+// in increments of STEP.
+#define TEST_MIN_THREADS 1
+#define TEST_MAX_THREADS 16
+#define TEST_STEP_THREADS 1
+
+// =============================================================================
+
+#include <cmath>
+#include <iostream>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChBenchmark.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+
+#include "chrono_fsi/ChSystemFsi.h"
+
+using namespace chrono;
+using namespace chrono::fsi;
+
+class DamBreak : public utils::ChBenchmarkTest {
+  public:
+    DamBreak();
+
+    void SetNumthreads(int nthreads) { m_sysFSI.SetNumThreads(nthreads); }
+    size_t GetNumParticles() const { return m_num_particles; }
+
+    virtual ChSystem* GetSystem() override { return &m_sysMBS; }
+    virtual void ExecuteStep() override { m_sysFSI.DoStepDynamics_FSI(); }
+
+  private:
+    ChSystemSMC m_sysMBS;
+    ChSystemFsi m_sysFSI;
+    size_t m_num_particles;
+};
+
+DamBreak::DamBreak() : m_sysFSI(&m_sysMBS) {
+    // Container and fluid dimensions
+    ChVector3d cdim(6.0, 1.0, 4.0);
+    ChVector3d fdim(2.0, 1.0, 2.0);
+
+    m_sysFSI.SetVerbose(false);
+    m_sysFSI.ReadParametersFromFile(GetChronoDataFile("fsi/input_json/demo_FSI_DamBreak_Explicit.json"));
+
+    // Use a finer resolution than the demo, for a problem size representative of CRM terrain simulations
+    double initSpace0 = 0.05;
+    m_sysFSI.SetInitialSpacing(initSpace0);
+    m_sysFSI.SetKernelLength(initSpace0);
+
+    // Periodic boundary condition in Y direction
+    ChVector3d cMin(-cdim.x() / 2 - 10 * initSpace0, -cdim.y() / 2 - initSpace0 / 2, -2 * cdim.z());
+    ChVector3d cMax(cdim.x() / 2 + 10 * initSpace0, cdim.y() / 2 + initSpace0 / 2, 2 * cdim.z());
+    m_sysFSI.SetBoundaries(cMin, cMax);
+
+    // Fluid particles, initialized with the hydrostatic pressure
+    chrono::utils::ChGridSampler<> sampler(initSpace0);
+    auto points = sampler.SampleBox(ChVector3d(-cdim.x() / 2 + fdim.x() / 2, 0, fdim.z() / 2), fdim / 2);
+    double gz = std::abs(m_sysFSI.GetGravitationalAcceleration().z());
+    double c2 = m_sysFSI.GetSoundSpeed() * m_sysFSI.GetSoundSpeed();
+    for (const auto& p : points) {
+        double pre_ini = m_sysFSI.GetDensity() * gz * (fdim.z() - p.z());
+        double rho_ini = m_sysFSI.GetDensity() + pre_ini / c2;
+        m_sysFSI.AddSPHParticle(p, rho_ini, pre_ini, m_sysFSI.GetViscosity());
+    }
+    m_num_particles = points.size();
+
+    // Container walls
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_sysMBS.AddBody(ground);
+    m_sysFSI.AddBoxContainerBCE(ground,                                           //
+                                ChFrame<>(ChVector3d(0, 0, cdim.z() / 2), QUNIT),  //
+                                cdim,                                              //
+                                ChVector3i(2, 0, 2));
+
+    m_sysFSI.Initialize();
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 100  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for benchmarking
+
+using TEST_NAME = chrono::utils::ChBenchmarkFixture<DamBreak, 0>;
+BENCHMARK_DEFINE_F(TEST_NAME, DamBreak)(benchmark::State& st) {
+    Reset(NUM_SKIP_STEPS);
+    m_test->SetNumthreads((int)st.range(0));
+    while (st.KeepRunning()) {
+        m_test->Simulate(NUM_SIM_STEPS);
+    }
+    Report(st);
+    st.counters["Particles"] = (double)m_test->GetNumParticles();
+    std::cout << "Simulated " << m_test->GetNumParticles() << " SPH particles using " << st.range(0) << " threads."
+              << std::endl;
+}
+BENCHMARK_REGISTER_F(TEST_NAME, DamBreak)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -13,6 +13,8 @@
 // =============================================================================
 //
 // Chrono::Multicore benchmark program using SMC method for frictional contact.
+// The settling test is run with the default and with the temporally coherent
+// broadphase (see collision_settings::broadphase_coherent).
 //
 // The global reference frame has Z up.
 // =============================================================================
@@ -40,11 +42,17 @@ using namespace chrono;
 
 class SettlingSMC : public utils::ChBenchmarkTest {
   public:
-    SettlingSMC();
+    SettlingSMC(bool coherent = false);
     ~SettlingSMC() { delete m_system; }
 
     void SetNumthreads(int nthreads) { m_system->SetNumThreads(nthreads); }
     unsigned int GetNumParticles() const { return m_num_particles; }
+    unsigned int GetNumPossibleContacts() const {
+        return m_system->data_manager->measures.collision.number_of_contacts_possible;
+    }
+    unsigned int GetNumReusedContacts() const {
+        return m_system->data_manager->measures.collision.number_of_contacts_reused;
+    }
     void SimulateVis();
 
     virtual ChSystem* GetSystem() override { return m_system; }
@@ -56,7 +64,7 @@ class SettlingSMC : public utils::ChBenchmarkTest {
     unsigned int m_num_particles;
 };
 
-SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
+SettlingSMC::SettlingSMC(bool coherent) : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     // Simulation parameters
     double gravity = 9.81;
 
@@ -72,6 +80,7 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
 
     m_system->GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
     m_system->GetSettings()->collision.bins_per_axis = vec3(10, 10, 1);
+    m_system->GetSettings()->collision.broadphase_coherent = coherent;
 
     // The following two lines are optional, since they are the default options.
     m_system->GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
@@ -130,6 +139,11 @@ SettlingSMC::SettlingSMC() : m_system(new ChSystemMulticoreSMC), m_step(1e-3) {
     m_num_particles = gen.GetTotalNumBodies();
 }
 
+class SettlingSMCCoherent : public SettlingSMC {
+  public:
+    SettlingSMCCoherent() : SettlingSMC(true) {}
+};
+
 // Run settling simulation with visualization
 void SettlingSMC::SimulateVis() {
 #ifdef CHRONO_OPENGL
@@ -174,6 +188,28 @@ BENCHMARK_REGISTER_F(TEST_NAME, Settle)
     ->UseRealTime()
     ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
 
+using TEST_NAME_COHERENT = chrono::utils::ChBenchmarkFixture<SettlingSMCCoherent, 0>;
+BENCHMARK_DEFINE_F(TEST_NAME_COHERENT, SettleCoherent)(benchmark::State& st) {
+    Reset(NUM_SKIP_STEPS);
+    m_test->SetNumthreads((int)st.range(0));
+    while (st.KeepRunning()) {
+        m_test->Simulate(NUM_SIM_STEPS);
+    }
+    Report(st);
+    st.counters["CD_Pairs"] = m_test->GetNumPossibleContacts();
+    st.counters["CD_Reused"] = m_test->GetNumReusedContacts();
+    std::cout << "Simulated " << m_test->GetNumParticles() << " particles ";
+#pragma omp parallel
+#pragma omp master
+    std::cout << "using " << ChOMP::GetNumThreads() << " threads." << std::endl;
+}
+BENCHMARK_REGISTER_F(TEST_NAME_COHERENT, SettleCoherent)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1)
+    ->Repetitions(1)
+    ->UseRealTime()
+    ->DenseRange(TEST_MIN_THREADS, TEST_MAX_THREADS, TEST_STEP_THREADS);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Benchmark test for the parallel per-item passes of ChAssembly.
+// A large number of independent pendulums (each a body connected to ground through
+// a revolute joint) is simulated with different numbers of Chrono threads.
+//
+// =============================================================================
+
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int N, int NT>
+class PendulumsTest : public utils::ChBenchmarkTest {
+  public:
+    PendulumsTest();
+    ~PendulumsTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <int N, int NT>
+PendulumsTest<N, NT>::PendulumsTest() : m_step(1e-3) {
+    m_system = new ChSystemNSC;
+    m_system->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    m_system->SetNumThreads(NT, 1, 1);
+    m_system->EnableParallelAssemblyPasses(true);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    m_system->AddBody(ground);
+
+    double length = 0.5;
+    for (int ib = 0; ib < N; ib++) {
+        double x = (ib % 100) * 1.0;
+        double z = (ib / 100) * 1.0;
+
+        auto pend = chrono_types::make_shared<ChBodyEasyBox>(length, 0.05, 0.05, 500, false, false);
+        pend->SetPos(ChVector3d(x + length / 2, 0, z));
+        m_system->AddBody(pend);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(pend, ground, ChFrame<>(ChVector3d(x, 0, z)));
+        m_system->AddLink(rev);
+    }
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 10  // number of steps for hot start
+#define NUM_SIM_STEPS 50   // number of simulation steps for each benchmark
+
+using Pendulums01k_1T = PendulumsTest<1000, 1>;
+using Pendulums01k_2T = PendulumsTest<1000, 2>;
+using Pendulums01k_4T = PendulumsTest<1000, 4>;
+using Pendulums10k_1T = PendulumsTest<10000, 1>;
+using Pendulums10k_2T = PendulumsTest<10000, 2>;
+using Pendulums10k_4T = PendulumsTest<10000, 4>;
+using Pendulums50k_1T = PendulumsTest<50000, 1>;
+using Pendulums50k_2T = PendulumsTest<50000, 2>;
+using Pendulums50k_4T = PendulumsTest<50000, 4>;
+
+CH_BM_SIMULATION_LOOP(Assembly01k_1T, Pendulums01k_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly01k_2T, Pendulums01k_2T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly01k_4T, Pendulums01k_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(Assembly10k_1T, Pendulums10k_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly10k_2T, Pendulums10k_2T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly10k_4T, Pendulums10k_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 5);
+CH_BM_SIMULATION_LOOP(Assembly50k_1T, Pendulums50k_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 2);
+CH_BM_SIMULATION_LOOP(Assembly50k_2T, Pendulums50k_2T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 2);
+CH_BM_SIMULATION_LOOP(Assembly50k_4T, Pendulums50k_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 2);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
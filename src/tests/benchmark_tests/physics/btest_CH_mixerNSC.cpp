@@ -21,8 +21,10 @@
 #include "chrono/utils/ChBenchmark.h"
 
 #include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChContactContainerPooledNSC.h"
 #include "chrono/physics/ChBodyEasy.h"
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChSolverPSOR.h"
 
 #ifdef CHRONO_IRRLICHT
     #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
@@ -35,7 +37,7 @@ using namespace chrono;
 template <int N>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
-    MixerTestNSC();
+    MixerTestNSC(bool pooled_contacts = false, int flat_solver_threads = 0);
     ~MixerTestNSC() { delete m_system; }
 
     ChSystem* GetSystem() override { return m_system; }
@@ -48,9 +50,32 @@ class MixerTestNSC : public utils::ChBenchmarkTest {
     double m_step;
 };
 
+// Same test, using a contact container with pooled contact storage
 template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+class MixerTestPooledNSC : public MixerTestNSC<N> {
+  public:
+    MixerTestPooledNSC() : MixerTestNSC<N>(true) {}
+};
+
+// Same test, using the flattened constraint kernel of the PSOR solver with NT threads
+template <int N, int NT>
+class MixerTestFlatNSC : public MixerTestNSC<N> {
+  public:
+    MixerTestFlatNSC() : MixerTestNSC<N>(false, NT) {}
+};
+
+template <int N>
+MixerTestNSC<N>::MixerTestNSC(bool pooled_contacts, int flat_solver_threads)
+    : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    if (pooled_contacts)
+        m_system->SetContactContainer(chrono_types::make_shared<ChContactContainerPooledNSC>());
+    if (flat_solver_threads > 0) {
+        auto solver = chrono_types::make_shared<ChSolverPSOR>();
+        solver->EnableFlatKernel(true);
+        solver->SetNumThreads(flat_solver_threads);
+        m_system->SetSolver(solver);
+    }
 
     auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
 
@@ -135,6 +160,14 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+CH_BM_SIMULATION_LOOP(MixerPooledNSC032, MixerTestPooledNSC<32>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerPooledNSC064, MixerTestPooledNSC<64>, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
+using MixerTestFlatNSC064_1T = MixerTestFlatNSC<64, 1>;
+using MixerTestFlatNSC064_4T = MixerTestFlatNSC<64, 4>;
+CH_BM_SIMULATION_LOOP(MixerFlatNSC064_1T, MixerTestFlatNSC064_1T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+CH_BM_SIMULATION_LOOP(MixerFlatNSC064_4T, MixerTestFlatNSC064_4T, NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
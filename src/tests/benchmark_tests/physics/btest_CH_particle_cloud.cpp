@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Benchmark test for the compact storage mode of ChParticleCloud.
+// For a cloud of sphere particles, with the default and with compact storage:
+// - the state gather/scatter throughput (particles per second);
+// - the heap memory per particle held by the cloud itself ("CloudBytes") and
+//   after the cloud is processed by the Bullet collision system ("TotalBytes").
+// The memory counters are only reported with glibc.
+//
+// =============================================================================
+
+#include <memory>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    #include <malloc.h>
+    #define HAVE_MALLINFO2
+#endif
+
+using namespace chrono;
+
+// =============================================================================
+
+// Currently allocated heap memory (0 if not available)
+static double HeapBytes() {
+#ifdef HAVE_MALLINFO2
+    return (double)mallinfo2().uordblks;
+#else
+    return 0;
+#endif
+}
+
+// Create a cloud of particles on a grid, with a shared sphere collision shape
+static std::shared_ptr<ChParticleCloud> CreateCloud(bool compact, int num_particles) {
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->EnableCompactStorage(compact);
+    cloud->SetMass(0.5);
+    cloud->SetInertiaXX(ChVector3d(0.0005, 0.0005, 0.0005));
+    cloud->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, 0.05));
+    cloud->EnableCollision(true);
+
+    for (int i = 0; i < num_particles; i++) {
+        ChVector3d pos(0.11 * (i % 100), 0.11 * ((i / 100) % 100), 0.11 * (i / 10000));
+        cloud->AddParticle(ChCoordsys<>(pos));
+    }
+
+    return cloud;
+}
+
+template <bool COMPACT>
+static void GatherScatter(benchmark::State& state) {
+    int num_particles = (int)state.range(0);
+
+    ChSystemNSC sys;
+    sys.SetNumThreads(1, 1, 1);
+    auto cloud = CreateCloud(COMPACT, num_particles);
+    sys.Add(cloud);
+    sys.Setup();
+
+    ChState x(cloud->GetNumCoordsPosLevel(), nullptr);
+    ChStateDelta v(cloud->GetNumCoordsVelLevel(), nullptr);
+    double T;
+
+    for (auto _ : state) {
+        cloud->IntStateGather(0, x, 0, v, T);
+        cloud->IntStateScatter(0, x, 0, v, T, false);
+        benchmark::DoNotOptimize(x.data());
+    }
+
+    state.counters["Particles"] =
+        benchmark::Counter((double)num_particles, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <bool COMPACT>
+static void Memory(benchmark::State& state) {
+    int num_particles = (int)state.range(0);
+
+    double cloud_bytes = 0;
+    double total_bytes = 0;
+    for (auto _ : state) {
+        double heap0 = HeapBytes();
+        {
+            auto cloud = CreateCloud(COMPACT, num_particles);
+            double heap1 = HeapBytes();
+
+            ChSystemNSC sys;
+            sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+            double heap2 = HeapBytes();
+            sys.Add(cloud);
+            sys.GetCollisionSystem()->BindItem(cloud);
+            double heap3 = HeapBytes();
+
+            cloud_bytes = heap1 - heap0;
+            total_bytes = cloud_bytes + (heap3 - heap2);
+        }
+    }
+
+    state.counters["CloudBytes"] = cloud_bytes / num_particles;
+    state.counters["TotalBytes"] = total_bytes / num_particles;
+}
+
+// =============================================================================
+
+BENCHMARK_TEMPLATE(GatherScatter, false)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_TEMPLATE(GatherScatter, true)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+BENCHMARK_TEMPLATE(Memory, false)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Memory, true)->Arg(100000)->Iterations(1)->Unit(benchmark::kMillisecond);
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
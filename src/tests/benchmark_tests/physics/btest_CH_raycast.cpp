@@ -0,0 +1,140 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Benchmark test for ray casting with the Bullet and multicore collision systems.
+// A grid of vertical rays (as used for SCM deformable terrain) is cast onto a
+// ground plate covered with spheres and boxes. The throughput of casting one ray
+// at a time is compared with that of the batched ray-hit query, using different
+// numbers of threads.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// =============================================================================
+
+class RaycastScene {
+  public:
+    RaycastScene(ChCollisionSystem::Type type, int num_threads);
+
+    ChCollisionSystem* GetCollisionSystem() const { return m_system.GetCollisionSystem().get(); }
+
+    std::vector<ChVector3d> m_from;
+    std::vector<ChVector3d> m_to;
+
+  private:
+    ChSystemNSC m_system;
+};
+
+RaycastScene::RaycastScene(ChCollisionSystem::Type type, int num_threads) {
+    m_system.SetCollisionSystemType(type);
+    m_system.SetNumThreads(1, num_threads, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 10, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    m_system.AddBody(ground);
+
+    for (int ix = 0; ix < 20; ix++) {
+        for (int iy = 0; iy < 20; iy++) {
+            ChVector3d pos(-4.75 + 0.5 * ix, -4.75 + 0.5 * iy, 0.2);
+            std::shared_ptr<ChBody> body;
+            if ((ix + iy) % 2 == 0)
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+            else
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.3, 0.3, 0.3, 1000, false, true, mat);
+            body->SetPos(pos);
+            body->SetFixed(true);
+            m_system.AddBody(body);
+        }
+    }
+
+    m_system.GetCollisionSystem()->Initialize();
+    m_system.ComputeCollisions();
+
+    // 200 x 200 grid of vertical rays
+    int n = 200;
+    double delta = 10.0 / n;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x = -5 + (i + 0.5) * delta;
+            double y = -5 + (j + 0.5) * delta;
+            m_from.push_back(ChVector3d(x, y, 1));
+            m_to.push_back(ChVector3d(x, y, -0.1));
+        }
+    }
+}
+
+// =============================================================================
+
+template <ChCollisionSystem::Type TYPE>
+static void PerRay(benchmark::State& state) {
+    RaycastScene scene(TYPE, 1);
+    auto coll_sys = scene.GetCollisionSystem();
+    auto num_rays = scene.m_from.size();
+
+    ChCollisionSystem::ChRayhitResult result;
+    for (auto _ : state) {
+        int num_hits = 0;
+        for (size_t i = 0; i < num_rays; i++) {
+            if (coll_sys->RayHit(scene.m_from[i], scene.m_to[i], result))
+                num_hits++;
+        }
+        benchmark::DoNotOptimize(num_hits);
+    }
+
+    state.counters["Rays"] = benchmark::Counter((double)num_rays, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <ChCollisionSystem::Type TYPE>
+static void Batched(benchmark::State& state) {
+    RaycastScene scene(TYPE, (int)state.range(0));
+    auto coll_sys = scene.GetCollisionSystem();
+    auto num_rays = scene.m_from.size();
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    for (auto _ : state) {
+        int num_hits = coll_sys->RayHit(scene.m_from, scene.m_to, results);
+        benchmark::DoNotOptimize(num_hits);
+    }
+
+    state.counters["Rays"] = benchmark::Counter((double)num_rays, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+// =============================================================================
+
+BENCHMARK_TEMPLATE(PerRay, ChCollisionSystem::Type::BULLET)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Batched, ChCollisionSystem::Type::BULLET)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+
+#ifdef CHRONO_COLLISION
+BENCHMARK_TEMPLATE(PerRay, ChCollisionSystem::Type::MULTICORE)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(Batched, ChCollisionSystem::Type::MULTICORE)->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+#endif
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -69,6 +69,9 @@ int nthreads = 4;
 // Moving patches under each wheel
 bool wheel_patches = false;
 
+// Store SCM modified nodes in dense tiles (false: hash map)
+bool dense_tiles = false;
+
 // Better conserve mass by displacing soil to the sides of a rut
 const bool bulldozing = false;
 
@@ -99,6 +102,7 @@ int main(int argc, char* argv[]) {
     end_time = cli.GetAsType<double>("end_time");
     nthreads = cli.GetAsType<int>("nthreads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
+    dense_tiles = cli.GetAsType<bool>("tiles");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
 #ifndef CHRONO_COLLISION
@@ -116,6 +120,7 @@ int main(int argc, char* argv[]) {
 
     std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
     std::cout << "Num SCM threads: " << nthreads << std::endl;
+    std::cout << "SCM node storage: " << (dense_tiles ? "dense tiles" : "hash map") << std::endl;
 
     // ------------------------
     // Create the Chrono system
@@ -188,6 +193,7 @@ int main(int argc, char* argv[]) {
     // Create the terrain
     // ------------------
     SCMTerrain terrain(&sys, visualize);
+    terrain.SetNodeStorage(dense_tiles ? SCMTerrain::NodeStorage::DENSE_TILES : SCMTerrain::NodeStorage::HASH_MAP);
 
     terrain.SetSoilParameters(2e6,   // Bekker Kphi
                               0,     // Bekker Kc
@@ -259,6 +265,7 @@ int main(int argc, char* argv[]) {
     double chrono_setup = 0;
     double raytest = 0;
     double raycast = 0;
+    double contact = 0;
 
     ChTimer timer;
     timer.start();
@@ -272,7 +279,7 @@ int main(int argc, char* argv[]) {
                 double rtf = timer() / end_time;
                 int nsteps = (int)(end_time / step_size);
 
-                std::string fname = "stats_" + std::to_string(nthreads) + ".out";
+                std::string fname = "stats_" + std::to_string(nthreads) + (dense_tiles ? "_tiles" : "") + ".out";
                 std::ofstream ofile(fname, std::ios_base::app);
                 ofile << raytest / nsteps << " " << raycast / nsteps << " " << rtf << endl;
                 ofile.close();
@@ -285,6 +292,8 @@ int main(int argc, char* argv[]) {
                 cout << "chrono setup (s):  " << chrono_setup << endl;
                 cout << "raytesting (s):    " << raytest / 1e3 << endl;
                 cout << "raycasting (s):    " << raycast / 1e3 << endl;
+                cout << "contact (s):       " << contact / 1e3 << endl;
+                cout << "modified nodes:    " << terrain.GetNumModifiedNodes() << endl;
                 cout << "RTF:               " << rtf << endl;
                 cout << "\nSCM stats for last step:" << endl;
                 terrain.PrintStepStatistics(cout);
@@ -335,6 +344,7 @@ int main(int argc, char* argv[]) {
         chrono_setup += sys.GetTimerSetup();
         raytest += terrain.GetTimerRayTesting();
         raycast += terrain.GetTimerRayCasting();
+        contact += terrain.GetTimerContactPatches() + terrain.GetTimerContactForces();
 
         // Increment frame number
         step_number++;
@@ -350,6 +360,8 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<bool>("Test", "c,csys", "Use Chrono multicore collision (false: Bullet)",
                         std ::to_string(chrono_collsys));
     cli.AddOption<bool>("Test", "w,wheel_patches", "Use patches under each wheel", std::to_string(wheel_patches));
+    cli.AddOption<bool>("Test", "t,tiles", "Store SCM nodes in dense tiles (false: hash map)",
+                        std::to_string(dense_tiles));
     cli.AddOption<bool>("Test", "v,vis", "Enable run-time visualization", std::to_string(visualize));
 }
 
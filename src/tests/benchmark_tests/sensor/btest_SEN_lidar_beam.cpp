@@ -71,6 +71,10 @@ int main(int argc, char* argv[]) {
     auto manager = std::make_shared<ChSensorManager>(&sys);
     manager->scene->AddPointLight({-100, 100, 100}, {1, 1, 1}, 1000);
 
+    // run with --cpu to trace the lidars with the CPU backend
+    if (argc > 1 && std::string(argv[1]) == "--cpu")
+        manager->SetRayTracingBackend(RayTracingBackend::CPU);
+
     // ------------------------------------------------
     // Create a camera and add it to the sensor manager
     // ------------------------------------------------
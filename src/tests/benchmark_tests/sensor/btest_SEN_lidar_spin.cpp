@@ -87,6 +87,11 @@ int main(int argc, char* argv[]) {
     auto manager = std::make_shared<ChSensorManager>(&sys);
     manager->scene->AddPointLight({-100, 100, 100}, {1, 1, 1}, 1000);
 
+    // run with --cpu to trace the lidar with the CPU backend (no camera and no visualization in that case)
+    bool use_cpu = argc > 1 && std::string(argv[1]) == "--cpu";
+    if (use_cpu)
+        manager->SetRayTracingBackend(RayTracingBackend::CPU);
+
     // ------------------------------------------------
     // Create a camera and add it to the sensor manager
     // ------------------------------------------------
@@ -104,7 +109,10 @@ int main(int argc, char* argv[]) {
     lidar1->SetLag(1);
     lidar1->SetCollectionWindow(1);
     lidar1->PushFilter(std::make_shared<ChFilterPCfromDepth>());
-    lidar1->PushFilter(std::make_shared<ChFilterVisualizePointCloud>(800, 800, 1.5f));
+    if (use_cpu)
+        lidar1->PushFilter(std::make_shared<ChFilterXYZIAccess>());
+    else
+        lidar1->PushFilter(std::make_shared<ChFilterVisualizePointCloud>(800, 800, 1.5f));
     manager->AddSensor(lidar1);
 
     auto camera = std::make_shared<ChCameraSensor>(
@@ -119,10 +127,12 @@ int main(int argc, char* argv[]) {
     camera->SetLag(0);
     camera->SetCollectionWindow(0);
     camera->PushFilter(std::make_shared<ChFilterVisualize>(1280, 720));
-    manager->AddSensor(camera);
+    if (!use_cpu)
+        manager->AddSensor(camera);
 
     float speed = 16;
 
+    std::chrono::high_resolution_clock::time_point t1 = std::chrono::high_resolution_clock::now();
     while (sys.GetChTime() < end_time) {
         // move the cart
         cart->SetPos(cart->GetPos() + ChVector3d({speed * step_size, 0, 0}));
@@ -130,6 +140,10 @@ int main(int argc, char* argv[]) {
         manager->Update();
         sys.DoStepDynamics(step_size);
     }
+    std::chrono::high_resolution_clock::time_point t2 = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double> wall_time = std::chrono::duration_cast<std::chrono::duration<double>>(t2 - t1);
+    std::cout << "Simulation time: " << sys.GetChTime() << " seconds, wall time: " << wall_time.count()
+              << " seconds.\n";
 
     return 0;
 }
@@ -0,0 +1,115 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono unit test for the temporally coherent broadphase of the multicore
+// collision system.
+// Two identical systems, with a set of spheres moved along prescribed paths, are
+// processed with the default and with the coherent broadphase. At each step, the
+// candidate pairs of the default broadphase must be a subset of the candidate
+// pairs of the coherent broadphase and the number of contacts must be the same.
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <utility>
+
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const int num_spheres = 6 * 6 * 6;
+
+// Create a system with a box container and a set of spheres
+static void CreateSystem(ChSystemNSC& sys, std::shared_ptr<ChCollisionSystemMulticore> coll_sys) {
+    coll_sys->SetBroadphaseGridResolution(ChVector3i(8, 8, 8));
+    sys.SetCollisionSystem(coll_sys);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto box = chrono_types::make_shared<ChBody>();
+    box->SetFixed(true);
+    box->EnableCollision(true);
+    utils::AddBoxContainer(box, mat, ChFrame<>(), ChVector3d(3, 3, 3), 0.1, ChVector3i(2, 2, 2));
+    sys.AddBody(box);
+
+    for (int i = 0; i < num_spheres; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+        sys.AddBody(ball);
+    }
+
+    coll_sys->Initialize();
+}
+
+// Prescribed sphere positions: a regular lattice with small perturbations and a few spheres moving across the box
+static ChVector3d SpherePosition(int i, int step) {
+    int ix = i % 6;
+    int iy = (i / 6) % 6;
+    int iz = i / 36;
+    ChVector3d pos(-1.05 + 0.42 * ix, -1.05 + 0.42 * iy, -1.05 + 0.42 * iz);
+    double t = 0.01 * step;
+    if (i % 10 == 0) {
+        pos.x() = 1.2 * std::sin(0.5 * t + i);
+    } else {
+        pos += 0.02 * ChVector3d(std::sin(7 * t + i), std::cos(5 * t + 2 * i), std::sin(3 * t + 3 * i));
+    }
+    return pos;
+}
+
+static std::set<std::pair<int, int>> GetPairs(std::shared_ptr<ChCollisionSystemMulticore> coll_sys) {
+    std::set<std::pair<int, int>> pairs;
+    for (const auto& p : coll_sys->GetOverlappingPairs())
+        pairs.insert(std::make_pair(std::min(p.x, p.y), std::max(p.x, p.y)));
+    return pairs;
+}
+
+TEST(ChBroadphase, coherent) {
+    ChSystemNSC sys_ref;
+    auto coll_ref = chrono_types::make_shared<ChCollisionSystemMulticore>();
+    CreateSystem(sys_ref, coll_ref);
+
+    ChSystemNSC sys_coh;
+    auto coll_coh = chrono_types::make_shared<ChCollisionSystemMulticore>();
+    coll_coh->EnableBroadphaseCoherence(true);
+    CreateSystem(sys_coh, coll_coh);
+
+    unsigned int num_reused = 0;
+    for (int step = 0; step < 200; step++) {
+        for (int i = 0; i < num_spheres; i++) {
+            sys_ref.GetBodies()[i + 1]->SetPos(SpherePosition(i, step));
+            sys_coh.GetBodies()[i + 1]->SetPos(SpherePosition(i, step));
+        }
+        sys_ref.ComputeCollisions();
+        sys_coh.ComputeCollisions();
+
+        auto pairs_ref = GetPairs(coll_ref);
+        auto pairs_coh = GetPairs(coll_coh);
+        ASSERT_GE(pairs_coh.size(), pairs_ref.size());
+        for (const auto& p : pairs_ref)
+            ASSERT_TRUE(pairs_coh.find(p) != pairs_coh.end());
+
+        ASSERT_EQ(sys_ref.GetNumContacts(), sys_coh.GetNumContacts());
+        ASSERT_EQ(coll_ref->GetNumReusedBroadphasePairs(), 0);
+
+        num_reused += coll_coh->GetNumReusedBroadphasePairs();
+    }
+
+    // most candidate pairs are carried over from one step to the next
+    ASSERT_GT(num_reused, 0);
+}
@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono unit test for the two-level broadphase of the multicore collision system.
+// Two identical polydisperse systems (small spheres between a ground plate, a
+// large box, and a boulder) are processed with a one-level grid and with the
+// two-level grid. The candidate pairs, the number of contacts, and the results of
+// ray intersection tests must be identical.
+// =============================================================================
+
+#include <algorithm>
+#include <random>
+#include <set>
+#include <utility>
+
+#include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const int num_spheres = 2000;
+const ChVector3i grid_resolution(120, 16, 80);  // bins of about 0.05 over the extent of the scene
+
+// Create a system with a ground plate, a large box, a boulder, and a set of small spheres
+static std::shared_ptr<ChBody> CreateSystem(ChSystemNSC& sys, std::shared_ptr<ChCollisionSystemMulticore> coll_sys) {
+    coll_sys->SetBroadphaseGridResolution(grid_resolution);
+    sys.SetCollisionSystem(coll_sys);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(6, 0.2, 4, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, -0.1, 0));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto chassis = chrono_types::make_shared<ChBodyEasyBox>(3, 0.5, 1.5, 100, false, true, mat);
+    chassis->SetPos(ChVector3d(0, 0.3, 0));
+    sys.AddBody(chassis);
+
+    auto boulder = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+    boulder->SetPos(ChVector3d(1.75, 0.3, 0));
+    sys.AddBody(boulder);
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> x_distrib(-2, 2);
+    std::uniform_real_distribution<double> y_distrib(0, 0.1);
+    std::uniform_real_distribution<double> z_distrib(-1, 1);
+    for (int i = 0; i < num_spheres; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.01, 1000, false, true, mat);
+        ball->SetPos(ChVector3d(x_distrib(generator), y_distrib(generator), z_distrib(generator)));
+        sys.AddBody(ball);
+    }
+
+    coll_sys->Initialize();
+
+    return chassis;
+}
+
+static std::set<std::pair<int, int>> GetPairs(std::shared_ptr<ChCollisionSystemMulticore> coll_sys) {
+    std::set<std::pair<int, int>> pairs;
+    for (const auto& p : coll_sys->GetOverlappingPairs())
+        pairs.insert(std::make_pair(std::min(p.x, p.y), std::max(p.x, p.y)));
+    return pairs;
+}
+
+TEST(ChBroadphase, two_level) {
+    ChSystemNSC sys_ref;
+    auto coll_ref = chrono_types::make_shared<ChCollisionSystemMulticore>();
+    auto chassis_ref = CreateSystem(sys_ref, coll_ref);
+
+    ChSystemNSC sys_tl;
+    auto coll_tl = chrono_types::make_shared<ChCollisionSystemMulticore>();
+    coll_tl->EnableBroadphaseTwoLevel(true, 4);
+    auto chassis_tl = CreateSystem(sys_tl, coll_tl);
+
+    for (int step = 0; step < 5; step++) {
+        // lower the large box into the layer of small spheres
+        chassis_ref->SetPos(ChVector3d(0.1 * step, 0.3 - 0.01 * step, 0));
+        chassis_tl->SetPos(ChVector3d(0.1 * step, 0.3 - 0.01 * step, 0));
+
+        sys_ref.ComputeCollisions();
+        sys_tl.ComputeCollisions();
+
+        // ground, large box, and boulder are processed in the coarse grid
+        ASSERT_EQ(coll_ref->GetNumCoarseGridShapes(), 0);
+        ASSERT_EQ(coll_tl->GetNumCoarseGridShapes(), 3);
+
+        auto pairs_ref = GetPairs(coll_ref);
+        auto pairs_tl = GetPairs(coll_tl);
+        ASSERT_EQ(pairs_ref.size(), coll_ref->GetOverlappingPairs().size());
+        ASSERT_EQ(pairs_tl.size(), coll_tl->GetOverlappingPairs().size());
+        ASSERT_TRUE(pairs_ref == pairs_tl);
+
+        ASSERT_GT(sys_ref.GetNumContacts(), 0);
+        ASSERT_EQ(sys_ref.GetNumContacts(), sys_tl.GetNumContacts());
+
+        // vertical rays hitting the large box, the boulder, small spheres, or the ground
+        for (int i = 0; i < 40; i++) {
+            ChVector3d from(-2 + 0.1 * i, 1, 0.01 * i);
+            ChVector3d to(-2 + 0.1 * i, -1, 0.01 * i);
+            ChCollisionSystem::ChRayhitResult res_ref;
+            ChCollisionSystem::ChRayhitResult res_tl;
+            bool hit_ref = coll_ref->RayHit(from, to, res_ref);
+            bool hit_tl = coll_tl->RayHit(from, to, res_tl);
+            ASSERT_EQ(hit_ref, hit_tl);
+            if (hit_ref) {
+                ASSERT_NEAR(res_ref.dist_factor, res_tl.dist_factor, 1e-12);
+            }
+        }
+    }
+}
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono unit test for the parallel contact reporting of the Bullet collision
+// system. Two identical piles of spheres in a box, one with sequential and one with
+// parallel contact reporting, are simulated with NSC and SMC contact. The contacts
+// must be reported in the same order and the simulation results must be identical.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Create a box container with a pile of spheres
+static void CreateModel(ChSystem& sys, bool parallel) {
+    auto coll_sys = chrono_types::make_shared<ChCollisionSystemBullet>();
+    coll_sys->EnableParallelReporting(parallel);
+    sys.SetCollisionSystem(coll_sys);
+    sys.SetNumThreads(1, 4, 1);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = ChContactMaterial::DefaultMaterial(sys.GetContactMethod());
+    mat->SetFriction(0.4f);
+
+    auto box = chrono_types::make_shared<ChBody>();
+    box->SetFixed(true);
+    box->EnableCollision(true);
+    utils::AddBoxContainer(box, mat, ChFrame<>(), ChVector3d(1, 1, 1), 0.1, ChVector3i(2, 2, -1));
+    sys.AddBody(box);
+
+    double radius = 0.05;
+    for (int iz = 0; iz < 4; iz++) {
+        for (int ix = 0; ix < 8; ix++) {
+            for (int iy = 0; iy < 8; iy++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(-0.4 + 0.11 * ix + 0.01 * iz, -0.4 + 0.11 * iy, -0.45 + 0.11 * iz));
+                sys.AddBody(ball);
+            }
+        }
+    }
+}
+
+// Collect contact information, in the order in which contacts are stored in the container
+class ContactRecorder : public ChContactContainer::ReportContactCallback {
+  public:
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        points.push_back(pA);
+        points.push_back(pB);
+        return true;
+    }
+
+    std::vector<ChVector3d> points;
+};
+
+static void Compare(ChSystem& sys_ser, ChSystem& sys_par) {
+    for (int step = 0; step < 100; step++) {
+        sys_ser.DoStepDynamics(1e-3);
+        sys_par.DoStepDynamics(1e-3);
+
+        auto rec_ser = chrono_types::make_shared<ContactRecorder>();
+        auto rec_par = chrono_types::make_shared<ContactRecorder>();
+        sys_ser.GetContactContainer()->ReportAllContacts(rec_ser);
+        sys_par.GetContactContainer()->ReportAllContacts(rec_par);
+
+        ASSERT_EQ(sys_ser.GetNumContacts(), sys_par.GetNumContacts());
+        ASSERT_EQ(rec_ser->points.size(), rec_par->points.size());
+        for (size_t i = 0; i < rec_ser->points.size(); i++)
+            ASSERT_EQ(rec_ser->points[i], rec_par->points[i]);
+
+        for (size_t i = 0; i < sys_ser.GetBodies().size(); i++)
+            ASSERT_EQ(sys_ser.GetBodies()[i]->GetPos(), sys_par.GetBodies()[i]->GetPos());
+    }
+
+    ASSERT_GT(sys_par.GetNumContacts(), 0);
+    ASSERT_GT(sys_par.GetTimerCollisionReport(), 0);
+}
+
+TEST(ChCollisionSystemBullet, parallel_report_NSC) {
+    ChSystemNSC sys_ser;
+    ChSystemNSC sys_par;
+    CreateModel(sys_ser, false);
+    CreateModel(sys_par, true);
+    Compare(sys_ser, sys_par);
+}
+
+TEST(ChCollisionSystemBullet, parallel_report_SMC) {
+    ChSystemSMC sys_ser;
+    ChSystemSMC sys_par;
+    CreateModel(sys_ser, false);
+    CreateModel(sys_par, true);
+    Compare(sys_ser, sys_par);
+}
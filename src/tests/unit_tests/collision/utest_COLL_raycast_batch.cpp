@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono unit test for the batched ray-hit query of the Bullet and multicore
+// collision systems. A grid of vertical rays is cast onto a ground plate covered
+// with spheres and boxes. The batched results (unfiltered, restricted to a given
+// collision model, and restricted to a given collision family) must match the
+// results of the single-ray queries.
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/collision/bullet/ChCollisionSystemBullet.h"
+#ifdef CHRONO_COLLISION
+    #include "chrono/collision/multicore/ChCollisionSystemMulticore.h"
+#endif
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Ground plate (family 1), a single box (family 2), and a set of spheres (family 0)
+static void CreateModel(ChSystemNSC& sys,
+                        std::shared_ptr<ChCollisionSystem> coll_sys,
+                        std::shared_ptr<ChBody>& ground,
+                        std::shared_ptr<ChBody>& box) {
+    sys.SetCollisionSystem(coll_sys);
+    sys.SetNumThreads(1, 4, 1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    ground->GetCollisionModel()->SetFamily(1);
+    sys.AddBody(ground);
+
+    box = chrono_types::make_shared<ChBodyEasyBox>(1, 1, 0.5, 1000, false, true, mat);
+    box->SetPos(ChVector3d(0.5, 0.5, 0.6));
+    box->SetFixed(true);
+    box->GetCollisionModel()->SetFamily(2);
+    sys.AddBody(box);
+
+    for (int ix = 0; ix < 8; ix++) {
+        for (int iy = 0; iy < 8; iy++) {
+            auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.15, 1000, false, true, mat);
+            ball->SetPos(ChVector3d(-1.75 + 0.5 * ix, -1.75 + 0.5 * iy, 0.15));
+            ball->SetFixed(true);
+            sys.AddBody(ball);
+        }
+    }
+
+    coll_sys->Initialize();
+    sys.ComputeCollisions();
+}
+
+static void CheckResult(const ChCollisionSystem::ChRayhitResult& single,
+                        const ChCollisionSystem::ChRayhitResult& batch) {
+    ASSERT_EQ(single.hit, batch.hit);
+    if (single.hit) {
+        ASSERT_EQ(single.hitModel, batch.hitModel);
+        ASSERT_DOUBLE_EQ(single.dist_factor, batch.dist_factor);
+        ASSERT_EQ(single.abs_hitPoint, batch.abs_hitPoint);
+        ASSERT_EQ(single.abs_hitNormal, batch.abs_hitNormal);
+    }
+}
+
+static void TestRayHit(std::shared_ptr<ChCollisionSystem> coll_sys) {
+    ChSystemNSC sys;
+    std::shared_ptr<ChBody> ground;
+    std::shared_ptr<ChBody> box;
+    CreateModel(sys, coll_sys, ground, box);
+
+    std::vector<ChVector3d> from;
+    std::vector<ChVector3d> to;
+    for (int i = 0; i < 50; i++) {
+        for (int j = 0; j < 50; j++) {
+            double x = -1.96 + 0.08 * i;
+            double y = -1.96 + 0.08 * j;
+            from.push_back(ChVector3d(x, y, 2));
+            to.push_back(ChVector3d(x, y, -0.1));
+        }
+    }
+    auto num_rays = from.size();
+
+    // All collision models
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = coll_sys->RayHit(from, to, results);
+    ASSERT_EQ(results.size(), num_rays);
+    ASSERT_EQ(num_hits, (int)num_rays);
+
+    int num_box_hits = 0;
+    for (size_t i = 0; i < num_rays; i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        coll_sys->RayHit(from[i], to[i], result);
+        CheckResult(result, results[i]);
+        if (result.hitModel == box->GetCollisionModel().get())
+            num_box_hits++;
+    }
+    ASSERT_GT(num_box_hits, 0);
+
+    // Only the box collision model
+    num_hits = coll_sys->RayHit(from, to, results, box->GetCollisionModel().get());
+    ASSERT_EQ(num_hits, num_box_hits);
+    for (size_t i = 0; i < num_rays; i++) {
+        ChCollisionSystem::ChRayhitResult result;
+        coll_sys->RayHit(from[i], to[i], box->GetCollisionModel().get(), result);
+        CheckResult(result, results[i]);
+    }
+
+    // Only the ground collision family (all rays hit the top face of the ground plate)
+    num_hits = coll_sys->RayHit(from, to, results, nullptr, 1);
+    ASSERT_EQ(num_hits, (int)num_rays);
+    for (size_t i = 0; i < num_rays; i++) {
+        ASSERT_EQ(results[i].hitModel, ground->GetCollisionModel().get());
+        ASSERT_NEAR(results[i].abs_hitPoint.z(), 0.0, 1e-2);
+    }
+
+    // No collision model in family 3
+    num_hits = coll_sys->RayHit(from, to, results, nullptr, 3);
+    ASSERT_EQ(num_hits, 0);
+}
+
+TEST(ChCollisionSystemBullet, raycast_batch) {
+    TestRayHit(chrono_types::make_shared<ChCollisionSystemBullet>());
+}
+
+#ifdef CHRONO_COLLISION
+TEST(ChCollisionSystemMulticore, raycast_batch) {
+    TestRayHit(chrono_types::make_shared<ChCollisionSystemMulticore>());
+}
+#endif
@@ -20,6 +20,7 @@
 #include "gtest/gtest.h"
 #include "chrono/functions/ChFunctionLambda.h"
 #include "chrono/functions/ChFunctionInterp.h"
+#include "chrono/functions/ChFunctionTable.h"
 #include "chrono/utils/ChConstants.h"
 
 using namespace chrono;
@@ -92,6 +93,95 @@ TEST(ChFunctionInterp, interp1_extrap) {
     // ASSERT_DOUBLE_EQ(fun_table.GetVal(-0.7), fun_table(-0.7));
 }
 
+TEST(ChFunctionTable, same_as_interp) {
+    std::vector<double> x = {0.0, 0.1, 9.8, -1.7, -1.0, 11.3};
+    std::vector<double> y = {2.7, 0.3, 13.5, -11.7, -15.0, -2.4};
+    std::vector<double> xq = {-5, -1.7, 0.0, 0.05, -1.5, -0.7, 3.7, 11.3, 18.3};
+
+    for (bool extrapolate : {false, true}) {
+        ChFunctionInterp fun_interp;
+        fun_interp.SetExtrapolate(extrapolate);
+        for (size_t i = 0; i < x.size(); i++)
+            fun_interp.AddPoint(x[i], y[i]);
+
+        ChFunctionTable fun_table(x, y);
+        fun_table.SetExtrapolate(extrapolate);
+        ASSERT_FALSE(fun_table.IsUniform());
+
+        std::vector<double> yq(xq.size());
+        fun_table.GetVal(xq.data(), yq.data(), xq.size());
+
+        for (size_t i = 0; i < xq.size(); i++) {
+            ASSERT_NEAR(fun_table.GetVal(xq[i]), fun_interp.GetVal(xq[i]), TOL_FUN);
+            ASSERT_NEAR(fun_table.GetDer(xq[i]), fun_interp.GetDer(xq[i]), TOL_FUN);
+            ASSERT_DOUBLE_EQ(yq[i], fun_table.GetVal(xq[i]));
+        }
+    }
+}
+
+TEST(ChFunctionTable, from_interp) {
+    std::vector<double> xq = {-5, -1.7, 0.0, 0.05, -1.5, -0.7, 3.7, 11.3, 18.3};
+
+    for (bool extrapolate : {false, true}) {
+        ChFunctionInterp fun_interp;
+        fun_interp.SetExtrapolate(extrapolate);
+        fun_interp.AddPoint(0.0, 2.7);
+        fun_interp.AddPoint(0.1, 0.3);
+        fun_interp.AddPoint(9.8, 13.5);
+        fun_interp.AddPoint(-1.7, -11.7);
+        fun_interp.AddPoint(-1.0, -15.0);
+        fun_interp.AddPoint(11.3, -2.4);
+
+        // The converted table keeps the points and the extrapolation setting (xq includes out-of-range values)
+        ChFunctionTable fun_table(fun_interp);
+        ASSERT_EQ(fun_table.GetExtrapolate(), extrapolate);
+        ASSERT_EQ(fun_table.GetNumPoints(), fun_interp.GetTable().size());
+
+        for (size_t i = 0; i < xq.size(); i++) {
+            ASSERT_NEAR(fun_table.GetVal(xq[i]), fun_interp.GetVal(xq[i]), TOL_FUN);
+            ASSERT_NEAR(fun_table.GetDer(xq[i]), fun_interp.GetDer(xq[i]), TOL_FUN);
+        }
+    }
+}
+
+TEST(ChFunctionTable, uniform) {
+    // Tabulate sin(x) on a uniform grid (points added in reverse order)
+    ChFunctionTable fun_table;
+    fun_table.SetExtrapolate(true);
+    int n = 101;
+    for (int i = n - 1; i >= 0; i--) {
+        double x = -1 + 0.1 * i;
+        fun_table.AddPoint(x, std::sin(x));
+    }
+    ASSERT_TRUE(fun_table.IsUniform());
+    ASSERT_EQ(fun_table.GetNumPoints(), (size_t)n);
+
+    ChFunctionInterp fun_interp;
+    fun_interp.SetExtrapolate(true);
+    for (int i = 0; i < n; i++) {
+        double x = -1 + 0.1 * i;
+        fun_interp.AddPoint(x, std::sin(x));
+    }
+
+    // Query at table points, inside intervals, and outside the table domain
+    ChVectorDynamic<> xq(4 * n + 2);
+    for (int i = 0; i < 4 * n + 2; i++)
+        xq(i) = -1.5 + 0.025 * i;
+    ChVectorDynamic<> yq;
+    fun_table.GetVal(xq, yq);
+    ASSERT_EQ(yq.size(), xq.size());
+
+    for (int i = 0; i < xq.size(); i++) {
+        ASSERT_NEAR(fun_table.GetVal(xq(i)), fun_interp.GetVal(xq(i)), TOL_FUN);
+        ASSERT_NEAR(yq(i), fun_interp.GetVal(xq(i)), TOL_FUN);
+    }
+
+    // Overwrite an existing point
+    EXPECT_THROW(fun_table.AddPoint(-1.0, 1.0), std::invalid_argument);
+    fun_table.AddPoint(-1.0, 1.0, true);
+    ASSERT_NEAR(fun_table.GetVal(-1.0), 1.0, TOL_FUN);
+}
+
 // TEST(ChFunctionInterp, wrong_insertions) {
 //    ChFunctionInterp fun_table_noovr;
 //    fun_table_noovr.AddPoint(0.0, 2.7);
@@ -0,0 +1,161 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the ensemble runner. Members advanced concurrently must produce
+// the same results as when simulated sequentially.
+//
+// =============================================================================
+
+#include <atomic>
+#include <stdexcept>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChEnsembleRunner.h"
+
+using namespace chrono;
+
+// Shared (read-only) member data
+struct PendulumData {
+    double length;
+    double density;
+};
+
+// Pendulum with a member-specific initial angle and number of steps
+class PendulumMember : public utils::ChEnsembleMember {
+  public:
+    PendulumMember(double angle, int num_steps) : m_angle(angle), m_num_steps(num_steps), m_step(0) {}
+
+    virtual void Initialize(utils::ChEnsembleRunner& runner) override {
+        auto data = runner.GetAsset<PendulumData>("pendulum", []() {
+            num_loads++;
+            return chrono_types::make_shared<PendulumData>(PendulumData{1.0, 1000});
+        });
+        Create(*data);
+    }
+
+    virtual ChSystem* GetSystem() override { return m_sys.get(); }
+
+    virtual bool Advance() override {
+        m_sys->DoStepDynamics(1e-3);
+        return ++m_step < m_num_steps;
+    }
+
+    virtual void Finalize() override { m_pos = m_body->GetPos(); }
+
+    void Create(const PendulumData& data) {
+        m_sys = chrono_types::make_unique<ChSystemNSC>();
+        m_sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+
+        auto ground = chrono_types::make_shared<ChBody>();
+        ground->SetFixed(true);
+        m_sys->AddBody(ground);
+
+        ChVector3d dir(std::sin(m_angle), -std::cos(m_angle), 0);
+        m_body = chrono_types::make_shared<ChBodyEasyBox>(0.1, data.length, 0.1, data.density, false, false);
+        m_body->SetPos(0.5 * data.length * dir);
+        m_body->SetRot(QuatFromAngleZ(m_angle));
+        m_sys->AddBody(m_body);
+
+        auto rev = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev->Initialize(ground, m_body, ChFrame<>(ChVector3d(0, 0, 0), QUNIT));
+        m_sys->AddLink(rev);
+    }
+
+    const ChVector3d& GetResult() const { return m_pos; }
+
+    static std::atomic<int> num_loads;
+
+  private:
+    double m_angle;
+    int m_num_steps;
+    int m_step;
+    std::unique_ptr<ChSystemNSC> m_sys;
+    std::shared_ptr<ChBody> m_body;
+    ChVector3d m_pos;
+};
+
+std::atomic<int> PendulumMember::num_loads(0);
+
+// Member which fails during the simulation
+class FailingMember : public PendulumMember {
+  public:
+    FailingMember() : PendulumMember(0.5, 1000) {}
+    virtual bool Advance() override {
+        if (GetSystem()->GetChTime() > 0.05)
+            throw std::runtime_error("member failure");
+        return PendulumMember::Advance();
+    }
+};
+
+TEST(ChEnsembleRunner, concurrent) {
+    const int num_members = 16;
+
+    utils::ChEnsembleRunner runner(4);
+    runner.SetStepsPerTask(20);
+
+    std::vector<std::shared_ptr<PendulumMember>> members;
+    for (int i = 0; i < num_members; i++) {
+        // Members of different lengths, to exercise work stealing
+        auto member = chrono_types::make_shared<PendulumMember>(0.1 * (i + 1), 100 + 50 * (i % 5));
+        members.push_back(member);
+        runner.AddMember(member);
+    }
+
+    PendulumMember::num_loads = 0;
+    runner.Run();
+
+    ASSERT_EQ(runner.GetNumFailed(), 0u);
+    ASSERT_EQ(PendulumMember::num_loads, 1);
+    ASSERT_GT(runner.GetWallTime(), 0.0);
+    ASSERT_GT(runner.GetThroughput(), 0.0);
+
+    // Sequential reference
+    PendulumData data{1.0, 1000};
+    for (int i = 0; i < num_members; i++) {
+        const auto& stats = runner.GetMemberStats(i);
+        int num_steps = 100 + 50 * (i % 5);
+        ASSERT_EQ(stats.num_steps, (unsigned int)num_steps);
+        ASSERT_NEAR(stats.sim_time, num_steps * 1e-3, 1e-10);
+        ASSERT_GE(stats.worker, 0);
+
+        PendulumMember ref(0.1 * (i + 1), num_steps);
+        ref.Create(data);
+        while (ref.Advance()) {
+        }
+        ref.Finalize();
+
+        ASSERT_DOUBLE_EQ(members[i]->GetResult().x(), ref.GetResult().x());
+        ASSERT_DOUBLE_EQ(members[i]->GetResult().y(), ref.GetResult().y());
+    }
+}
+
+TEST(ChEnsembleRunner, failure) {
+    utils::ChEnsembleRunner runner(2);
+    runner.SetStepsPerTask(10);
+
+    runner.AddMember(chrono_types::make_shared<PendulumMember>(0.5, 200));
+    runner.AddMember(chrono_types::make_shared<FailingMember>());
+    runner.AddMember(chrono_types::make_shared<PendulumMember>(0.5, 200));
+    runner.Run();
+
+    ASSERT_EQ(runner.GetNumFailed(), 1u);
+    ASSERT_TRUE(runner.GetMemberStats(1).failed);
+    ASSERT_EQ(runner.GetMemberStats(1).error, "member failure");
+    ASSERT_FALSE(runner.GetMemberStats(0).failed);
+    ASSERT_EQ(runner.GetMemberStats(2).num_steps, 200u);
+}
@@ -0,0 +1,202 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the shared memory transport. Nodes are run on separate threads
+// of the test process, each with its own mapping of the shared segment.
+//
+// =============================================================================
+
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChSharedMemory.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+// Run the given function for each node on its own thread
+template <typename Function>
+static void RunNodes(int num_nodes, Function&& func) {
+    std::vector<std::thread> threads;
+    for (int node = 0; node < num_nodes; node++)
+        threads.emplace_back(func, node);
+    for (auto& t : threads)
+        t.join();
+}
+
+static std::string SegmentName(const std::string& test) {
+    return "chrono_utest_" + test + "_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed());
+}
+
+TEST(ChSharedMemoryTransport, ping_pong) {
+    const int num_steps = 1000;
+    std::string name = SegmentName("ping_pong");
+    std::vector<double> results(2, 0);
+
+    RunNodes(2, [&](int node) {
+        ChSharedMemoryTransport transport(name, node, 2, 1024);
+        double data[3];
+        for (int step = 0; step < num_steps; step++) {
+            if (node == 0) {
+                data[0] = step;
+                data[1] = 2.0 * step;
+                data[2] = 3.0 * step;
+                transport.Send(1, data, sizeof(data));
+                transport.Recv(1, data, sizeof(data));
+                results[0] += data[0] + data[1] + data[2];
+            } else {
+                transport.Recv(0, data, sizeof(data));
+                for (int i = 0; i < 3; i++)
+                    data[i] = -data[i];
+                transport.Send(0, data, sizeof(data));
+            }
+        }
+        transport.Barrier();
+    });
+
+    // sum over steps of -(1+2+3)*step
+    ASSERT_DOUBLE_EQ(results[0], -6.0 * num_steps * (num_steps - 1) / 2);
+}
+
+TEST(ChSharedMemoryTransport, wrap_around) {
+    // Variable size messages through a small ring buffer exercise padding and wrap around
+    const int num_msgs = 2000;
+    std::string name = SegmentName("wrap_around");
+    bool ok = true;
+
+    RunNodes(2, [&](int node) {
+        ChSharedMemoryTransport transport(name, node, 2, 256);
+        for (int k = 0; k < num_msgs; k++) {
+            int n = 1 + (k * 7) % 50;
+            if (node == 0) {
+                std::vector<int> msg(n);
+                std::iota(msg.begin(), msg.end(), k);
+                transport.Send(1, msg.data(), n * sizeof(int));
+            } else {
+                size_t size;
+                auto msg = static_cast<const int*>(transport.Peek(1 - node, size));
+                ok = ok && size == n * sizeof(int);
+                for (int i = 0; ok && i < n; i++)
+                    ok = msg[i] == k + i;
+                transport.Release(1 - node);
+            }
+        }
+        transport.Barrier();
+    });
+
+    ASSERT_TRUE(ok);
+}
+
+TEST(ChSharedMemoryTransport, all_to_all) {
+    const int num_nodes = 4;
+    std::string name = SegmentName("all_to_all");
+    std::vector<int> sums(num_nodes, 0);
+
+    RunNodes(num_nodes, [&](int node) {
+        ChSharedMemoryTransport transport(name, node, num_nodes);
+        for (int dest = 0; dest < num_nodes; dest++)
+            if (dest != node)
+                transport.Send(dest, &node, sizeof(int));
+        for (int source = 0; source < num_nodes; source++) {
+            if (source != node) {
+                int value;
+                transport.Recv(source, &value, sizeof(int));
+                sums[node] += value;
+            }
+        }
+        ASSERT_FALSE(transport.Probe((node + 1) % num_nodes));
+        transport.Barrier();
+    });
+
+    for (int node = 0; node < num_nodes; node++)
+        ASSERT_EQ(sums[node], num_nodes * (num_nodes - 1) / 2 - node);
+}
+
+TEST(ChSharedMemoryTransport, errors) {
+    std::string name = SegmentName("errors");
+
+    RunNodes(2, [&](int node) {
+        ChSharedMemoryTransport transport(name, node, 2, 128);
+        std::vector<char> big(256);
+        if (node == 0) {
+            ASSERT_THROW(transport.Send(1, big.data(), big.size()), std::runtime_error);
+            transport.Send(1, big.data(), 16);
+        } else {
+            ASSERT_THROW(transport.Recv(0, big.data(), 8), std::runtime_error);
+            size_t size;
+            transport.Peek(0, size);
+            ASSERT_EQ(size, (size_t)16);
+            transport.Release(0);
+        }
+        transport.Barrier();
+    });
+}
+
+TEST(ChSharedMemoryTransport, timeout) {
+    std::string name = SegmentName("timeout");
+
+    // Node 1 does not attach to a segment with a different key; node 0 times out waiting for node 1
+    RunNodes(2, [&](int node) {
+        uint64_t key = 1 + node;
+        ASSERT_THROW(ChSharedMemoryTransport(name, node, 2, 128, 0.2, key), std::runtime_error);
+    });
+
+    // Node 1 times out at a barrier not reached by node 0
+    RunNodes(2, [&](int node) {
+        ChSharedMemoryTransport transport(name, node, 2, 128, 0.2);
+        if (node == 1)
+            ASSERT_THROW(transport.Barrier(), std::runtime_error);
+    });
+}
+
+#ifndef _WIN32
+TEST(ChSharedMemoryTransport, stale_segment) {
+    std::string name = SegmentName("stale_segment");
+
+    // Leave behind an initialized segment, as a run which did not terminate cleanly would
+    pid_t pid = fork();
+    if (pid == 0) {
+        RunNodes(2, [&](int node) { new ChSharedMemoryTransport(name, node, 2, 128, 5, 1); });
+        _exit(0);
+    }
+    int status;
+    waitpid(pid, &status, 0);
+
+    // Node 1 starts first and must wait for node 0 to replace the stale segment
+    std::vector<int> values(2, 0);
+    RunNodes(2, [&](int node) {
+        if (node == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        ChSharedMemoryTransport transport(name, node, 2, 128, 5, 2);
+        int value = 10 + node;
+        transport.Send(1 - node, &value, sizeof(int));
+        transport.Recv(1 - node, &values[node], sizeof(int));
+        transport.Barrier();
+    });
+
+    ASSERT_EQ(values[0], 11);
+    ASSERT_EQ(values[1], 10);
+}
+#endif
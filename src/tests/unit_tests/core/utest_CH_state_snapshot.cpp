@@ -0,0 +1,220 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for binary system state snapshots (capture, restore, file I/O).
+// A simulation rolled back to a snapshot must reproduce the original trajectory.
+//
+// =============================================================================
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChStateSnapshot.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+
+// Double pendulum integrated with HHT (timestepper with internal state)
+static void CreatePendulum(ChSystemNSC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    sys.SetSolverType(ChSolver::Type::SPARSE_QR);
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxIters(20);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetStepControl(false);
+    integrator->SetModifiedNewton(false);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto link1 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    link1->SetPos(ChVector3d(0.5, 0, 0));
+    sys.AddBody(link1);
+
+    auto link2 = chrono_types::make_shared<ChBodyEasyBox>(1, 0.1, 0.1, 1000, false, false);
+    link2->SetPos(ChVector3d(1.5, 0, 0));
+    sys.AddBody(link2);
+
+    auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev1->Initialize(ground, link1, ChFrame<>(ChVector3d(0, 0, 0), QUNIT));
+    sys.AddLink(rev1);
+
+    auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+    rev2->Initialize(link1, link2, ChFrame<>(ChVector3d(1, 0, 0), QUNIT));
+    sys.AddLink(rev2);
+}
+
+// Spheres dropped on a plate (NSC contact)
+static void CreateBalls(ChSystemNSC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(4, 4, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < 4; i++) {
+        auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.1, 1000, false, true, mat);
+        ball->SetPos(ChVector3d(0.05 * i, 0.2 * i, 0.15 + 0.25 * i));
+        sys.AddBody(ball);
+    }
+}
+
+static std::vector<ChVector3d> Simulate(ChSystemNSC& sys, int num_steps, double step) {
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step);
+
+    std::vector<ChVector3d> pos;
+    for (const auto& body : sys.GetBodies())
+        pos.push_back(body->GetPos());
+    return pos;
+}
+
+static void CheckEqual(const std::vector<ChVector3d>& a, const std::vector<ChVector3d>& b, double tol) {
+    ASSERT_EQ(a.size(), b.size());
+    for (size_t i = 0; i < a.size(); i++) {
+        ASSERT_NEAR(a[i].x(), b[i].x(), tol);
+        ASSERT_NEAR(a[i].y(), b[i].y(), tol);
+        ASSERT_NEAR(a[i].z(), b[i].z(), tol);
+    }
+}
+
+TEST(ChStateSnapshot, rollback_hht) {
+    ChSystemNSC sys;
+    CreatePendulum(sys);
+    Simulate(sys, 200, 1e-3);
+
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(sys);
+    ASSERT_DOUBLE_EQ(snapshot.GetTime(), sys.GetChTime());
+
+    auto pos1 = Simulate(sys, 200, 1e-3);
+
+    ASSERT_TRUE(snapshot.Restore(sys));
+    ASSERT_DOUBLE_EQ(sys.GetChTime(), snapshot.GetTime());
+    auto pos2 = Simulate(sys, 200, 1e-3);
+
+    CheckEqual(pos1, pos2, 1e-10);
+}
+
+TEST(ChStateSnapshot, rollback_contact) {
+    ChSystemNSC sys;
+    CreateBalls(sys);
+    Simulate(sys, 300, 1e-3);
+
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(sys);
+
+    auto pos1 = Simulate(sys, 300, 1e-3);
+
+    ASSERT_TRUE(snapshot.Restore(sys));
+    auto pos2 = Simulate(sys, 300, 1e-3);
+
+    CheckEqual(pos1, pos2, 1e-6);
+}
+
+TEST(ChStateSnapshot, file) {
+    const std::string out_dir = GetChronoOutputPath() + "UTEST_STATE_SNAPSHOT";
+    ASSERT_TRUE(filesystem::create_directory(filesystem::path(out_dir)));
+    const std::string filename = out_dir + "/pendulum.snap";
+
+    ChSystemNSC sys1;
+    CreatePendulum(sys1);
+    Simulate(sys1, 200, 1e-3);
+
+    utils::ChStateSnapshot snapshot1;
+    snapshot1.Capture(sys1);
+    ASSERT_TRUE(snapshot1.Write(filename));
+    ASSERT_EQ((size_t)filesystem::path(filename).file_size(), snapshot1.GetFileSize());
+
+    auto pos1 = Simulate(sys1, 200, 1e-3);
+
+    // Restore into a new system with the same structure
+    ChSystemNSC sys2;
+    CreatePendulum(sys2);
+    sys2.DoStepDynamics(1e-3);
+
+    utils::ChStateSnapshot snapshot2;
+    ASSERT_TRUE(snapshot2.Read(filename));
+    ASSERT_TRUE(snapshot2.Restore(sys2));
+    auto pos2 = Simulate(sys2, 200, 1e-3);
+
+    CheckEqual(pos1, pos2, 1e-10);
+
+    // A system with a different structure is rejected
+    ChSystemNSC sys3;
+    CreateBalls(sys3);
+    ASSERT_FALSE(snapshot2.IsCompatible(sys3));
+    ASSERT_FALSE(snapshot2.Restore(sys3));
+}
+
+TEST(ChStateSnapshot, file_corrupt) {
+    const std::string out_dir = GetChronoOutputPath() + "UTEST_STATE_SNAPSHOT";
+    filesystem::create_directory(filesystem::path(out_dir));
+    const std::string filename = out_dir + "/corrupt.snap";
+
+    ChSystemNSC sys;
+    CreatePendulum(sys);
+    Simulate(sys, 10, 1e-3);
+
+    utils::ChStateSnapshot snapshot;
+    snapshot.Capture(sys);
+    ASSERT_TRUE(snapshot.Write(filename));
+
+    std::vector<char> bytes(snapshot.GetFileSize());
+    {
+        std::ifstream ifile(filename, std::ios::binary);
+        ifile.read(bytes.data(), bytes.size());
+    }
+
+    // Truncated file (missing the last reaction)
+    {
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(bytes.data(), bytes.size() - sizeof(double));
+    }
+    utils::ChStateSnapshot snapshot2;
+    ASSERT_FALSE(snapshot2.Read(filename));
+
+    // Corrupt header announcing a huge number of position coordinates (first counter after magic, version, and the
+    // five item counts); this must be rejected without attempting the allocation
+    {
+        auto corrupt = bytes;
+        uint64_t huge = uint64_t(1) << 60;
+        std::memcpy(corrupt.data() + 8 + 8 + 5 * 8, &huge, sizeof(huge));
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(corrupt.data(), corrupt.size());
+    }
+    ASSERT_FALSE(snapshot2.Read(filename));
+
+    // The original file is accepted
+    {
+        std::ofstream ofile(filename, std::ios::binary);
+        ofile.write(bytes.data(), bytes.size());
+    }
+    ASSERT_TRUE(snapshot2.Read(filename));
+    ASSERT_TRUE(snapshot2.Restore(sys));
+}
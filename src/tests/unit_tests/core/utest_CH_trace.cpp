@@ -0,0 +1,185 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for timeline tracing and Chrome trace export.
+//
+// =============================================================================
+
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChTrace.h"
+
+#include "chrono_thirdparty/rapidjson/document.h"
+
+using namespace chrono;
+using namespace chrono::utils;
+
+static void Work(int n) {
+    volatile double x = 0;
+    for (int i = 0; i < n; i++)
+        x = x + 1e-3 * i;
+}
+
+static rapidjson::Document Export() {
+    std::stringstream stream;
+    ChTraceManager::WriteChromeTrace(stream);
+    rapidjson::Document d;
+    d.Parse<0>(stream.str().c_str());
+    return d;
+}
+
+TEST(ChTraceManager, disabled) {
+    ChTraceManager::Enable(false);
+    ChTraceManager::Clear();
+    {
+        CH_TRACE("Ignored");
+        Work(100);
+    }
+    ASSERT_EQ(ChTraceManager::GetNumZones(), (size_t)0);
+}
+
+TEST(ChTraceManager, nested_zones) {
+    ChTraceManager::SetCapacity(1024);
+    ChTraceManager::Clear();
+    ChTraceManager::Enable(true);
+    ChTraceManager::SetThreadName("Main \"thread\"");
+
+    for (int step = 0; step < 3; step++) {
+        CH_TRACE("Step");
+        {
+            CH_TRACE("Collision");
+            Work(1000);
+        }
+        {
+            CH_TRACE("Solve");
+            Work(1000);
+        }
+    }
+    ChTraceManager::Enable(false);
+
+    ASSERT_EQ(ChTraceManager::GetNumZones(), (size_t)9);
+
+    auto d = Export();
+    ASSERT_FALSE(d.HasParseError());
+    ASSERT_TRUE(d.HasMember("traceEvents"));
+    const auto& events = d["traceEvents"];
+
+    // Collect the complete events of the main thread
+    int tid = -1;
+    std::vector<const rapidjson::Value*> zones;
+    for (auto& e : events.GetArray()) {
+        if (std::string(e["ph"].GetString()) == "M" && std::string(e["args"]["name"].GetString()) == "Main \"thread\"")
+            tid = e["tid"].GetInt();
+    }
+    ASSERT_GE(tid, 0);
+    for (auto& e : events.GetArray()) {
+        if (std::string(e["ph"].GetString()) == "X" && e["tid"].GetInt() == tid)
+            zones.push_back(&e);
+    }
+    ASSERT_EQ(zones.size(), (size_t)9);
+
+    // Zones are recorded at exit, so each step is preceded by its two children, which it must contain
+    for (int step = 0; step < 3; step++) {
+        const auto& collision = *zones[3 * step + 0];
+        const auto& solve = *zones[3 * step + 1];
+        const auto& parent = *zones[3 * step + 2];
+        ASSERT_STREQ(collision["name"].GetString(), "Collision");
+        ASSERT_STREQ(solve["name"].GetString(), "Solve");
+        ASSERT_STREQ(parent["name"].GetString(), "Step");
+
+        double begin = parent["ts"].GetDouble();
+        double end = begin + parent["dur"].GetDouble();
+        ASSERT_LE(begin, collision["ts"].GetDouble());
+        ASSERT_LE(collision["ts"].GetDouble() + collision["dur"].GetDouble(), solve["ts"].GetDouble());
+        ASSERT_LE(solve["ts"].GetDouble() + solve["dur"].GetDouble(), end + 1e-3);
+    }
+}
+
+TEST(ChTraceManager, threads) {
+    const int num_threads = 4;
+    const int num_zones = 100;
+
+    ChTraceManager::SetCapacity(1024);
+    ChTraceManager::Clear();
+    ChTraceManager::Enable(true);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; t++) {
+        threads.emplace_back([t]() {
+            ChTraceManager::SetThreadName("Worker " + std::to_string(t));
+            for (int i = 0; i < num_zones; i++) {
+                CH_TRACE("Task");
+                Work(100 * (t + 1));
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+    ChTraceManager::Enable(false);
+
+    auto d = Export();
+    ASSERT_FALSE(d.HasParseError());
+
+    // Count zones per named worker thread
+    std::map<int, std::string> names;
+    std::map<int, int> counts;
+    for (auto& e : d["traceEvents"].GetArray()) {
+        if (std::string(e["ph"].GetString()) == "M")
+            names[e["tid"].GetInt()] = e["args"]["name"].GetString();
+        else
+            counts[e["tid"].GetInt()]++;
+    }
+
+    int num_workers = 0;
+    for (const auto& n : names) {
+        if (n.second.rfind("Worker ", 0) == 0) {
+            ASSERT_EQ(counts[n.first], num_zones);
+            num_workers++;
+        }
+    }
+    ASSERT_EQ(num_workers, num_threads);
+}
+
+TEST(ChTraceManager, ring_buffer) {
+    // A thread recording more zones than the capacity keeps only the most recent ones
+    ChTraceManager::SetCapacity(16);
+    ChTraceManager::Clear();
+    ChTraceManager::Enable(true);
+
+    std::thread thread([]() {
+        for (int i = 0; i < 40; i++) {
+            CH_TRACE("Zone");
+        }
+    });
+    thread.join();
+    {
+        CH_TRACE("Zone");
+    }
+    ChTraceManager::Enable(false);
+
+    ASSERT_EQ(ChTraceManager::GetNumDroppedZones(), (size_t)24);
+
+    auto d = Export();
+    ASSERT_FALSE(d.HasParseError());
+    ASSERT_EQ(d["otherData"]["dropped_zones"].GetInt(), 24);
+
+    ChTraceManager::SetCapacity(65536);
+    ChTraceManager::Clear();
+}
@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the batched evaluation of ANCF element internal forces.
+// The generalized internal forces of meshes of ANCF 3333 beam elements and ANCF
+// 3843 brick elements, in a deformed configuration and with non-zero nodal
+// velocities, are compared against the element-by-element evaluation, also
+// after changing the material of some elements once the batches were created.
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementBeamANCF_3333.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a mesh of N ANCF 3333 beam elements.
+// The last element uses a different material and the second to last element uses the "Pre-Integration" method, so
+// that the mesh contains both batched and individually evaluated elements.
+static std::shared_ptr<ChMesh> CreateBeamMesh(ChSystem& sys, int N) {
+    double length = 1.0;
+    double width = 0.02;
+    double thickness = 0.01;
+
+    auto mat1 = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 2.1e8, 0.3, 0.85, 0.85);
+    auto mat2 = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 1.0e8, 0.2, 0.85, 0.85);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double dx = length / (2 * N);
+    ChVector3d dir1(0, 1, 0);
+    ChVector3d dir2(0, 0, 1);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(0, 0, 0), dir1, dir2);
+    nodeA->SetFixed(true);
+    mesh->AddNode(nodeA);
+
+    for (int i = 1; i <= N; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(dx * (2 * i - 1), 0, 0), dir1, dir2);
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector3d(dx * (2 * i), 0, 0), dir1, dir2);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeB);
+
+        auto element = chrono_types::make_shared<ChElementBeamANCF_3333>();
+        element->SetNodes(nodeA, nodeB, nodeC);
+        element->SetDimensions(2 * dx, thickness, width);
+        element->SetMaterial(i == N ? mat2 : mat1);
+        element->SetAlphaDamp(0.01);
+        if (i == N - 1)
+            element->SetIntFrcCalcMethod(ChElementBeamANCF_3333::IntFrcMethod::PreInt);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+    }
+
+    return mesh;
+}
+
+// Create a mesh of Nx x Ny ANCF 3843 brick elements (one element through the thickness).
+static std::shared_ptr<ChMesh> CreateBrickMesh(ChSystem& sys, int Nx, int Ny) {
+    double length = 0.6;
+    double width = 0.3;
+    double thickness = 0.01;
+
+    auto mat = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 1.0e5, 0.3);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double dx = length / Nx;
+    double dy = width / Ny;
+    ChVector3d dir1(1, 0, 0);
+    ChVector3d dir2(0, 1, 0);
+    ChVector3d dir3(0, 0, 1);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+    for (int i = 0; i <= Nx; i++) {
+        for (int j = 0; j <= Ny; j++) {
+            for (int k = 0; k <= 1; k++) {
+                ChVector3d pos(dx * i, dy * j, thickness * k);
+                auto node = chrono_types::make_shared<ChNodeFEAxyzDDD>(pos, dir1, dir2, dir3);
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    auto node = [&](int i, int j, int k) { return nodes[2 * (i * (Ny + 1) + j) + k]; };
+    for (int i = 0; i < Nx; i++) {
+        for (int j = 0; j < Ny; j++) {
+            auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+            element->SetNodes(node(i, j, 0), node(i + 1, j, 0), node(i + 1, j + 1, 0), node(i, j + 1, 0),
+                              node(i, j, 1), node(i + 1, j, 1), node(i + 1, j + 1, 1), node(i, j + 1, 1));
+            element->SetDimensions(dx, dy, thickness);
+            element->SetMaterial(mat);
+            element->SetAlphaDamp(0.01);
+            mesh->AddElement(element);
+        }
+    }
+
+    return mesh;
+}
+
+// Return the generalized forces at the current system state.
+static ChVectorDynamic<> LoadForces(ChSystem& sys) {
+    ChVectorDynamic<> R(sys.GetNumCoordsVelLevel());
+    R.setZero();
+    sys.LoadResidual_F(R, 1.0);
+    return R;
+}
+
+// Perturb the system state (from its reference configuration) and return the generalized forces.
+static ChVectorDynamic<> PerturbAndLoadForces(ChSystem& sys) {
+    // the first update performs the initial setup of the nodes (number of active coordinates) and elements
+    sys.Update();
+    sys.Setup();
+
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    double T;
+    sys.StateGather(x, v, T);
+    for (int i = 0; i < x.size(); i++) {
+        x(i) += 1e-3 * std::sin(0.7 * i);
+        v(i) += 1e-1 * std::cos(1.3 * i);
+    }
+    sys.StateScatter(x, v, T, true);
+
+    return LoadForces(sys);
+}
+
+static void CompareForces(const ChVectorDynamic<>& R, const ChVectorDynamic<>& R_ref) {
+    ASSERT_EQ(R.size(), R_ref.size());
+    double tol = 1e-10 * R_ref.lpNorm<Eigen::Infinity>();
+    for (int i = 0; i < R.size(); i++) {
+        ASSERT_NEAR(R(i), R_ref(i), tol);
+    }
+}
+
+TEST(ChElementANCFBatch, beam_3333) {
+    const int N = 11;
+
+    ChSystemSMC sys_ref;
+    CreateBeamMesh(sys_ref, N);
+    auto R_ref = PerturbAndLoadForces(sys_ref);
+
+    for (bool coloring : {false, true}) {
+        ChSystemSMC sys;
+        auto mesh = CreateBeamMesh(sys, N);
+        mesh->SetElementColoring(coloring);
+        mesh->SetElementBatching(true);
+        auto R = PerturbAndLoadForces(sys);
+
+        // one batch for each material
+        ASSERT_EQ(mesh->GetNumElementBatches(), 2);
+        CompareForces(R, R_ref);
+    }
+}
+
+TEST(ChElementANCFBatch, hexa_3843) {
+    ChSystemSMC sys_ref;
+    CreateBrickMesh(sys_ref, 5, 3);
+    auto R_ref = PerturbAndLoadForces(sys_ref);
+
+    ChSystemSMC sys;
+    auto mesh = CreateBrickMesh(sys, 5, 3);
+    mesh->SetElementBatching(true);
+    auto R = PerturbAndLoadForces(sys);
+
+    ASSERT_EQ(mesh->GetNumElementBatches(), 1);
+    CompareForces(R, R_ref);
+}
+
+TEST(ChElementANCFBatch, beam_3333_set_material) {
+    const int N = 11;
+    auto mat3 = chrono_types::make_shared<ChMaterialBeamANCF>(7850, 3.0e8, 0.25, 0.85, 0.85);
+
+    ChSystemSMC sys_ref;
+    auto mesh_ref = CreateBeamMesh(sys_ref, N);
+    PerturbAndLoadForces(sys_ref);
+
+    ChSystemSMC sys;
+    auto mesh = CreateBeamMesh(sys, N);
+    mesh->SetElementBatching(true);
+    PerturbAndLoadForces(sys);
+    ASSERT_EQ(mesh->GetNumElementBatches(), 2);
+
+    // Change the material of elements which were batched with the first material
+    for (int ie : {2, 5}) {
+        std::static_pointer_cast<ChElementBeamANCF_3333>(mesh_ref->GetElement(ie))->SetMaterial(mat3);
+        std::static_pointer_cast<ChElementBeamANCF_3333>(mesh->GetElement(ie))->SetMaterial(mat3);
+    }
+    auto R_ref = LoadForces(sys_ref);
+    auto R = LoadForces(sys);
+
+    // the batches must have been rebuilt, with one batch for each material
+    ASSERT_EQ(mesh->GetNumElementBatches(), 3);
+    CompareForces(R, R_ref);
+}
+
+TEST(ChElementANCFBatch, hexa_3843_set_material) {
+    auto mat2 = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 2.0e5, 0.25);
+
+    ChSystemSMC sys_ref;
+    auto mesh_ref = CreateBrickMesh(sys_ref, 5, 3);
+    PerturbAndLoadForces(sys_ref);
+
+    ChSystemSMC sys;
+    auto mesh = CreateBrickMesh(sys, 5, 3);
+    mesh->SetElementBatching(true);
+    PerturbAndLoadForces(sys);
+    ASSERT_EQ(mesh->GetNumElementBatches(), 1);
+
+    // Change the material of one element
+    std::static_pointer_cast<ChElementHexaANCF_3843>(mesh_ref->GetElement(7))->SetMaterial(mat2);
+    std::static_pointer_cast<ChElementHexaANCF_3843>(mesh->GetElement(7))->SetMaterial(mat2);
+    auto R_ref = LoadForces(sys_ref);
+    auto R = LoadForces(sys);
+
+    ASSERT_EQ(mesh->GetNumElementBatches(), 2);
+    CompareForces(R, R_ref);
+}
@@ -0,0 +1,168 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the colored parallel assembly of ChMesh element forces.
+// For a mesh of ANCF 3843 brick elements sharing nodes (up to 8 elements per
+// node), in a deformed configuration and with non-zero nodal velocities, the
+// generalized forces (internal and gravity) and the stiffness and damping
+// matrices obtained with the colored parallel assembly must match those
+// obtained with the default parallel assembly (atomic updates) and with a
+// single thread.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChElementHexaANCF_3843.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Generalized forces and Jacobians of the system
+struct Results {
+    ChVectorDynamic<> F;
+    ChMatrixDynamic<> K;
+    ChMatrixDynamic<> R;
+};
+
+// System which exposes the loading of its variables in the system descriptor, needed to extract the system Jacobians.
+class TestSystem : public ChSystemSMC {
+  public:
+    using ChSystemSMC::DescriptorPrepareInject;
+};
+
+// Create a mesh of Nx x Ny x Nz ANCF 3843 brick elements, perturb its state, and evaluate the generalized forces and
+// the stiffness and damping matrices with the specified number of threads and assembly mode.
+static Results Evaluate(int num_threads, bool coloring, unsigned int& num_colors) {
+    const int Nx = 4;
+    const int Ny = 3;
+    const int Nz = 2;
+    const double dx = 0.1;
+    const double dy = 0.1;
+    const double dz = 0.05;
+
+    TestSystem sys;
+    sys.SetNumThreads(num_threads);
+
+    auto mat = chrono_types::make_shared<ChMaterialHexaANCF>(7810, 1.0e7, 0.3);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetElementColoring(coloring);
+    sys.Add(mesh);
+
+    ChVector3d dir1(1, 0, 0);
+    ChVector3d dir2(0, 1, 0);
+    ChVector3d dir3(0, 0, 1);
+
+    std::vector<std::shared_ptr<ChNodeFEAxyzDDD>> nodes;
+    for (int i = 0; i <= Nx; i++) {
+        for (int j = 0; j <= Ny; j++) {
+            for (int k = 0; k <= Nz; k++) {
+                auto node = chrono_types::make_shared<ChNodeFEAxyzDDD>(ChVector3d(dx * i, dy * j, dz * k), dir1, dir2,
+                                                                       dir3);
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+    }
+
+    auto node = [&](int i, int j, int k) { return nodes[(i * (Ny + 1) + j) * (Nz + 1) + k]; };
+    for (int i = 0; i < Nx; i++) {
+        for (int j = 0; j < Ny; j++) {
+            for (int k = 0; k < Nz; k++) {
+                auto element = chrono_types::make_shared<ChElementHexaANCF_3843>();
+                element->SetNodes(node(i, j, k), node(i + 1, j, k), node(i + 1, j + 1, k), node(i, j + 1, k),
+                                  node(i, j, k + 1), node(i + 1, j, k + 1), node(i + 1, j + 1, k + 1),
+                                  node(i, j + 1, k + 1));
+                element->SetDimensions(dx, dy, dz);
+                element->SetMaterial(mat);
+                element->SetAlphaDamp(0.01);
+                mesh->AddElement(element);
+            }
+        }
+    }
+
+    // the first update performs the initial setup of the nodes (number of active coordinates) and elements
+    sys.Update();
+    sys.Setup();
+
+    ChState x(sys.GetNumCoordsPosLevel(), &sys);
+    ChStateDelta v(sys.GetNumCoordsVelLevel(), &sys);
+    double T;
+    sys.StateGather(x, v, T);
+    for (int i = 0; i < x.size(); i++) {
+        x(i) += 1e-3 * std::sin(0.7 * i);
+        v(i) += 1e-1 * std::cos(1.3 * i);
+    }
+    sys.StateScatter(x, v, T, true);
+
+    Results results;
+    results.F.setZero(sys.GetNumCoordsVelLevel());
+    sys.LoadResidual_F(results.F, 1.0);
+    num_colors = mesh->GetNumElementColors();
+
+    sys.DescriptorPrepareInject(*sys.GetSystemDescriptor());
+    ChSparseMatrix K;
+    ChSparseMatrix R;
+    sys.GetStiffnessMatrix(K);
+    sys.GetDampingMatrix(R);
+    results.K = K;
+    results.R = R;
+
+    return results;
+}
+
+// Contributions of different elements to a shared node are summed in a different order, so results may differ at the
+// level of round-off errors.
+static void Compare(const Results& res, const Results& res_ref) {
+    ASSERT_EQ(res.F.size(), res_ref.F.size());
+    double tol_F = 1e-12 * res_ref.F.lpNorm<Eigen::Infinity>();
+    for (int i = 0; i < res.F.size(); i++)
+        ASSERT_NEAR(res.F(i), res_ref.F(i), tol_F) << "F(" << i << ")";
+
+    ASSERT_EQ(res.K.rows(), res_ref.K.rows());
+    ASSERT_EQ(res.K.cols(), res_ref.K.cols());
+    double tol_K = 1e-12 * res_ref.K.lpNorm<Eigen::Infinity>();
+    ASSERT_LE((res.K - res_ref.K).lpNorm<Eigen::Infinity>(), tol_K);
+
+    ASSERT_EQ(res.R.rows(), res_ref.R.rows());
+    ASSERT_EQ(res.R.cols(), res_ref.R.cols());
+    double tol_R = 1e-12 * res_ref.R.lpNorm<Eigen::Infinity>();
+    ASSERT_LE((res.R - res_ref.R).lpNorm<Eigen::Infinity>(), tol_R);
+}
+
+TEST(ChMesh, colored_assembly) {
+    unsigned int num_colors;
+
+    auto res_serial = Evaluate(1, false, num_colors);
+    ASSERT_GT(res_serial.F.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_GT(res_serial.K.lpNorm<Eigen::Infinity>(), 0);
+    ASSERT_GT(res_serial.R.lpNorm<Eigen::Infinity>(), 0);
+
+    auto res_atomic = Evaluate(4, false, num_colors);
+    ASSERT_EQ(num_colors, 0);
+
+    auto res_colored = Evaluate(4, true, num_colors);
+    // interior nodes are shared by 8 elements, so at least 8 colors are needed
+    ASSERT_GE(num_colors, 8);
+
+    Compare(res_atomic, res_serial);
+    Compare(res_colored, res_serial);
+    Compare(res_colored, res_atomic);
+}
@@ -0,0 +1,159 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the matrix-free Krylov solvers with block-Jacobi preconditioning.
+// Results for an ANCF shell cantilever are compared against a direct sparse
+// solver (static and dynamic analysis).
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChIterativeSolverLS.h"
+#include "chrono/fea/ChElementShellANCF_3423.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// Create a cantilever plate with N ANCF shell elements and return its tip node.
+// The plate is not aligned with the global axes, so that nodal diagonal blocks are not diagonal.
+static std::shared_ptr<ChNodeFEAxyzD> CreateCantilever(ChSystem& sys, int N) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.8, 0));
+    ChMatrix33<> R(QuatFromAngleAxis(CH_PI / 5, ChVector3d(1, 2, 3).GetNormalized()));
+
+    double length = 1;
+    double width = 0.1;
+    double thickness = 0.01;
+
+    double rho = 500;
+    ChVector3d E(2.1e7, 2.1e7, 2.1e7);
+    ChVector3d nu(0.3, 0.3, 0.3);
+    ChVector3d G(8.0769231e6, 8.0769231e6, 8.0769231e6);
+    auto mat = chrono_types::make_shared<ChMaterialShellANCF>(rho, E, nu, G);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double dx = length / N;
+    ChVector3d dir = R * ChVector3d(0, 1, 0);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzD>(R * ChVector3d(0, 0, -width / 2), dir);
+    auto nodeB = chrono_types::make_shared<ChNodeFEAxyzD>(R * ChVector3d(0, 0, +width / 2), dir);
+    nodeA->SetFixed(true);
+    nodeB->SetFixed(true);
+    mesh->AddNode(nodeA);
+    mesh->AddNode(nodeB);
+
+    for (int i = 1; i <= N; i++) {
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzD>(R * ChVector3d(i * dx, 0, -width / 2), dir);
+        auto nodeD = chrono_types::make_shared<ChNodeFEAxyzD>(R * ChVector3d(i * dx, 0, +width / 2), dir);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeD);
+
+        auto element = chrono_types::make_shared<ChElementShellANCF_3423>();
+        element->SetNodes(nodeA, nodeB, nodeD, nodeC);
+        element->SetDimensions(dx, width);
+        element->AddLayer(thickness, 0 * CH_DEG_TO_RAD, mat);
+        element->SetAlphaDamp(0.0);
+        mesh->AddElement(element);
+
+        nodeA = nodeC;
+        nodeB = nodeD;
+    }
+
+    return nodeA;
+}
+
+static std::shared_ptr<ChIterativeSolverLS> CreateKrylovSolver(ChSolver::Type type, bool block_precond) {
+    std::shared_ptr<ChIterativeSolverLS> solver;
+    if (type == ChSolver::Type::GMRES)
+        solver = chrono_types::make_shared<ChSolverGMRES>();
+    else
+        solver = chrono_types::make_shared<ChSolverMINRES>();
+    solver->SetMaxIterations(5000);
+    solver->SetTolerance(1e-12);
+    solver->EnableDiagonalPreconditioner(true);
+    solver->EnableBlockJacobiPreconditioner(block_precond);
+    return solver;
+}
+
+TEST(ChIterativeSolverLS, static_MINRES) {
+    const int N = 20;
+
+    // Reference solution with a direct sparse solver
+    ChSystemSMC sys_ref;
+    auto tip_ref = CreateCantilever(sys_ref, N);
+    sys_ref.SetSolver(chrono_types::make_shared<ChSolverSparseQR>());
+    sys_ref.DoStaticLinear();
+
+    // Krylov solver with diagonal and block-Jacobi preconditioning
+    int iterations[2];
+    for (int k = 0; k < 2; k++) {
+        ChSystemSMC sys;
+        auto tip = CreateCantilever(sys, N);
+        auto solver = CreateKrylovSolver(ChSolver::Type::MINRES, k == 1);
+        sys.SetSolver(solver);
+        sys.DoStaticLinear();
+        iterations[k] = solver->GetIterations();
+
+        double tol = 1e-6 * tip_ref->GetPos().Length();
+        ASSERT_NEAR(tip->GetPos().x(), tip_ref->GetPos().x(), tol);
+        ASSERT_NEAR(tip->GetPos().y(), tip_ref->GetPos().y(), tol);
+        ASSERT_NEAR(tip->GetPos().z(), tip_ref->GetPos().z(), tol);
+    }
+
+    std::cout << "MINRES iterations (diagonal / block-Jacobi): " << iterations[0] << " / " << iterations[1]
+              << std::endl;
+    ASSERT_LT(iterations[1], iterations[0]);
+}
+
+TEST(ChIterativeSolverLS, dynamic_GMRES) {
+    const int N = 20;
+    const double step = 1e-3;
+    const int num_steps = 50;
+
+    // Reference solution with a direct sparse solver
+    ChSystemSMC sys_ref;
+    auto tip_ref = CreateCantilever(sys_ref, N);
+    sys_ref.SetSolver(chrono_types::make_shared<ChSolverSparseLU>());
+    sys_ref.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+    for (int i = 0; i < num_steps; i++)
+        sys_ref.DoStepDynamics(step);
+
+    // Krylov solver with diagonal and block-Jacobi preconditioning
+    int iterations[2] = {0, 0};
+    for (int k = 0; k < 2; k++) {
+        ChSystemSMC sys;
+        auto tip = CreateCantilever(sys, N);
+        auto solver = CreateKrylovSolver(ChSolver::Type::GMRES, k == 1);
+        sys.SetSolver(solver);
+        sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+        for (int i = 0; i < num_steps; i++) {
+            sys.DoStepDynamics(step);
+            iterations[k] += solver->GetIterations();
+        }
+
+        ASSERT_NEAR(tip->GetPos().x(), tip_ref->GetPos().x(), 1e-8);
+        ASSERT_NEAR(tip->GetPos().y(), tip_ref->GetPos().y(), 1e-8);
+        ASSERT_NEAR(tip->GetPos().z(), tip_ref->GetPos().z(), 1e-8);
+        ASSERT_NEAR(tip->GetPosDt().y(), tip_ref->GetPosDt().y(), 1e-6);
+    }
+
+    std::cout << "GMRES iterations (diagonal / block-Jacobi): " << iterations[0] << " / " << iterations[1]
+              << std::endl;
+    ASSERT_LE(iterations[1], iterations[0]);
+}
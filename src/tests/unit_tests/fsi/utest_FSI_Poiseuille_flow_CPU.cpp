@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the CPU (OpenMP) version of the explicit WCSPH solver
+// (Chrono::FSI built with USE_FSI_CPU).
+// A Poiseuille flow is simulated with 1 and with 4 threads:
+// - at each step, the fluid velocity must match the analytical solution;
+// - the results must not depend on the number of threads.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+
+#include "chrono_fsi/ChSystemFsi.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fsi;
+
+// Relative tolerance on the fluid velocity (same as the CUDA version of this test)
+const double rel_tol = 1.0e-2;
+
+// Dimensions of the computational domain
+const double bxDim = 0.2;
+const double byDim = 0.1;
+const double bzDim = 0.2;
+
+const int num_steps = 200;
+
+// Analytical solution of the Poiseuille flow
+static double PoiseuilleAnalytical(double Z, double L, double time, ChSystemFsi& sysFSI) {
+    double nu = sysFSI.GetViscosity() / sysFSI.GetDensity();
+    double F = sysFSI.GetBodyForce().x();
+    double initSpace0 = sysFSI.GetInitialSpacing();
+
+    double L_modify = L + initSpace0;
+    double Z_modify = Z + 0.5 * initSpace0;
+
+    double theory = 1.0 / (2.0 * nu) * F * Z_modify * (L_modify - Z_modify);
+
+    for (int n = 0; n < 50; n++) {
+        double k = 2 * n + 1;
+        theory -= 4.0 * F * L_modify * L_modify / (nu * std::pow(CH_PI * k, 3)) *
+                  std::sin(CH_PI * Z_modify * k / L_modify) *
+                  std::exp(-std::pow(CH_PI * k / L_modify, 2) * nu * time);
+    }
+
+    return theory;
+}
+
+// Simulate the Poiseuille flow with the specified number of threads and return the final fluid particle velocities.
+// Check the relative velocity error at each step.
+static std::vector<ChVector3d> Simulate(int num_threads) {
+    ChSystemSMC sysMBS;
+    ChSystemFsi sysFSI(&sysMBS);
+    sysFSI.SetVerbose(false);
+
+    sysFSI.ReadParametersFromFile(GetChronoDataFile("fsi/input_json/demo_FSI_Poiseuille_flow_Explicit.json"));
+    sysFSI.SetNumThreads(num_threads);
+
+    // Periodic boundary conditions in X and Y
+    auto initSpace0 = sysFSI.GetInitialSpacing();
+    ChVector3d cMin(-bxDim / 2 - initSpace0 / 2, -byDim / 2 - initSpace0 / 2, -10.0 * initSpace0);
+    ChVector3d cMax(bxDim / 2 + initSpace0 / 2, byDim / 2 + initSpace0 / 2, bzDim + 10.0 * initSpace0);
+    sysFSI.SetBoundaries(cMin, cMax);
+
+    // Fluid particles, initialized with the analytical velocity at t = 0.5
+    chrono::utils::ChGridSampler<> sampler(initSpace0);
+    std::vector<ChVector3d> points =
+        sampler.SampleBox(ChVector3d(0, 0, bzDim / 2), ChVector3d(bxDim / 2, byDim / 2, bzDim / 2));
+    size_t num_part = points.size();
+    for (size_t i = 0; i < num_part; i++) {
+        double v_x = PoiseuilleAnalytical(points[i].z(), bzDim, 0.5, sysFSI);
+        sysFSI.AddSPHParticle(points[i], ChVector3d(v_x, 0.0, 0.0));
+    }
+
+    // Bottom and top walls
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetFixed(true);
+    sysMBS.AddBody(body);
+    sysFSI.AddBoxContainerBCE(body,                                           //
+                              ChFrame<>(ChVector3d(0, 0, bzDim / 2), QUNIT),  //
+                              ChVector3d(bxDim, byDim, bzDim),                //
+                              ChVector3i(0, 0, 2));
+
+    sysFSI.Initialize();
+
+    double time = 0;
+    std::vector<ChVector3d> vel;
+    for (int step = 0; step <= num_steps; step++) {
+        sysFSI.DoStepDynamics_FSI();
+        time += sysFSI.GetStepSize();
+
+        auto pos = sysFSI.GetParticlePositions();
+        vel = sysFSI.GetParticleVelocities();
+
+        double error = 0;
+        double abs_val = 0;
+        for (size_t i = 0; i < num_part; i++) {
+            double vel_ana = PoiseuilleAnalytical(pos[i].z(), bzDim, time + 0.5, sysFSI);
+            error += std::pow(vel[i].x() - vel_ana, 2);
+            abs_val += std::pow(vel_ana, 2);
+        }
+        if (step > 1) {
+            EXPECT_LT(std::sqrt(error / abs_val), rel_tol) << "step " << step << " (" << num_threads << " threads)";
+            if (::testing::Test::HasFailure())
+                break;
+        }
+    }
+
+    vel.resize(num_part);
+    return vel;
+}
+
+TEST(ChFsiCPU, poiseuille_flow) {
+    auto vel_1 = Simulate(1);
+    ASSERT_FALSE(::testing::Test::HasFailure());
+    auto vel_4 = Simulate(4);
+    ASSERT_FALSE(::testing::Test::HasFailure());
+
+    // Per-particle updates are independent and FSI forces are accumulated serially, so the results are identical
+    ASSERT_EQ(vel_1.size(), vel_4.size());
+    for (size_t i = 0; i < vel_1.size(); i++) {
+        ASSERT_EQ(vel_1[i], vel_4[i]) << "particle " << i;
+    }
+}
@@ -0,0 +1,167 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono::Multicore unit test for distributed-memory (MPI) simulation.
+// Granular material settles in a container split into one slab per MPI rank.
+// The result is compared against a single-rank ChSystemMulticoreSMC simulation
+// of the same model, run on rank 0. Particles cross sub-domain boundaries, so
+// both body migration and ghost exchange are exercised.
+//
+// Run with:  mpirun -np 2 utest_MCORE_distributed
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+
+#include "chrono/utils/ChUtilsCreators.h"
+#include "chrono/utils/ChUtilsGenerators.h"
+
+#include "chrono_multicore/distributed/ChSystemMulticoreDistributed.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const ChVector3d hdim(0.5, 0.25, 0.5);
+static const double radius = 0.02;
+static const double time_step = 1e-4;
+static const double time_end = 0.5;
+
+// Create the settling model. Bodies are added in the same order on all ranks.
+static void CreateModel(ChSystemMulticoreSMC& sys) {
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+    sys.GetSettings()->collision.narrowphase_algorithm = ChNarrowphase::Algorithm::HYBRID;
+    sys.GetSettings()->collision.bins_per_axis = vec3(10, 5, 5);
+    sys.GetSettings()->solver.contact_force_model = ChSystemSMC::ContactForceModel::Hertz;
+    sys.GetSettings()->solver.tangential_displ_mode = ChSystemSMC::TangentialDisplacementModel::OneStep;
+    sys.SetNumThreads(1);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+    mat->SetYoungModulus(2e6f);
+    mat->SetFriction(0.4f);
+    mat->SetRestitution(0.4f);
+
+    auto bin = chrono_types::make_shared<ChBody>();
+    bin->SetFixed(true);
+    bin->EnableCollision(true);
+    utils::AddBoxContainer(bin, mat,                                      //
+                           ChFrame<>(ChVector3d(0, 0, hdim.z()), QUNIT),  //
+                           hdim * 2, 0.2,                                 //
+                           ChVector3i(2, 2, -1));
+    sys.AddBody(bin);
+
+    // Staggered layers, so that particles spread laterally (and across sub-domains) while settling
+    double r = 1.01 * radius;
+    utils::ChGridSampler<double> sampler(2 * r);
+    utils::ChGenerator gen(&sys);
+    auto m1 = gen.AddMixtureIngredient(utils::MixtureType::SPHERE, 1.0);
+    m1->SetDefaultMaterial(mat);
+    m1->SetDefaultDensity(2000);
+    m1->SetDefaultSize(radius);
+
+    ChVector3d range(hdim.x() - 2 * r, hdim.y() - 2 * r, 0);
+    ChVector3d center(0, 0, 2 * r);
+    for (int il = 0; il < 6; il++) {
+        double shift = (il % 2) * r;
+        gen.CreateObjectsBox(sampler, center + ChVector3d(shift, shift, 0), range);
+        center.z() += 2 * r;
+    }
+}
+
+static double MeanHeight(const std::vector<ChVector3d>& pos) {
+    double z = 0;
+    for (const auto& p : pos)
+        z += p.z();
+    return z / pos.size();
+}
+
+TEST(ChSystemMulticoreDistributed, settling) {
+    int rank;
+    int num_ranks;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &num_ranks);
+
+    // Distributed simulation
+    ChSystemMulticoreDistributed sys(MPI_COMM_WORLD);
+    sys.GetDomain().SetSplitAxis(0);
+    sys.GetDomain().SetSimDomain(-hdim, hdim);
+    sys.GetDomain().SetGhostLayer(4 * radius);
+    sys.GetDomain().Initialize();
+    CreateModel(sys);
+
+    unsigned int num_particles = sys.GetNumBodiesDistributed();
+
+    while (sys.GetChTime() < time_end) {
+        sys.DoStepDynamics(time_step);
+        // No body may be lost or duplicated during migration
+        ASSERT_EQ(sys.GetNumBodiesDistributed(), num_particles);
+    }
+
+    std::vector<ChDistributedBodyState> states;
+    sys.GatherBodies(states);
+
+    if (rank != 0)
+        return;
+
+    // Single-rank reference simulation
+    ChSystemMulticoreSMC ref;
+    CreateModel(ref);
+    while (ref.GetChTime() < time_end)
+        ref.DoStepDynamics(time_step);
+
+    std::vector<ChVector3d> ref_pos;
+    for (const auto& body : ref.GetBodies()) {
+        if (!body->IsFixed())
+            ref_pos.push_back(body->GetPos());
+    }
+
+    ASSERT_EQ(states.size(), ref_pos.size());
+    ASSERT_EQ(states.size(), (size_t)num_particles);
+
+    std::vector<ChVector3d> pos;
+    for (size_t i = 0; i < states.size(); i++) {
+        ASSERT_EQ(states[i].gid, (unsigned int)(i + 1));
+        pos.push_back(states[i].pos);
+
+        // All particles settled inside the container
+        ASSERT_LT(std::abs(states[i].pos.x()), hdim.x());
+        ASSERT_LT(std::abs(states[i].pos.y()), hdim.y());
+        ASSERT_GT(states[i].pos.z(), 0.0);
+        ASSERT_LT(states[i].pos_dt.Length(), 0.1);
+    }
+
+    // Individual trajectories diverge (contact forces are accumulated in different order), but the settled packing
+    // must be statistically equivalent
+    ASSERT_NEAR(MeanHeight(pos), MeanHeight(ref_pos), 0.25 * radius);
+
+    auto max_z = [](const std::vector<ChVector3d>& p) {
+        return std::max_element(p.begin(), p.end(), [](const ChVector3d& a, const ChVector3d& b) {
+                   return a.z() < b.z();
+               })->z();
+    };
+    ASSERT_NEAR(max_z(pos), max_z(ref_pos), 2 * radius);
+
+    if (num_ranks > 1)
+        std::cout << "Compared " << num_ranks << "-rank and single-rank settling of " << num_particles << " particles"
+                  << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the NSC contact container with pooled contact storage.
+// A pile of spheres settling in a box is simulated with the default (list-based)
+// NSC contact container and with ChContactContainerPooledNSC. Since contacts are
+// stored and traversed in the same order, the two simulations must produce
+// identical contact sets and body states.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChContactContainerPooledNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+// Count reported contacts and accumulate the normal contact forces
+class ContactCounter : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactCounter() : num_contacts(0), normal_force(0) {}
+    virtual bool OnReportContact(const ChVector3d& pA,
+                                 const ChVector3d& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector3d& react_forces,
+                                 const ChVector3d& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        num_contacts++;
+        normal_force += react_forces.x();
+        return true;
+    }
+    int num_contacts;
+    double normal_force;
+};
+
+static std::unique_ptr<ChSystemNSC> CreateSystem(bool pooled, std::vector<std::shared_ptr<ChBody>>& balls) {
+    auto sys = std::unique_ptr<ChSystemNSC>(new ChSystemNSC);
+    sys->SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys->SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    if (pooled)
+        sys->SetContactContainer(chrono_types::make_shared<ChContactContainerPooledNSC>());
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto box = chrono_types::make_shared<ChBody>();
+    box->SetFixed(true);
+    box->EnableCollision(true);
+    utils::AddBoxContainer(box, mat, ChFrame<>(), ChVector3d(2, 2, 2), 0.1, ChVector3i(2, -1, 2));
+    sys->AddBody(box);
+
+    balls.clear();
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(-0.6 + 0.41 * ix, -0.78 + 0.41 * iy, -0.6 + 0.41 * iz));
+                sys->AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    return sys;
+}
+
+TEST(ChContactContainerPooledNSC, same_as_list) {
+    std::vector<std::shared_ptr<ChBody>> balls_list;
+    std::vector<std::shared_ptr<ChBody>> balls_pool;
+    auto sys_list = CreateSystem(false, balls_list);
+    auto sys_pool = CreateSystem(true, balls_pool);
+
+    ASSERT_TRUE(std::dynamic_pointer_cast<ChContactContainerPooledNSC>(sys_pool->GetContactContainer()));
+
+    auto counter_list = chrono_types::make_shared<ContactCounter>();
+    auto counter_pool = chrono_types::make_shared<ContactCounter>();
+
+    double step = 1e-3;
+    for (int i = 0; i < 300; i++) {
+        sys_list->DoStepDynamics(step);
+        sys_pool->DoStepDynamics(step);
+
+        ASSERT_EQ(sys_list->GetNumContacts(), sys_pool->GetNumContacts());
+    }
+
+    ASSERT_GT(sys_pool->GetNumContacts(), 0);
+
+    sys_list->GetContactContainer()->ReportAllContacts(counter_list);
+    sys_pool->GetContactContainer()->ReportAllContacts(counter_pool);
+    ASSERT_EQ(counter_list->num_contacts, (int)sys_list->GetNumContacts());
+    ASSERT_EQ(counter_pool->num_contacts, (int)sys_pool->GetNumContacts());
+    ASSERT_DOUBLE_EQ(counter_list->normal_force, counter_pool->normal_force);
+
+    for (size_t i = 0; i < balls_list.size(); i++) {
+        ASSERT_DOUBLE_EQ(balls_list[i]->GetPos().x(), balls_pool[i]->GetPos().x());
+        ASSERT_DOUBLE_EQ(balls_list[i]->GetPos().y(), balls_pool[i]->GetPos().y());
+        ASSERT_DOUBLE_EQ(balls_list[i]->GetPos().z(), balls_pool[i]->GetPos().z());
+    }
+}
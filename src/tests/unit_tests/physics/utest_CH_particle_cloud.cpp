@@ -0,0 +1,117 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Chrono unit test for the compact storage mode of ChParticleCloud.
+// Two identical particle clouds, one with the default storage and one with compact
+// (structure-of-arrays) storage, settle on a fixed box. Halfway, the storage of
+// both clouds is switched. The particle states must match at all times.
+// =============================================================================
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChParticleCloud.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+const int num_layers = 4;
+const double radius = 0.05;
+
+// Create a system with a ground box and a particle cloud
+static std::shared_ptr<ChParticleCloud> CreateSystem(ChSystemNSC& sys, bool compact) {
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(2, 2, 0.2, 1000, false, true, mat);
+    ground->SetPos(ChVector3d(0, 0, -0.1));
+    ground->SetFixed(true);
+    sys.AddBody(ground);
+
+    auto cloud = chrono_types::make_shared<ChParticleCloud>();
+    cloud->EnableCompactStorage(compact);
+    cloud->SetMass(0.5);
+    cloud->SetInertiaXX(ChVector3d(0.0005, 0.0005, 0.0005));
+    cloud->AddCollisionShape(chrono_types::make_shared<ChCollisionShapeSphere>(mat, radius));
+    cloud->EnableCollision(true);
+
+    for (int iz = 0; iz < num_layers; iz++) {
+        for (int ix = 0; ix < 5; ix++) {
+            for (int iy = 0; iy < 5; iy++) {
+                ChVector3d pos(-0.25 + 0.11 * ix + 0.01 * iz, -0.25 + 0.11 * iy - 0.01 * iz, radius + 0.11 * iz);
+                cloud->AddParticle(ChCoordsys<>(pos, QuatFromAngleZ(0.1 * ix)));
+            }
+        }
+    }
+    sys.Add(cloud);
+
+    return cloud;
+}
+
+TEST(ChParticleCloud, compact) {
+    ChSystemNSC sys_ref;
+    auto cloud_ref = CreateSystem(sys_ref, false);
+
+    ChSystemNSC sys_cmp;
+    auto cloud_cmp = CreateSystem(sys_cmp, true);
+
+    ASSERT_FALSE(cloud_ref->IsCompactStorage());
+    ASSERT_TRUE(cloud_cmp->IsCompactStorage());
+    ASSERT_EQ(cloud_ref->GetNumParticles(), cloud_cmp->GetNumParticles());
+    ASSERT_TRUE(cloud_cmp->GetParticles().empty());
+
+    // apply a user force on one of the particles
+    cloud_ref->SetParticleForce(3, ChVector3d(1, 0, 0));
+    cloud_cmp->SetParticleForce(3, ChVector3d(1, 0, 0));
+
+    for (int step = 0; step < 300; step++) {
+        // switch the storage of both clouds halfway, with existing particles and bound collision models
+        if (step == 150) {
+            cloud_ref->EnableCompactStorage(true);
+            ASSERT_TRUE(cloud_ref->IsCompactStorage());
+            ASSERT_TRUE(cloud_ref->GetParticles().empty());
+
+            // accessing a particle switches back to the default storage
+            ASSERT_EQ(cloud_cmp->Particle(3).GetPos(), cloud_cmp->GetParticlePos(3));
+            ASSERT_FALSE(cloud_cmp->IsCompactStorage());
+            ASSERT_EQ(cloud_cmp->GetParticles().size(), cloud_cmp->GetNumParticles());
+            ASSERT_EQ(cloud_cmp->GetParticles()[3]->UserForce, ChVector3d(1, 0, 0));
+        }
+
+        sys_ref.DoStepDynamics(1e-3);
+        sys_cmp.DoStepDynamics(1e-3);
+
+        ASSERT_EQ(sys_ref.GetNumContacts(), sys_cmp.GetNumContacts());
+
+        for (unsigned int i = 0; i < cloud_ref->GetNumParticles(); i++) {
+            ASSERT_NEAR((cloud_ref->GetParticlePos(i) - cloud_cmp->GetParticlePos(i)).Length(), 0, 1e-9);
+            ASSERT_NEAR((cloud_ref->GetParticleVel(i) - cloud_cmp->GetParticleVel(i)).Length(), 0, 1e-9);
+            ASSERT_NEAR((cloud_ref->GetParticleAngVel(i) - cloud_cmp->GetParticleAngVel(i)).Length(), 0, 1e-9);
+            ASSERT_NEAR((cloud_ref->GetParticleRot(i) - cloud_cmp->GetParticleRot(i)).Length(), 0, 1e-9);
+        }
+    }
+
+    ASSERT_TRUE(cloud_ref->IsCompactStorage());
+    ASSERT_FALSE(cloud_cmp->IsCompactStorage());
+
+    // the particles settled on the box
+    ASSERT_GT(sys_cmp.GetNumContacts(), 0);
+    for (unsigned int i = 0; i < cloud_ref->GetNumParticles(); i++) {
+        ASSERT_GT(cloud_ref->GetParticlePos(i).z(), 0.9 * radius);
+        ASSERT_EQ(cloud_ref->GetVisualModelFrame(i).GetPos(), cloud_ref->GetParticlePos(i));
+    }
+}
@@ -0,0 +1,153 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the flattened constraint kernel of the PSOR and PJacobi solvers.
+// A pile of spheres settling in a box is simulated with the default solver
+// implementation and with the flattened kernel:
+// - single-threaded PSOR and multithreaded PJacobi must reproduce the default
+//   results (up to round-off);
+// - multithreaded (colored) PSOR must be deterministic.
+// The tests are repeated with rolling and spinning friction, in which case the
+// 6 rows of each rolling contact are updated as a single unit.
+//
+// =============================================================================
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverPJacobi.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::vector<ChVector3d> Simulate(std::shared_ptr<ChIterativeSolverVI> solver, int num_steps, bool rolling) {
+    ChSystemNSC sys;
+    sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+    sys.SetGravitationalAcceleration(ChVector3d(0, -9.81, 0));
+    solver->SetMaxIterations(50);
+    sys.SetSolver(solver);
+
+    auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+    mat->SetFriction(0.4f);
+    if (rolling) {
+        mat->SetRollingFriction(0.02f);
+        mat->SetSpinningFriction(0.01f);
+    }
+
+    auto box = chrono_types::make_shared<ChBody>();
+    box->SetFixed(true);
+    box->EnableCollision(true);
+    utils::AddBoxContainer(box, mat, ChFrame<>(), ChVector3d(2, 2, 2), 0.1, ChVector3i(2, -1, 2));
+    sys.AddBody(box);
+
+    std::vector<std::shared_ptr<ChBody>> balls;
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(0.2, 1000, false, true, mat);
+                ball->SetPos(ChVector3d(-0.6 + 0.41 * ix, -0.78 + 0.41 * iy, -0.6 + 0.41 * iz));
+                if (rolling)
+                    ball->SetAngVelParent(ChVector3d(2, 5, 0));
+                sys.AddBody(ball);
+                balls.push_back(ball);
+            }
+        }
+    }
+
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(1e-3);
+
+    std::vector<ChVector3d> pos;
+    for (const auto& ball : balls)
+        pos.push_back(ball->GetPos());
+    return pos;
+}
+
+static void Compare(const std::vector<ChVector3d>& pos1, const std::vector<ChVector3d>& pos2, double tol) {
+    ASSERT_EQ(pos1.size(), pos2.size());
+    for (size_t i = 0; i < pos1.size(); i++) {
+        ASSERT_NEAR(pos1[i].x(), pos2[i].x(), tol);
+        ASSERT_NEAR(pos1[i].y(), pos2[i].y(), tol);
+        ASSERT_NEAR(pos1[i].z(), pos2[i].z(), tol);
+    }
+}
+
+static void CheckPSOR(bool rolling) {
+    int num_steps = 100;
+
+    auto pos_ref = Simulate(chrono_types::make_shared<ChSolverPSOR>(), num_steps, rolling);
+
+    auto solver_flat = chrono_types::make_shared<ChSolverPSOR>();
+    solver_flat->EnableFlatKernel(true);
+    auto pos_flat = Simulate(solver_flat, num_steps, rolling);
+    Compare(pos_ref, pos_flat, 1e-8);
+}
+
+static void CheckPSORColored(bool rolling) {
+    int num_steps = 100;
+
+    std::vector<ChVector3d> pos[2];
+    for (int k = 0; k < 2; k++) {
+        auto solver = chrono_types::make_shared<ChSolverPSOR>();
+        solver->EnableFlatKernel(true);
+        solver->SetNumThreads(4);
+        pos[k] = Simulate(solver, num_steps, rolling);
+    }
+    Compare(pos[0], pos[1], 0.0);
+
+    // all spheres are still in the box
+    for (const auto& p : pos[0])
+        ASSERT_GT(p.y(), -1.0);
+}
+
+static void CheckPJacobi(bool rolling) {
+    int num_steps = 100;
+
+    auto pos_ref = Simulate(chrono_types::make_shared<ChSolverPJacobi>(), num_steps, rolling);
+
+    auto solver_flat = chrono_types::make_shared<ChSolverPJacobi>();
+    solver_flat->EnableFlatKernel(true);
+    solver_flat->SetNumThreads(4);
+    auto pos_flat = Simulate(solver_flat, num_steps, rolling);
+    Compare(pos_ref, pos_flat, 1e-8);
+}
+
+TEST(ChSolverPSOR, flat_kernel) {
+    CheckPSOR(false);
+}
+
+TEST(ChSolverPSOR, flat_kernel_rolling) {
+    CheckPSOR(true);
+}
+
+TEST(ChSolverPSOR, flat_kernel_colored) {
+    CheckPSORColored(false);
+}
+
+TEST(ChSolverPSOR, flat_kernel_colored_rolling) {
+    CheckPSORColored(true);
+}
+
+TEST(ChSolverPJacobi, flat_kernel) {
+    CheckPJacobi(false);
+}
+
+TEST(ChSolverPJacobi, flat_kernel_rolling) {
+    CheckPJacobi(true);
+}
@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the ray tracer of the CPU sensor backend
+//
+// =============================================================================
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBody.h"
+#include "chrono_sensor/cpu/ChCPURayTracer.h"
+
+using namespace chrono;
+using namespace sensor;
+
+#define RAY_TEST_EPSILON 1e-4
+
+// Trace a single ray and return the index of the instance hit (-1 if none)
+static int TraceRay(const ChCPURayTracer& tracer,
+                    const ChVector3f& origin,
+                    const ChVector3f& dir,
+                    float& t,
+                    ChVector3f& normal) {
+    CPURayPacket packet;
+    packet.size = 1;
+    packet.origin[0] = origin;
+    packet.direction[0] = dir;
+    packet.tmin[0] = 0;
+    packet.tmax[0] = 1e16f;
+    tracer.Intersect(packet);
+    t = packet.tmax[0];
+    normal = packet.normal[0];
+    return packet.hit[0];
+}
+
+static std::shared_ptr<ChBody> MakeBody(const ChVector3d& pos) {
+    auto body = chrono_types::make_shared<ChBody>();
+    body->SetPos(pos);
+    return body;
+}
+
+TEST(ChCPURayTracer, primitives) {
+    ChCPURayTracer tracer;
+    tracer.AddBox(MakeBody({5, 0, 0}), ChFrame<>(), {1, 2, 2});
+    tracer.AddSphere(MakeBody({0, 5, 0}), ChFrame<>(), 1);
+    tracer.AddCylinder(MakeBody({-5, 0, 0}), ChFrame<>(), .5, 2);
+    tracer.Update({0, 0, 0});
+    ASSERT_EQ(tracer.GetNumInstances(), 3);
+
+    float t;
+    ChVector3f n;
+
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {1, 0, 0}, t, n), 0);
+    ASSERT_NEAR(t, 4.5, RAY_TEST_EPSILON);
+    ASSERT_NEAR(n.x(), -1, RAY_TEST_EPSILON);
+
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {0, 1, 0}, t, n), 1);
+    ASSERT_NEAR(t, 4, RAY_TEST_EPSILON);
+    ASSERT_NEAR(n.y(), -1, RAY_TEST_EPSILON);
+
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {-1, 0, 0}, t, n), 2);
+    ASSERT_NEAR(t, 4.5, RAY_TEST_EPSILON);
+    ASSERT_NEAR(n.x(), 1, RAY_TEST_EPSILON);
+
+    // cylinder cap
+    ASSERT_EQ(TraceRay(tracer, {-5, 0, 5}, {0, 0, -1}, t, n), 2);
+    ASSERT_NEAR(t, 4, RAY_TEST_EPSILON);
+    ASSERT_NEAR(n.z(), 1, RAY_TEST_EPSILON);
+
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {0, -1, 0}, t, n), -1);
+}
+
+TEST(ChCPURayTracer, mesh) {
+    auto trimesh = chrono_types::make_shared<ChTriangleMeshConnected>();
+    trimesh->GetCoordsVertices() = {{0, -1, -1}, {0, 1, -1}, {0, 0, 1}};
+    trimesh->GetIndicesVertexes() = {{0, 1, 2}};
+
+    ChCPURayTracer tracer;
+    tracer.AddMesh(MakeBody({3, 0, 0}), ChFrame<>(), trimesh, {2, 2, 2}, false);
+    tracer.AddMesh(MakeBody({0, 0, 3}), ChFrame<>({0, 0, 0}, QuatFromAngleY(CH_PI_2)), trimesh, {1, 1, 1}, false);
+    tracer.Update({0, 0, 0});
+
+    float t;
+    ChVector3f n;
+
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {1, 0, 0}, t, n), 0);
+    ASSERT_NEAR(t, 3, RAY_TEST_EPSILON);
+    ASSERT_NEAR(std::abs(n.x()), 1, RAY_TEST_EPSILON);
+
+    // the scaled triangle covers z in [-2, 2]
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 1.5f}, {1, 0, 0}, t, n), 0);
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 2.5f}, {1, 0, 0}, t, n), -1);
+
+    // rotated instance, facing down the Z axis
+    ASSERT_EQ(TraceRay(tracer, {0, 0, 0}, {0, 0, 1}, t, n), 1);
+    ASSERT_NEAR(t, 3, RAY_TEST_EPSILON);
+}
+
+TEST(ChCPURayTracer, update) {
+    auto body = MakeBody({5, 0, 0});
+    body->SetPosDt({0, 1, 0});
+    body->SetAngVelParent({0, 0, 2});
+
+    ChCPURayTracer tracer;
+    tracer.SetRebuildRatio(1.2f);
+    tracer.AddBox(body, ChFrame<>(), {1, 1, 1});
+    for (int i = 0; i < 20; i++)
+        tracer.AddSphere(MakeBody({0, 10. + i, 0}), ChFrame<>(), .25);
+
+    // trace relative to a shifted origin
+    tracer.Update({1, 0, 0});
+
+    float t;
+    ChVector3f n;
+    ASSERT_EQ(TraceRay(tracer, {-1, 0, 0}, {1, 0, 0}, t, n), 0);
+    ASSERT_NEAR(t, 4.5, RAY_TEST_EPSILON);
+
+    // rigid velocity at the hit point: v + w x r
+    ChVector3f vel = tracer.GetPointVelocity(0, {3.5f, 0, 0});
+    ASSERT_NEAR(vel.x(), 0, RAY_TEST_EPSILON);
+    ASSERT_NEAR(vel.y(), 0, RAY_TEST_EPSILON);
+
+    // move the box and refit
+    body->SetPos({8, 0, 0});
+    tracer.Update({1, 0, 0});
+    ASSERT_EQ(TraceRay(tracer, {-1, 0, 0}, {1, 0, 0}, t, n), 0);
+    ASSERT_NEAR(t, 7.5, RAY_TEST_EPSILON);
+
+    // moving the box far away degrades the refitted hierarchy, which is then rebuilt
+    unsigned int rebuilds = tracer.GetNumRebuilds();
+    body->SetPos({0, 1000, 0});
+    tracer.Update({1, 0, 0});
+    ASSERT_GT(tracer.GetNumRebuilds(), rebuilds);
+    ASSERT_EQ(TraceRay(tracer, {-1, 0, 0}, {1, 0, 0}, t, n), -1);
+    ASSERT_EQ(TraceRay(tracer, {-1, 0, 0}, {0, 1, 0}, t, n), 1);
+}
@@ -0,0 +1,96 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for SynChrono interest management
+//
+// =============================================================================
+
+#include <limits>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/communication/SynInterestManager.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+static SynInterestRecord MakeRecord(double x, double radius = std::numeric_limits<double>::infinity()) {
+    return {{x, 0, 0}, radius};
+}
+
+TEST(SynInterestManager, Convoy) {
+    // Four single-vehicle nodes 100 m apart, each interested in vehicles within 150 m
+    std::vector<std::vector<SynInterestRecord>> records(4);
+    for (int i = 0; i < 4; i++)
+        records[i].push_back(MakeRecord(100.0 * i, 150));
+
+    SynInterestManager interest;
+    interest.Update(records);
+
+    ASSERT_FALSE(interest.IsFullExchange());
+    ASSERT_TRUE(interest.IsInterested(1, 0));
+    ASSERT_TRUE(interest.IsInterested(0, 1));
+    ASSERT_FALSE(interest.IsInterested(2, 0));
+    ASSERT_FALSE(interest.IsInterested(0, 0));
+
+    ASSERT_EQ(interest.GetDestinations(0), std::vector<int>({1}));
+    ASSERT_EQ(interest.GetSources(2), std::vector<int>({1, 3}));
+}
+
+TEST(SynInterestManager, Asymmetric) {
+    // Node 0 sees everything, node 1 only its surroundings
+    std::vector<std::vector<SynInterestRecord>> records(2);
+    records[0].push_back(MakeRecord(0));
+    records[1].push_back(MakeRecord(500, 100));
+
+    SynInterestManager interest;
+    interest.Update(records);
+
+    ASSERT_TRUE(interest.IsInterested(0, 1));
+    ASSERT_FALSE(interest.IsInterested(1, 0));
+    ASSERT_TRUE(interest.GetSources(1).empty());
+}
+
+TEST(SynInterestManager, Unlocated) {
+    // Node 2 has no located agents (e.g. environment or terrain only)
+    std::vector<std::vector<SynInterestRecord>> records(3);
+    records[0].push_back(MakeRecord(0, 10));
+    records[1].push_back(MakeRecord(1000, 10));
+
+    SynInterestManager interest;
+    interest.Update(records);
+
+    ASSERT_FALSE(interest.IsInterested(0, 1));
+    ASSERT_TRUE(interest.IsInterested(0, 2));
+    ASSERT_TRUE(interest.IsInterested(2, 0));
+    ASSERT_TRUE(interest.IsInterested(2, 1));
+
+    // Without any summary (e.g. during initialization) every node exchanges with every other node
+    interest.Update(std::vector<std::vector<SynInterestRecord>>(3));
+    ASSERT_TRUE(interest.IsFullExchange());
+}
+
+TEST(SynInterestManager, Broadcast) {
+    std::vector<std::vector<SynInterestRecord>> records(3);
+    for (int i = 0; i < 3; i++)
+        records[i].push_back(MakeRecord(1000.0 * i, 10));
+
+    // Node 1 sends a quit message, which must reach everyone
+    SynInterestManager interest;
+    interest.Update(records, {false, true, false});
+
+    ASSERT_EQ(interest.GetDestinations(1), std::vector<int>({0, 2}));
+    ASSERT_FALSE(interest.IsInterested(1, 0));
+    ASSERT_FALSE(interest.IsInterested(2, 0));
+}
@@ -0,0 +1,114 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Unit test for the SynChrono shared memory communicator. Nodes are run on
+// separate threads of the test process, each with its own communicator.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "chrono_synchrono/communication/shm/SynSHMCommunicator.h"
+#include "chrono_synchrono/flatbuffer/message/SynSimulationMessage.h"
+
+using namespace chrono;
+using namespace synchrono;
+
+// Run the given function for each node on its own thread
+template <typename Function>
+static void RunNodes(int num_nodes, Function&& func) {
+    std::vector<std::thread> threads;
+    for (int node = 0; node < num_nodes; node++)
+        threads.emplace_back(func, node);
+    for (auto& t : threads)
+        t.join();
+}
+
+static std::string SegmentName(const std::string& test) {
+    return "synchrono_utest_" + test + "_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed());
+}
+
+TEST(SynSHMCommunicator, interest) {
+    // Nodes 0 and 1 are close to each other, node 2 is far away from both
+    const int num_nodes = 3;
+    const int num_steps = 10;
+    std::string name = SegmentName("interest");
+    std::vector<std::vector<int>> sources(num_nodes);
+    std::vector<size_t> bytes_received(num_nodes, 0);
+
+    RunNodes(num_nodes, [&](int node) {
+        SynSHMCommunicator communicator(node, num_nodes, name, 1 << 16, 1234);
+        double x = (node == 2) ? 1000.0 : 10.0 * node;
+        communicator.SetInterestRecords({{{x, 0, 0}, 100}});
+
+        for (int step = 0; step < num_steps; step++) {
+            SynMessageList messages;
+            messages.push_back(chrono_types::make_shared<SynSimulationMessage>(AgentKey(node, 0)));
+            communicator.AddOutgoingMessages(messages);
+            communicator.Synchronize();
+
+            for (auto& message : communicator.GetMessages())
+                sources[node].push_back(message->GetSourceKey().GetNodeID());
+            bytes_received[node] += communicator.GetMessageVolume().bytes_received;
+            communicator.Reset();
+        }
+        communicator.Barrier();
+    });
+
+    ASSERT_EQ(sources[0], std::vector<int>(num_steps, 1));
+    ASSERT_EQ(sources[1], std::vector<int>(num_steps, 0));
+    ASSERT_TRUE(sources[2].empty());
+    ASSERT_GT(bytes_received[0], (size_t)0);
+    ASSERT_EQ(bytes_received[2], (size_t)0);
+}
+
+TEST(SynSHMCommunicator, broadcast) {
+    // A quit message reaches all nodes, regardless of interest
+    const int num_nodes = 3;
+    std::string name = SegmentName("broadcast");
+    std::vector<int> num_quit(num_nodes, 0);
+
+    RunNodes(num_nodes, [&](int node) {
+        SynSHMCommunicator communicator(node, num_nodes, name, 1 << 16, 1234);
+        communicator.SetInterestRecords({{{1000.0 * node, 0, 0}, 1}});
+        if (node == 0)
+            communicator.AddQuitMessage();
+        communicator.Synchronize();
+
+        for (auto& message : communicator.GetMessages()) {
+            auto sim_message = std::dynamic_pointer_cast<SynSimulationMessage>(message);
+            if (sim_message && sim_message->m_quit_sim)
+                num_quit[node]++;
+        }
+        communicator.Barrier();
+    });
+
+    ASSERT_EQ(num_quit, std::vector<int>({0, 1, 1}));
+}
+
+TEST(SynSHMCommunicator, timeout) {
+    // Node 1 does not attach to the segment of a run with a different key
+    std::string name = SegmentName("timeout");
+
+    RunNodes(2, [&](int node) {
+        uint64_t key = 1 + node;
+        ASSERT_THROW(SynSHMCommunicator(node, 2, name, 1 << 16, key, 0.2), std::runtime_error);
+    });
+}
@@ -0,0 +1,197 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the storage types of SCM modified grid nodes.
+// A sphere is moved (kinematically) through two identical SCM terrains, one with
+// the HASH_MAP and one with the DENSE_TILES node storage. Its path covers nodes
+// with negative grid indices and leaves the terrain patch, so that nodes outside
+// the tile directory are modified. Sinkage and modified node lists must be
+// identical for the two storage types, including after switching the storage
+// type of both terrains mid-run.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <set>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const double terrain_length = 4;  // terrain patch length (grid indices in [-50,50])
+const double terrain_width = 2;   // terrain patch width (grid indices in [-25,25])
+const double delta = 0.04;
+const double radius = 0.2;
+const double step_size = 2e-3;
+const int num_steps = 1200;
+
+// Sphere position at the given step: from (-1.8, -0.6) to (3, 0.6), 3 cm below the undeformed terrain surface
+static ChVector3d SpherePos(int step) {
+    double s = (double)step / num_steps;
+    return ChVector3d(-1.8 + 4.8 * s, -0.6 + 1.2 * s, radius - 0.03);
+}
+
+class SCMSystem {
+  public:
+    SCMSystem(SCMTerrain::NodeStorage storage) {
+        m_sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        m_sys.SetGravitationalAcceleration(ChVector3d(0, 0, -9.81));
+
+        auto mat = chrono_types::make_shared<ChContactMaterialSMC>();
+        m_sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+        m_sphere->SetFixed(true);
+        m_sphere->SetPos(SpherePos(0));
+        m_sys.AddBody(m_sphere);
+
+        m_terrain = chrono_types::make_unique<SCMTerrain>(&m_sys, false);
+        m_terrain->SetNodeStorage(storage);
+        m_terrain->SetSoilParameters(0.2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        m_terrain->EnableBulldozing(true);
+        m_terrain->SetBulldozingParameters(55, 1, 5, 6);
+        m_terrain->Initialize(terrain_length, terrain_width, delta);
+    }
+
+    void Advance(int step) {
+        m_sphere->SetPos(SpherePos(step));
+        m_terrain->Synchronize(m_sys.GetChTime());
+        m_sys.DoStepDynamics(step_size);
+    }
+
+    SCMTerrain& GetTerrain() { return *m_terrain; }
+
+  private:
+    ChSystemSMC m_sys;
+    std::shared_ptr<ChBodyEasySphere> m_sphere;
+    std::unique_ptr<SCMTerrain> m_terrain;
+};
+
+static void SortNodes(std::vector<SCMTerrain::NodeLevel>& nodes) {
+    std::sort(nodes.begin(), nodes.end(), [](const SCMTerrain::NodeLevel& a, const SCMTerrain::NodeLevel& b) {
+        return a.first.x() < b.first.x() || (a.first.x() == b.first.x() && a.first.y() < b.first.y());
+    });
+}
+
+// Check that the two node lists are identical (same nodes, in the same order, with the same levels)
+static void CheckNodes(const std::vector<SCMTerrain::NodeLevel>& nodes1,
+                       const std::vector<SCMTerrain::NodeLevel>& nodes2) {
+    ASSERT_EQ(nodes1.size(), nodes2.size());
+    for (size_t k = 0; k < nodes1.size(); k++) {
+        ASSERT_EQ(nodes1[k].first.x(), nodes2[k].first.x());
+        ASSERT_EQ(nodes1[k].first.y(), nodes2[k].first.y());
+        ASSERT_EQ(nodes1[k].second, nodes2[k].second);
+    }
+}
+
+// Check that the node information at the specified grid nodes is identical
+static void CheckNodeInfo(SCMTerrain& terrain1, SCMTerrain& terrain2, const std::vector<SCMTerrain::NodeLevel>& nodes) {
+    for (const auto& n : nodes) {
+        ChVector3d loc(n.first.x() * delta, n.first.y() * delta, 0);
+        auto info1 = terrain1.GetNodeInfo(loc);
+        auto info2 = terrain2.GetNodeInfo(loc);
+        ASSERT_EQ(info1.sinkage, info2.sinkage);
+        ASSERT_EQ(info1.sinkage_plastic, info2.sinkage_plastic);
+        ASSERT_EQ(info1.sinkage_elastic, info2.sinkage_elastic);
+        ASSERT_EQ(info1.sigma, info2.sigma);
+        ASSERT_EQ(info1.kshear, info2.kshear);
+        ASSERT_EQ(info1.tau, info2.tau);
+        ASSERT_EQ(terrain1.GetHeight(loc), terrain2.GetHeight(loc));
+    }
+}
+
+TEST(SCMTerrain, node_storage) {
+    SCMSystem sys1(SCMTerrain::NodeStorage::HASH_MAP);
+    SCMSystem sys2(SCMTerrain::NodeStorage::DENSE_TILES);
+    auto& terrain1 = sys1.GetTerrain();
+    auto& terrain2 = sys2.GetTerrain();
+
+    bool negative_i = false;
+    bool negative_j = false;
+    bool outside = false;
+    bool sinkage = false;
+
+    for (int step = 0; step < num_steps; step++) {
+        // switch the storage types of both terrains, with existing node records
+        if (step == num_steps / 2) {
+            terrain1.SetNodeStorage(SCMTerrain::NodeStorage::DENSE_TILES);
+            terrain2.SetNodeStorage(SCMTerrain::NodeStorage::HASH_MAP);
+        }
+
+        sys1.Advance(step);
+        sys2.Advance(step);
+
+        // nodes modified over the last step: same nodes, in the same order, each node listed once
+        auto nodes1 = terrain1.GetModifiedNodes(false);
+        auto nodes2 = terrain2.GetModifiedNodes(false);
+        CheckNodes(nodes1, nodes2);
+        if (HasFatalFailure())
+            return;
+
+        std::set<std::pair<int, int>> unique_nodes;
+        for (const auto& n : nodes1)
+            unique_nodes.insert(std::make_pair(n.first.x(), n.first.y()));
+        ASSERT_EQ(unique_nodes.size(), nodes1.size());
+
+        CheckNodeInfo(terrain1, terrain2, nodes1);
+        if (HasFatalFailure())
+            return;
+
+        for (const auto& n : nodes1) {
+            negative_i |= n.first.x() < 0;
+            negative_j |= n.first.y() < 0;
+            outside |= n.first.x() > 63;  // beyond the last tile of the directory (nodes 48 to 63)
+            sinkage |= terrain1.GetNodeInfo(ChVector3d(n.first.x() * delta, n.first.y() * delta, 0)).sinkage > 0;
+        }
+    }
+
+    ASSERT_TRUE(negative_i);
+    ASSERT_TRUE(negative_j);
+    ASSERT_TRUE(outside);
+    ASSERT_TRUE(sinkage);
+
+    // all modified nodes (in storage-dependent order)
+    auto all1 = terrain1.GetModifiedNodes(true);
+    auto all2 = terrain2.GetModifiedNodes(true);
+    ASSERT_EQ(all1.size(), terrain1.GetNumModifiedNodes());
+    ASSERT_EQ(all2.size(), terrain2.GetNumModifiedNodes());
+    SortNodes(all1);
+    SortNodes(all2);
+    CheckNodes(all1, all2);
+
+    // set node levels, including new nodes far outside the terrain patch and existing nodes
+    std::vector<SCMTerrain::NodeLevel> levels = {{ChVector2i(-500, -300), -0.1},
+                                                 {ChVector2i(-17, 3), -0.2},
+                                                 {ChVector2i(400, -1), -0.3},
+                                                 {all1.front().first, -0.4},
+                                                 {all1.back().first, -0.5}};
+    terrain1.SetModifiedNodes(levels);
+    terrain2.SetModifiedNodes(levels);
+    for (const auto& n : levels) {
+        ChVector3d loc(n.first.x() * delta, n.first.y() * delta, 0);
+        ASSERT_DOUBLE_EQ(terrain1.GetHeight(loc), n.second);
+        ASSERT_DOUBLE_EQ(terrain2.GetHeight(loc), n.second);
+    }
+
+    all1 = terrain1.GetModifiedNodes(true);
+    all2 = terrain2.GetModifiedNodes(true);
+    SortNodes(all1);
+    SortNodes(all2);
+    CheckNodes(all1, all2);
+    ASSERT_EQ(terrain1.GetNumModifiedNodes(), terrain2.GetNumModifiedNodes());
+}
@@ -0,0 +1,163 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the co-simulation data exchange.
+// A single-wheel rig with a rigid tire on rigid terrain is co-simulated with the
+// non-blocking (default) and with the blocking data exchange, with and without
+// lagged coupling, and with the coupling data exchanged through shared memory.
+// The drawbar pull reported by the rig on the MBS node must be identical at all
+// steps for all exchange modes.
+//
+// Run with:  mpirun -np 3 utest_VEH_cosim_exchange
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/cosim/mbs/ChVehicleCosimRigNode.h"
+#include "chrono_vehicle/cosim/terrain/ChVehicleCosimTerrainNodeRigid.h"
+#include "chrono_vehicle/cosim/tire/ChVehicleCosimTireNodeRigid.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const double step_size = 1e-3;
+static const int num_steps = 500;
+static const double terrain_length = 6;
+static const double terrain_width = 2;
+
+static std::string out_dir;
+
+// Co-simulate the single-wheel rig with the specified exchange mode.
+// On the MBS node, return the drawbar pull at each step. On the terrain node, return the number of contacts.
+static std::vector<double> Simulate(bool nonblocking, bool lagged, bool shared_memory) {
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    std::string suffix = std::string(lagged ? "_lagged" : "") + (nonblocking ? "_nonblocking" : "_blocking") +
+                         (shared_memory ? "_shm" : "");
+
+    ChVehicleCosimBaseNode* node = nullptr;
+    std::shared_ptr<ChVehicleCosimDBPRig> dbp_rig;
+    ChVehicleCosimTerrainNode* terrain_node = nullptr;
+
+    if (rank == MBS_NODE_RANK) {
+        auto act_type = ChVehicleCosimDBPRigImposedSlip::ActuationType::SET_ANG_VEL;
+        dbp_rig = chrono_types::make_shared<ChVehicleCosimDBPRigImposedSlip>(act_type, 1.0, 0.2);
+        dbp_rig->SetDBPFilterWindow(0.1);
+
+        auto mbs = new ChVehicleCosimRigNode();
+        mbs->SetInitialLocation(ChVector3d(-terrain_length / 2 + 1, 0, 0.425));
+        mbs->SetTotalMass(200);
+        mbs->AttachDrawbarPullRig(dbp_rig);
+        node = mbs;
+    } else if (rank == TIRE_NODE_RANK(0)) {
+        node = new ChVehicleCosimTireNodeRigid(0, vehicle::GetDataFile("cosim/tire/RigidTire_mesh_coarse.json"));
+    } else if (rank == TERRAIN_NODE_RANK) {
+        auto terrain = new ChVehicleCosimTerrainNodeRigid(vehicle::GetDataFile("cosim/terrain/rigid.json"),
+                                                          ChContactMethod::SMC);
+        terrain->SetDimensions(terrain_length, terrain_width);
+        terrain_node = terrain;
+        node = terrain;
+    }
+
+    node->SetVerbose(false);
+    node->SetStepSize(step_size);
+    node->SetOutDir(out_dir, suffix);
+    node->EnableNonblockingExchange(nonblocking);
+    node->EnableLaggedCoupling(lagged);
+    if (shared_memory)
+        node->EnableSharedMemory("chrono_utest_cosim_exchange" + suffix);
+    node->Initialize();
+
+    std::vector<double> results;
+    for (int is = 0; is < num_steps; is++) {
+        node->Synchronize(is, is * step_size);
+        node->Advance(step_size);
+
+        if (dbp_rig)
+            results.push_back(dbp_rig->GetDBP());
+        if (terrain_node)
+            results.push_back(terrain_node->GetNumContacts());
+    }
+
+    delete node;
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    return results;
+}
+
+static void CheckExchange(bool lagged) {
+    auto results_nonblocking = Simulate(true, lagged, false);
+    auto results_blocking = Simulate(false, lagged, false);
+    auto results_shm = Simulate(true, lagged, true);
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    // The tire must be in contact with the terrain (i.e., non-zero forces were exchanged)
+    if (rank == TERRAIN_NODE_RANK) {
+        ASSERT_GT(results_nonblocking.back(), 0);
+        ASSERT_GT(results_blocking.back(), 0);
+        ASSERT_GT(results_shm.back(), 0);
+    }
+
+    // The exchanged data is identical, so results must match exactly
+    if (rank == MBS_NODE_RANK) {
+        ASSERT_EQ(results_nonblocking.size(), results_blocking.size());
+        ASSERT_EQ(results_nonblocking.size(), results_shm.size());
+        for (size_t i = 0; i < results_nonblocking.size(); i++) {
+            ASSERT_EQ(results_nonblocking[i], results_blocking[i]) << "step " << i;
+            ASSERT_EQ(results_nonblocking[i], results_shm[i]) << "step " << i;
+        }
+    }
+}
+
+TEST(ChVehicleCosim, exchange) {
+    CheckExchange(false);
+}
+
+TEST(ChVehicleCosim, exchange_lagged) {
+    CheckExchange(true);
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+
+    int num_procs;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+    if (num_procs != 3) {
+        std::cout << "utest_VEH_cosim_exchange must be run on exactly 3 ranks" << std::endl;
+        MPI_Abort(MPI_COMM_WORLD, 1);
+        return 1;
+    }
+
+    out_dir = GetChronoOutputPath() + "UTEST_COSIM_EXCHANGE";
+
+    int rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    if (rank == 0)
+        filesystem::create_directory(filesystem::path(out_dir));
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    cosim::InitializeFramework(1);
+
+    ::testing::InitGoogleTest(&argc, argv);
+    int result = RUN_ALL_TESTS();
+    MPI_Finalize();
+    return result;
+}
@@ -0,0 +1,165 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Ensemble of JSON-specified vehicles sharing parsed JSON subsystem data.
+// Vehicles advanced concurrently must produce the same results as when
+// simulated sequentially, and each shared JSON file must be parsed only once.
+//
+// =============================================================================
+
+#include <atomic>
+
+#include <Eigen/Core>
+
+#include "gtest/gtest.h"
+
+#include "chrono/utils/ChEnsembleRunner.h"
+#include "chrono/utils/ChOpenMP.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/powertrain/AutomaticTransmissionSimpleMap.h"
+#include "chrono_vehicle/powertrain/EngineSimpleMap.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+#include "chrono_vehicle/utils/ChUtilsJSON.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/RigidTire.h"
+#include "chrono_vehicle/wheeled_vehicle/vehicle/WheeledVehicle.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static std::atomic<int> num_parsed(0);
+
+// Load a JSON file as a shared asset (parsed only once for the whole ensemble)
+static std::shared_ptr<rapidjson::Document> GetDocument(utils::ChEnsembleRunner* runner, const std::string& file) {
+    auto loader = [file]() {
+        num_parsed++;
+        auto d = chrono_types::make_shared<rapidjson::Document>();
+        ReadFileJSON(vehicle::GetDataFile(file), *d);
+        return d;
+    };
+    if (runner)
+        return runner->GetAsset<rapidjson::Document>("json:" + file, loader);
+    return loader();
+}
+
+// HMMWV specified through JSON files, accelerating on flat rigid terrain with a member-specific throttle
+class VehicleMember : public utils::ChEnsembleMember {
+  public:
+    VehicleMember(double throttle, int num_steps) : m_throttle(throttle), m_num_steps(num_steps), m_step(0) {}
+
+    virtual void Initialize(utils::ChEnsembleRunner& runner) override { Create(&runner); }
+
+    virtual ChSystem* GetSystem() override { return m_vehicle->GetSystem(); }
+
+    virtual bool Advance() override {
+        double time = m_vehicle->GetSystem()->GetChTime();
+        DriverInputs inputs = {0.0, m_throttle, 0.0, 0.0};
+        m_vehicle->Synchronize(time, inputs, *m_terrain);
+        m_terrain->Synchronize(time);
+        m_vehicle->Advance(1e-3);
+        m_terrain->Advance(1e-3);
+        return ++m_step < m_num_steps;
+    }
+
+    virtual void Finalize() override { m_pos = m_vehicle->GetPos(); }
+
+    // Construct the vehicle, using shared JSON documents if a runner is provided
+    void Create(utils::ChEnsembleRunner* runner) {
+        m_vehicle = chrono_types::make_unique<WheeledVehicle>(vehicle::GetDataFile("hmmwv/vehicle/HMMWV_Vehicle.json"),
+                                                              ChContactMethod::NSC, false, false);
+        m_vehicle->Initialize(ChCoordsys<>(ChVector3d(0, 0, 0.6), QUNIT));
+
+        auto engine_doc = GetDocument(runner, "hmmwv/powertrain/HMMWV_EngineSimpleMap.json");
+        auto transmission_doc = GetDocument(runner, "hmmwv/powertrain/HMMWV_AutomaticTransmissionSimpleMap.json");
+        auto engine = chrono_types::make_shared<EngineSimpleMap>(*engine_doc);
+        auto transmission = chrono_types::make_shared<AutomaticTransmissionSimpleMap>(*transmission_doc);
+        m_vehicle->InitializePowertrain(chrono_types::make_shared<ChPowertrainAssembly>(engine, transmission));
+
+        auto tire_doc = GetDocument(runner, "hmmwv/tire/HMMWV_RigidTire.json");
+        for (auto& axle : m_vehicle->GetAxles()) {
+            for (auto& wheel : axle->GetWheels()) {
+                auto tire = chrono_types::make_shared<RigidTire>(*tire_doc);
+                m_vehicle->InitializeTire(tire, wheel, VisualizationType::NONE);
+            }
+        }
+
+        m_terrain = chrono_types::make_unique<RigidTerrain>(m_vehicle->GetSystem());
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        mat->SetFriction(0.9f);
+        m_terrain->AddPatch(mat, ChCoordsys<>(ChVector3d(0, 0, 0), QUNIT), 200, 20);
+        m_terrain->Initialize();
+    }
+
+    const ChVector3d& GetResult() const { return m_pos; }
+
+  private:
+    double m_throttle;
+    int m_num_steps;
+    int m_step;
+    std::unique_ptr<WheeledVehicle> m_vehicle;
+    std::unique_ptr<RigidTerrain> m_terrain;
+    ChVector3d m_pos;
+};
+
+TEST(ChEnsembleRunner, json_vehicles) {
+    const int num_members = 6;
+    const int num_steps = 1000;
+
+    // Thread settings of the calling thread must survive the ensemble run
+    ChOMP::SetNumThreads(3);
+    Eigen::setNbThreads(2);
+
+    utils::ChEnsembleRunner runner(3);
+    runner.SetStepsPerTask(50);
+
+    std::vector<std::shared_ptr<VehicleMember>> members;
+    for (int i = 0; i < num_members; i++) {
+        auto member = chrono_types::make_shared<VehicleMember>(0.2 + 0.1 * i, num_steps);
+        members.push_back(member);
+        runner.AddMember(member);
+    }
+
+    num_parsed = 0;
+    runner.Run();
+
+    ASSERT_EQ(runner.GetNumFailed(), 0u);
+    ASSERT_EQ(num_parsed, 3);  // engine, transmission, and tire JSON files, shared by all members
+
+#ifdef _OPENMP
+    ASSERT_EQ(omp_get_max_threads(), 3);
+    ASSERT_EQ(Eigen::nbThreads(), 2);
+#endif
+    ChOMP::SetNumThreads(1);
+    Eigen::setNbThreads(1);
+
+    // Sequential reference, each member parsing its own JSON files
+    for (int i = 0; i < num_members; i++) {
+        ASSERT_EQ(runner.GetMemberStats(i).num_steps, (unsigned int)num_steps);
+
+        VehicleMember ref(0.2 + 0.1 * i, num_steps);
+        ref.Create(nullptr);
+        ref.GetSystem()->SetNumThreads(1, 1, 1);
+        while (ref.Advance()) {
+        }
+        ref.Finalize();
+
+        ASSERT_DOUBLE_EQ(members[i]->GetResult().x(), ref.GetResult().x());
+        ASSERT_DOUBLE_EQ(members[i]->GetResult().y(), ref.GetResult().y());
+        ASSERT_DOUBLE_EQ(members[i]->GetResult().z(), ref.GetResult().z());
+    }
+
+    // Vehicles with larger throttle travel farther
+    for (int i = 1; i < num_members; i++)
+        ASSERT_GT(members[i]->GetResult().x(), members[i - 1]->GetResult().x());
+}
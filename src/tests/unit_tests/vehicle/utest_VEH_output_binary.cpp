@@ -0,0 +1,146 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the asynchronous binary vehicle output database: write frames through
+// the ChVehicleOutput interface, read back the schema and frame records.
+//
+// =============================================================================
+
+#include <cstring>
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "chrono_vehicle/output/ChVehicleOutputBinary.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+template <typename T>
+static T Read(std::istream& stream) {
+    T value;
+    stream.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return value;
+}
+
+static std::string ReadString(std::istream& stream) {
+    auto len = Read<uint32_t>(stream);
+    std::string str(len, ' ');
+    stream.read(&str[0], len);
+    return str;
+}
+
+TEST(ChVehicleOutputBinary, frames) {
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 3; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetName("body_" + std::to_string(i));
+        bodies.push_back(body);
+    }
+    std::vector<std::shared_ptr<ChShaft>> shafts;
+    for (int i = 0; i < 2; i++)
+        shafts.push_back(chrono_types::make_shared<ChShaft>());
+
+    const int num_frames = 20;
+    std::stringstream stream;
+    {
+        ChVehicleOutputBinary output(stream);
+        ChVehicleOutput& database = output;
+        for (int frame = 0; frame < num_frames; frame++) {
+            // Add a body halfway, which changes the output layout
+            if (frame == num_frames / 2) {
+                auto body = chrono_types::make_shared<ChBody>();
+                body->SetName("body_3");
+                bodies.push_back(body);
+            }
+            for (int i = 0; i < (int)bodies.size(); i++)
+                bodies[i]->SetPos(ChVector3d(frame, i, 0));
+            for (auto& shaft : shafts)
+                shaft->SetPos(frame);
+
+            database.WriteTime(frame, 0.1 * frame);
+            database.WriteSection("chassis");
+            database.WriteBodies(bodies);
+            database.WriteSection("driveline");
+            database.WriteShafts(shafts);
+        }
+        output.Flush();
+        ASSERT_EQ(output.GetNumFramesWritten(), num_frames);
+    }
+
+    char magic[8];
+    stream.read(magic, 8);
+    ASSERT_EQ(std::memcmp(magic, "CHVOBIN1", 8), 0);
+
+    int num_schemas = 0;
+    int num_read = 0;
+    unsigned int num_bodies = 0;
+    while (true) {
+        auto type = Read<uint32_t>(stream);
+        if (!stream)
+            break;
+
+        if (type == 1) {
+            // Schema record: body table followed by shaft table
+            num_schemas++;
+            ASSERT_EQ(Read<uint32_t>(stream), 2u);
+
+            ASSERT_EQ(ReadString(stream), "chassis");
+            ASSERT_EQ(Read<uint32_t>(stream), (uint32_t)ChVehicleOutputBinary::BODIES);
+            num_bodies = Read<uint32_t>(stream);
+            auto num_columns = Read<uint32_t>(stream);
+            ASSERT_EQ(num_columns, 19u);
+            for (unsigned int c = 0; c < num_columns; c++)
+                ReadString(stream);
+            for (unsigned int i = 0; i < num_bodies; i++) {
+                Read<int32_t>(stream);
+                ASSERT_EQ(ReadString(stream), "body_" + std::to_string(i));
+            }
+
+            ASSERT_EQ(ReadString(stream), "driveline");
+            ASSERT_EQ(Read<uint32_t>(stream), (uint32_t)ChVehicleOutputBinary::SHAFTS);
+            ASSERT_EQ(Read<uint32_t>(stream), 2u);
+            ASSERT_EQ(Read<uint32_t>(stream), 4u);
+            for (unsigned int c = 0; c < 4; c++)
+                ReadString(stream);
+            for (unsigned int i = 0; i < 2; i++) {
+                Read<int32_t>(stream);
+                ReadString(stream);
+            }
+        } else {
+            // Frame record
+            ASSERT_EQ(type, 2u);
+            ASSERT_EQ(Read<int32_t>(stream), num_read);
+            ASSERT_DOUBLE_EQ(Read<double>(stream), 0.1 * num_read);
+            auto num_values = Read<uint64_t>(stream);
+            ASSERT_EQ(num_values, num_bodies * 19 + 2 * 4);
+            std::vector<double> values(num_values);
+            stream.read(reinterpret_cast<char*>(values.data()), num_values * sizeof(double));
+
+            // Columns are stored contiguously: pos_x and pos_y of all bodies, then the shaft positions
+            for (unsigned int i = 0; i < num_bodies; i++) {
+                ASSERT_EQ(values[0 * num_bodies + i], num_read);
+                ASSERT_EQ(values[1 * num_bodies + i], i);
+            }
+            ASSERT_EQ(values[19 * num_bodies + 0], num_read);
+            ASSERT_EQ(values[19 * num_bodies + 1], num_read);
+
+            num_read++;
+        }
+    }
+
+    ASSERT_EQ(num_schemas, 2);
+    ASSERT_EQ(num_read, num_frames);
+    ASSERT_EQ(num_bodies, 4u);
+}
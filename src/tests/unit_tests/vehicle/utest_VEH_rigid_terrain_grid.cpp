@@ -0,0 +1,263 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: Chrono developers
+// =============================================================================
+//
+// Test for the height/normal grid of RigidTerrain mesh patches.
+// Over the entire mesh patch (smooth regions, a step, and the patch boundaries)
+// and outside of it, the grid must report a hit exactly where ray casting does.
+// Heights and normals obtained with the grid must either match those of the
+// exact (piecewise linear) mesh surface, or be identical to those obtained
+// through ray casting (fallback for cells which cannot be interpolated). This
+// must also hold for a grid coarser than the mesh, with mesh features smaller
+// than a grid cell.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <functional>
+
+#include "gtest/gtest.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const double hlength = 4;  // mesh half-length
+const double hwidth = 3;   // mesh half-width
+const double spacing = 0.25;
+const ChCoordsys<> patch_csys(ChVector3d(1, -0.5, 0.2), QuatFromAngleZ(0.3));
+
+// Height of the mesh surface: a smooth hill, with a step along the line x = 2.
+static double MeshHeight(double x, double y) {
+    return 0.5 * std::exp(-(x * x + y * y) / 4) + (x > 2 ? 0.3 : 0.0);
+}
+
+// Height of a flat mesh surface with a narrow bump centered at the origin.
+static double BumpHeight(double x, double y) {
+    return 0.1 * std::exp(-(x * x + y * y) / (2 * 0.03 * 0.03));
+}
+
+// Write a triangulated regular grid of the given surface in Wavefront OBJ format.
+static void WriteMesh(const std::string& filename,
+                      double hlen,
+                      double hwid,
+                      double spacing,
+                      std::function<double(double, double)> height) {
+    int nx = (int)std::round(2 * hlen / spacing) + 1;
+    int ny = (int)std::round(2 * hwid / spacing) + 1;
+
+    std::ofstream obj(filename);
+    for (int j = 0; j < ny; j++) {
+        for (int i = 0; i < nx; i++) {
+            double x = -hlen + i * spacing;
+            double y = -hwid + j * spacing;
+            obj << "v " << x << " " << y << " " << height(x, y) << "\n";
+        }
+    }
+    for (int j = 0; j < ny - 1; j++) {
+        for (int i = 0; i < nx - 1; i++) {
+            int v0 = 1 + i + j * nx;
+            obj << "f " << v0 << " " << v0 + 1 << " " << v0 + 1 + nx << "\n";
+            obj << "f " << v0 << " " << v0 + 1 + nx << " " << v0 + nx << "\n";
+        }
+    }
+}
+
+// Exact surface of the mesh written by WriteMesh (expressed in the patch frame).
+struct MeshSurface {
+    double hlen;
+    double hwid;
+    double spacing;
+    std::function<double(double, double)> height;
+
+    // Height and upward normal of the mesh face below the given point.
+    void Evaluate(double x, double y, double& h, ChVector3d& normal) const {
+        double u = (x + hlen) / spacing;
+        double v = (y + hwid) / spacing;
+        int i = std::max(0, std::min((int)u, (int)std::round(2 * hlen / spacing) - 1));
+        int j = std::max(0, std::min((int)v, (int)std::round(2 * hwid / spacing) - 1));
+        double fu = u - i;
+        double fv = v - j;
+        auto H = [&](int a, int b) { return height(-hlen + a * spacing, -hwid + b * spacing); };
+
+        // Each mesh cell is split along its diagonal into the faces (00, 10, 11) and (00, 11, 01)
+        double dhdu, dhdv;
+        if (fu >= fv) {
+            dhdu = H(i + 1, j) - H(i, j);
+            dhdv = H(i + 1, j + 1) - H(i + 1, j);
+        } else {
+            dhdu = H(i + 1, j + 1) - H(i, j + 1);
+            dhdv = H(i, j + 1) - H(i, j);
+        }
+        h = H(i, j) + fu * dhdu + fv * dhdv;
+        normal = ChVector3d(-dhdu / spacing, -dhdv / spacing, 1).GetNormalized();
+    }
+};
+
+// System with a rigid terrain consisting of a single mesh patch.
+class TerrainSystem {
+  public:
+    TerrainSystem(const std::string& mesh_file,
+                  const ChCoordsys<>& csys,
+                  bool use_grid,
+                  double resolution,
+                  double sweep_sphere_radius) {
+        m_sys.SetCollisionSystemType(ChCollisionSystem::Type::BULLET);
+        m_terrain = chrono_types::make_unique<RigidTerrain>(&m_sys);
+        m_terrain->UseMeshPatchGrid(use_grid, resolution);
+        auto mat = chrono_types::make_shared<ChContactMaterialNSC>();
+        auto patch = m_terrain->AddPatch(mat, csys, mesh_file, true, sweep_sphere_radius, false);
+
+        // Ray casting hits the mesh inflated by the collision envelope and only corrects the hit point along the
+        // normal, which shifts it horizontally on sloped faces. Use a negligible envelope to obtain the mesh surface.
+        patch->GetGroundBody()->GetCollisionModel()->SetEnvelope(1e-4f);
+
+        m_terrain->Initialize();
+
+        // process the collision models, so that ray casting can be used
+        m_sys.DoStepDynamics(1e-3);
+    }
+
+    const RigidTerrain& GetTerrain() const { return *m_terrain; }
+
+  private:
+    ChSystemNSC m_sys;
+    std::unique_ptr<RigidTerrain> m_terrain;
+};
+
+class RigidTerrainGridTest : public ::testing::Test {
+  protected:
+    RigidTerrainGridTest() {
+        const std::string out_dir = GetChronoOutputPath() + "UTEST_RIGID_TERRAIN_GRID";
+        filesystem::create_directory(filesystem::path(out_dir));
+        m_mesh_file = out_dir + "/terrain.obj";
+        WriteMesh(m_mesh_file, hlength, hwidth, spacing, MeshHeight);
+        m_bump_file = out_dir + "/terrain_bump.obj";
+        WriteMesh(m_bump_file, 1, 1, 0.02, BumpHeight);
+    }
+
+    // Query both terrains at the given location (expressed in the patch frame), starting above the surface.
+    // The ray cast reference is used to check hits and misses only: Bullet's convex ray cast stops once within 1e-2
+    // of the surface (the default sub-simplex cast epsilon is the squared distance 1e-4) and its normal can be off by
+    // several degrees. Grid results are therefore checked against the exact mesh surface, unless the grid deferred to
+    // ray casting.
+    void Check(const RigidTerrain& ref, const RigidTerrain& grid, const MeshSurface& surf, double x, double y) {
+        auto loc = m_csys.TransformPointLocalToParent(ChVector3d(x, y, 2));
+
+        double height_ref = ref.GetHeight(loc);
+        double height_grid = grid.GetHeight(loc);
+
+        // a miss is reported with zero height (the terrain surface is above z = 0.2 everywhere)
+        bool hit_ref = height_ref != 0;
+        bool hit_grid = height_grid != 0;
+        ASSERT_EQ(hit_ref, hit_grid) << "at (" << x << ", " << y << ")";
+        if (!hit_ref) {
+            num_miss++;
+            return;
+        }
+        num_hit++;
+
+        auto normal_ref = ref.GetNormal(loc);
+        auto normal_grid = grid.GetNormal(loc);
+        if (height_grid == height_ref && normal_grid == normal_ref) {
+            num_fallback++;
+            return;
+        }
+
+        double height;
+        ChVector3d normal;
+        surf.Evaluate(x, y, height, normal);
+        height += m_csys.pos.z();
+        normal = m_csys.TransformDirectionLocalToParent(normal);
+
+        ASSERT_NEAR(height_grid, height, 5e-3) << "at (" << x << ", " << y << ")";
+        ASSERT_GT(Vdot(normal_grid, normal), std::cos(5.0 * CH_DEG_TO_RAD)) << "at (" << x << ", " << y << ")";
+    }
+
+    std::string m_mesh_file;
+    std::string m_bump_file;
+    ChCoordsys<> m_csys = patch_csys;
+    int num_hit = 0;
+    int num_miss = 0;
+    int num_fallback = 0;
+};
+
+TEST_F(RigidTerrainGridTest, ray_hit) {
+    TerrainSystem ref(m_mesh_file, patch_csys, false, 0.05, 0);
+    TerrainSystem grid(m_mesh_file, patch_csys, true, 0.05, 0);
+    MeshSurface surf{hlength, hwidth, spacing, MeshHeight};
+
+    // Dense sampling over (and beyond) the patch, including the step
+    for (double x = -hlength - 1; x <= hlength + 1; x += 0.037) {
+        for (double y = -hwidth - 1; y <= hwidth + 1; y += 0.043) {
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, x, y);
+            if (HasFatalFailure())
+                return;
+        }
+    }
+    ASSERT_GT(num_hit, 0);
+    ASSERT_GT(num_miss, 0);
+    ASSERT_LT(num_fallback, num_hit / 4);
+
+    // Just inside and just outside the patch boundaries
+    for (double d : {-1e-3, 1e-3}) {
+        for (double s = -0.99; s <= 0.99; s += 0.01) {
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, hlength + d, s * hwidth);
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, -hlength - d, s * hwidth);
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, s * hlength, hwidth + d);
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, s * hlength, -hwidth - d);
+            if (HasFatalFailure())
+                return;
+        }
+    }
+}
+
+TEST_F(RigidTerrainGridTest, sub_cell_feature) {
+    // Grid cells (0.4) much larger than the mesh spacing (0.02). The grid starts at the mesh corner, so that the bump
+    // lies at the center of a grid cell whose corners are on the flat part of the surface; the cell must not be
+    // interpolated.
+    m_csys = ChCoordsys<>(ChVector3d(0.25, 0.25, 0.2), QUNIT);
+    TerrainSystem ref(m_bump_file, m_csys, false, 0.4, 0);
+    TerrainSystem grid(m_bump_file, m_csys, true, 0.4, 0);
+    MeshSurface surf{1, 1, 0.02, BumpHeight};
+
+    for (double x = -0.95; x <= 0.95; x += 0.0123) {
+        for (double y = -0.95; y <= 0.95; y += 0.0117) {
+            Check(ref.GetTerrain(), grid.GetTerrain(), surf, x, y);
+            if (HasFatalFailure())
+                return;
+        }
+    }
+    ASSERT_GT(num_hit, 0);
+}
+
+TEST_F(RigidTerrainGridTest, sweep_sphere) {
+    // No grid is used for a patch with a sweep sphere: results must be identical to ray casting
+    TerrainSystem ref(m_mesh_file, patch_csys, false, 0.05, 0.01);
+    TerrainSystem grid(m_mesh_file, patch_csys, true, 0.05, 0.01);
+
+    for (double x = -hlength - 0.5; x <= hlength + 0.5; x += 0.13) {
+        for (double y = -hwidth - 0.5; y <= hwidth + 0.5; y += 0.17) {
+            auto loc = patch_csys.TransformPointLocalToParent(ChVector3d(x, y, 2));
+            ASSERT_EQ(ref.GetTerrain().GetHeight(loc), grid.GetTerrain().GetHeight(loc));
+            ASSERT_EQ(ref.GetTerrain().GetNormal(loc), grid.GetTerrain().GetNormal(loc));
+        }
+    }
+}